@@ -12,6 +12,10 @@
 
 //#define DSM_DEBUG
 //#define DSM_NVM_FACTORY_RESET
+//#define DSM_NVM_JOURNAL
+// Data EEPROM word programming on STM32L0 boards.
+// Warning: requires the NVM_read_word() and NVM_write_word() functions of the STM32L0 drivers submodule.
+//#define DSM_NVM_WORD_WRITE
 
 /*** Board options ***/
 
@@ -67,6 +71,14 @@
 #ifdef GPSM
 #define GPSM_ACTIVE_ANTENNA
 //#define GPSM_BKEN_FORCED_HARDWARE
+// UBX binary protocol instead of NMEA sentences.
+//#define GPSM_UBX_PROTOCOL
+// GPS UART reception by circular DMA.
+// Warning: requires the USART character match and idle line interrupts, the RDR address getter and the USART2 RX DMA request of the STM32L0 drivers submodule.
+//#define GPSM_UART_DMA
+// Acquisition diagnostic registers.
+// Warning: requires the DIAGNOSTIC_0/1/2 registers of the dinfox-registers submodule.
+//#define GPSM_ACQUISITION_DIAGNOSTICS_ENABLE
 #ifdef DSM_NVM_FACTORY_RESET
 #define GPSM_TIME_TIMEOUT_SECONDS           120
 #define GPSM_GEOLOC_TIMEOUT_SECONDS         180
@@ -96,6 +108,21 @@
 #ifdef MPMCM
 // Measurements selection.
 #define MPMCM_ANALOG_MEASURE_ENABLE
+// Analog acquisition mode.
+#define MPMCM_ANALOG_CIRCULAR_DMA
+// Period computation kernel.
+//#define MPMCM_ANALOG_FIXED_POINT_KERNEL
+// Period computation cycles measurement (DWT cycle counter).
+//#define MPMCM_ANALOG_CYCLE_COUNT
+// Harmonics analysis.
+// Warning: requires the THD and harmonics registers of the dinfox-registers submodule.
+//#define MPMCM_ANALOG_HARMONICS_ENABLE
+// Reactive power, phase angle and reactive energy.
+// Warning: requires the reactive power, phase angle and reactive energy registers of the dinfox-registers submodule.
+//#define MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+// Raw waveform capture.
+// Warning: requires the capture registers of the dinfox-registers submodule.
+//#define MPMCM_ANALOG_CAPTURE_ENABLE
 //#define MPMCM_LINKY_TIC_ENABLE
 // Linky TIC mode.
 #define MPMCM_LINKY_TIC_MODE_HISTORIC
@@ -103,6 +130,9 @@
 // Transformer selection.
 //#define MPMCM_TRANSFORMER_BLOCK_VC_10_2_6
 #define MPMCM_TRANSFORMER_BLOCK_VB_2_1_6
+// RS485 interface mode.
+// Warning: requires the DMA channels mapping, the LPUART character match interrupt and the LPUART_wait_tx_complete() function of the STM32G4 drivers submodule.
+//#define MPMCM_RS485_DMA
 // Transformer settings.
 #ifdef MPMCM_TRANSFORMER_BLOCK_VC_10_2_6
 #define MPMCM_TRANSFORMER_ATTEN             11 // Unit V/V.
@@ -12,11 +12,13 @@
 #ifndef MPMCM
 #include "aes.h"
 #endif
+#include "crc.h"
 #include "iwdg.h"
 #include "lptim.h"
 #include "nvm.h"
 #include "rcc.h"
 #include "rtc.h"
+#include "systick.h"
 #include "tim.h"
 // MAC.
 #include "lmac.h"
@@ -82,8 +84,11 @@ typedef enum {
     // Sigfox.
     ERROR_BASE_SIGFOX_EP_LIB = (ERROR_BASE_RFE + RFE_ERROR_BASE_LAST),
     ERROR_BASE_SIGFOX_EP_ADDON_RFP = (ERROR_BASE_SIGFOX_EP_LIB + (SIGFOX_ERROR_SOURCE_LAST * ERROR_BASE_STEP)),
+    // Peripherals added afterwards.
+    ERROR_BASE_CRC = (ERROR_BASE_SIGFOX_EP_ADDON_RFP + ERROR_BASE_STEP),
+    ERROR_BASE_SYSTICK = (ERROR_BASE_CRC + CRC_ERROR_BASE_LAST),
     // Last base value.
-    ERROR_BASE_LAST = (ERROR_BASE_SIGFOX_EP_ADDON_RFP + ERROR_BASE_STEP)
+    ERROR_BASE_LAST = (ERROR_BASE_SYSTICK + SYSTICK_ERROR_BASE_LAST)
 } ERROR_base_t;
 
 #endif /* __ERROR_BASE_H__ */
@@ -13,5 +13,8 @@
 #ifdef MPMCM
 #define AES_ERROR_BASE_LAST  ERROR_BASE_STEP
 #endif
+#ifndef UHFM
+#define CRC_ERROR_BASE_LAST  ERROR_BASE_STEP
+#endif
 
 #endif /* __ERROR_PATCH_H__ */
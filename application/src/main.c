@@ -26,6 +26,9 @@
 #include "cli.h"
 #include "node.h"
 #include "power.h"
+#ifndef UNA_AT_DISABLE_FLAGS_FILE
+#include "una_at_flags.h"
+#endif
 // Applicative.
 #include "dsm_flags.h"
 #include "error_base.h"
@@ -49,10 +52,13 @@ static DSM_context_t dsm_ctx = {
 
 /*** MAIN local functions ***/
 
-#ifdef MPMCM
+#if ((defined MPMCM) || (defined UNA_AT_CUSTOM_COMMANDS))
 /*******************************************************************/
 static void _DSM_rtc_wakeup_timer_irq_callback(void) {
+#ifdef MPMCM
     dsm_ctx.rtc_wakeup_timer_flag = 1;
+#endif
+    // Note: on other boards, the periodic wake-up is only used to run the RS485 baud rate fallback check of the main loop.
 }
 #endif
 
@@ -100,7 +106,7 @@ static void _DSM_init_hw(void) {
     RCC_stack_error(ERROR_BASE_RCC);
 #endif
     // Init RTC.
-#ifdef MPMCM
+#if ((defined MPMCM) || (defined UNA_AT_CUSTOM_COMMANDS))
     rtc_status = RTC_init(&_DSM_rtc_wakeup_timer_irq_callback, NVIC_PRIORITY_RTC);
 #else
     rtc_status = RTC_init(NULL, NVIC_PRIORITY_RTC);
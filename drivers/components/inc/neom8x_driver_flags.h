@@ -8,6 +8,10 @@
 #ifndef __NEOM8X_DRIVER_FLAGS_H__
 #define __NEOM8X_DRIVER_FLAGS_H__
 
+#ifdef GPSM_UART_DMA
+#include "dma.h"
+#endif
+#include "dsm_flags.h"
 #include "lptim.h"
 #include "usart.h"
 
@@ -18,7 +22,11 @@
 #endif
 
 #define NEOM8X_DRIVER_GPIO_ERROR_BASE_LAST              0
+#ifdef GPSM_UART_DMA
+#define NEOM8X_DRIVER_UART_ERROR_BASE_LAST              (USART_ERROR_BASE_LAST + DMA_ERROR_BASE_LAST)
+#else
 #define NEOM8X_DRIVER_UART_ERROR_BASE_LAST              USART_ERROR_BASE_LAST
+#endif
 #define NEOM8X_DRIVER_DELAY_ERROR_BASE_LAST             LPTIM_ERROR_BASE_LAST
 
 #define NEOM8X_DRIVER_GPS_DATA_TIME
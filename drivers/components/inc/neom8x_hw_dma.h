@@ -0,0 +1,26 @@
+/*
+ * neom8x_hw_dma.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_HW_DMA_H__
+#define __NEOM8X_HW_DMA_H__
+
+#include "types.h"
+
+/*** NEOM8X HW DMA functions ***/
+
+/*!******************************************************************
+ * \fn void NEOM8X_HW_flush_rx_buffer(void)
+ * \brief Transmit the bytes received by DMA since the last call to the NMEA driver or UBX parser.
+ * \brief This function has to be called from the main context after each MCU wake-up while reception is enabled.
+ * \brief In case of overrun, the unread bytes are dropped and the rx_overrun_count statistic is incremented.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_HW_flush_rx_buffer(void);
+
+#endif /* __NEOM8X_HW_DMA_H__ */
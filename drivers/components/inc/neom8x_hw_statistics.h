@@ -0,0 +1,45 @@
+/*
+ * neom8x_hw_statistics.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_HW_STATISTICS_H__
+#define __NEOM8X_HW_STATISTICS_H__
+
+#include "types.h"
+
+/*** NEOM8X HW statistics structures ***/
+
+/*!******************************************************************
+ * \struct NEOM8X_HW_statistics_t
+ * \brief GPS UART reception statistics.
+ *******************************************************************/
+typedef struct {
+    uint32_t rx_byte_count;
+    uint32_t rx_irq_count;
+    uint32_t rx_overrun_count;
+} NEOM8X_HW_statistics_t;
+
+/*** NEOM8X HW statistics functions ***/
+
+/*!******************************************************************
+ * \fn void NEOM8X_HW_get_statistics(NEOM8X_HW_statistics_t* statistics)
+ * \brief Get GPS UART reception statistics.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the reception statistics.
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_HW_get_statistics(NEOM8X_HW_statistics_t* statistics);
+
+/*!******************************************************************
+ * \fn void NEOM8X_HW_reset_statistics(void)
+ * \brief Reset GPS UART reception statistics.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_HW_reset_statistics(void);
+
+#endif /* __NEOM8X_HW_STATISTICS_H__ */
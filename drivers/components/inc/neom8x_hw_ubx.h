@@ -0,0 +1,33 @@
+/*
+ * neom8x_hw_ubx.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_HW_UBX_H__
+#define __NEOM8X_HW_UBX_H__
+
+#include "neom8x.h"
+#include "types.h"
+
+/*** NEOM8X HW UBX structures ***/
+
+/*!******************************************************************
+ * \fn NEOM8X_HW_ubx_rx_irq_cb_t
+ * \brief UBX byte reception callback (called under interrupt, or from the main context when the UART DMA is enabled).
+ *******************************************************************/
+typedef void (*NEOM8X_HW_ubx_rx_irq_cb_t)(uint8_t data);
+
+/*** NEOM8X HW UBX functions ***/
+
+/*!******************************************************************
+ * \fn void NEOM8X_HW_set_ubx_rx_irq_callback(NEOM8X_HW_ubx_rx_irq_cb_t ubx_rx_irq_callback)
+ * \brief Redirect the GPS UART received bytes to the UBX parser instead of the NMEA driver.
+ * \param[in]   ubx_rx_irq_callback: Function to call on byte reception, NULL to restore the NMEA driver callback.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_HW_set_ubx_rx_irq_callback(NEOM8X_HW_ubx_rx_irq_cb_t ubx_rx_irq_callback);
+
+#endif /* __NEOM8X_HW_UBX_H__ */
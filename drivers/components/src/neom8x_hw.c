@@ -13,13 +13,101 @@
 
 #ifndef NEOM8X_DRIVER_DISABLE
 
+#ifdef GPSM_UART_DMA
+#include "dma.h"
+#endif
+#include "dsm_flags.h"
 #include "error.h"
 #include "error_base.h"
 #include "lptim.h"
 #include "mcu_mapping.h"
+#ifdef GPSM_UART_DMA
+#include "neom8x_hw_dma.h"
+#endif
+#include "neom8x_hw_statistics.h"
+#ifdef GPSM_UBX_PROTOCOL
+#include "neom8x_hw_ubx.h"
+#endif
 #include "nvic_priority.h"
+#include "types.h"
 #include "usart.h"
 
+/*** NEOM8X HW local macros ***/
+
+#ifdef GPSM_UART_DMA
+#define NEOM8X_HW_ERROR_BASE_DMA        (NEOM8X_ERROR_BASE_UART + USART_ERROR_BASE_LAST)
+#define NEOM8X_HW_RX_BUFFER_SIZE        256
+#define NEOM8X_HW_NMEA_END_CHAR         '\n'
+#endif
+
+/*** NEOM8X HW local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    USART_rx_irq_cb_t rx_irq_callback;
+#ifdef GPSM_UBX_PROTOCOL
+    volatile NEOM8X_HW_ubx_rx_irq_cb_t ubx_rx_irq_callback;
+#endif
+#ifdef GPSM_UART_DMA
+    uint8_t rx_buffer[NEOM8X_HW_RX_BUFFER_SIZE];
+    volatile uint32_t rx_lap_count;
+    uint32_t rx_read_count;
+#endif
+    volatile NEOM8X_HW_statistics_t statistics;
+} NEOM8X_HW_context_t;
+
+/*** NEOM8X HW local global variables ***/
+
+static NEOM8X_HW_context_t neom8x_hw_ctx;
+
+/*** NEOM8X HW local functions ***/
+
+/*******************************************************************/
+static void _NEOM8X_HW_transmit_byte(uint8_t data) {
+    // Update statistics.
+    neom8x_hw_ctx.statistics.rx_byte_count++;
+#ifdef GPSM_UBX_PROTOCOL
+    // Transmit byte to the UBX parser if enabled.
+    if (neom8x_hw_ctx.ubx_rx_irq_callback != NULL) {
+        neom8x_hw_ctx.ubx_rx_irq_callback(data);
+        return;
+    }
+#endif
+    // Transmit byte to the NMEA driver.
+    if (neom8x_hw_ctx.rx_irq_callback != NULL) {
+        neom8x_hw_ctx.rx_irq_callback(data);
+    }
+}
+
+#ifdef GPSM_UART_DMA
+/*******************************************************************/
+static void _NEOM8X_HW_rx_event_irq_callback(void) {
+    // Update statistics.
+    // Note: bytes are extracted from the circular buffer in the main context, the interrupt is only used to wake-up the MCU.
+    neom8x_hw_ctx.statistics.rx_irq_count++;
+}
+#endif
+
+#ifdef GPSM_UART_DMA
+/*******************************************************************/
+static void _NEOM8X_HW_dma_tc_irq_callback(void) {
+    // Update buffer laps count.
+    neom8x_hw_ctx.rx_lap_count++;
+    // Update statistics.
+    neom8x_hw_ctx.statistics.rx_irq_count++;
+}
+#endif
+
+#ifndef GPSM_UART_DMA
+/*******************************************************************/
+static void _NEOM8X_HW_usart_rxne_irq_callback(uint8_t data) {
+    // Update statistics.
+    neom8x_hw_ctx.statistics.rx_irq_count++;
+    // Transmit byte to the upper layer.
+    _NEOM8X_HW_transmit_byte(data);
+}
+#endif
+
 /*** NEOM8X HW functions ***/
 
 /*******************************************************************/
@@ -28,15 +116,59 @@ NEOM8X_status_t NEOM8X_HW_init(NEOM8X_HW_configuration_t* configuration) {
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
     USART_configuration_t usart_config;
+#ifdef GPSM_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+    DMA_configuration_t dma_config;
+    uint16_t idx = 0;
+#endif
+    // Init context.
+    neom8x_hw_ctx.rx_irq_callback = (USART_rx_irq_cb_t) (configuration->rx_irq_callback);
+#ifdef GPSM_UBX_PROTOCOL
+    neom8x_hw_ctx.ubx_rx_irq_callback = NULL;
+#endif
+#ifdef GPSM_UART_DMA
+    for (idx = 0; idx < NEOM8X_HW_RX_BUFFER_SIZE; idx++) {
+        neom8x_hw_ctx.rx_buffer[idx] = 0;
+    }
+    neom8x_hw_ctx.rx_lap_count = 0;
+    neom8x_hw_ctx.rx_read_count = 0;
+#endif
+    NEOM8X_HW_reset_statistics();
     // Init backup pin.
     GPIO_configure(&GPIO_GPS_VBCKP, GPIO_MODE_OUTPUT, GPIO_TYPE_PUSH_PULL, GPIO_SPEED_LOW, GPIO_PULL_NONE);
     // Init USART.
     usart_config.clock = RCC_CLOCK_HSI;
     usart_config.baud_rate = (configuration->uart_baud_rate);
     usart_config.nvic_priority = NVIC_PRIORITY_GPS_UART;
-    usart_config.rxne_irq_callback = (USART_rx_irq_cb_t) (configuration->rx_irq_callback);
+#ifdef GPSM_UART_DMA
+    // Wake-up on NMEA sentence end and on idle line (end of UBX frames burst).
+    usart_config.rxne_irq_callback = NULL;
+    usart_config.cm_irq_callback = &_NEOM8X_HW_rx_event_irq_callback;
+    usart_config.match_character = NEOM8X_HW_NMEA_END_CHAR;
+    usart_config.idle_irq_callback = &_NEOM8X_HW_rx_event_irq_callback;
+#else
+    usart_config.rxne_irq_callback = &_NEOM8X_HW_usart_rxne_irq_callback;
+#endif
     usart_status = USART_init(USART_INSTANCE_GPS, &USART_GPIO_GPS, &usart_config);
     USART_exit_error(NEOM8X_ERROR_BASE_UART);
+#ifdef GPSM_UART_DMA
+    // Init RX DMA in circular mode.
+    dma_config.direction = DMA_DIRECTION_PERIPHERAL_TO_MEMORY;
+    dma_config.flags.all = 0;
+    dma_config.flags.memory_increment = 1;
+    dma_config.flags.circular_mode = 1;
+    dma_config.memory_address = (uint32_t) &(neom8x_hw_ctx.rx_buffer);
+    dma_config.memory_data_size = DMA_DATA_SIZE_8_BITS;
+    dma_config.peripheral_address = USART_get_rdr_register_address(USART_INSTANCE_GPS);
+    dma_config.peripheral_data_size = DMA_DATA_SIZE_8_BITS;
+    dma_config.number_of_data = NEOM8X_HW_RX_BUFFER_SIZE;
+    dma_config.priority = DMA_PRIORITY_HIGH;
+    dma_config.request_id = DMA_REQUEST_ID_USART2_RX;
+    dma_config.tc_irq_callback = &_NEOM8X_HW_dma_tc_irq_callback;
+    dma_config.nvic_priority = NVIC_PRIORITY_DMA_GPS_UART;
+    dma_status = DMA_init(DMA_INSTANCE_GPS_RX, DMA_CHANNEL_GPS_RX, &dma_config);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+#endif
 errors:
     return status;
 }
@@ -46,9 +178,17 @@ NEOM8X_status_t NEOM8X_HW_de_init(void) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
+#ifdef GPSM_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+#endif
     // Release USART.
     usart_status = USART_de_init(USART_INSTANCE_GPS, &USART_GPIO_GPS);
     USART_stack_error(ERROR_BASE_NEOM8N + NEOM8X_ERROR_BASE_UART);
+#ifdef GPSM_UART_DMA
+    // Release DMA channel.
+    dma_status = DMA_de_init(DMA_INSTANCE_GPS_RX, DMA_CHANNEL_GPS_RX);
+    DMA_stack_error(ERROR_BASE_NEOM8N + NEOM8X_HW_ERROR_BASE_DMA);
+#endif
     return status;
 }
 
@@ -69,6 +209,18 @@ NEOM8X_status_t NEOM8X_HW_start_rx(void) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
+#ifdef GPSM_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+    // Restart RX DMA from the beginning of the buffer.
+    dma_status = DMA_stop(DMA_INSTANCE_GPS_RX, DMA_CHANNEL_GPS_RX);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+    dma_status = DMA_set_memory_address(DMA_INSTANCE_GPS_RX, DMA_CHANNEL_GPS_RX, (uint32_t) &(neom8x_hw_ctx.rx_buffer), NEOM8X_HW_RX_BUFFER_SIZE);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+    neom8x_hw_ctx.rx_lap_count = 0;
+    neom8x_hw_ctx.rx_read_count = 0;
+    dma_status = DMA_start(DMA_INSTANCE_GPS_RX, DMA_CHANNEL_GPS_RX);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+#endif
     // Start USART.
     usart_status = USART_enable_rx(USART_INSTANCE_GPS);
     USART_exit_error(NEOM8X_ERROR_BASE_UART);
@@ -81,9 +233,18 @@ NEOM8X_status_t NEOM8X_HW_stop_rx(void) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
+#ifdef GPSM_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+#endif
     // Stop USART.
     usart_status = USART_disable_rx(USART_INSTANCE_GPS);
     USART_exit_error(NEOM8X_ERROR_BASE_UART);
+#ifdef GPSM_UART_DMA
+    // Stop RX DMA.
+    // Note: remaining bytes are not transmitted since the upper layer has stopped the acquisition.
+    dma_status = DMA_stop(DMA_INSTANCE_GPS_RX, DMA_CHANNEL_GPS_RX);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+#endif
 errors:
     return status;
 }
@@ -100,6 +261,63 @@ errors:
     return status;
 }
 
+#ifdef GPSM_UART_DMA
+/*******************************************************************/
+void NEOM8X_HW_flush_rx_buffer(void) {
+    // Local variables.
+    uint16_t rx_write_idx = 0;
+    uint32_t rx_lap_count = 0;
+    uint32_t rx_write_count = 0;
+    int32_t rx_pending_count = 0;
+    uint8_t rx_byte = 0;
+    // Get current DMA position.
+    // Note: the position is read again if the buffer rolled over in the meantime.
+    do {
+        rx_lap_count = neom8x_hw_ctx.rx_lap_count;
+        DMA_get_number_of_transfered_data(DMA_INSTANCE_GPS_RX, DMA_CHANNEL_GPS_RX, &rx_write_idx);
+    }
+    while (rx_lap_count != neom8x_hw_ctx.rx_lap_count);
+    rx_write_count = (rx_lap_count * NEOM8X_HW_RX_BUFFER_SIZE) + (rx_write_idx % NEOM8X_HW_RX_BUFFER_SIZE);
+    rx_pending_count = (int32_t) (rx_write_count - neom8x_hw_ctx.rx_read_count);
+    // Check overrun.
+    if (rx_pending_count > NEOM8X_HW_RX_BUFFER_SIZE) {
+        // Unread bytes have been overwritten by the DMA: drop the whole buffer, the upper layer will synchronize on the next frame.
+        neom8x_hw_ctx.statistics.rx_overrun_count++;
+        neom8x_hw_ctx.rx_read_count = rx_write_count;
+    }
+    // Transmit all new bytes to the upper layer.
+    while (((int32_t) (rx_write_count - neom8x_hw_ctx.rx_read_count)) > 0) {
+        rx_byte = neom8x_hw_ctx.rx_buffer[neom8x_hw_ctx.rx_read_count % NEOM8X_HW_RX_BUFFER_SIZE];
+        neom8x_hw_ctx.rx_read_count++;
+        _NEOM8X_HW_transmit_byte(rx_byte);
+    }
+}
+#endif
+
+/*******************************************************************/
+void NEOM8X_HW_get_statistics(NEOM8X_HW_statistics_t* statistics) {
+    // Check parameter.
+    if (statistics == NULL) return;
+    // Copy statistics.
+    (*statistics) = neom8x_hw_ctx.statistics;
+}
+
+/*******************************************************************/
+void NEOM8X_HW_reset_statistics(void) {
+    // Reset counters.
+    neom8x_hw_ctx.statistics.rx_byte_count = 0;
+    neom8x_hw_ctx.statistics.rx_irq_count = 0;
+    neom8x_hw_ctx.statistics.rx_overrun_count = 0;
+}
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+void NEOM8X_HW_set_ubx_rx_irq_callback(NEOM8X_HW_ubx_rx_irq_cb_t ubx_rx_irq_callback) {
+    // Update callback.
+    neom8x_hw_ctx.ubx_rx_irq_callback = ubx_rx_irq_callback;
+}
+#endif
+
 #ifdef NEOM8X_DRIVER_VBCKP_CONTROL
 /*******************************************************************/
 NEOM8X_status_t NEOM8X_HW_set_backup_voltage(uint8_t state) {
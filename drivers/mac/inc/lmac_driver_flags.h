@@ -8,12 +8,21 @@
 #ifndef __LMAC_DRIVER_FLAGS_H__
 #define __LMAC_DRIVER_FLAGS_H__
 
+#include "dsm_flags.h"
+#ifdef MPMCM_RS485_DMA
+#include "dma.h"
+#endif
 #include "lpuart.h"
 #include "nvm.h"
 
 /*** LMAC driver compilation flags ***/
 
-#define LMAC_DRIVER_HW_INTERFACE_ERROR_BASE_LAST    LPUART_ERROR_BASE_LAST
+// Note: last step is used for the interface errors (binary frame size and TX DMA timeout).
+#ifdef MPMCM_RS485_DMA
+#define LMAC_DRIVER_HW_INTERFACE_ERROR_BASE_LAST    (LPUART_ERROR_BASE_LAST + DMA_ERROR_BASE_LAST + ERROR_BASE_STEP)
+#else
+#define LMAC_DRIVER_HW_INTERFACE_ERROR_BASE_LAST    (LPUART_ERROR_BASE_LAST + ERROR_BASE_STEP)
+#endif
 #define LMAC_DRIVER_NVM_ERROR_BASE_LAST             NVM_ERROR_BASE_LAST
 
 //#define LMAC_DRIVER_MODE_MASTER
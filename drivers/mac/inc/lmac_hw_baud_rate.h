@@ -0,0 +1,44 @@
+/*
+ * lmac_hw_baud_rate.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LMAC_HW_BAUD_RATE_H__
+#define __LMAC_HW_BAUD_RATE_H__
+
+#include "lmac.h"
+#include "types.h"
+
+/*** LMAC HW baud rate functions ***/
+
+/*!******************************************************************
+ * \fn LMAC_status_t LMAC_HW_set_baud_rate(uint32_t baud_rate)
+ * \brief Change RS485 interface baud rate.
+ * \param[in]   baud_rate: New baud rate.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+LMAC_status_t LMAC_HW_set_baud_rate(uint32_t baud_rate);
+
+/*!******************************************************************
+ * \fn LMAC_status_t LMAC_HW_update_clock(void)
+ * \brief Recompute RS485 interface baud rate register after a system clock switch.
+ * \brief The interface is not re-initialized when it runs at the default baud rate.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+LMAC_status_t LMAC_HW_update_clock(void);
+
+/*!******************************************************************
+ * \fn LMAC_status_t LMAC_HW_check_baud_rate_fallback(void)
+ * \brief Switch back to the default baud rate if the node has not been addressed during the fallback timeout.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+LMAC_status_t LMAC_HW_check_baud_rate_fallback(void);
+
+#endif /* __LMAC_HW_BAUD_RATE_H__ */
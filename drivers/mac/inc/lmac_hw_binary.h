@@ -0,0 +1,59 @@
+/*
+ * lmac_hw_binary.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LMAC_HW_BINARY_H__
+#define __LMAC_HW_BINARY_H__
+
+#include "lmac.h"
+#include "types.h"
+
+/*** LMAC HW binary macros ***/
+
+// Maximum payload size of a binary frame (CRC excluded).
+#define LMAC_HW_BINARY_DATA_SIZE_MAX    60
+
+/*** LMAC HW binary structures ***/
+
+/*!******************************************************************
+ * \fn LMAC_HW_binary_rx_cb_t
+ * \brief Binary frame reception interrupt callback.
+ *******************************************************************/
+typedef void (*LMAC_HW_binary_rx_cb_t)(void);
+
+/*** LMAC HW binary functions ***/
+
+/*!******************************************************************
+ * \fn void LMAC_HW_set_binary_rx_callback(LMAC_HW_binary_rx_cb_t binary_rx_callback)
+ * \brief Register the callback called when a binary frame has been received.
+ * \brief Binary frames are never transmitted to the MAC layer: they are dropped if no callback is registered.
+ * \param[in]   binary_rx_callback: Function to call on binary frame reception.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LMAC_HW_set_binary_rx_callback(LMAC_HW_binary_rx_cb_t binary_rx_callback);
+
+/*!******************************************************************
+ * \fn LMAC_status_t LMAC_HW_read_binary_frame(uint8_t* data, uint8_t* data_size_bytes)
+ * \brief Decode the last received binary frame and check its CRC.
+ * \param[in]   none
+ * \param[out]  data: Pointer to the frame payload (LMAC_HW_BINARY_DATA_SIZE_MAX bytes).
+ * \param[out]  data_size_bytes: Pointer to the payload size, 0 if there is no frame or if the CRC is invalid.
+ * \retval      Function execution status.
+ *******************************************************************/
+LMAC_status_t LMAC_HW_read_binary_frame(uint8_t* data, uint8_t* data_size_bytes);
+
+/*!******************************************************************
+ * \fn LMAC_status_t LMAC_HW_write_binary_frame(uint8_t* data, uint8_t data_size_bytes)
+ * \brief Send a binary frame to the source of the last received binary frame.
+ * \param[in]   data: Pointer to the frame payload.
+ * \param[in]   data_size_bytes: Payload size (LMAC_HW_BINARY_DATA_SIZE_MAX bytes maximum).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+LMAC_status_t LMAC_HW_write_binary_frame(uint8_t* data, uint8_t data_size_bytes);
+
+#endif /* __LMAC_HW_BINARY_H__ */
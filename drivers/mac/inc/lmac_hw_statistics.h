@@ -0,0 +1,44 @@
+/*
+ * lmac_hw_statistics.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LMAC_HW_STATISTICS_H__
+#define __LMAC_HW_STATISTICS_H__
+
+#include "types.h"
+
+/*** LMAC HW statistics structures ***/
+
+/*!******************************************************************
+ * \struct LMAC_HW_statistics_t
+ * \brief RS485 interface interrupts statistics.
+ *******************************************************************/
+typedef struct {
+    uint32_t rx_frame_count;
+    uint32_t rx_byte_count;
+    uint32_t rx_irq_count;
+    uint32_t rx_overrun_count;
+    uint32_t tx_frame_count;
+    uint32_t tx_byte_count;
+    uint32_t tx_irq_count;
+    uint32_t tx_sleep_count;
+    uint32_t tx_timeout_count;
+    uint32_t rx_binary_frame_count;
+    uint32_t rx_binary_error_count;
+} LMAC_HW_statistics_t;
+
+/*** LMAC HW statistics functions ***/
+
+/*!******************************************************************
+ * \fn void LMAC_HW_get_statistics(LMAC_HW_statistics_t* statistics)
+ * \brief Get RS485 interface interrupts statistics.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the interface statistics.
+ * \retval      none
+ *******************************************************************/
+void LMAC_HW_get_statistics(LMAC_HW_statistics_t* statistics);
+
+#endif /* __LMAC_HW_STATISTICS_H__ */
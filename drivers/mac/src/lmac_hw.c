@@ -10,19 +10,356 @@
 #ifndef LMAC_DRIVER_DISABLE_FLAGS_FILE
 #include "lmac_driver_flags.h"
 #endif
+#ifdef MPMCM_RS485_DMA
+#include "dma.h"
+#endif
+#include "dsm_flags.h"
 #include "error.h"
 #include "error_base.h"
 #include "lmac.h"
+#include "lmac_hw_baud_rate.h"
+#include "lmac_hw_binary.h"
+#include "lmac_hw_statistics.h"
 #include "lpuart.h"
 #include "mcu_mapping.h"
 #include "nvic_priority.h"
 #include "nvm.h"
 #include "nvm_address.h"
+#ifdef MPMCM_RS485_DMA
+#include "pwr.h"
+#endif
+#include "rtc.h"
 #include "types.h"
 #include "una.h"
+#ifndef UNA_AT_DISABLE_FLAGS_FILE
+#include "una_at_flags.h"
+#endif
 
 #ifndef LMAC_DRIVER_DISABLE
 
+/*** LMAC HW local macros ***/
+
+#define LMAC_HW_FRAME_END_CHAR          '\r'
+#define LMAC_HW_ADDRESS_MARKER          0x80
+// Note: the master has to address the node at least once during this period to keep a negotiated baud rate.
+#define LMAC_HW_BAUD_RATE_FALLBACK_TIMEOUT_SECONDS  60
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+// Binary frame: <destination | marker><source><binary marker><number of characters><characters><frame end>.
+// Note: payload and CRC are sent as 7-bit characters, so that the address mark is never set inside the frame.
+// The frame is delimited by its size, the frame end character is only used to trigger the DMA character match.
+#define LMAC_HW_BINARY_FRAME_MARKER     0x02
+#define LMAC_HW_BINARY_CRC_SIZE         2
+#define LMAC_HW_BINARY_CRC16_POLYNOMIAL 0x1021
+#define LMAC_HW_BINARY_CRC16_INIT_VALUE 0xFFFF
+#define LMAC_HW_BINARY_CHAR_BITS        7
+#define LMAC_HW_BINARY_CHAR_MASK        0x7F
+#define LMAC_HW_BINARY_SIZE_CHAR_MAX    ((((LMAC_HW_BINARY_DATA_SIZE_MAX + LMAC_HW_BINARY_CRC_SIZE) * 8) + LMAC_HW_BINARY_CHAR_BITS - 1) / LMAC_HW_BINARY_CHAR_BITS)
+#define LMAC_HW_BINARY_HEADER_SIZE      4
+#define LMAC_HW_BINARY_FRAME_SIZE_MAX   (LMAC_HW_BINARY_HEADER_SIZE + LMAC_HW_BINARY_SIZE_CHAR_MAX + 1)
+#endif
+
+#ifdef MPMCM_RS485_DMA
+#define LMAC_HW_ERROR_BASE_DMA          (LMAC_ERROR_BASE_HW_INTERFACE + LPUART_ERROR_BASE_LAST)
+#define LMAC_HW_ERROR_BASE_INTERFACE    (LMAC_HW_ERROR_BASE_DMA + DMA_ERROR_BASE_LAST)
+#define LMAC_HW_ERROR_TX_TIMEOUT        (LMAC_HW_ERROR_BASE_INTERFACE + 0)
+#else
+#define LMAC_HW_ERROR_BASE_INTERFACE    (LMAC_ERROR_BASE_HW_INTERFACE + LPUART_ERROR_BASE_LAST)
+#endif
+#ifdef UNA_AT_CUSTOM_COMMANDS
+#define LMAC_HW_ERROR_BINARY_DATA_SIZE  (LMAC_HW_ERROR_BASE_INTERFACE + 1)
+#endif
+
+#ifdef MPMCM_RS485_DMA
+#define LMAC_HW_RX_BUFFER_SIZE          LMAC_DRIVER_BUFFER_SIZE
+// Note: a full buffer takes 534ms at 1200 bauds, the RTC wake-up timer bounds the sleep duration.
+#define LMAC_HW_TX_TIMEOUT_SECONDS      2
+#endif
+
+/*** LMAC HW local structures ***/
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+typedef enum {
+    LMAC_HW_RX_STATE_IDLE = 0,
+    LMAC_HW_RX_STATE_SOURCE_ADDRESS,
+    LMAC_HW_RX_STATE_FRAME_TYPE,
+    LMAC_HW_RX_STATE_TEXT,
+    LMAC_HW_RX_STATE_BINARY_SIZE,
+    LMAC_HW_RX_STATE_BINARY_DATA,
+    LMAC_HW_RX_STATE_BINARY_END,
+    LMAC_HW_RX_STATE_LAST
+} LMAC_HW_rx_state_t;
+#endif
+
+/*******************************************************************/
+typedef struct {
+    LMAC_rx_irq_cb_t rx_irq_callback;
+    uint8_t self_address;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    LMAC_HW_binary_rx_cb_t binary_rx_callback;
+    LMAC_HW_rx_state_t rx_state;
+    uint8_t rx_destination_address;
+    uint8_t rx_source_address;
+    uint8_t rx_size_char;
+    uint8_t binary_rx_buffer[LMAC_HW_BINARY_SIZE_CHAR_MAX];
+    uint8_t binary_rx_size_char;
+    uint8_t binary_rx_idx;
+    uint8_t binary_source_address;
+    volatile uint8_t binary_rx_flag;
+#endif
+    uint32_t baud_rate;
+    uint32_t default_baud_rate;
+    volatile uint32_t rx_frame_time_seconds;
+#ifdef MPMCM_RS485_DMA
+    uint8_t rx_buffer[LMAC_HW_RX_BUFFER_SIZE];
+    volatile uint32_t rx_lap_count;
+    uint32_t rx_read_count;
+    volatile uint8_t tx_done_flag;
+#endif
+    volatile LMAC_HW_statistics_t statistics;
+} LMAC_HW_context_t;
+
+/*** LMAC HW local global variables ***/
+
+static LMAC_HW_context_t lmac_hw_ctx;
+
+/*** LMAC HW local functions ***/
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static uint16_t _LMAC_HW_compute_crc16(uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    uint16_t crc16 = LMAC_HW_BINARY_CRC16_INIT_VALUE;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // Byte loop.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        crc16 ^= (((uint16_t) data[idx]) << 8);
+        // Bit loop.
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc16 = ((crc16 & 0x8000) != 0) ? ((uint16_t) ((crc16 << 1) ^ LMAC_HW_BINARY_CRC16_POLYNOMIAL)) : ((uint16_t) (crc16 << 1));
+        }
+    }
+    return crc16;
+}
+#endif
+
+/*******************************************************************/
+static void _LMAC_HW_end_of_frame(void) {
+    // Update statistics.
+    lmac_hw_ctx.statistics.rx_frame_count++;
+    lmac_hw_ctx.rx_frame_time_seconds = RTC_get_uptime_seconds();
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_IDLE;
+#endif
+}
+
+/*******************************************************************/
+static void _LMAC_HW_transmit_byte(uint8_t data) {
+    // Transmit byte to the MAC layer.
+    if (lmac_hw_ctx.rx_irq_callback != NULL) {
+        lmac_hw_ctx.rx_irq_callback(data);
+    }
+    // Check end of text frame.
+    if (data == LMAC_HW_FRAME_END_CHAR) {
+        _LMAC_HW_end_of_frame();
+    }
+}
+
+/*******************************************************************/
+static void _LMAC_HW_receive_byte(uint8_t data) {
+    // Update statistics.
+    lmac_hw_ctx.statistics.rx_byte_count++;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    // Address mark always starts a new frame.
+    if ((data & LMAC_HW_ADDRESS_MARKER) != 0) {
+        lmac_hw_ctx.rx_destination_address = data;
+        lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_SOURCE_ADDRESS;
+        return;
+    }
+    // Perform state machine.
+    switch (lmac_hw_ctx.rx_state) {
+    case LMAC_HW_RX_STATE_SOURCE_ADDRESS:
+        lmac_hw_ctx.rx_source_address = data;
+        lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_FRAME_TYPE;
+        break;
+    case LMAC_HW_RX_STATE_FRAME_TYPE:
+        // Check binary marker.
+        if (data == LMAC_HW_BINARY_FRAME_MARKER) {
+            lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_BINARY_SIZE;
+            break;
+        }
+        // Text frame: transmit header to the MAC layer.
+        lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_TEXT;
+        _LMAC_HW_transmit_byte(lmac_hw_ctx.rx_destination_address);
+        _LMAC_HW_transmit_byte(lmac_hw_ctx.rx_source_address);
+        _LMAC_HW_transmit_byte(data);
+        break;
+    case LMAC_HW_RX_STATE_BINARY_SIZE:
+        // Check size.
+        if ((data == 0) || (data > LMAC_HW_BINARY_SIZE_CHAR_MAX)) {
+            lmac_hw_ctx.statistics.rx_binary_error_count++;
+            lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_IDLE;
+            break;
+        }
+        lmac_hw_ctx.rx_size_char = data;
+        lmac_hw_ctx.binary_rx_idx = 0;
+        lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_BINARY_DATA;
+        break;
+    case LMAC_HW_RX_STATE_BINARY_DATA:
+        // Note: the buffer is not written while the previous frame is still pending.
+        if (lmac_hw_ctx.binary_rx_flag == 0) {
+            lmac_hw_ctx.binary_rx_buffer[lmac_hw_ctx.binary_rx_idx] = data;
+        }
+        lmac_hw_ctx.binary_rx_idx++;
+        if (lmac_hw_ctx.binary_rx_idx >= lmac_hw_ctx.rx_size_char) {
+            lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_BINARY_END;
+        }
+        break;
+    case LMAC_HW_RX_STATE_BINARY_END:
+        // Check frame end and previous frame processing.
+        if ((data != LMAC_HW_FRAME_END_CHAR) || (lmac_hw_ctx.binary_rx_flag != 0) || (lmac_hw_ctx.binary_rx_callback == NULL)) {
+            lmac_hw_ctx.statistics.rx_binary_error_count++;
+            lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_IDLE;
+            break;
+        }
+        lmac_hw_ctx.binary_source_address = lmac_hw_ctx.rx_source_address;
+        lmac_hw_ctx.binary_rx_size_char = lmac_hw_ctx.rx_size_char;
+        lmac_hw_ctx.binary_rx_flag = 1;
+        lmac_hw_ctx.statistics.rx_binary_frame_count++;
+        _LMAC_HW_end_of_frame();
+        lmac_hw_ctx.binary_rx_callback();
+        break;
+    default:
+        // Text frame content or bytes received out of any frame.
+        _LMAC_HW_transmit_byte(data);
+        break;
+    }
+#else
+    // Transmit byte to the MAC layer.
+    _LMAC_HW_transmit_byte(data);
+#endif
+}
+
+#ifdef MPMCM_RS485_DMA
+/*******************************************************************/
+static void _LMAC_HW_flush_rx_buffer(void) {
+    // Local variables.
+    uint16_t rx_write_idx = 0;
+    uint32_t rx_lap_count = 0;
+    uint32_t rx_write_count = 0;
+    int32_t rx_pending_count = 0;
+    uint8_t rx_byte = 0;
+    // Get current DMA position.
+    // Note: the position is read again if the buffer rolled over in the meantime.
+    do {
+        rx_lap_count = lmac_hw_ctx.rx_lap_count;
+        DMA_get_number_of_transfered_data(DMA_INSTANCE_RS485_RX, DMA_CHANNEL_RS485_RX, &rx_write_idx);
+    }
+    while (rx_lap_count != lmac_hw_ctx.rx_lap_count);
+    rx_write_count = (rx_lap_count * LMAC_HW_RX_BUFFER_SIZE) + (rx_write_idx % LMAC_HW_RX_BUFFER_SIZE);
+    rx_pending_count = (int32_t) (rx_write_count - lmac_hw_ctx.rx_read_count);
+    // Check overrun.
+    if (rx_pending_count > LMAC_HW_RX_BUFFER_SIZE) {
+        // Unread bytes have been overwritten by the DMA: drop the whole buffer, the master will repeat the request on timeout.
+        lmac_hw_ctx.statistics.rx_overrun_count++;
+        lmac_hw_ctx.rx_read_count = rx_write_count;
+    }
+    // Transmit all new bytes to the MAC layer.
+    while (((int32_t) (rx_write_count - lmac_hw_ctx.rx_read_count)) > 0) {
+        rx_byte = lmac_hw_ctx.rx_buffer[lmac_hw_ctx.rx_read_count % LMAC_HW_RX_BUFFER_SIZE];
+        lmac_hw_ctx.rx_read_count++;
+        _LMAC_HW_receive_byte(rx_byte);
+    }
+}
+#endif
+
+#ifdef MPMCM_RS485_DMA
+/*******************************************************************/
+static void _LMAC_HW_lpuart_cm_irq_callback(void) {
+    // Update statistics.
+    lmac_hw_ctx.statistics.rx_irq_count++;
+    // Note: the match character can also be part of the frame content, in this case the frame is just transmitted in several parts.
+    _LMAC_HW_flush_rx_buffer();
+}
+#endif
+
+#ifdef MPMCM_RS485_DMA
+/*******************************************************************/
+static void _LMAC_HW_dma_rx_tc_irq_callback(void) {
+    // Update buffer laps count.
+    lmac_hw_ctx.rx_lap_count++;
+    // Update statistics.
+    lmac_hw_ctx.statistics.rx_irq_count++;
+    // Buffer roll-over.
+    _LMAC_HW_flush_rx_buffer();
+}
+#endif
+
+#ifdef MPMCM_RS485_DMA
+/*******************************************************************/
+static void _LMAC_HW_dma_tx_tc_irq_callback(void) {
+    // Update statistics and flag.
+    lmac_hw_ctx.statistics.tx_irq_count++;
+    lmac_hw_ctx.tx_done_flag = 1;
+}
+#endif
+
+#ifndef MPMCM_RS485_DMA
+/*******************************************************************/
+static void _LMAC_HW_lpuart_rxne_irq_callback(uint8_t data) {
+    // Update statistics.
+    lmac_hw_ctx.statistics.rx_irq_count++;
+    // Process byte.
+    _LMAC_HW_receive_byte(data);
+}
+#endif
+
+/*******************************************************************/
+static LMAC_status_t _LMAC_HW_init_lpuart(uint32_t baud_rate) {
+    // Local variables.
+    LMAC_status_t status = LMAC_SUCCESS;
+    LPUART_status_t lpuart_status = LPUART_SUCCESS;
+    LPUART_configuration_t lpuart_config;
+    // Note: the baud rate register is computed from the current LPUART clock frequency.
+    lpuart_config.baud_rate = baud_rate;
+    lpuart_config.nvic_priority = NVIC_PRIORITY_RS485;
+#ifdef MPMCM_RS485_DMA
+    lpuart_config.rxne_irq_callback = NULL;
+    lpuart_config.cm_irq_callback = &_LMAC_HW_lpuart_cm_irq_callback;
+    lpuart_config.match_character = LMAC_HW_FRAME_END_CHAR;
+#else
+    lpuart_config.rxne_irq_callback = &_LMAC_HW_lpuart_rxne_irq_callback;
+#endif
+    lpuart_config.self_address = lmac_hw_ctx.self_address;
+    lpuart_config.rs485_mode = LPUART_RS485_MODE_ADDRESSED;
+    lpuart_status = LPUART_init(&LPUART_GPIO_RS485, &lpuart_config);
+    LPUART_exit_error(LMAC_ERROR_BASE_HW_INTERFACE);
+    // Update context.
+    lmac_hw_ctx.baud_rate = baud_rate;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static LMAC_status_t _LMAC_HW_switch_baud_rate(uint32_t baud_rate) {
+    // Local variables.
+    LMAC_status_t status = LMAC_SUCCESS;
+    LPUART_status_t lpuart_status = LPUART_SUCCESS;
+    // Release LPUART.
+    lpuart_status = LPUART_de_init(&LPUART_GPIO_RS485);
+    LPUART_exit_error(LMAC_ERROR_BASE_HW_INTERFACE);
+    // Init LPUART with new baud rate.
+    status = _LMAC_HW_init_lpuart(baud_rate);
+    if (status != LMAC_SUCCESS) goto errors;
+    // Restart reception.
+    status = LMAC_HW_enable_rx();
+    if (status != LMAC_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
 /*** LMAC HW functions ***/
 
 /*******************************************************************/
@@ -30,11 +367,41 @@ LMAC_status_t LMAC_HW_init(uint32_t baud_rate, LMAC_rx_irq_cb_t rx_irq_callback,
     // Local variables.
     LMAC_status_t status = LMAC_SUCCESS;
     NVM_status_t nvm_status = NVM_SUCCESS;
-    LPUART_status_t lpuart_status = LPUART_SUCCESS;
-    LPUART_configuration_t lpuart_config;
+#ifdef MPMCM_RS485_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+    DMA_configuration_t dma_config;
+    uint16_t idx = 0;
+#endif
 #ifdef MPMCM
     uint32_t tmp_u32 = 0;
 #endif
+    // Init context.
+    lmac_hw_ctx.rx_irq_callback = rx_irq_callback;
+    lmac_hw_ctx.default_baud_rate = baud_rate;
+    lmac_hw_ctx.rx_frame_time_seconds = 0;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    lmac_hw_ctx.rx_state = LMAC_HW_RX_STATE_IDLE;
+    lmac_hw_ctx.binary_rx_flag = 0;
+#endif
+#ifdef MPMCM_RS485_DMA
+    for (idx = 0; idx < LMAC_HW_RX_BUFFER_SIZE; idx++) {
+        lmac_hw_ctx.rx_buffer[idx] = 0;
+    }
+    lmac_hw_ctx.rx_lap_count = 0;
+    lmac_hw_ctx.rx_read_count = 0;
+    lmac_hw_ctx.tx_done_flag = 0;
+#endif
+    lmac_hw_ctx.statistics.rx_frame_count = 0;
+    lmac_hw_ctx.statistics.rx_byte_count = 0;
+    lmac_hw_ctx.statistics.rx_irq_count = 0;
+    lmac_hw_ctx.statistics.rx_overrun_count = 0;
+    lmac_hw_ctx.statistics.tx_frame_count = 0;
+    lmac_hw_ctx.statistics.tx_byte_count = 0;
+    lmac_hw_ctx.statistics.tx_irq_count = 0;
+    lmac_hw_ctx.statistics.tx_sleep_count = 0;
+    lmac_hw_ctx.statistics.tx_timeout_count = 0;
+    lmac_hw_ctx.statistics.rx_binary_frame_count = 0;
+    lmac_hw_ctx.statistics.rx_binary_error_count = 0;
     // Read self address.
 #ifdef MPMCM
     nvm_status = NVM_read_word(NVM_ADDRESS_SELF_ADDRESS, &tmp_u32);
@@ -43,14 +410,40 @@ LMAC_status_t LMAC_HW_init(uint32_t baud_rate, LMAC_rx_irq_cb_t rx_irq_callback,
     nvm_status = NVM_read_byte(NVM_ADDRESS_SELF_ADDRESS, self_address);
 #endif
     NVM_exit_error(LMAC_ERROR_BASE_NVM);
+    lmac_hw_ctx.self_address = (*self_address);
     // Init LPUART.
-    lpuart_config.baud_rate = baud_rate;
-    lpuart_config.nvic_priority = NVIC_PRIORITY_RS485;
-    lpuart_config.rxne_irq_callback = rx_irq_callback;
-    lpuart_config.self_address = (*self_address);
-    lpuart_config.rs485_mode = LPUART_RS485_MODE_ADDRESSED;
-    lpuart_status = LPUART_init(&LPUART_GPIO_RS485, &lpuart_config);
-    LPUART_exit_error(LMAC_ERROR_BASE_HW_INTERFACE);
+    status = _LMAC_HW_init_lpuart(baud_rate);
+    if (status != LMAC_SUCCESS) goto errors;
+#ifdef MPMCM_RS485_DMA
+    // Init RX DMA in circular mode.
+    // Note: the LPUART remains muted by hardware until its address is received, so only addressed frames are transfered.
+    dma_config.direction = DMA_DIRECTION_PERIPHERAL_TO_MEMORY;
+    dma_config.flags.all = 0;
+    dma_config.flags.memory_increment = 1;
+    dma_config.flags.circular_mode = 1;
+    dma_config.memory_address = (uint32_t) &(lmac_hw_ctx.rx_buffer);
+    dma_config.memory_data_size = DMA_DATA_SIZE_8_BITS;
+    dma_config.peripheral_address = LPUART_get_rdr_register_address();
+    dma_config.peripheral_data_size = DMA_DATA_SIZE_8_BITS;
+    dma_config.number_of_data = LMAC_HW_RX_BUFFER_SIZE;
+    dma_config.priority = DMA_PRIORITY_HIGH;
+    dma_config.request_id = DMAMUX_PERIPHERAL_REQUEST_LPUART1_RX;
+    dma_config.tc_irq_callback = &_LMAC_HW_dma_rx_tc_irq_callback;
+    dma_config.nvic_priority = NVIC_PRIORITY_DMA_RS485;
+    dma_status = DMA_init(DMA_INSTANCE_RS485_RX, DMA_CHANNEL_RS485_RX, &dma_config);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+    // Init TX DMA.
+    dma_config.direction = DMA_DIRECTION_MEMORY_TO_PERIPHERAL;
+    dma_config.flags.all = 0;
+    dma_config.flags.memory_increment = 1;
+    dma_config.memory_address = 0;
+    dma_config.peripheral_address = LPUART_get_tdr_register_address();
+    dma_config.number_of_data = 0;
+    dma_config.request_id = DMAMUX_PERIPHERAL_REQUEST_LPUART1_TX;
+    dma_config.tc_irq_callback = &_LMAC_HW_dma_tx_tc_irq_callback;
+    dma_status = DMA_init(DMA_INSTANCE_RS485_TX, DMA_CHANNEL_RS485_TX, &dma_config);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+#endif
 errors:
     return status;
 }
@@ -60,9 +453,21 @@ LMAC_status_t LMAC_HW_de_init(void) {
     // Local variables.
     LMAC_status_t status = LMAC_SUCCESS;
     LPUART_status_t lpuart_status = LPUART_SUCCESS;
+#ifdef MPMCM_RS485_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+#endif
     // Release LPUART.
     lpuart_status = LPUART_de_init(&LPUART_GPIO_RS485);
     LPUART_stack_error(ERROR_BASE_LMAC + LMAC_ERROR_BASE_HW_INTERFACE);
+#ifdef MPMCM_RS485_DMA
+    // Release DMA channels.
+    dma_status = DMA_de_init(DMA_INSTANCE_RS485_RX, DMA_CHANNEL_RS485_RX);
+    DMA_stack_error(ERROR_BASE_LMAC + LMAC_HW_ERROR_BASE_DMA);
+    dma_status = DMA_de_init(DMA_INSTANCE_RS485_TX, DMA_CHANNEL_RS485_TX);
+    DMA_stack_error(ERROR_BASE_LMAC + LMAC_HW_ERROR_BASE_DMA);
+#endif
+    // Reset context.
+    lmac_hw_ctx.baud_rate = 0;
     return status;
 }
 
@@ -71,6 +476,18 @@ LMAC_status_t LMAC_HW_enable_rx(void) {
     // Local variables.
     LMAC_status_t status = LMAC_SUCCESS;
     LPUART_status_t lpuart_status = LPUART_SUCCESS;
+#ifdef MPMCM_RS485_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+    // Restart RX DMA from the beginning of the buffer.
+    dma_status = DMA_stop(DMA_INSTANCE_RS485_RX, DMA_CHANNEL_RS485_RX);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+    dma_status = DMA_set_memory_address(DMA_INSTANCE_RS485_RX, DMA_CHANNEL_RS485_RX, (uint32_t) &(lmac_hw_ctx.rx_buffer), LMAC_HW_RX_BUFFER_SIZE);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+    lmac_hw_ctx.rx_lap_count = 0;
+    lmac_hw_ctx.rx_read_count = 0;
+    dma_status = DMA_start(DMA_INSTANCE_RS485_RX, DMA_CHANNEL_RS485_RX);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+#endif
     // Enable receiver.
     lpuart_status = LPUART_enable_rx();
     LPUART_exit_error(LMAC_ERROR_BASE_HW_INTERFACE);
@@ -83,9 +500,18 @@ LMAC_status_t LMAC_HW_disable_rx(void) {
     // Local variables.
     LMAC_status_t status = LMAC_SUCCESS;
     LPUART_status_t lpuart_status = LPUART_SUCCESS;
+#ifdef MPMCM_RS485_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+#endif
     // Disable receiver.
     lpuart_status = LPUART_disable_rx();
     LPUART_exit_error(LMAC_ERROR_BASE_HW_INTERFACE);
+#ifdef MPMCM_RS485_DMA
+    // Transmit remaining bytes and stop RX DMA.
+    _LMAC_HW_flush_rx_buffer();
+    dma_status = DMA_stop(DMA_INSTANCE_RS485_RX, DMA_CHANNEL_RS485_RX);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+#endif
 errors:
     return status;
 }
@@ -95,9 +521,42 @@ LMAC_status_t LMAC_HW_write(uint8_t* data, uint32_t data_size_bytes) {
     // Local variables.
     LMAC_status_t status = LMAC_SUCCESS;
     LPUART_status_t lpuart_status = LPUART_SUCCESS;
+#ifdef MPMCM_RS485_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+    uint32_t start_time_seconds = 0;
+    // Start TX DMA.
+    lmac_hw_ctx.tx_done_flag = 0;
+    dma_status = DMA_set_memory_address(DMA_INSTANCE_RS485_TX, DMA_CHANNEL_RS485_TX, (uint32_t) data, (uint16_t) data_size_bytes);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+    dma_status = DMA_start(DMA_INSTANCE_RS485_TX, DMA_CHANNEL_RS485_TX);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+    start_time_seconds = RTC_get_uptime_seconds();
+    // Sleep until transfer is complete.
+    while (lmac_hw_ctx.tx_done_flag == 0) {
+        // Exit if timeout.
+        if (RTC_get_uptime_seconds() >= (start_time_seconds + LMAC_HW_TX_TIMEOUT_SECONDS)) {
+            lmac_hw_ctx.statistics.tx_timeout_count++;
+            status = (LMAC_status_t) LMAC_HW_ERROR_TX_TIMEOUT;
+            break;
+        }
+        lmac_hw_ctx.statistics.tx_sleep_count++;
+        PWR_enter_sleep_mode(PWR_SLEEP_MODE_NORMAL);
+    }
+    dma_status = DMA_stop(DMA_INSTANCE_RS485_TX, DMA_CHANNEL_RS485_TX);
+    DMA_exit_error(LMAC_HW_ERROR_BASE_DMA);
+    if (status != LMAC_SUCCESS) goto errors;
+    // Wait for the last byte to be sent on the bus.
+    // Note: the DMA transfer complete interrupt is triggered when the last byte is written in the data register, before it is shifted out.
+    lpuart_status = LPUART_wait_tx_complete();
+    LPUART_exit_error(LMAC_ERROR_BASE_HW_INTERFACE);
+#else
     // Send bytes over LPUART.
     lpuart_status = LPUART_write(data, data_size_bytes);
     LPUART_exit_error(LMAC_ERROR_BASE_HW_INTERFACE);
+#endif
+    // Update statistics.
+    lmac_hw_ctx.statistics.tx_frame_count++;
+    lmac_hw_ctx.statistics.tx_byte_count += data_size_bytes;
 errors:
     return status;
 }
@@ -107,4 +566,148 @@ void LMAC_HW_stack_error(LMAC_status_t status) {
     ERROR_stack_add(ERROR_BASE_LMAC + status);
 }
 
+/*******************************************************************/
+LMAC_status_t LMAC_HW_set_baud_rate(uint32_t baud_rate) {
+    // Restart fallback timeout.
+    lmac_hw_ctx.rx_frame_time_seconds = RTC_get_uptime_seconds();
+    // Note: LMAC_HW_write() returns once the last byte has been sent, so the pending reply is never truncated by the switch.
+    return _LMAC_HW_switch_baud_rate(baud_rate);
+}
+
+/*******************************************************************/
+LMAC_status_t LMAC_HW_update_clock(void) {
+    // Local variables.
+    LMAC_status_t status = LMAC_SUCCESS;
+    // Check if interface is initialized.
+    if (lmac_hw_ctx.baud_rate == 0) goto errors;
+    // Note: the default baud rate register is kept as configured at init, only a negotiated baud rate has to be recomputed.
+    if (lmac_hw_ctx.baud_rate == lmac_hw_ctx.default_baud_rate) goto errors;
+    // Recompute baud rate register with the new clock frequency.
+    status = _LMAC_HW_switch_baud_rate(lmac_hw_ctx.baud_rate);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+LMAC_status_t LMAC_HW_check_baud_rate_fallback(void) {
+    // Local variables.
+    LMAC_status_t status = LMAC_SUCCESS;
+    // Fall back to default baud rate when the node has not been addressed for too long.
+    if ((lmac_hw_ctx.baud_rate != lmac_hw_ctx.default_baud_rate) && (RTC_get_uptime_seconds() >= (lmac_hw_ctx.rx_frame_time_seconds + LMAC_HW_BAUD_RATE_FALLBACK_TIMEOUT_SECONDS))) {
+        status = _LMAC_HW_switch_baud_rate(lmac_hw_ctx.default_baud_rate);
+    }
+    return status;
+}
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+void LMAC_HW_set_binary_rx_callback(LMAC_HW_binary_rx_cb_t binary_rx_callback) {
+    // Register callback.
+    lmac_hw_ctx.binary_rx_callback = binary_rx_callback;
+}
+
+/*******************************************************************/
+LMAC_status_t LMAC_HW_read_binary_frame(uint8_t* data, uint8_t* data_size_bytes) {
+    // Local variables.
+    LMAC_status_t status = LMAC_SUCCESS;
+    uint8_t frame[LMAC_HW_BINARY_DATA_SIZE_MAX + LMAC_HW_BINARY_CRC_SIZE];
+    uint8_t frame_size = 0;
+    uint32_t bits = 0;
+    uint8_t number_of_bits = 0;
+    uint16_t crc16 = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((data == NULL) || (data_size_bytes == NULL)) {
+        status = LMAC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*data_size_bytes) = 0;
+    // Check flag.
+    if (lmac_hw_ctx.binary_rx_flag == 0) goto errors;
+    // Decode characters, padding bits of the last character are ignored.
+    for (idx = 0; idx < lmac_hw_ctx.binary_rx_size_char; idx++) {
+        bits = (bits << LMAC_HW_BINARY_CHAR_BITS) | (lmac_hw_ctx.binary_rx_buffer[idx] & LMAC_HW_BINARY_CHAR_MASK);
+        number_of_bits += LMAC_HW_BINARY_CHAR_BITS;
+        if (number_of_bits >= 8) {
+            number_of_bits -= 8;
+            frame[frame_size++] = (uint8_t) (bits >> number_of_bits);
+        }
+    }
+    // Release buffer.
+    lmac_hw_ctx.binary_rx_flag = 0;
+    // Check CRC.
+    if (frame_size > LMAC_HW_BINARY_CRC_SIZE) {
+        frame_size -= LMAC_HW_BINARY_CRC_SIZE;
+        crc16 = _LMAC_HW_compute_crc16(frame, frame_size);
+        if ((frame[frame_size] == (uint8_t) (crc16 >> 8)) && (frame[frame_size + 1] == (uint8_t) (crc16 >> 0))) {
+            // Copy payload.
+            for (idx = 0; idx < frame_size; idx++) {
+                data[idx] = frame[idx];
+            }
+            (*data_size_bytes) = frame_size;
+            goto errors;
+        }
+    }
+    // Corrupted frame is dropped.
+    lmac_hw_ctx.statistics.rx_binary_error_count++;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+LMAC_status_t LMAC_HW_write_binary_frame(uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    LMAC_status_t status = LMAC_SUCCESS;
+    uint8_t frame[LMAC_HW_BINARY_FRAME_SIZE_MAX];
+    uint8_t frame_size = LMAC_HW_BINARY_HEADER_SIZE;
+    uint32_t bits = 0;
+    uint8_t number_of_bits = 0;
+    uint16_t crc16 = 0;
+    uint8_t byte = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if (data == NULL) {
+        status = LMAC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (data_size_bytes > LMAC_HW_BINARY_DATA_SIZE_MAX) {
+        status = (LMAC_status_t) LMAC_HW_ERROR_BINARY_DATA_SIZE;
+        goto errors;
+    }
+    crc16 = _LMAC_HW_compute_crc16(data, data_size_bytes);
+    // Encode payload and CRC.
+    for (idx = 0; idx < (data_size_bytes + LMAC_HW_BINARY_CRC_SIZE); idx++) {
+        byte = (idx < data_size_bytes) ? data[idx] : (uint8_t) (crc16 >> (8 * (data_size_bytes + LMAC_HW_BINARY_CRC_SIZE - 1 - idx)));
+        bits = (bits << 8) | byte;
+        number_of_bits += 8;
+        while (number_of_bits >= LMAC_HW_BINARY_CHAR_BITS) {
+            number_of_bits -= LMAC_HW_BINARY_CHAR_BITS;
+            frame[frame_size++] = (uint8_t) ((bits >> number_of_bits) & LMAC_HW_BINARY_CHAR_MASK);
+        }
+    }
+    // Pad last character with zeros.
+    if (number_of_bits != 0) {
+        frame[frame_size++] = (uint8_t) ((bits << (LMAC_HW_BINARY_CHAR_BITS - number_of_bits)) & LMAC_HW_BINARY_CHAR_MASK);
+    }
+    // Header and frame end.
+    frame[0] = (lmac_hw_ctx.binary_source_address | LMAC_HW_ADDRESS_MARKER);
+    frame[1] = lmac_hw_ctx.self_address;
+    frame[2] = LMAC_HW_BINARY_FRAME_MARKER;
+    frame[3] = (uint8_t) (frame_size - LMAC_HW_BINARY_HEADER_SIZE);
+    frame[frame_size++] = LMAC_HW_FRAME_END_CHAR;
+    // Send frame.
+    status = LMAC_HW_write(frame, frame_size);
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+void LMAC_HW_get_statistics(LMAC_HW_statistics_t* statistics) {
+    // Check parameter.
+    if (statistics == NULL) return;
+    // Copy statistics.
+    (*statistics) = lmac_hw_ctx.statistics;
+}
+
 #endif /* LMAC_DRIVER_DISABLE */
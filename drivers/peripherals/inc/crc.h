@@ -0,0 +1,83 @@
+/*
+ * crc.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __CRC_H__
+#define __CRC_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** CRC structures ***/
+
+/*!******************************************************************
+ * \enum CRC_status_t
+ * \brief CRC driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    CRC_SUCCESS = 0,
+    CRC_ERROR_NULL_PARAMETER,
+    CRC_ERROR_POLYNOMIAL_SIZE,
+    // Last base value.
+    CRC_ERROR_BASE_LAST = ERROR_BASE_STEP
+} CRC_status_t;
+
+/*!******************************************************************
+ * \enum CRC_polynomial_size_t
+ * \brief CRC polynomial sizes list.
+ *******************************************************************/
+typedef enum {
+    CRC_POLYNOMIAL_SIZE_32 = 0,
+    CRC_POLYNOMIAL_SIZE_16,
+    CRC_POLYNOMIAL_SIZE_8,
+    CRC_POLYNOMIAL_SIZE_7,
+    CRC_POLYNOMIAL_SIZE_LAST
+} CRC_polynomial_size_t;
+
+/*** CRC functions ***/
+
+/*!******************************************************************
+ * \fn void CRC_init(void)
+ * \brief Init CRC peripheral.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void CRC_init(void);
+
+/*!******************************************************************
+ * \fn void CRC_de_init(void)
+ * \brief Release CRC peripheral.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void CRC_de_init(void);
+
+/*!******************************************************************
+ * \fn CRC_status_t CRC_compute(uint8_t* data, uint32_t data_size_bytes, CRC_polynomial_size_t polynomial_size, uint32_t polynomial, uint32_t init_value, uint32_t* crc)
+ * \brief Compute a non-reflected CRC of a byte array.
+ * \param[in]   data: Input data.
+ * \param[in]   data_size_bytes: Number of bytes to process.
+ * \param[in]   polynomial_size: CRC polynomial size.
+ * \param[in]   polynomial: CRC polynomial (without the leading coefficient).
+ * \param[in]   init_value: CRC initial value.
+ * \param[out]  crc: Pointer to the computed CRC.
+ * \retval      Function execution status.
+ *******************************************************************/
+CRC_status_t CRC_compute(uint8_t* data, uint32_t data_size_bytes, CRC_polynomial_size_t polynomial_size, uint32_t polynomial, uint32_t init_value, uint32_t* crc);
+
+/*******************************************************************/
+#define CRC_exit_error(base) { ERROR_check_exit(crc_status, CRC_SUCCESS, base) }
+
+/*******************************************************************/
+#define CRC_stack_error(base) { ERROR_check_stack(crc_status, CRC_SUCCESS, base) }
+
+/*******************************************************************/
+#define CRC_stack_exit_error(base, code) { ERROR_check_stack_exit(crc_status, CRC_SUCCESS, base, code) }
+
+#endif /* __CRC_H__ */
@@ -86,6 +86,14 @@
 #define DMA_CHANNEL_ACV_FREQUENCY   DMA_CHANNEL_3
 #define DMA_INSTANCE_TIC            DMA_INSTANCE_DMA1
 #define DMA_CHANNEL_TIC             DMA_CHANNEL_4
+#define DMA_INSTANCE_RS485_RX       DMA_INSTANCE_DMA1
+#define DMA_CHANNEL_RS485_RX        DMA_CHANNEL_5
+#define DMA_INSTANCE_RS485_TX       DMA_INSTANCE_DMA1
+#define DMA_CHANNEL_RS485_TX        DMA_CHANNEL_6
+#endif
+#ifdef GPSM
+#define DMA_INSTANCE_GPS_RX         DMA_INSTANCE_DMA1
+#define DMA_CHANNEL_GPS_RX          DMA_CHANNEL_5
 #endif
 
 #define I2C_INSTANCE_SENSORS        I2C_INSTANCE_I2C1
@@ -26,6 +26,7 @@ typedef enum {
     NVIC_PRIORITY_DMA_TIC,
     // RS485 interface.
     NVIC_PRIORITY_RS485,
+    NVIC_PRIORITY_DMA_RS485,
     // Common.
     NVIC_PRIORITY_CLOCK,
     NVIC_PRIORITY_CLOCK_CALIBRATION,
@@ -52,6 +53,7 @@ typedef enum {
 #endif
 #ifdef GPSM
     NVIC_PRIORITY_GPS_UART = 0,
+    NVIC_PRIORITY_DMA_GPS_UART = 0,
 #endif
 #endif
 } NVIC_priority_list_t;
@@ -20,6 +20,7 @@ typedef enum {
     NVM_ADDRESS_SIGFOX_EP_KEY = (NVM_ADDRESS_SIGFOX_EP_ID + SIGFOX_EP_ID_SIZE_BYTES),
     NVM_ADDRESS_SIGFOX_EP_LIB_DATA = (NVM_ADDRESS_SIGFOX_EP_KEY + SIGFOX_EP_KEY_SIZE_BYTES),
     NVM_ADDRESS_REGISTERS = 0x40,
+    NVM_ADDRESS_REGISTERS_JOURNAL = 0x100,
 } NVM_address_mapping_t;
 
 #endif /* __NVM_ADDRESS_H__ */
@@ -17,7 +17,7 @@
 #define STM32G4XX_DRIVERS_ADC_MODE_MASK                 0x03
 #define STM32G4XX_DRIVERS_ADC_VREF_MV                   2500
 
-#define STM32G4XX_DRIVERS_DMA_CHANNEL_MASK              0x000F
+#define STM32G4XX_DRIVERS_DMA_CHANNEL_MASK              0x003F
 
 #define STM32G4XX_DRIVERS_EXTI_GPIO_MASK                0x0004
 
@@ -16,7 +16,11 @@
 #define STM32L0XX_DRIVERS_DISABLE
 #endif
 
+#ifdef GPSM_UART_DMA
+#define STM32L0XX_DRIVERS_DMA_CHANNEL_MASK              0x10
+#else
 #define STM32L0XX_DRIVERS_DMA_CHANNEL_MASK              0x00
+#endif
 
 #ifdef UHFM
 #define STM32L0XX_DRIVERS_EXTI_GPIO_MASK                0x0800
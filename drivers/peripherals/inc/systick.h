@@ -0,0 +1,87 @@
+/*
+ * systick.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SYSTICK_H__
+#define __SYSTICK_H__
+
+#include "error.h"
+#include "rcc.h"
+#include "types.h"
+
+/*** SYSTICK structures ***/
+
+/*!******************************************************************
+ * \enum SYSTICK_status_t
+ * \brief SYSTICK driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    SYSTICK_SUCCESS = 0,
+    SYSTICK_ERROR_CLOCK_FREQUENCY,
+    // Low level drivers errors.
+    SYSTICK_ERROR_BASE_RCC = ERROR_BASE_STEP,
+    // Last base value.
+    SYSTICK_ERROR_BASE_LAST = (SYSTICK_ERROR_BASE_RCC + RCC_ERROR_BASE_LAST)
+} SYSTICK_status_t;
+
+/*** SYSTICK functions ***/
+
+/*!******************************************************************
+ * \fn SYSTICK_status_t SYSTICK_start(void)
+ * \brief Start SysTick as a free running down counter on the system clock.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SYSTICK_status_t SYSTICK_start(void);
+
+/*!******************************************************************
+ * \fn void SYSTICK_stop(void)
+ * \brief Stop SysTick.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SYSTICK_stop(void);
+
+/*!******************************************************************
+ * \fn uint8_t SYSTICK_is_running(void)
+ * \brief Check if SysTick is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if SysTick is running, 0 otherwise.
+ *******************************************************************/
+uint8_t SYSTICK_is_running(void);
+
+/*!******************************************************************
+ * \fn uint32_t SYSTICK_get_timestamp(void)
+ * \brief Read SysTick current value.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current counter value.
+ *******************************************************************/
+uint32_t SYSTICK_get_timestamp(void);
+
+/*!******************************************************************
+ * \fn uint32_t SYSTICK_get_elapsed_us(uint32_t start_timestamp)
+ * \brief Compute the time elapsed since a timestamp.
+ * \param[in]   start_timestamp: Counter value returned by SYSTICK_get_timestamp() at the beginning of the measured sequence.
+ * \param[out]  none
+ * \retval      Elapsed time in microseconds (modulo the 24-bits counter period).
+ *******************************************************************/
+uint32_t SYSTICK_get_elapsed_us(uint32_t start_timestamp);
+
+/*******************************************************************/
+#define SYSTICK_exit_error(base) { ERROR_check_exit(systick_status, SYSTICK_SUCCESS, base) }
+
+/*******************************************************************/
+#define SYSTICK_stack_error(base) { ERROR_check_stack(systick_status, SYSTICK_SUCCESS, base) }
+
+/*******************************************************************/
+#define SYSTICK_stack_exit_error(base, code) { ERROR_check_stack_exit(systick_status, SYSTICK_SUCCESS, base, code) }
+
+#endif /* __SYSTICK_H__ */
@@ -0,0 +1,79 @@
+/*
+ * crc.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "crc.h"
+
+#include "crc_registers.h"
+#include "error.h"
+#include "rcc_registers.h"
+#ifndef STM32G4XX_REGISTERS_DISABLE_FLAGS_FILE
+#include "stm32g4xx_registers_flags.h"
+#endif
+#include "types.h"
+
+/*** CRC local macros ***/
+
+// CRC peripheral clock is on the AHB1 bus of the STM32G4 family and on the single AHB bus of the STM32L0 family.
+#ifdef STM32G4XX_REGISTERS_DISABLE
+#define CRC_RCC_AHBENR          (RCC->AHBENR)
+#else
+#define CRC_RCC_AHBENR          (RCC->AHB1ENR)
+#endif
+
+#define CRC_CR_POLYSIZE_SHIFT   3
+#define CRC_CR_POLYSIZE_MASK    (0b11 << CRC_CR_POLYSIZE_SHIFT)
+
+/*** CRC local global variables ***/
+
+static const uint32_t CRC_POLYNOMIAL_MASK[CRC_POLYNOMIAL_SIZE_LAST] = { 0xFFFFFFFF, 0x0000FFFF, 0x000000FF, 0x0000007F };
+
+/*** CRC functions ***/
+
+/*******************************************************************/
+void CRC_init(void) {
+    // Enable peripheral clock.
+    CRC_RCC_AHBENR |= (0b1 << 12); // CRCEN='1'.
+    // Reset configuration (no input or output reversal).
+    CRC->CR = 0;
+}
+
+/*******************************************************************/
+void CRC_de_init(void) {
+    // Disable peripheral clock.
+    CRC_RCC_AHBENR &= ~(0b1 << 12); // CRCEN='0'.
+}
+
+/*******************************************************************/
+CRC_status_t CRC_compute(uint8_t* data, uint32_t data_size_bytes, CRC_polynomial_size_t polynomial_size, uint32_t polynomial, uint32_t init_value, uint32_t* crc) {
+    // Local variables.
+    CRC_status_t status = CRC_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((data == NULL) || (crc == NULL)) {
+        status = CRC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (polynomial_size >= CRC_POLYNOMIAL_SIZE_LAST) {
+        status = CRC_ERROR_POLYNOMIAL_SIZE;
+        goto errors;
+    }
+    // Configure polynomial.
+    CRC->CR &= ~CRC_CR_POLYSIZE_MASK;
+    CRC->CR |= (polynomial_size << CRC_CR_POLYSIZE_SHIFT);
+    CRC->POL = (polynomial & CRC_POLYNOMIAL_MASK[polynomial_size]);
+    // Load initial value.
+    CRC->INIT = (init_value & CRC_POLYNOMIAL_MASK[polynomial_size]);
+    CRC->CR |= (0b1 << 0); // RESET='1'.
+    // Feed data with byte accesses.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        *((volatile uint8_t*) &(CRC->DR)) = data[idx];
+    }
+    // Read result.
+    (*crc) = ((CRC->DR) & CRC_POLYNOMIAL_MASK[polynomial_size]);
+errors:
+    return status;
+}
@@ -0,0 +1,73 @@
+/*
+ * systick.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "systick.h"
+
+#include "error.h"
+#include "rcc.h"
+#include "types.h"
+
+/*** SYSTICK local macros ***/
+
+#define SYSTICK_CSR     (*((volatile uint32_t*) 0xE000E010))
+#define SYSTICK_RVR     (*((volatile uint32_t*) 0xE000E014))
+#define SYSTICK_CVR     (*((volatile uint32_t*) 0xE000E018))
+
+#define SYSTICK_MASK    0x00FFFFFF
+
+/*** SYSTICK local global variables ***/
+
+static uint32_t systick_frequency_mhz = 0;
+
+/*** SYSTICK functions ***/
+
+/*******************************************************************/
+SYSTICK_status_t SYSTICK_start(void) {
+    // Local variables.
+    SYSTICK_status_t status = SYSTICK_SUCCESS;
+    RCC_status_t rcc_status = RCC_SUCCESS;
+    uint32_t sysclk_frequency_hz = 0;
+    // Get current system clock frequency.
+    rcc_status = RCC_get_frequency_hz(RCC_CLOCK_SYSTEM, &sysclk_frequency_hz);
+    RCC_exit_error(SYSTICK_ERROR_BASE_RCC);
+    systick_frequency_mhz = (sysclk_frequency_hz / 1000000);
+    if (systick_frequency_mhz == 0) {
+        status = SYSTICK_ERROR_CLOCK_FREQUENCY;
+        goto errors;
+    }
+    // Free running counter on processor clock, without interrupt.
+    SYSTICK_RVR = SYSTICK_MASK;
+    SYSTICK_CVR = 0;
+    SYSTICK_CSR = ((0b1UL << 2) | (0b1UL << 0)); // CLKSOURCE='1' and ENABLE='1'.
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void SYSTICK_stop(void) {
+    // Disable counter.
+    SYSTICK_CSR = 0;
+}
+
+/*******************************************************************/
+uint8_t SYSTICK_is_running(void) {
+    // Read ENABLE bit.
+    return ((SYSTICK_CSR & (0b1UL << 0)) != 0) ? 1 : 0;
+}
+
+/*******************************************************************/
+uint32_t SYSTICK_get_timestamp(void) {
+    return SYSTICK_CVR;
+}
+
+/*******************************************************************/
+uint32_t SYSTICK_get_elapsed_us(uint32_t start_timestamp) {
+    // Check frequency.
+    if (systick_frequency_mhz == 0) return 0;
+    // Note: SysTick is a down counter.
+    return (((start_timestamp - SYSTICK_CVR) & SYSTICK_MASK) / systick_frequency_mhz);
+}
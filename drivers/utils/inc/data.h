@@ -12,7 +12,9 @@
 
 /*** DATA macros ***/
 
-#define DATA_SECONDS_PER_HOUR   3600
+#define DATA_SECONDS_PER_HOUR       3600
+
+#define DATA_NUMBER_OF_HARMONICS    3
 
 /*** DATA structures ***/
 
@@ -25,6 +27,15 @@ typedef struct {
     uint32_t number_of_samples;
 } DATA_run_t;
 
+/*!******************************************************************
+ * \struct DATA_run_sum_t
+ * \brief Single run data accumulator structure.
+ *******************************************************************/
+typedef struct {
+    float32_t sum;
+    uint32_t number_of_samples;
+} DATA_run_sum_t;
+
 /*!******************************************************************
  * \struct DATA_accumulated_t
  * \brief Single accumulated data structure.
@@ -32,7 +43,8 @@ typedef struct {
 typedef struct {
     float64_t min;
     float64_t max;
-    float64_t rolling_mean;
+    float64_t sum;
+    float64_t mean;
     uint32_t number_of_samples;
 } DATA_accumulated_t;
 
@@ -46,8 +58,23 @@ typedef struct {
     DATA_run_t rms_current_ma;
     DATA_run_t apparent_power_mva;
     DATA_run_t power_factor;
+    DATA_run_t reactive_power_mvar;
+    DATA_run_t phase_angle_degrees;
 } DATA_run_channel_t;
 
+/*!******************************************************************
+ * \struct DATA_run_sum_channel_t
+ * \brief Single channel run data accumulator structure.
+ *******************************************************************/
+typedef struct {
+    DATA_run_sum_t active_power_mw;
+    DATA_run_sum_t rms_voltage_mv;
+    DATA_run_sum_t rms_current_ma;
+    DATA_run_sum_t apparent_power_mva;
+    DATA_run_sum_t power_factor;
+    DATA_run_sum_t reactive_power_mvar;
+} DATA_run_sum_channel_t;
+
 /*!******************************************************************
  * \struct DATA_accumulated_channel_t
  * \brief Single channel accumulated data structure.
@@ -58,10 +85,40 @@ typedef struct {
     DATA_accumulated_t rms_current_ma;
     DATA_accumulated_t apparent_power_mva;
     DATA_accumulated_t power_factor;
+    DATA_accumulated_t reactive_power_mvar;
+    DATA_accumulated_t phase_angle_degrees;
     DATA_run_t active_energy_mwh;
     DATA_run_t apparent_energy_mvah;
+    DATA_run_t reactive_energy_mvarh;
 } DATA_accumulated_channel_t;
 
+/*!******************************************************************
+ * \struct DATA_run_harmonics_t
+ * \brief Single signal harmonics run data structure.
+ *******************************************************************/
+typedef struct {
+    DATA_run_t thd_percent;
+    DATA_run_t odd_harmonic_percent[DATA_NUMBER_OF_HARMONICS];
+} DATA_run_harmonics_t;
+
+/*!******************************************************************
+ * \struct DATA_run_sum_harmonics_t
+ * \brief Single signal harmonics run data accumulator structure.
+ *******************************************************************/
+typedef struct {
+    DATA_run_sum_t thd_percent;
+    DATA_run_sum_t odd_harmonic_percent[DATA_NUMBER_OF_HARMONICS];
+} DATA_run_sum_harmonics_t;
+
+/*!******************************************************************
+ * \struct DATA_accumulated_harmonics_t
+ * \brief Single signal harmonics accumulated data structure.
+ *******************************************************************/
+typedef struct {
+    DATA_accumulated_t thd_percent;
+    DATA_accumulated_t odd_harmonic_percent[DATA_NUMBER_OF_HARMONICS];
+} DATA_accumulated_harmonics_t;
+
 /*** DATA functions ***/
 
 /*******************************************************************/
@@ -77,13 +134,41 @@ typedef struct {
     DATA_reset_run(channel.rms_current_ma); \
     DATA_reset_run(channel.apparent_power_mva); \
     DATA_reset_run(channel.power_factor); \
+    DATA_reset_run(channel.reactive_power_mvar); \
+    DATA_reset_run(channel.phase_angle_degrees); \
+}
+
+/*******************************************************************/
+#define DATA_reset_run_sum(source) { \
+    source.sum = 0.0; \
+    source.number_of_samples = 0; \
+}
+
+/*******************************************************************/
+#define DATA_reset_run_sum_channel(channel) { \
+    DATA_reset_run_sum(channel.active_power_mw); \
+    DATA_reset_run_sum(channel.rms_voltage_mv); \
+    DATA_reset_run_sum(channel.rms_current_ma); \
+    DATA_reset_run_sum(channel.apparent_power_mva); \
+    DATA_reset_run_sum(channel.power_factor); \
+    DATA_reset_run_sum(channel.reactive_power_mvar); \
+}
+
+/*******************************************************************/
+#define DATA_reset_run_sum_harmonics(harmonics) { \
+    uint8_t data_harmonic_idx = 0; \
+    DATA_reset_run_sum(harmonics.thd_percent); \
+    for (data_harmonic_idx = 0; data_harmonic_idx < DATA_NUMBER_OF_HARMONICS; data_harmonic_idx++) { \
+        DATA_reset_run_sum(harmonics.odd_harmonic_percent[data_harmonic_idx]); \
+    } \
 }
 
 /*******************************************************************/
 #define DATA_reset_accumulated(data) { \
     data.min = 1.7976931348623157e308L; \
     data.max = 0.0; \
-    data.rolling_mean = 0.0; \
+    data.sum = 0.0; \
+    data.mean = 0.0; \
     data.number_of_samples = 0; \
 }
 
@@ -94,8 +179,29 @@ typedef struct {
     DATA_reset_accumulated(channel.rms_current_ma); \
     DATA_reset_accumulated(channel.apparent_power_mva); \
     DATA_reset_accumulated(channel.power_factor); \
+    DATA_reset_accumulated(channel.reactive_power_mvar); \
+    DATA_reset_accumulated(channel.phase_angle_degrees); \
     DATA_reset_run(channel.active_energy_mwh); \
     DATA_reset_run(channel.apparent_energy_mvah); \
+    DATA_reset_run(channel.reactive_energy_mvarh); \
+}
+
+/*******************************************************************/
+#define DATA_reset_run_harmonics(harmonics) { \
+    uint8_t data_harmonic_idx = 0; \
+    DATA_reset_run(harmonics.thd_percent); \
+    for (data_harmonic_idx = 0; data_harmonic_idx < DATA_NUMBER_OF_HARMONICS; data_harmonic_idx++) { \
+        DATA_reset_run(harmonics.odd_harmonic_percent[data_harmonic_idx]); \
+    } \
+}
+
+/*******************************************************************/
+#define DATA_reset_accumulated_harmonics(harmonics) { \
+    uint8_t data_harmonic_idx = 0; \
+    DATA_reset_accumulated(harmonics.thd_percent); \
+    for (data_harmonic_idx = 0; data_harmonic_idx < DATA_NUMBER_OF_HARMONICS; data_harmonic_idx++) { \
+        DATA_reset_accumulated(harmonics.odd_harmonic_percent[data_harmonic_idx]); \
+    } \
 }
 
 /*******************************************************************/
@@ -111,13 +217,43 @@ typedef struct {
     DATA_copy_run(source.rms_current_ma, destination.rms_current_ma); \
     DATA_copy_run(source.apparent_power_mva, destination.apparent_power_mva); \
     DATA_copy_run(source.power_factor, destination.power_factor); \
+    DATA_copy_run(source.reactive_power_mvar, destination.reactive_power_mvar); \
+    DATA_copy_run(source.phase_angle_degrees, destination.phase_angle_degrees); \
+}
+
+/*******************************************************************/
+#define DATA_compute_run(source, destination) { \
+    /* Compute mean from sum */ \
+    destination.value = (source.number_of_samples > 0) ? (((float64_t) source.sum) / ((float64_t) source.number_of_samples)) : 0.0; \
+    destination.number_of_samples = source.number_of_samples; \
+}
+
+/*******************************************************************/
+#define DATA_compute_run_channel(source, destination) { \
+    DATA_compute_run(source.active_power_mw, destination.active_power_mw); \
+    DATA_compute_run(source.rms_voltage_mv, destination.rms_voltage_mv); \
+    DATA_compute_run(source.rms_current_ma, destination.rms_current_ma); \
+    DATA_compute_run(source.apparent_power_mva, destination.apparent_power_mva); \
+    DATA_compute_run(source.power_factor, destination.power_factor); \
+    DATA_compute_run(source.reactive_power_mvar, destination.reactive_power_mvar); \
+}
+
+/*******************************************************************/
+#define DATA_compute_run_harmonics(source, destination) { \
+    uint8_t data_harmonic_idx = 0; \
+    DATA_compute_run(source.thd_percent, destination.thd_percent); \
+    for (data_harmonic_idx = 0; data_harmonic_idx < DATA_NUMBER_OF_HARMONICS; data_harmonic_idx++) { \
+        DATA_compute_run(source.odd_harmonic_percent[data_harmonic_idx], destination.odd_harmonic_percent[data_harmonic_idx]); \
+    } \
 }
 
 /*******************************************************************/
 #define DATA_copy_accumulated(source, destination) { \
     destination.min = source.min; \
     destination.max = source.max; \
-    destination.rolling_mean = source.rolling_mean; \
+    destination.sum = source.sum; \
+    /* Compute mean from sum */ \
+    destination.mean = (source.number_of_samples > 0) ? (source.sum / ((float64_t) source.number_of_samples)) : 0.0; \
     destination.number_of_samples = source.number_of_samples; \
 }
 
@@ -128,20 +264,43 @@ typedef struct {
     DATA_copy_accumulated(source.rms_current_ma, destination.rms_current_ma); \
     DATA_copy_accumulated(source.apparent_power_mva, destination.apparent_power_mva); \
     DATA_copy_accumulated(source.power_factor, destination.power_factor); \
+    DATA_copy_accumulated(source.reactive_power_mvar, destination.reactive_power_mvar); \
+    DATA_copy_accumulated(source.phase_angle_degrees, destination.phase_angle_degrees); \
     DATA_copy_run(source.active_energy_mwh, destination.active_energy_mwh); \
     DATA_copy_run(source.apparent_energy_mvah, destination.apparent_energy_mvah); \
+    DATA_copy_run(source.reactive_energy_mvarh, destination.reactive_energy_mvarh); \
+}
+
+/*******************************************************************/
+#define DATA_copy_run_harmonics(source, destination) { \
+    uint8_t data_harmonic_idx = 0; \
+    DATA_copy_run(source.thd_percent, destination.thd_percent); \
+    for (data_harmonic_idx = 0; data_harmonic_idx < DATA_NUMBER_OF_HARMONICS; data_harmonic_idx++) { \
+        DATA_copy_run(source.odd_harmonic_percent[data_harmonic_idx], destination.odd_harmonic_percent[data_harmonic_idx]); \
+    } \
+}
+
+/*******************************************************************/
+#define DATA_copy_accumulated_harmonics(source, destination) { \
+    uint8_t data_harmonic_idx = 0; \
+    DATA_copy_accumulated(source.thd_percent, destination.thd_percent); \
+    for (data_harmonic_idx = 0; data_harmonic_idx < DATA_NUMBER_OF_HARMONICS; data_harmonic_idx++) { \
+        DATA_copy_accumulated(source.odd_harmonic_percent[data_harmonic_idx], destination.odd_harmonic_percent[data_harmonic_idx]); \
+    } \
 }
 
 /*******************************************************************/
 #define DATA_add_run_sample(data, sample) { \
-    /* Compute rolling mean */ \
-    MATH_rolling_mean(data.value, data.number_of_samples, sample, float64_t); \
+    /* Update sum */ \
+    data.sum += ((float32_t) (sample)); \
+    data.number_of_samples++; \
 }
 
 /*******************************************************************/
 #define DATA_add_run_channel_sample(channel, data, sample) { \
-    /* Compute rolling mean */ \
-    MATH_rolling_mean(channel.data.value, channel.data.number_of_samples, sample, float64_t); \
+    /* Update sum */ \
+    channel.data.sum += ((float32_t) (sample)); \
+    channel.data.number_of_samples++; \
 }
 
 /*******************************************************************/
@@ -160,8 +319,9 @@ typedef struct {
         if (sample_abs > ref_abs) { \
             data.max = source.value; \
         } \
-        /* Compute rolling mean */ \
-        MATH_rolling_mean(data.rolling_mean, data.number_of_samples, source.value, float64_t); \
+        /* Update sum (mean is computed on copy) */ \
+        data.sum += source.value; \
+        data.number_of_samples++; \
     } \
 }
 
@@ -181,8 +341,18 @@ typedef struct {
         if (sample_abs > ref_abs) { \
             channel.data.max = source.value; \
         } \
-        /* Compute rolling mean */ \
-        MATH_rolling_mean(channel.data.rolling_mean, channel.data.number_of_samples, source.value, float64_t); \
+        /* Update sum (mean is computed on copy) */ \
+        channel.data.sum += source.value; \
+        channel.data.number_of_samples++; \
+    } \
+}
+
+/*******************************************************************/
+#define DATA_add_accumulated_harmonics_sample(harmonics, source) { \
+    uint8_t data_harmonic_idx = 0; \
+    DATA_add_accumulated_sample(harmonics.thd_percent, source.thd_percent); \
+    for (data_harmonic_idx = 0; data_harmonic_idx < DATA_NUMBER_OF_HARMONICS; data_harmonic_idx++) { \
+        DATA_add_accumulated_sample(harmonics.odd_harmonic_percent[data_harmonic_idx], source.odd_harmonic_percent[data_harmonic_idx]); \
     } \
 }
 
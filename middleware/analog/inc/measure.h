@@ -29,6 +29,8 @@
 
 #define MEASURE_PERIOD_BUFFER_SIZE          (MEASURE_MAINS_PERIOD_US / MEASURE_ACV_ACI_SAMPLING_PERIOD_US)
 
+#define MEASURE_CAPTURE_NUMBER_OF_PERIODS_MAX   4
+
 /*** MEASURE global variables ***/
 
 extern const uint8_t MEASURE_SCT013_ATTEN[MEASURE_NUMBER_OF_ACI_CHANNELS];
@@ -46,6 +48,11 @@ typedef enum {
     MEASURE_ERROR_STATE,
     MEASURE_ERROR_DATA_TYPE,
     MEASURE_ERROR_AC_CHANNEL,
+    MEASURE_ERROR_HARMONICS_SIGNAL,
+    MEASURE_ERROR_HARMONICS_FFT,
+    MEASURE_ERROR_CAPTURE_NUMBER_OF_PERIODS,
+    MEASURE_ERROR_CAPTURE_STATE,
+    MEASURE_ERROR_CAPTURE_SAMPLE_INDEX,
     // Low level drivers errors.
     MEASURE_ERROR_BASE_ADC = ERROR_BASE_STEP,
     MEASURE_ERROR_BASE_DMA_ACV_SAMPLING = (MEASURE_ERROR_BASE_ADC + ADC_ERROR_BASE_LAST),
@@ -82,6 +89,43 @@ typedef enum {
     MEASURE_DATA_INDEX_LAST
 } MEASURE_data_index_t;
 
+/*!******************************************************************
+ * \enum MEASURE_harmonics_signal_t
+ * \brief MEASURE harmonics analysis signals list.
+ *******************************************************************/
+typedef enum {
+    MEASURE_HARMONICS_SIGNAL_ACV = 0,
+    MEASURE_HARMONICS_SIGNAL_ACI1,
+    MEASURE_HARMONICS_SIGNAL_ACI2,
+    MEASURE_HARMONICS_SIGNAL_ACI3,
+    MEASURE_HARMONICS_SIGNAL_ACI4,
+    MEASURE_HARMONICS_SIGNAL_LAST
+} MEASURE_harmonics_signal_t;
+
+/*!******************************************************************
+ * \enum MEASURE_capture_state_t
+ * \brief MEASURE waveform capture states list.
+ *******************************************************************/
+typedef enum {
+    MEASURE_CAPTURE_STATE_IDLE = 0,
+    MEASURE_CAPTURE_STATE_RUNNING,
+    MEASURE_CAPTURE_STATE_DONE,
+    MEASURE_CAPTURE_STATE_LAST
+} MEASURE_capture_state_t;
+
+/*!******************************************************************
+ * \struct MEASURE_pipeline_statistics_t
+ * \brief MEASURE deferred processing statistics.
+ *******************************************************************/
+typedef struct {
+    uint32_t processed_period_count;
+    uint32_t dropped_period_count;
+    uint8_t backlog;
+    uint8_t backlog_max;
+    uint32_t period_cycles_last;
+    uint32_t period_cycles_max;
+} MEASURE_pipeline_statistics_t;
+
 /*** MEASURE functions ***/
 
 /*!******************************************************************
@@ -132,6 +176,64 @@ MEASURE_status_t MEASURE_set_gains(uint16_t transformer_gain, uint16_t current_s
 MEASURE_status_t MEASURE_tick_second(void);
 #endif
 
+#ifdef MPMCM_ANALOG_MEASURE_ENABLE
+/*!******************************************************************
+ * \fn MEASURE_status_t MEASURE_process(void)
+ * \brief Process the mains periods captured under interrupt.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MEASURE_status_t MEASURE_process(void);
+#endif
+
+#ifdef MPMCM_ANALOG_MEASURE_ENABLE
+/*!******************************************************************
+ * \fn MEASURE_status_t MEASURE_get_pipeline_statistics(MEASURE_pipeline_statistics_t* pipeline_statistics)
+ * \brief Get deferred processing statistics.
+ * \param[in]   none
+ * \param[out]  pipeline_statistics: Pointer to the processing statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+MEASURE_status_t MEASURE_get_pipeline_statistics(MEASURE_pipeline_statistics_t* pipeline_statistics);
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+/*!******************************************************************
+ * \fn MEASURE_status_t MEASURE_start_capture(uint8_t channel, uint8_t number_of_periods)
+ * \brief Start raw waveform capture of the mains voltage and one AC channel current.
+ * \param[in]   channel: AC channel index to capture.
+ * \param[in]   number_of_periods: Number of complete mains periods to capture.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MEASURE_status_t MEASURE_start_capture(uint8_t channel, uint8_t number_of_periods);
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+/*!******************************************************************
+ * \fn MEASURE_status_t MEASURE_get_capture_state(MEASURE_capture_state_t* capture_state, uint16_t* number_of_samples)
+ * \brief Get raw waveform capture state.
+ * \param[in]   none
+ * \param[out]  capture_state: Pointer to the capture state.
+ * \param[out]  number_of_samples: Pointer to the number of captured samples per signal.
+ * \retval      Function execution status.
+ *******************************************************************/
+MEASURE_status_t MEASURE_get_capture_state(MEASURE_capture_state_t* capture_state, uint16_t* number_of_samples);
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+/*!******************************************************************
+ * \fn MEASURE_status_t MEASURE_read_capture(uint16_t sample_index, int16_t* acv_sample, int16_t* aci_sample)
+ * \brief Read raw waveform capture samples.
+ * \param[in]   sample_index: Index of the sample to read.
+ * \param[out]  acv_sample: Pointer to the raw voltage sample.
+ * \param[out]  aci_sample: Pointer to the raw current sample.
+ * \retval      Function execution status.
+ *******************************************************************/
+MEASURE_status_t MEASURE_read_capture(uint16_t sample_index, int16_t* acv_sample, int16_t* aci_sample);
+#endif
+
 /*!******************************************************************
  * \fn MEASURE_status_t MEASURE_get_probe_detect_flag(uint8_t channel_index, uint8_t* current_probe_connected)
  * \brief Get AC channel detect flag.
@@ -186,6 +288,28 @@ MEASURE_status_t MEASURE_get_channel_run_data(uint8_t channel, DATA_run_channel_
  *******************************************************************/
 MEASURE_status_t MEASURE_get_channel_accumulated_data(uint8_t channel, DATA_accumulated_channel_t* channel_accumulated_data);
 
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*!******************************************************************
+ * \fn MEASURE_status_t MEASURE_get_harmonics_run_data(MEASURE_harmonics_signal_t signal, DATA_run_harmonics_t* harmonics_run_data)
+ * \brief Get harmonics run data.
+ * \param[in]   signal: Signal to read.
+ * \param[out]  harmonics_run_data: Pointer to the harmonics results.
+ * \retval      Function execution status.
+ *******************************************************************/
+MEASURE_status_t MEASURE_get_harmonics_run_data(MEASURE_harmonics_signal_t signal, DATA_run_harmonics_t* harmonics_run_data);
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*!******************************************************************
+ * \fn MEASURE_status_t MEASURE_get_harmonics_accumulated_data(MEASURE_harmonics_signal_t signal, DATA_accumulated_harmonics_t* harmonics_accumulated_data)
+ * \brief Get harmonics accumulated data.
+ * \param[in]   signal: Signal to read.
+ * \param[out]  harmonics_accumulated_data: Pointer to the harmonics results.
+ * \retval      Function execution status.
+ *******************************************************************/
+MEASURE_status_t MEASURE_get_harmonics_accumulated_data(MEASURE_harmonics_signal_t signal, DATA_accumulated_harmonics_t* harmonics_accumulated_data);
+#endif
+
 /*******************************************************************/
 #define MEASURE_exit_error(base) { ERROR_check_exit(measure_status, MEASURE_SUCCESS, base) }
 
@@ -18,7 +18,10 @@
 #include "dmamux.h"
 #include "dsm_flags.h"
 #include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/fast_math_functions.h"
 #include "dsp/statistics_functions.h"
+#include "dsp/transform_functions.h"
 #include "error.h"
 #include "error_base.h"
 #include "exti.h"
@@ -53,9 +56,17 @@
 #define MEASURE_PERIOD_PER_BUFFER                       2
 #define MEASURE_PERIOD_ADCX_BUFFER_SIZE                 (MEASURE_PERIOD_PER_BUFFER * MEASURE_PERIOD_BUFFER_SIZE)
 #define MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE             (MEASURE_NUMBER_OF_ACI_CHANNELS * MEASURE_PERIOD_ADCX_BUFFER_SIZE)
-#define MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH            2
+// Note: one buffer is always filled by the DMA while the others hold complete periods waiting for processing.
+#define MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH            3
 #define MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE             3
 
+// Note: circular buffer size must be a power of 2 and a multiple of the number of channels.
+// 2048 samples give 512 samples per channel (about 5 mains periods).
+#define MEASURE_CIRCULAR_ADCX_DMA_BUFFER_SIZE           2048
+#define MEASURE_CIRCULAR_ADCX_DMA_BUFFER_MASK           (MEASURE_CIRCULAR_ADCX_DMA_BUFFER_SIZE - 1)
+// Mains is considered lost when the circular buffer wraps this number of times without zero cross.
+#define MEASURE_CIRCULAR_ADCX_DMA_TC_WITHOUT_ZERO_CROSS_MAX 2
+
 // Wait for 1 second of sampling before computing run and accumulated data.
 #define MEASURE_SAMPLED_PERIOD_START_THRESHOLD          (MATH_POWER_10[6] / MEASURE_MAINS_PERIOD_US)
 
@@ -64,31 +75,70 @@
 #define MEASURE_PERIOD_ADCX_BUFFER_SIZE_ERROR_PERCENT   20
 
 #define MEASURE_POWER_FACTOR_MULTIPLIER                 100
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+#define MEASURE_RADIANS_TO_DEGREES                      (180.0 / 3.14159265358979)
+#endif
 
 #define MEASURE_LED_PULSE_DURATION_MS                   50
 #define MEASURE_LED_PULSE_PERIOD_SECONDS                5
 
 #define MEASURE_ANALOG_POWER_DELAY_SECONDS              1
 
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+// Note: capture buffer includes the same margin as the period buffer size check.
+#define MEASURE_CAPTURE_BUFFER_SIZE                     ((MEASURE_CAPTURE_NUMBER_OF_PERIODS_MAX * (100 + MEASURE_PERIOD_ADCX_BUFFER_SIZE_ERROR_PERCENT) * MEASURE_PERIOD_BUFFER_SIZE) / (100))
+#endif
+
+// Note: one period is resampled on the FFT size so that harmonic of rank k is located in bin k.
+#define MEASURE_HARMONICS_FFT_SIZE                      128
+#define MEASURE_HARMONICS_THD_RANK_MAX                  40
+// Harmonics are not computed when the fundamental amplitude is below this value (unit ADC LSB).
+#define MEASURE_HARMONICS_FUNDAMENTAL_AMPLITUDE_MIN     10
+
 #define MEASURE_MAINS_DETECT_PERIOD_SECONDS             30
 #define MEASURE_MAINS_DETECT_TIMEOUT_SECONDS            2
 
-/*** MEASURE static functions declaration ***/
-
-#ifdef MPMCM_ANALOG_MEASURE_ENABLE
-static MEASURE_status_t _MEASURE_internal_process(void);
+#ifdef MPMCM_ANALOG_CYCLE_COUNT
+// Note: Cortex-M4 core debug registers are not part of the peripherals registers definition.
+#define MEASURE_CORE_DEMCR                              (*((volatile uint32_t*) 0xE000EDFC))
+#define MEASURE_CORE_DWT_CTRL                           (*((volatile uint32_t*) 0xE0001000))
+#define MEASURE_CORE_DWT_CYCCNT                         (*((volatile uint32_t*) 0xE0001004))
 #endif
 
 /*** MEASURE local structures ***/
 
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+/*******************************************************************/
+typedef struct {
+    uint32_t position;
+    uint16_t size;
+} MEASURE_period_t;
+#else
 /*******************************************************************/
 typedef struct {
     int16_t data[MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE];
     uint16_t size;
 } MEASURE_buffer_t;
+#endif
 
 /*******************************************************************/
 typedef struct {
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+    // Raw circular buffers continuously filled by ADC and DMA.
+    int16_t acv_data[MEASURE_CIRCULAR_ADCX_DMA_BUFFER_SIZE];
+    int16_t aci_data[MEASURE_CIRCULAR_ADCX_DMA_BUFFER_SIZE];
+    // Absolute position of the period being sampled.
+    uint32_t acv_position;
+    uint32_t aci_position;
+    uint8_t tc_without_zero_cross_count;
+    // Periods boundaries in the circular buffers.
+    MEASURE_period_t acv[MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH];
+    uint8_t acv_read_idx;
+    uint8_t acv_write_idx;
+    MEASURE_period_t aci[MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH];
+    uint8_t aci_read_idx;
+    uint8_t aci_write_idx;
+#else
     // Raw buffers filled by ADC and DMA for 1 period.
     MEASURE_buffer_t acv[MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH];
     uint8_t acv_read_idx;
@@ -96,8 +146,14 @@ typedef struct {
     MEASURE_buffer_t aci[MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH];
     uint8_t aci_read_idx;
     uint8_t aci_write_idx;
+#endif
     // Raw buffer filled by timer and DMA.
     uint32_t acv_frequency_capture[MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE];
+    // Frequency captures saved at the end of each period.
+    uint32_t acv_frequency_capture_period[MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH][MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE];
+    // Periods queue (written under interrupt, read by the deferred processing).
+    uint32_t period_write_count;
+    uint32_t period_read_count;
 } MEASURE_sampling_t;
 
 /*******************************************************************/
@@ -110,9 +166,14 @@ typedef struct {
     float64_t acp_factor_num[MEASURE_NUMBER_OF_ACI_CHANNELS];
     float64_t acp_factor_den;
     // Temporary variables for individual channel processing on 1 period.
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+    q15_t period_acvx_buffer_q15[MEASURE_PERIOD_ADCX_BUFFER_SIZE];
+    q15_t period_acix_buffer_q15[MEASURE_PERIOD_ADCX_BUFFER_SIZE];
+#else
     float32_t period_acvx_buffer_f32[MEASURE_PERIOD_ADCX_BUFFER_SIZE];
     float32_t period_acix_buffer_f32[MEASURE_PERIOD_ADCX_BUFFER_SIZE];
     float32_t period_acpx_buffer_f32[MEASURE_PERIOD_ADCX_BUFFER_SIZE];
+#endif
     uint32_t period_acxx_buffer_size;
     uint32_t period_acxx_buffer_size_low_limit;
     uint32_t period_acxx_buffer_size_high_limit;
@@ -121,18 +182,48 @@ typedef struct {
     float32_t period_rms_current_f32;
     float32_t period_apparent_power_f32;
     float32_t period_power_factor_f32;
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    float32_t period_reactive_power_f32;
+#endif
     // AC channels results.
-    DATA_run_channel_t chx_rolling_mean[MEASURE_NUMBER_OF_ACI_CHANNELS];
+    DATA_run_sum_channel_t chx_run_sum[MEASURE_NUMBER_OF_ACI_CHANNELS];
     DATA_run_channel_t chx_run_data[MEASURE_NUMBER_OF_ACI_CHANNELS];
     DATA_accumulated_channel_t chx_accumulated_data[MEASURE_NUMBER_OF_ACI_CHANNELS];
     DATA_run_t active_energy_mws_sum[MEASURE_NUMBER_OF_ACI_CHANNELS];
     DATA_run_t apparent_energy_mvas_sum[MEASURE_NUMBER_OF_ACI_CHANNELS];
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    DATA_run_t reactive_energy_mvars_sum[MEASURE_NUMBER_OF_ACI_CHANNELS];
+#endif
     // Mains frequency.
-    DATA_run_t acv_frequency_rolling_mean;
+    DATA_run_sum_t acv_frequency_run_sum;
     DATA_run_t acv_frequency_run_data;
     DATA_accumulated_t acv_frequency_accumulated_data;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    // Harmonics analysis.
+    arm_rfft_fast_instance_f32 harmonics_rfft;
+    float32_t harmonics_input_buffer_f32[MEASURE_HARMONICS_FFT_SIZE];
+    float32_t harmonics_spectrum_buffer_f32[MEASURE_HARMONICS_FFT_SIZE];
+    float32_t harmonics_magnitude_buffer_f32[MEASURE_HARMONICS_THD_RANK_MAX];
+    DATA_run_sum_harmonics_t harmonics_run_sum[MEASURE_HARMONICS_SIGNAL_LAST];
+    DATA_run_harmonics_t harmonics_run_data[MEASURE_HARMONICS_SIGNAL_LAST];
+    DATA_accumulated_harmonics_t harmonics_accumulated_data[MEASURE_HARMONICS_SIGNAL_LAST];
+#endif
 } MEASURE_data_t;
 
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+/*******************************************************************/
+typedef struct {
+    MEASURE_capture_state_t state;
+    uint8_t channel;
+    uint8_t number_of_periods;
+    uint8_t period_count;
+    uint16_t number_of_samples;
+    // Raw samples of the voltage and the selected channel current.
+    int16_t acv_data[MEASURE_CAPTURE_BUFFER_SIZE];
+    int16_t aci_data[MEASURE_CAPTURE_BUFFER_SIZE];
+} MEASURE_capture_t;
+#endif
+
 /*******************************************************************/
 typedef struct {
     MEASURE_state_t state;
@@ -146,6 +237,15 @@ typedef struct {
     uint32_t mains_detect_next_time_seconds;
     uint32_t analog_power_delay_start_time_seconds;
     uint32_t mains_detect_start_time_second;
+    // Deferred processing statistics.
+    uint32_t processed_period_count;
+    uint32_t dropped_period_count;
+    uint8_t backlog_max;
+    uint32_t period_cycles_last;
+    uint32_t period_cycles_max;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    MEASURE_harmonics_signal_t harmonics_signal;
+#endif
 #ifdef MPMCM_ANALOG_SIMULATION
     uint8_t random_divider;
 #endif
@@ -183,36 +283,27 @@ static const GPIO_pin_t* const MEASURE_GPIO_ACI_DETECT[MEASURE_NUMBER_OF_ACI_CHA
 static volatile MEASURE_sampling_t measure_sampling;
 static volatile MEASURE_data_t measure_data __attribute__((section(".bss_ccmsram")));
 static volatile MEASURE_context_t measure_ctx;
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+static volatile MEASURE_capture_t measure_capture;
+#endif
 
 /*** MEASURE local functions ***/
 
-#ifdef MPMCM_ANALOG_MEASURE_ENABLE
-/*******************************************************************/
-static void _MEASURE_increment_zero_cross_count(void) {
-    // Local variables.
-    MEASURE_status_t measure_status = MEASURE_SUCCESS;
-    // Increment counts.
-    measure_ctx.zero_cross_count++;
-    // Process measure.
-    if (measure_ctx.state == MEASURE_STATE_ACTIVE) {
-        measure_status = _MEASURE_internal_process();
-        MEASURE_stack_error(ERROR_BASE_MEASURE);
-    }
-}
-#endif
-
 #ifdef MPMCM_ANALOG_MEASURE_ENABLE
 /*******************************************************************/
 static void _MEASURE_set_dma_transfer_end_flag(void) {
-    // Local variables.
-    MEASURE_status_t measure_status = MEASURE_SUCCESS;
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+    // Circular buffer wrapped: check if zero cross occured since last wrap.
+    measure_sampling.tc_without_zero_cross_count++;
+    if (measure_sampling.tc_without_zero_cross_count < MEASURE_CIRCULAR_ADCX_DMA_TC_WITHOUT_ZERO_CROSS_MAX) goto end;
+#endif
     // Set local flag.
+    // Note: the measure is stopped by the deferred processing.
     measure_ctx.dma_transfer_end_flag = 1;
-    // Process measure.
-    if (measure_ctx.state == MEASURE_STATE_ACTIVE) {
-        measure_status = _MEASURE_internal_process();
-        MEASURE_stack_error(ERROR_BASE_MEASURE);
-    }
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+end:
+    return;
+#endif
 }
 #endif
 
@@ -220,6 +311,9 @@ static void _MEASURE_set_dma_transfer_end_flag(void) {
 static void _MEASURE_reset(void) {
     // Local variables.
     uint8_t chx_idx = 0;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    uint8_t signal_idx = 0;
+#endif
     uint32_t idx0 = 0;
     uint32_t idx1 = 0;
     // Reset indexes.
@@ -227,6 +321,13 @@ static void _MEASURE_reset(void) {
     measure_sampling.acv_read_idx = 0;
     measure_sampling.aci_write_idx = 0;
     measure_sampling.aci_read_idx = 0;
+    measure_sampling.period_write_count = 0;
+    measure_sampling.period_read_count = 0;
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+    measure_sampling.acv_position = 0;
+    measure_sampling.aci_position = 0;
+    measure_sampling.tc_without_zero_cross_count = 0;
+#endif
     // Reset flags.
     measure_ctx.processing_enable = 0;
     measure_ctx.zero_cross_count = 0;
@@ -234,32 +335,56 @@ static void _MEASURE_reset(void) {
     measure_ctx.sampled_period_count = 0;
     measure_ctx.period_compute_enable = 0;
     measure_ctx.tick_led_seconds_count = 0;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    measure_ctx.harmonics_signal = MEASURE_HARMONICS_SIGNAL_ACV;
+#endif
 #ifdef MPMCM_ANALOG_SIMULATION
     measure_ctx.random_divider = 1;
 #endif
     // Reset sampling buffers.
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+    for (idx1 = 0; idx1 < MEASURE_CIRCULAR_ADCX_DMA_BUFFER_SIZE; idx1++) {
+        measure_sampling.acv_data[idx1] = 0;
+        measure_sampling.aci_data[idx1] = 0;
+    }
+#else
     for (idx0 = 0; idx0 < MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH; idx0++) {
         for (idx1 = 0; idx1 < MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE; idx1++) {
             measure_sampling.acv[idx0].data[idx1] = 0;
             measure_sampling.aci[idx0].data[idx1] = 0;
         }
     }
+#endif
     // Reset channels data.
     for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
         // Clear all data.
-        DATA_reset_run_channel(measure_data.chx_rolling_mean[chx_idx]);
+        DATA_reset_run_sum_channel(measure_data.chx_run_sum[chx_idx]);
         DATA_reset_run_channel(measure_data.chx_run_data[chx_idx]);
         DATA_reset_accumulated_channel(measure_data.chx_accumulated_data[chx_idx]);
         DATA_reset_run(measure_data.active_energy_mws_sum[chx_idx]);
         DATA_reset_run(measure_data.apparent_energy_mvas_sum[chx_idx]);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        DATA_reset_run(measure_data.reactive_energy_mvars_sum[chx_idx]);
+#endif
     }
     // Reset frequency data.
-    DATA_reset_run(measure_data.acv_frequency_rolling_mean);
+    DATA_reset_run_sum(measure_data.acv_frequency_run_sum);
     DATA_reset_run(measure_data.acv_frequency_run_data);
     DATA_reset_accumulated(measure_data.acv_frequency_accumulated_data);
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    // Reset harmonics data.
+    for (signal_idx = 0; signal_idx < MEASURE_HARMONICS_SIGNAL_LAST; signal_idx++) {
+        DATA_reset_run_sum_harmonics(measure_data.harmonics_run_sum[signal_idx]);
+        DATA_reset_run_harmonics(measure_data.harmonics_run_data[signal_idx]);
+        DATA_reset_accumulated_harmonics(measure_data.harmonics_accumulated_data[signal_idx]);
+    }
+#endif
     // Reset sampling buffers.
     for (idx1 = 0; idx1 < MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE; idx1++) {
         measure_sampling.acv_frequency_capture[idx1] = 0;
+        for (idx0 = 0; idx0 < MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH; idx0++) {
+            measure_sampling.acv_frequency_capture_period[idx0][idx1] = 0;
+        }
     }
 }
 
@@ -339,11 +464,17 @@ static MEASURE_status_t _MEASURE_start(void) {
     dma_config.direction = DMA_DIRECTION_PERIPHERAL_TO_MEMORY;
     dma_config.flags.all = 0;
     dma_config.flags.memory_increment = 1;
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+    dma_config.flags.circular_mode = 1;
+    dma_config.memory_address = (uint32_t) &(measure_sampling.acv_data);
+    dma_config.number_of_data = MEASURE_CIRCULAR_ADCX_DMA_BUFFER_SIZE;
+#else
     dma_config.memory_address = (uint32_t) &(measure_sampling.acv[measure_sampling.acv_write_idx].data);
+    dma_config.number_of_data = MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE;
+#endif
     dma_config.memory_data_size = DMA_DATA_SIZE_16_BITS;
     dma_config.peripheral_address = ADC_get_master_dr_register_address(ADC_INSTANCE_ACX_SAMPLING);
     dma_config.peripheral_data_size = DMA_DATA_SIZE_16_BITS;
-    dma_config.number_of_data = MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE;
     dma_config.priority = DMA_PRIORITY_VERY_HIGH;
     dma_config.request_id = DMAMUX_PERIPHERAL_REQUEST_ADC1;
     dma_config.tc_irq_callback = &_MEASURE_set_dma_transfer_end_flag;
@@ -351,9 +482,14 @@ static MEASURE_status_t _MEASURE_start(void) {
     dma_status = DMA_init(DMA_INSTANCE_ACV_SAMPLING, DMA_CHANNEL_ACV_SAMPLING, &dma_config);
     DMA_exit_error(MEASURE_ERROR_BASE_DMA_ACV_SAMPLING);
     // Init DMA for slave ADC.
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+    // Note: mains loss is only checked on master DMA transfer complete event.
+    dma_config.memory_address = (uint32_t) &(measure_sampling.aci_data);
+    dma_config.tc_irq_callback = NULL;
+#else
     dma_config.memory_address = (uint32_t) &(measure_sampling.aci[measure_sampling.aci_write_idx].data);
+#endif
     dma_config.peripheral_address = ADC_get_slave_dr_register_address(ADC_INSTANCE_ACX_SAMPLING);
-    dma_config.number_of_data = MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE;
     dma_config.priority = DMA_PRIORITY_HIGH;
     dma_config.request_id = DMAMUX_PERIPHERAL_REQUEST_ADC2;
     dma_config.nvic_priority = NVIC_PRIORITY_DMA_ACI_SAMPLING;
@@ -475,12 +611,14 @@ static void _MEASURE_power_off(void) {
 }
 #endif
 
-#ifdef MPMCM_ANALOG_MEASURE_ENABLE
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && !(defined MPMCM_ANALOG_CIRCULAR_DMA))
 /*******************************************************************/
 static MEASURE_status_t _MEASURE_switch_dma_buffer(void) {
     // Local variables.
     MEASURE_status_t status = MEASURE_SUCCESS;
     DMA_status_t dma_status = DMA_SUCCESS;
+    uint32_t backlog = 0;
+    uint8_t idx = 0;
     // Stop ADC and DMA.
     status = _MEASURE_stop_analog_transfer();
     if (status != MEASURE_SUCCESS) goto errors;
@@ -489,9 +627,28 @@ static MEASURE_status_t _MEASURE_switch_dma_buffer(void) {
     DMA_stack_error(ERROR_BASE_MEASURE + MEASURE_ERROR_BASE_DMA_ACV_SAMPLING);
     dma_status = DMA_get_number_of_transfered_data(DMA_INSTANCE_ACI_SAMPLING, DMA_CHANNEL_ACI_SAMPLING, (uint16_t*) &(measure_sampling.aci[measure_sampling.aci_write_idx].size));
     DMA_stack_error(ERROR_BASE_MEASURE + MEASURE_ERROR_BASE_DMA_ACI_SAMPLING);
-    // Update write indexes.
-    measure_sampling.acv_write_idx = ((measure_sampling.acv_write_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
-    measure_sampling.aci_write_idx = ((measure_sampling.aci_write_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
+    // Save frequency captures of the period.
+    for (idx = 0; idx < MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE; idx++) {
+        measure_sampling.acv_frequency_capture_period[measure_sampling.acv_write_idx][idx] = measure_sampling.acv_frequency_capture[idx];
+    }
+    // Check if a free buffer is available.
+    backlog = (measure_sampling.period_write_count - measure_sampling.period_read_count);
+    if (backlog < (MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH - 1)) {
+        // Push period in queue.
+        measure_sampling.period_write_count++;
+        backlog++;
+        // Update write indexes.
+        measure_sampling.acv_write_idx = ((measure_sampling.acv_write_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
+        measure_sampling.aci_write_idx = ((measure_sampling.aci_write_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
+    }
+    else {
+        // Processing is late: current buffer is overwritten by the next period.
+        measure_ctx.dropped_period_count++;
+    }
+    // Update statistics.
+    if (backlog > measure_ctx.backlog_max) {
+        measure_ctx.backlog_max = (uint8_t) backlog;
+    }
     // Set new address.
     dma_status = DMA_set_memory_address(DMA_INSTANCE_ACV_SAMPLING, DMA_CHANNEL_ACV_SAMPLING, (uint32_t) &(measure_sampling.acv[measure_sampling.acv_write_idx].data), MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE);
     DMA_stack_error(ERROR_BASE_MEASURE + MEASURE_ERROR_BASE_DMA_ACV_SAMPLING);
@@ -504,25 +661,226 @@ errors:
 }
 #endif
 
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CIRCULAR_DMA))
+/*******************************************************************/
+static MEASURE_status_t _MEASURE_set_period_boundary(void) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    DMA_status_t dma_status = DMA_SUCCESS;
+    uint16_t acv_dma_position = 0;
+    uint16_t aci_dma_position = 0;
+    uint32_t acv_period_size = 0;
+    uint32_t aci_period_size = 0;
+    uint32_t backlog = 0;
+    uint8_t idx = 0;
+    // Read current DMA positions.
+    dma_status = DMA_get_number_of_transfered_data(DMA_INSTANCE_ACV_SAMPLING, DMA_CHANNEL_ACV_SAMPLING, &acv_dma_position);
+    DMA_exit_error(MEASURE_ERROR_BASE_DMA_ACV_SAMPLING);
+    dma_status = DMA_get_number_of_transfered_data(DMA_INSTANCE_ACI_SAMPLING, DMA_CHANNEL_ACI_SAMPLING, &aci_dma_position);
+    DMA_exit_error(MEASURE_ERROR_BASE_DMA_ACI_SAMPLING);
+    // Align boundaries on the start of the ADC sequence.
+    acv_dma_position -= (acv_dma_position % MEASURE_NUMBER_OF_ACI_CHANNELS);
+    aci_dma_position -= (aci_dma_position % MEASURE_NUMBER_OF_ACI_CHANNELS);
+    // Compute period sizes.
+    // Note: the circular buffer is longer than the maximum period duration, so the modulo gives the number of samples since the previous boundary.
+    acv_period_size = ((((uint32_t) acv_dma_position) - measure_sampling.acv_position) & MEASURE_CIRCULAR_ADCX_DMA_BUFFER_MASK);
+    aci_period_size = ((((uint32_t) aci_dma_position) - measure_sampling.aci_position) & MEASURE_CIRCULAR_ADCX_DMA_BUFFER_MASK);
+    // Fill period descriptors.
+    measure_sampling.acv[measure_sampling.acv_write_idx].position = measure_sampling.acv_position;
+    measure_sampling.acv[measure_sampling.acv_write_idx].size = (uint16_t) acv_period_size;
+    measure_sampling.aci[measure_sampling.aci_write_idx].position = measure_sampling.aci_position;
+    measure_sampling.aci[measure_sampling.aci_write_idx].size = (uint16_t) aci_period_size;
+    // Save frequency captures of the period.
+    for (idx = 0; idx < MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE; idx++) {
+        measure_sampling.acv_frequency_capture_period[measure_sampling.acv_write_idx][idx] = measure_sampling.acv_frequency_capture[idx];
+    }
+    // Next period starts at current boundary.
+    measure_sampling.acv_position += acv_period_size;
+    measure_sampling.aci_position += aci_period_size;
+    measure_sampling.tc_without_zero_cross_count = 0;
+    // Check if a free descriptor is available.
+    backlog = (measure_sampling.period_write_count - measure_sampling.period_read_count);
+    if (backlog < (MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH - 1)) {
+        // Push period in queue.
+        measure_sampling.period_write_count++;
+        backlog++;
+        // Update write indexes.
+        measure_sampling.acv_write_idx = ((measure_sampling.acv_write_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
+        measure_sampling.aci_write_idx = ((measure_sampling.aci_write_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
+    }
+    else {
+        // Processing is late: period is skipped.
+        measure_ctx.dropped_period_count++;
+    }
+    // Update statistics.
+    if (backlog > measure_ctx.backlog_max) {
+        measure_ctx.backlog_max = (uint8_t) backlog;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_MEASURE_ENABLE
+/*******************************************************************/
+static void _MEASURE_increment_zero_cross_count(void) {
+    // Local variables.
+    MEASURE_status_t measure_status = MEASURE_SUCCESS;
+    // Increment counts.
+    measure_ctx.zero_cross_count++;
+    // Check state and zero cross count.
+    if ((measure_ctx.state == MEASURE_STATE_ACTIVE) && (measure_ctx.processing_enable != 0) && (measure_ctx.zero_cross_count >= MEASURE_ZERO_CROSS_PER_PERIOD)) {
+        // Clear counters.
+        measure_ctx.zero_cross_count = 0;
+        measure_ctx.dma_transfer_end_flag = 0;
+        // Note: period data is computed later by the MEASURE_process() function.
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+        // Mark period end in circular buffers.
+        measure_status = _MEASURE_set_period_boundary();
+#else
+        // Switch to next buffer.
+        measure_status = _MEASURE_switch_dma_buffer();
+#endif
+        MEASURE_stack_error(ERROR_BASE_MEASURE);
+    }
+}
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_HARMONICS_ENABLE))
+/*******************************************************************/
+static void _MEASURE_compute_harmonics(MEASURE_harmonics_signal_t signal) {
+    // Local variables.
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+    volatile q15_t* period_buffer = (signal == MEASURE_HARMONICS_SIGNAL_ACV) ? measure_data.period_acvx_buffer_q15 : measure_data.period_acix_buffer_q15;
+#else
+    volatile float32_t* period_buffer = (signal == MEASURE_HARMONICS_SIGNAL_ACV) ? measure_data.period_acvx_buffer_f32 : measure_data.period_acix_buffer_f32;
+#endif
+    float32_t position = 0.0;
+    float32_t position_step = 0.0;
+    float32_t fraction = 0.0;
+    float32_t sample = 0.0;
+    float32_t next_sample = 0.0;
+    float32_t fundamental_square = 0.0;
+    float32_t fundamental_square_min = 0.0;
+    float32_t distortion_square = 0.0;
+    float32_t ratio = 0.0;
+    uint32_t sample_idx = 0;
+    uint32_t idx = 0;
+    uint8_t harmonic_idx = 0;
+    uint8_t rank = 0;
+    // Resample exactly one period on the FFT size with linear interpolation.
+    position_step = ((float32_t) measure_data.period_acxx_buffer_size) / ((float32_t) MEASURE_HARMONICS_FFT_SIZE);
+    for (idx = 0; idx < MEASURE_HARMONICS_FFT_SIZE; idx++) {
+        sample_idx = (uint32_t) position;
+        fraction = position - ((float32_t) sample_idx);
+        sample = (float32_t) period_buffer[sample_idx];
+        // Note: the signal is periodic so the last point is interpolated with the first sample.
+        next_sample = (float32_t) period_buffer[(sample_idx + 1) % measure_data.period_acxx_buffer_size];
+        measure_data.harmonics_input_buffer_f32[idx] = sample + (fraction * (next_sample - sample));
+        position += position_step;
+    }
+    // Real FFT.
+    arm_rfft_fast_f32((arm_rfft_fast_instance_f32*) &(measure_data.harmonics_rfft), (float32_t*) measure_data.harmonics_input_buffer_f32, (float32_t*) measure_data.harmonics_spectrum_buffer_f32, 0);
+    // Squared magnitudes of ranks 1 to THD maximum rank.
+    // Note: first complex value of the output buffer packs the DC and Nyquist components.
+    arm_cmplx_mag_squared_f32((float32_t*) &(measure_data.harmonics_spectrum_buffer_f32[2]), (float32_t*) measure_data.harmonics_magnitude_buffer_f32, MEASURE_HARMONICS_THD_RANK_MAX);
+    // Check fundamental amplitude (magnitude of a sine wave of amplitude A is A * N / 2).
+    fundamental_square = measure_data.harmonics_magnitude_buffer_f32[0];
+    fundamental_square_min = (float32_t) ((MEASURE_HARMONICS_FUNDAMENTAL_AMPLITUDE_MIN * MEASURE_HARMONICS_FFT_SIZE) / 2);
+    fundamental_square_min *= fundamental_square_min;
+    if (fundamental_square < fundamental_square_min) goto errors;
+    // Total harmonic distortion.
+    for (idx = 1; idx < MEASURE_HARMONICS_THD_RANK_MAX; idx++) {
+        distortion_square += measure_data.harmonics_magnitude_buffer_f32[idx];
+    }
+    arm_sqrt_f32((distortion_square / fundamental_square), &ratio);
+    DATA_add_run_sample(measure_data.harmonics_run_sum[signal].thd_percent, (ratio * ((float32_t) 100.0)));
+    // Odd harmonics.
+    for (harmonic_idx = 0; harmonic_idx < DATA_NUMBER_OF_HARMONICS; harmonic_idx++) {
+        rank = (3 + (harmonic_idx << 1));
+        arm_sqrt_f32((measure_data.harmonics_magnitude_buffer_f32[rank - 1] / fundamental_square), &ratio);
+        DATA_add_run_sample(measure_data.harmonics_run_sum[signal].odd_harmonic_percent[harmonic_idx], (ratio * ((float32_t) 100.0)));
+    }
+errors:
+    return;
+}
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_REACTIVE_POWER_ENABLE))
+/*******************************************************************/
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+static q63_t _MEASURE_compute_shifted_dot_product(uint32_t shift) {
+    // Local variables.
+    q63_t dot_product = 0;
+    q63_t temp_q63 = 0;
+    // Current is circularly shifted since the buffer contains exactly one period.
+    arm_dot_prod_q15((q15_t*) &(measure_data.period_acvx_buffer_q15[0]), (q15_t*) &(measure_data.period_acix_buffer_q15[shift]), (measure_data.period_acxx_buffer_size - shift), &dot_product);
+    arm_dot_prod_q15((q15_t*) &(measure_data.period_acvx_buffer_q15[measure_data.period_acxx_buffer_size - shift]), (q15_t*) &(measure_data.period_acix_buffer_q15[0]), shift, &temp_q63);
+    return (dot_product + temp_q63);
+}
+#else
+static float32_t _MEASURE_compute_shifted_dot_product(uint32_t shift) {
+    // Local variables.
+    float32_t dot_product = 0.0;
+    float32_t temp_f32 = 0.0;
+    // Current is circularly shifted since the buffer contains exactly one period.
+    arm_dot_prod_f32((float32_t*) &(measure_data.period_acvx_buffer_f32[0]), (float32_t*) &(measure_data.period_acix_buffer_f32[shift]), (measure_data.period_acxx_buffer_size - shift), &dot_product);
+    arm_dot_prod_f32((float32_t*) &(measure_data.period_acvx_buffer_f32[measure_data.period_acxx_buffer_size - shift]), (float32_t*) &(measure_data.period_acix_buffer_f32[0]), shift, &temp_f32);
+    return (dot_product + temp_f32);
+}
+#endif
+#endif
+
 #ifdef MPMCM_ANALOG_MEASURE_ENABLE
 /*******************************************************************/
 static void _MEASURE_compute_period_data(void) {
     // Local variables.
     uint32_t acv_buffer_size = 0;
     uint32_t aci_buffer_size = 0;
+    int16_t acv_sample = 0;
+    int16_t aci_sample = 0;
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+    int32_t acv_sum = 0;
+    int32_t aci_sum = 0;
+    q63_t acv_square_sum = 0;
+    q63_t aci_square_sum = 0;
+    q63_t acp_sum = 0;
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    q63_t acq_sum = 0;
+#endif
+    q63_t temp_q63 = 0;
+    float32_t period_acxx_buffer_size_square_f32 = 0.0;
+#else
     float32_t mean_voltage_f32 = 0.0;
     float32_t mean_current_f32 = 0.0;
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    float32_t acq_sum_f32 = 0.0;
+    float32_t temp_f32 = 0.0;
+#endif
+#endif
     float64_t active_power_mw = 0.0;
     float64_t rms_voltage_mv = 0.0;
     float64_t rms_current_ma = 0.0;
     float64_t apparent_power_mva = 0.0;
     float64_t power_factor = 0.0;
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    float64_t reactive_power_mvar = 0.0;
+    uint32_t quarter_period_size = 0;
+    uint32_t quarter_period_remainder = 0;
+#endif
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+    uint8_t capture_enable = 0;
+#endif
     uint32_t acv_frequency_capture_delta = 0;
     float64_t frequency_mhz = 0.0;
     float64_t temp_f64 = 0.0;
     uint8_t chx_idx = 0;
     uint32_t sample_idx = 0;
     uint32_t idx = 0;
+#if ((defined MPMCM_ANALOG_CIRCULAR_DMA) && !(defined MPMCM_ANALOG_SIMULATION))
+    uint32_t acv_position = 0;
+    uint32_t aci_position = 0;
+#endif
     // Check enable flag.
     if (measure_ctx.processing_enable == 0) goto errors;
     // Check compute flag.
@@ -542,8 +900,17 @@ static void _MEASURE_compute_period_data(void) {
     acv_buffer_size = (SIMULATION_BUFFER_SIZE / MEASURE_NUMBER_OF_ACI_CHANNELS);
     aci_buffer_size = (SIMULATION_BUFFER_SIZE / MEASURE_NUMBER_OF_ACI_CHANNELS);
 #else
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+    // Check that the period has not been overwritten by the DMA.
+    if ((measure_sampling.acv_position - measure_sampling.acv[measure_sampling.acv_read_idx].position) > (MEASURE_CIRCULAR_ADCX_DMA_BUFFER_SIZE - MEASURE_PERIOD_ADCX_DMA_BUFFER_SIZE)) {
+        measure_ctx.dropped_period_count++;
+        goto errors;
+    }
+    acv_position = measure_sampling.acv[measure_sampling.acv_read_idx].position;
+    aci_position = measure_sampling.aci[measure_sampling.aci_read_idx].position;
+#endif
     acv_buffer_size = (uint32_t) ((measure_sampling.acv[measure_sampling.acv_read_idx].size) / (MEASURE_NUMBER_OF_ACI_CHANNELS));
-    aci_buffer_size = (uint32_t) ((measure_sampling.aci[measure_sampling.acv_read_idx].size) / (MEASURE_NUMBER_OF_ACI_CHANNELS));
+    aci_buffer_size = (uint32_t) ((measure_sampling.aci[measure_sampling.aci_read_idx].size) / (MEASURE_NUMBER_OF_ACI_CHANNELS));
 #endif
     // Take the minimum size between voltage and current.
     measure_data.period_acxx_buffer_size = (acv_buffer_size < aci_buffer_size) ? acv_buffer_size : aci_buffer_size;
@@ -551,26 +918,91 @@ static void _MEASURE_compute_period_data(void) {
     if ((measure_data.period_acxx_buffer_size < measure_data.period_acxx_buffer_size_low_limit) || (measure_data.period_acxx_buffer_size > measure_data.period_acxx_buffer_size_high_limit)) {
         goto errors;
     }
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+    // Check if the period has to be captured.
+    if ((measure_capture.state == MEASURE_CAPTURE_STATE_RUNNING) && ((measure_capture.number_of_samples + measure_data.period_acxx_buffer_size) <= MEASURE_CAPTURE_BUFFER_SIZE)) {
+        capture_enable = 1;
+    }
+#endif
     // Processing each channel.
     for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+        // Reset sums.
+        acv_sum = 0;
+        aci_sum = 0;
+#endif
         // Compute channel buffer.
         for (idx = 0; idx < (measure_data.period_acxx_buffer_size); idx++) {
-            // Copy samples by channel and convert to Q31 type.
+            // Read samples of the current channel.
             sample_idx = (MEASURE_NUMBER_OF_ACI_CHANNELS * idx) + chx_idx;
 #ifdef MPMCM_ANALOG_SIMULATION
-            measure_data.period_acvx_buffer_f32[idx] = (float32_t) (SIMULATION_ACV_BUFFER[sample_idx]);
-            measure_data.period_acix_buffer_f32[idx] = (float32_t) (SIMULATION_ACI_BUFFER[sample_idx] / measure_ctx.random_divider);
+            acv_sample = SIMULATION_ACV_BUFFER[sample_idx];
+            aci_sample = (int16_t) (SIMULATION_ACI_BUFFER[sample_idx] / measure_ctx.random_divider);
+#else
+#ifdef MPMCM_ANALOG_CIRCULAR_DMA
+            acv_sample = measure_sampling.acv_data[(acv_position + sample_idx) & MEASURE_CIRCULAR_ADCX_DMA_BUFFER_MASK];
+            aci_sample = measure_sampling.aci_data[(aci_position + sample_idx) & MEASURE_CIRCULAR_ADCX_DMA_BUFFER_MASK];
 #else
-            measure_data.period_acvx_buffer_f32[idx] = (float32_t) (measure_sampling.acv[measure_sampling.acv_read_idx].data[sample_idx]);
-            measure_data.period_acix_buffer_f32[idx] = (float32_t) (measure_sampling.aci[measure_sampling.aci_read_idx].data[sample_idx]);
+            acv_sample = measure_sampling.acv[measure_sampling.acv_read_idx].data[sample_idx];
+            aci_sample = measure_sampling.aci[measure_sampling.aci_read_idx].data[sample_idx];
+#endif
             // Update current probe detect flag.
             measure_ctx.probe_detect_flag[chx_idx] = GPIO_read(MEASURE_GPIO_ACI_DETECT[chx_idx]);
             // Force current to 0 if sensor is not connected.
             if (measure_ctx.probe_detect_flag[chx_idx] == 0) {
-                measure_data.period_acix_buffer_f32[idx] = 0.0;
+                aci_sample = 0;
+            }
+#endif
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+            // Copy samples to capture area.
+            if ((capture_enable != 0) && (chx_idx == measure_capture.channel)) {
+                measure_capture.acv_data[measure_capture.number_of_samples + idx] = acv_sample;
+                measure_capture.aci_data[measure_capture.number_of_samples + idx] = aci_sample;
             }
 #endif
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+            // Copy samples and accumulate sums for DC removal.
+            // Note: 12-bits ADC samples fit in Q15 type without scaling.
+            measure_data.period_acvx_buffer_q15[idx] = (q15_t) acv_sample;
+            measure_data.period_acix_buffer_q15[idx] = (q15_t) aci_sample;
+            acv_sum += acv_sample;
+            aci_sum += aci_sample;
+#else
+            // Copy samples and convert to float type.
+            measure_data.period_acvx_buffer_f32[idx] = (float32_t) acv_sample;
+            measure_data.period_acix_buffer_f32[idx] = (float32_t) aci_sample;
+#endif
+        }
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+        // Sums of products and squares (dual MAC instructions, exact 64-bits results).
+        arm_dot_prod_q15((q15_t*) measure_data.period_acvx_buffer_q15, (q15_t*) measure_data.period_acix_buffer_q15, measure_data.period_acxx_buffer_size, &acp_sum);
+        arm_power_q15((q15_t*) measure_data.period_acvx_buffer_q15, measure_data.period_acxx_buffer_size, &acv_square_sum);
+        arm_power_q15((q15_t*) measure_data.period_acix_buffer_q15, measure_data.period_acxx_buffer_size, &aci_square_sum);
+        // DC removal is directly applied on sums: (N^2 * mean((x - mean(x)) * (y - mean(y)))) = (N * sum(x * y)) - (sum(x) * sum(y)).
+        period_acxx_buffer_size_square_f32 = (float32_t) (measure_data.period_acxx_buffer_size * measure_data.period_acxx_buffer_size);
+        // Active power.
+        temp_q63 = (((q63_t) measure_data.period_acxx_buffer_size) * acp_sum) - (((q63_t) acv_sum) * ((q63_t) aci_sum));
+        measure_data.period_active_power_f32 = ((float32_t) temp_q63) / period_acxx_buffer_size_square_f32;
+        // RMS voltage.
+        temp_q63 = (((q63_t) measure_data.period_acxx_buffer_size) * acv_square_sum) - (((q63_t) acv_sum) * ((q63_t) acv_sum));
+        arm_sqrt_f32((((float32_t) temp_q63) / period_acxx_buffer_size_square_f32), (float32_t*) &(measure_data.period_rms_voltage_f32));
+        // RMS current.
+        temp_q63 = (((q63_t) measure_data.period_acxx_buffer_size) * aci_square_sum) - (((q63_t) aci_sum) * ((q63_t) aci_sum));
+        arm_sqrt_f32((((float32_t) temp_q63) / period_acxx_buffer_size_square_f32), (float32_t*) &(measure_data.period_rms_current_f32));
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        // Reactive power: voltage delayed by a quarter period.
+        // Note: when the period size is not a multiple of 4, the result is linearly interpolated between the two closest integer shifts.
+        quarter_period_size = (measure_data.period_acxx_buffer_size >> 2);
+        quarter_period_remainder = (measure_data.period_acxx_buffer_size & 0x03);
+        acq_sum = _MEASURE_compute_shifted_dot_product(quarter_period_size);
+        if (quarter_period_remainder != 0) {
+            temp_q63 = _MEASURE_compute_shifted_dot_product(quarter_period_size + 1);
+            acq_sum += (((temp_q63 - acq_sum) * ((q63_t) quarter_period_remainder)) / 4);
         }
+        temp_q63 = (((q63_t) measure_data.period_acxx_buffer_size) * acq_sum) - (((q63_t) acv_sum) * ((q63_t) aci_sum));
+        measure_data.period_reactive_power_f32 = ((float32_t) temp_q63) / period_acxx_buffer_size_square_f32;
+#endif
+#else
         // Mean voltage and current.
         arm_mean_f32((float32_t*) measure_data.period_acvx_buffer_f32, measure_data.period_acxx_buffer_size, &mean_voltage_f32);
         arm_mean_f32((float32_t*) measure_data.period_acix_buffer_f32, measure_data.period_acxx_buffer_size, &mean_current_f32);
@@ -583,17 +1015,50 @@ static void _MEASURE_compute_period_data(void) {
         arm_mult_f32((float32_t*) measure_data.period_acvx_buffer_f32, (float32_t*) measure_data.period_acix_buffer_f32, (float32_t*) measure_data.period_acpx_buffer_f32, measure_data.period_acxx_buffer_size);
         // Active power.
         arm_mean_f32((float32_t*) measure_data.period_acpx_buffer_f32, measure_data.period_acxx_buffer_size, (float32_t*) &(measure_data.period_active_power_f32));
+        // RMS voltage.
+        arm_rms_f32((float32_t*) measure_data.period_acvx_buffer_f32, measure_data.period_acxx_buffer_size, (float32_t*) &(measure_data.period_rms_voltage_f32));
+        // RMS current.
+        arm_rms_f32((float32_t*) measure_data.period_acix_buffer_f32, measure_data.period_acxx_buffer_size, (float32_t*) &(measure_data.period_rms_current_f32));
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        // Reactive power: voltage delayed by a quarter period.
+        // Note: when the period size is not a multiple of 4, the result is linearly interpolated between the two closest integer shifts.
+        quarter_period_size = (measure_data.period_acxx_buffer_size >> 2);
+        quarter_period_remainder = (measure_data.period_acxx_buffer_size & 0x03);
+        acq_sum_f32 = _MEASURE_compute_shifted_dot_product(quarter_period_size);
+        if (quarter_period_remainder != 0) {
+            temp_f32 = _MEASURE_compute_shifted_dot_product(quarter_period_size + 1);
+            acq_sum_f32 += (((temp_f32 - acq_sum_f32) * ((float32_t) quarter_period_remainder)) / ((float32_t) 4.0));
+        }
+        measure_data.period_reactive_power_f32 = (acq_sum_f32 / ((float32_t) measure_data.period_acxx_buffer_size));
+#endif
+#endif
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+        // Harmonics analysis.
+        // Note: a single signal is analyzed per period to limit the processing load.
+        if ((measure_ctx.harmonics_signal == MEASURE_HARMONICS_SIGNAL_ACV) && (chx_idx == 0)) {
+            _MEASURE_compute_harmonics(MEASURE_HARMONICS_SIGNAL_ACV);
+        }
+        if (measure_ctx.harmonics_signal == (MEASURE_HARMONICS_SIGNAL_ACI1 + chx_idx)) {
+            _MEASURE_compute_harmonics(measure_ctx.harmonics_signal);
+        }
+#endif
+        // Convert active power.
         temp_f64 = (float64_t) measure_data.period_active_power_f32;
         temp_f64 *= measure_data.acp_factor_num[chx_idx];
         active_power_mw = (temp_f64 / measure_data.acp_factor_den);
-        // RMS voltage.
-        arm_rms_f32((float32_t*) measure_data.period_acvx_buffer_f32, measure_data.period_acxx_buffer_size, (float32_t*) &(measure_data.period_rms_voltage_f32));
+        // Convert RMS voltage.
         temp_f64 = measure_data.acv_factor_num * ((float64_t) measure_data.period_rms_voltage_f32);
         rms_voltage_mv = (temp_f64 / measure_data.acv_factor_den);
-        // RMS current.
-        arm_rms_f32((float32_t*) measure_data.period_acix_buffer_f32, measure_data.period_acxx_buffer_size, (float32_t*) &(measure_data.period_rms_current_f32));
+        // Convert RMS current.
         temp_f64 = measure_data.aci_factor_num[chx_idx] * ((float64_t) measure_data.period_rms_current_f32);
         rms_current_ma = (temp_f64 / measure_data.aci_factor_den);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        // Convert reactive power.
+        // Note: reactive power is positive when current lags voltage (inductive load).
+        temp_f64 = (float64_t) measure_data.period_reactive_power_f32;
+        temp_f64 *= measure_data.acp_factor_num[chx_idx];
+        reactive_power_mvar = (temp_f64 / measure_data.acp_factor_den);
+#endif
         // Apparent power.
         temp_f64 = (rms_voltage_mv * rms_current_ma);
         apparent_power_mva = ((temp_f64) / ((float64_t) 1000.0));
@@ -607,18 +1072,35 @@ static void _MEASURE_compute_period_data(void) {
             power_factor *= (-1.0);
         }
         // Update accumulated data.
-        DATA_add_run_channel_sample(measure_data.chx_rolling_mean[chx_idx], active_power_mw, active_power_mw);
-        DATA_add_run_channel_sample(measure_data.chx_rolling_mean[chx_idx], rms_voltage_mv, rms_voltage_mv);
-        DATA_add_run_channel_sample(measure_data.chx_rolling_mean[chx_idx], rms_current_ma, rms_current_ma);
-        DATA_add_run_channel_sample(measure_data.chx_rolling_mean[chx_idx], apparent_power_mva, apparent_power_mva);
-        DATA_add_run_channel_sample(measure_data.chx_rolling_mean[chx_idx], power_factor, power_factor);
+        DATA_add_run_channel_sample(measure_data.chx_run_sum[chx_idx], active_power_mw, active_power_mw);
+        DATA_add_run_channel_sample(measure_data.chx_run_sum[chx_idx], rms_voltage_mv, rms_voltage_mv);
+        DATA_add_run_channel_sample(measure_data.chx_run_sum[chx_idx], rms_current_ma, rms_current_ma);
+        DATA_add_run_channel_sample(measure_data.chx_run_sum[chx_idx], apparent_power_mva, apparent_power_mva);
+        DATA_add_run_channel_sample(measure_data.chx_run_sum[chx_idx], power_factor, power_factor);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        DATA_add_run_channel_sample(measure_data.chx_run_sum[chx_idx], reactive_power_mvar, reactive_power_mvar);
+#endif
     }
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+    // Update capture.
+    if (capture_enable != 0) {
+        measure_capture.number_of_samples += measure_data.period_acxx_buffer_size;
+        measure_capture.period_count++;
+        if (measure_capture.period_count >= measure_capture.number_of_periods) {
+            measure_capture.state = MEASURE_CAPTURE_STATE_DONE;
+        }
+    }
+#endif
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    // Select signal to analyze on next period.
+    measure_ctx.harmonics_signal = ((measure_ctx.harmonics_signal + 1) % MEASURE_HARMONICS_SIGNAL_LAST);
+#endif
     // Compute mains frequency.
     for (idx = 0; idx < MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE; idx++) {
         // Search two valid consecutive samples.
-        if (measure_sampling.acv_frequency_capture[idx] < measure_sampling.acv_frequency_capture[(idx + 1) % MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE]) {
+        if (measure_sampling.acv_frequency_capture_period[measure_sampling.acv_read_idx][idx] < measure_sampling.acv_frequency_capture_period[measure_sampling.acv_read_idx][(idx + 1) % MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE]) {
             // Compute delta.
-            acv_frequency_capture_delta = measure_sampling.acv_frequency_capture[(idx + 1) % MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE] - measure_sampling.acv_frequency_capture[idx];
+            acv_frequency_capture_delta = measure_sampling.acv_frequency_capture_period[measure_sampling.acv_read_idx][(idx + 1) % MEASURE_PERIOD_TIMX_DMA_BUFFER_SIZE] - measure_sampling.acv_frequency_capture_period[measure_sampling.acv_read_idx][idx];
             // Avoid rollover case (clamp to 1Hz).
             if (acv_frequency_capture_delta < MEASURE_ACV_FREQUENCY_SAMPLING_HZ) break;
         }
@@ -628,12 +1110,17 @@ static void _MEASURE_compute_period_data(void) {
         // Compute mains frequency.
         frequency_mhz = (((float64_t) (MEASURE_ACV_FREQUENCY_SAMPLING_HZ * 1000)) / ((float64_t) acv_frequency_capture_delta));
         // Update accumulated data.
-        DATA_add_run_sample(measure_data.acv_frequency_rolling_mean, frequency_mhz);
+        DATA_add_run_sample(measure_data.acv_frequency_run_sum, frequency_mhz);
     }
+    // Update statistics.
+    // Note: warm-up, dropped and out of range periods are not counted.
+    measure_ctx.processed_period_count++;
 errors:
     // Update read indexes.
     measure_sampling.acv_read_idx = ((measure_sampling.acv_read_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
     measure_sampling.aci_read_idx = ((measure_sampling.aci_read_idx + 1) % MEASURE_PERIOD_ADCX_DMA_BUFFER_DEPTH);
+    // Release buffer.
+    measure_sampling.period_read_count++;
 }
 #endif
 
@@ -641,16 +1128,39 @@ errors:
 /*******************************************************************/
 static void _MEASURE_compute_run_data(void) {
     // Local variables.
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    float32_t phase_angle_radians = 0.0;
+#endif
     uint8_t chx_idx = 0;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    uint8_t signal_idx = 0;
+#endif
     // Compute AC channels run data.
     for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
-        // Copy all rolling means and reset.
-        DATA_copy_run_channel(measure_data.chx_rolling_mean[chx_idx], measure_data.chx_run_data[chx_idx]);
-        DATA_reset_run_channel(measure_data.chx_rolling_mean[chx_idx]);
+        // Compute means from sums and reset.
+        DATA_compute_run_channel(measure_data.chx_run_sum[chx_idx], measure_data.chx_run_data[chx_idx]);
+        DATA_reset_run_sum_channel(measure_data.chx_run_sum[chx_idx]);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        // Compute phase angle from mean active and reactive powers.
+        // Note: angle is not averaged on periods to avoid wrapping issue around +/-180 degrees.
+        DATA_reset_run(measure_data.chx_run_data[chx_idx].phase_angle_degrees);
+        if ((measure_data.chx_run_data[chx_idx].active_power_mw.number_of_samples > 0) && (measure_data.chx_run_data[chx_idx].reactive_power_mvar.number_of_samples > 0)) {
+            arm_atan2_f32((float32_t) measure_data.chx_run_data[chx_idx].reactive_power_mvar.value, (float32_t) measure_data.chx_run_data[chx_idx].active_power_mw.value, &phase_angle_radians);
+            measure_data.chx_run_data[chx_idx].phase_angle_degrees.value = (((float64_t) phase_angle_radians) * MEASURE_RADIANS_TO_DEGREES);
+            measure_data.chx_run_data[chx_idx].phase_angle_degrees.number_of_samples = measure_data.chx_run_data[chx_idx].active_power_mw.number_of_samples;
+        }
+#endif
     }
     // Compute frequency run data and reset.
-    DATA_copy_run(measure_data.acv_frequency_rolling_mean, measure_data.acv_frequency_run_data);
-    DATA_reset_run(measure_data.acv_frequency_rolling_mean);
+    DATA_compute_run(measure_data.acv_frequency_run_sum, measure_data.acv_frequency_run_data);
+    DATA_reset_run_sum(measure_data.acv_frequency_run_sum);
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    // Compute harmonics run data and reset.
+    for (signal_idx = 0; signal_idx < MEASURE_HARMONICS_SIGNAL_LAST; signal_idx++) {
+        DATA_compute_run_harmonics(measure_data.harmonics_run_sum[signal_idx], measure_data.harmonics_run_data[signal_idx]);
+        DATA_reset_run_sum_harmonics(measure_data.harmonics_run_sum[signal_idx]);
+    }
+#endif
 }
 #endif
 
@@ -661,25 +1171,42 @@ static void _MEASURE_compute_accumulated_data(void) {
     float64_t sample_abs = 0.0;
     float64_t ref_abs = 0.0;
     uint8_t chx_idx = 0;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    uint8_t signal_idx = 0;
+#endif
     // Compute AC channels accumulated data.
     for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
-        // Copy all rolling means.
+        // Add run data to accumulated sums.
         DATA_add_accumulated_channel_sample(measure_data.chx_accumulated_data[chx_idx], active_power_mw, measure_data.chx_run_data[chx_idx].active_power_mw);
         DATA_add_accumulated_channel_sample(measure_data.chx_accumulated_data[chx_idx], rms_voltage_mv, measure_data.chx_run_data[chx_idx].rms_voltage_mv);
         DATA_add_accumulated_channel_sample(measure_data.chx_accumulated_data[chx_idx], rms_current_ma, measure_data.chx_run_data[chx_idx].rms_current_ma);
         DATA_add_accumulated_channel_sample(measure_data.chx_accumulated_data[chx_idx], apparent_power_mva, measure_data.chx_run_data[chx_idx].apparent_power_mva);
         DATA_add_accumulated_channel_sample(measure_data.chx_accumulated_data[chx_idx], power_factor, measure_data.chx_run_data[chx_idx].power_factor);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        DATA_add_accumulated_channel_sample(measure_data.chx_accumulated_data[chx_idx], reactive_power_mvar, measure_data.chx_run_data[chx_idx].reactive_power_mvar);
+        // Note: phase angle mean is computed from active and reactive powers sums when reading data.
+        DATA_add_accumulated_channel_sample(measure_data.chx_accumulated_data[chx_idx], phase_angle_degrees, measure_data.chx_run_data[chx_idx].phase_angle_degrees);
+#endif
         // Increase active energy.
         measure_data.active_energy_mws_sum[chx_idx].value += (measure_data.chx_run_data[chx_idx].active_power_mw.value);
         measure_data.active_energy_mws_sum[chx_idx].number_of_samples++;
         // Increase apparent energy.
         measure_data.apparent_energy_mvas_sum[chx_idx].value += (measure_data.chx_run_data[chx_idx].apparent_power_mva.value);
         measure_data.apparent_energy_mvas_sum[chx_idx].number_of_samples++;
-        // Reset results.
-        DATA_reset_run_channel(measure_data.chx_rolling_mean[chx_idx]);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        // Increase reactive energy.
+        measure_data.reactive_energy_mvars_sum[chx_idx].value += (measure_data.chx_run_data[chx_idx].reactive_power_mvar.value);
+        measure_data.reactive_energy_mvars_sum[chx_idx].number_of_samples++;
+#endif
     }
     // Compute frequency accumulated data.
     DATA_add_accumulated_sample(measure_data.acv_frequency_accumulated_data, measure_data.acv_frequency_run_data);
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    // Compute harmonics accumulated data.
+    for (signal_idx = 0; signal_idx < MEASURE_HARMONICS_SIGNAL_LAST; signal_idx++) {
+        DATA_add_accumulated_harmonics_sample(measure_data.harmonics_accumulated_data[signal_idx], measure_data.harmonics_run_data[signal_idx]);
+    }
+#endif
 }
 #endif
 
@@ -717,6 +1244,10 @@ static MEASURE_status_t _MEASURE_internal_process(void) {
     MEASURE_status_t status = MEASURE_SUCCESS;
     uint32_t uptime_seconds = RTC_get_uptime_seconds();
     uint8_t chx_idx = 0;
+#ifdef MPMCM_ANALOG_CYCLE_COUNT
+    uint32_t processed_period_count = 0;
+    uint32_t period_cycles = 0;
+#endif
     // Perform state machine.
     switch (measure_ctx.state) {
     case MEASURE_STATE_OFF:
@@ -776,16 +1307,23 @@ static MEASURE_status_t _MEASURE_internal_process(void) {
         }
         break;
     case MEASURE_STATE_ACTIVE:
-        // Check zero cross count.
-        if (measure_ctx.zero_cross_count >= MEASURE_ZERO_CROSS_PER_PERIOD) {
-            // Clear counters.
-            measure_ctx.zero_cross_count = 0;
-            measure_ctx.dma_transfer_end_flag = 0;
-            // Switch to next buffer.
-            status = _MEASURE_switch_dma_buffer();
-            if (status != MEASURE_SUCCESS) goto errors;
-            // Compute data.
+        // Compute all pending periods.
+        while (measure_sampling.period_read_count != measure_sampling.period_write_count) {
+#ifdef MPMCM_ANALOG_CYCLE_COUNT
+            processed_period_count = measure_ctx.processed_period_count;
+            period_cycles = MEASURE_CORE_DWT_CYCCNT;
+#endif
             _MEASURE_compute_period_data();
+#ifdef MPMCM_ANALOG_CYCLE_COUNT
+            period_cycles = (MEASURE_CORE_DWT_CYCCNT - period_cycles);
+            // Update statistics only when the period has been computed.
+            if (measure_ctx.processed_period_count != processed_period_count) {
+                measure_ctx.period_cycles_last = period_cycles;
+                if (period_cycles > measure_ctx.period_cycles_max) {
+                    measure_ctx.period_cycles_max = period_cycles;
+                }
+            }
+#endif
         }
         // Check DMA transfer end flag.
         if (measure_ctx.dma_transfer_end_flag != 0) {
@@ -827,6 +1365,21 @@ MEASURE_status_t MEASURE_init(void) {
     measure_ctx.mains_detect_next_time_seconds = 0;
     measure_ctx.analog_power_delay_start_time_seconds = 0;
     measure_ctx.mains_detect_start_time_second = 0;
+    measure_ctx.processed_period_count = 0;
+    measure_ctx.dropped_period_count = 0;
+    measure_ctx.backlog_max = 0;
+    measure_ctx.period_cycles_last = 0;
+    measure_ctx.period_cycles_max = 0;
+#ifdef MPMCM_ANALOG_CYCLE_COUNT
+    // Enable trace and cycle counter.
+    MEASURE_CORE_DEMCR |= (0b1UL << 24);
+    MEASURE_CORE_DWT_CYCCNT = 0;
+    MEASURE_CORE_DWT_CTRL |= (0b1UL << 0);
+#endif
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+    measure_capture.state = MEASURE_CAPTURE_STATE_IDLE;
+    measure_capture.number_of_samples = 0;
+#endif
     // Reset data.
     _MEASURE_reset();
 #ifdef MPMCM_ANALOG_MEASURE_ENABLE
@@ -835,6 +1388,16 @@ MEASURE_status_t MEASURE_init(void) {
         GPIO_configure(MEASURE_GPIO_ACI_DETECT[chx_idx], GPIO_MODE_INPUT, GPIO_TYPE_PUSH_PULL, GPIO_SPEED_LOW, GPIO_PULL_NONE);
         measure_ctx.probe_detect_flag[chx_idx] = 0;
     }
+#endif
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    // Init FFT.
+    if (arm_rfft_fast_init_f32((arm_rfft_fast_instance_f32*) &(measure_data.harmonics_rfft), MEASURE_HARMONICS_FFT_SIZE) != ARM_MATH_SUCCESS) {
+        status = MEASURE_ERROR_HARMONICS_FFT;
+        goto errors;
+    }
+#endif
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+errors:
 #endif
     return status;
 }
@@ -910,9 +1473,8 @@ MEASURE_status_t MEASURE_tick_second(void) {
     // Check state.
     if ((measure_ctx.state == MEASURE_STATE_ACTIVE) && (measure_ctx.period_compute_enable != 0)) {
         // Compute run data from last second.
-        measure_ctx.processing_enable = 0;
+        // Note: period data is computed in the same context so there is no need to lock the run sums.
         _MEASURE_compute_run_data();
-        measure_ctx.processing_enable = 1;
         // Compute accumulated data.
         _MEASURE_compute_accumulated_data();
     }
@@ -925,6 +1487,111 @@ MEASURE_status_t MEASURE_tick_second(void) {
 }
 #endif
 
+#ifdef MPMCM_ANALOG_MEASURE_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_process(void) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    // Process pending periods and mains loss detection.
+    if (measure_ctx.state == MEASURE_STATE_ACTIVE) {
+        status = _MEASURE_internal_process();
+    }
+    return status;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_MEASURE_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_pipeline_statistics(MEASURE_pipeline_statistics_t* pipeline_statistics) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    // Check parameter.
+    if (pipeline_statistics == NULL) {
+        status = MEASURE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Copy statistics.
+    pipeline_statistics->processed_period_count = measure_ctx.processed_period_count;
+    pipeline_statistics->dropped_period_count = measure_ctx.dropped_period_count;
+    pipeline_statistics->backlog = (uint8_t) (measure_sampling.period_write_count - measure_sampling.period_read_count);
+    pipeline_statistics->backlog_max = measure_ctx.backlog_max;
+    pipeline_statistics->period_cycles_last = measure_ctx.period_cycles_last;
+    pipeline_statistics->period_cycles_max = measure_ctx.period_cycles_max;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+/*******************************************************************/
+MEASURE_status_t MEASURE_start_capture(uint8_t channel, uint8_t number_of_periods) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    // Check parameters.
+    if (channel >= MEASURE_NUMBER_OF_ACI_CHANNELS) {
+        status = MEASURE_ERROR_AC_CHANNEL;
+        goto errors;
+    }
+    if ((number_of_periods == 0) || (number_of_periods > MEASURE_CAPTURE_NUMBER_OF_PERIODS_MAX)) {
+        status = MEASURE_ERROR_CAPTURE_NUMBER_OF_PERIODS;
+        goto errors;
+    }
+    // Disable capture while updating parameters.
+    measure_capture.state = MEASURE_CAPTURE_STATE_IDLE;
+    measure_capture.channel = channel;
+    measure_capture.number_of_periods = number_of_periods;
+    measure_capture.period_count = 0;
+    measure_capture.number_of_samples = 0;
+    // Samples will be copied by the next computed periods.
+    measure_capture.state = MEASURE_CAPTURE_STATE_RUNNING;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_capture_state(MEASURE_capture_state_t* capture_state, uint16_t* number_of_samples) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    // Check parameters.
+    if ((capture_state == NULL) || (number_of_samples == NULL)) {
+        status = MEASURE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*capture_state) = measure_capture.state;
+    (*number_of_samples) = (measure_capture.state == MEASURE_CAPTURE_STATE_DONE) ? measure_capture.number_of_samples : 0;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+/*******************************************************************/
+MEASURE_status_t MEASURE_read_capture(uint16_t sample_index, int16_t* acv_sample, int16_t* aci_sample) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    // Check parameters.
+    if ((acv_sample == NULL) || (aci_sample == NULL)) {
+        status = MEASURE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (measure_capture.state != MEASURE_CAPTURE_STATE_DONE) {
+        status = MEASURE_ERROR_CAPTURE_STATE;
+        goto errors;
+    }
+    if (sample_index >= measure_capture.number_of_samples) {
+        status = MEASURE_ERROR_CAPTURE_SAMPLE_INDEX;
+        goto errors;
+    }
+    // Read samples.
+    (*acv_sample) = measure_capture.acv_data[sample_index];
+    (*aci_sample) = measure_capture.aci_data[sample_index];
+errors:
+    return status;
+}
+#endif
+
 /*******************************************************************/
 MEASURE_status_t MEASURE_get_probe_detect_flag(uint8_t channel_index, uint8_t* current_sensor_connected) {
     // Local variables.
@@ -1037,6 +1704,9 @@ errors:
 MEASURE_status_t MEASURE_get_channel_accumulated_data(uint8_t channel, DATA_accumulated_channel_t* channel_accumulated_data) {
     // Local variables.
     MEASURE_status_t status = MEASURE_SUCCESS;
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    float32_t phase_angle_radians = 0.0;
+#endif
     // Check parameters.
     if (channel_accumulated_data == NULL) {
         status = MEASURE_ERROR_NULL_PARAMETER;
@@ -1052,12 +1722,28 @@ MEASURE_status_t MEASURE_get_channel_accumulated_data(uint8_t channel, DATA_accu
     // Compute apparent energy.
     measure_data.chx_accumulated_data[channel].apparent_energy_mvah.value = ((measure_data.apparent_energy_mvas_sum[channel].value) / ((float64_t) DATA_SECONDS_PER_HOUR));
     measure_data.chx_accumulated_data[channel].apparent_energy_mvah.number_of_samples = measure_data.apparent_energy_mvas_sum[channel].number_of_samples;
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    // Compute reactive energy.
+    measure_data.chx_accumulated_data[channel].reactive_energy_mvarh.value = ((measure_data.reactive_energy_mvars_sum[channel].value) / ((float64_t) DATA_SECONDS_PER_HOUR));
+    measure_data.chx_accumulated_data[channel].reactive_energy_mvarh.number_of_samples = measure_data.reactive_energy_mvars_sum[channel].number_of_samples;
+#endif
     // Copy data.
     DATA_copy_accumulated_channel(measure_data.chx_accumulated_data[channel], (*channel_accumulated_data));
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    // Compute mean phase angle from active and reactive powers sums to avoid wrapping issue around +/-180 degrees.
+    if (channel_accumulated_data->phase_angle_degrees.number_of_samples > 0) {
+        arm_atan2_f32((float32_t) channel_accumulated_data->reactive_power_mvar.sum, (float32_t) channel_accumulated_data->active_power_mw.sum, &phase_angle_radians);
+        channel_accumulated_data->phase_angle_degrees.mean = (((float64_t) phase_angle_radians) * MEASURE_RADIANS_TO_DEGREES);
+        channel_accumulated_data->phase_angle_degrees.sum = (channel_accumulated_data->phase_angle_degrees.mean * ((float64_t) channel_accumulated_data->phase_angle_degrees.number_of_samples));
+    }
+#endif
     // Reset data.
     DATA_reset_accumulated_channel(measure_data.chx_accumulated_data[channel]);
     DATA_reset_run(measure_data.active_energy_mws_sum[channel]);
     DATA_reset_run(measure_data.apparent_energy_mvas_sum[channel]);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    DATA_reset_run(measure_data.reactive_energy_mvars_sum[channel]);
+#endif
 #ifdef MPMCM_ANALOG_SIMULATION
     measure_ctx.random_divider = 1;
 #endif
@@ -1065,4 +1751,47 @@ errors:
     return status;
 }
 
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_harmonics_run_data(MEASURE_harmonics_signal_t signal, DATA_run_harmonics_t* harmonics_run_data) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    // Check parameters.
+    if (harmonics_run_data == NULL) {
+        status = MEASURE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (signal >= MEASURE_HARMONICS_SIGNAL_LAST) {
+        status = MEASURE_ERROR_HARMONICS_SIGNAL;
+        goto errors;
+    }
+    // Copy data.
+    DATA_copy_run_harmonics(measure_data.harmonics_run_data[signal], (*harmonics_run_data));
+errors:
+    return status;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_harmonics_accumulated_data(MEASURE_harmonics_signal_t signal, DATA_accumulated_harmonics_t* harmonics_accumulated_data) {
+    // Local variables.
+    MEASURE_status_t status = MEASURE_SUCCESS;
+    // Check parameters.
+    if (harmonics_accumulated_data == NULL) {
+        status = MEASURE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (signal >= MEASURE_HARMONICS_SIGNAL_LAST) {
+        status = MEASURE_ERROR_HARMONICS_SIGNAL;
+        goto errors;
+    }
+    // Copy and reset data.
+    DATA_copy_accumulated_harmonics(measure_data.harmonics_accumulated_data[signal], (*harmonics_accumulated_data));
+    DATA_reset_accumulated_harmonics(measure_data.harmonics_accumulated_data[signal]);
+errors:
+    return status;
+}
+#endif
+
 #endif /* MPMCM */
@@ -8,7 +8,9 @@
 #ifndef __CLI_H__
 #define __CLI_H__
 
+#include "at.h"
 #include "error.h"
+#include "lmac.h"
 #include "types.h"
 #include "una_at.h"
 
@@ -23,8 +25,10 @@ typedef enum {
     CLI_SUCCESS = 0,
     // Low level drivers errors.
     CLI_ERROR_BASE_UNA_AT = ERROR_BASE_STEP,
+    CLI_ERROR_BASE_AT = (CLI_ERROR_BASE_UNA_AT + UNA_AT_ERROR_BASE_LAST),
+    CLI_ERROR_BASE_LMAC = (CLI_ERROR_BASE_AT + AT_ERROR_BASE_LAST),
     // Last base value.
-    CLI_ERROR_BASE_LAST = (CLI_ERROR_BASE_UNA_AT + UNA_AT_ERROR_BASE_LAST)
+    CLI_ERROR_BASE_LAST = (CLI_ERROR_BASE_LMAC + LMAC_ERROR_BASE_LAST)
 } CLI_status_t;
 
 /*** CLI functions ***/
@@ -10,22 +10,114 @@
 #include "at.h"
 #include "error.h"
 #include "error_base.h"
+#ifdef UNA_AT_CUSTOM_COMMANDS
+#include "lmac.h"
+#include "lmac_hw_baud_rate.h"
+#include "lmac_hw_binary.h"
+#endif
+#if ((defined UNA_AT_CUSTOM_COMMANDS) && (defined MPMCM))
+#include "measure.h"
+#endif
 #include "node.h"
+#include "parser.h"
+#include "strings.h"
 #include "una.h"
 #include "una_at.h"
+#ifndef UNA_AT_DISABLE_FLAGS_FILE
+#include "una_at_flags.h"
+#endif
 #include "types.h"
 
+/*** CLI local macros ***/
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+#define CLI_REGISTER_VALUE_SIZE_CHAR                8
+#define CLI_CHAR_SEPARATOR                          ','
+#define CLI_STRING_SEPARATOR                        ","
+// Each register value is followed by a separator or the reply end character.
+#define CLI_BURST_READ_NUMBER_OF_REGISTERS_MAX      (EMBEDDED_UTILS_AT_BUFFER_SIZE / (CLI_REGISTER_VALUE_SIZE_CHAR + 1))
+#define CLI_BAUD_RATE_DEFAULT                       EMBEDDED_UTILS_AT_BAUD_RATE
+// Binary frame payload: opcode, first register address, number of registers and big endian register values.
+#define CLI_BINARY_FRAME_INDEX_OPCODE               0
+#define CLI_BINARY_FRAME_INDEX_REG_ADDR             1
+#define CLI_BINARY_FRAME_INDEX_NUMBER_OF_REGISTERS  2
+#define CLI_BINARY_FRAME_INDEX_DATA                 3
+#define CLI_BINARY_REGISTER_SIZE                    4
+#define CLI_BINARY_NUMBER_OF_REGISTERS_MAX          ((LMAC_HW_BINARY_DATA_SIZE_MAX - CLI_BINARY_FRAME_INDEX_DATA) / CLI_BINARY_REGISTER_SIZE)
+#endif
+
 /*** CLI local structures ***/
 
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+typedef enum {
+    CLI_BINARY_OPCODE_READ_REGISTERS = 0x01,
+    CLI_BINARY_OPCODE_WRITE_REGISTERS = 0x02,
+    CLI_BINARY_OPCODE_ERROR = 0x7F,
+    CLI_BINARY_OPCODE_LAST
+} CLI_binary_opcode_t;
+#endif
+
 /*******************************************************************/
 typedef struct {
     volatile uint8_t una_at_process_flag;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    volatile uint8_t binary_process_flag;
+    PARSER_context_t* at_parser_ptr;
+    uint32_t baud_rate_request;
+#endif
 } CLI_context_t;
 
+/*** CLI local functions declaration ***/
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+static AT_status_t _CLI_burst_read_callback(void);
+static AT_status_t _CLI_baud_rate_callback(void);
+#endif
+#if ((defined UNA_AT_CUSTOM_COMMANDS) && (defined MPMCM) && (defined MPMCM_ANALOG_MEASURE_ENABLE))
+static AT_status_t _CLI_measure_statistics_callback(void);
+#endif
+
 /*** CLI local global variables ***/
 
+#ifdef UNA_AT_CUSTOM_COMMANDS
+static const AT_command_t CLI_COMMANDS_LIST[] = {
+    {
+        .parser_mode = PARSER_MODE_HEADER,
+        .syntax = "AT$BR=",
+        .parameters = "<reg_addr[hex]>,<number_of_registers[dec]>",
+        .description = "Read consecutive registers",
+        .callback = &_CLI_burst_read_callback
+    },
+    {
+        .parser_mode = PARSER_MODE_HEADER,
+        .syntax = "AT$BD=",
+        .parameters = "<baud_rate[dec]>",
+        .description = "Switch RS485 baud rate",
+        .callback = &_CLI_baud_rate_callback
+    },
+#if ((defined MPMCM) && (defined MPMCM_ANALOG_MEASURE_ENABLE))
+    {
+        .parser_mode = PARSER_MODE_COMMAND,
+        .syntax = "AT$PS?",
+        .parameters = NULL,
+        .description = "Read mains periods processing statistics",
+        .callback = &_CLI_measure_statistics_callback
+    },
+#endif
+};
+
+// Note: baud rate is limited to 9600 so that the LPUART can still be clocked by the LSE in stop mode.
+static const uint32_t CLI_BAUD_RATE_LIST[] = { CLI_BAUD_RATE_DEFAULT, 2400, 4800, 9600 };
+#endif
+
 static CLI_context_t cli_ctx = {
-    .una_at_process_flag = 0
+    .una_at_process_flag = 0,
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    .binary_process_flag = 0,
+    .at_parser_ptr = NULL,
+    .baud_rate_request = 0
+#endif
 };
 
 /*** CLI local functions ***/
@@ -72,6 +164,207 @@ errors:
     return status;
 }
 
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static AT_status_t _CLI_burst_read_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    NODE_status_t node_status = NODE_SUCCESS;
+    uint32_t reg_value[CLI_BURST_READ_NUMBER_OF_REGISTERS_MAX];
+    int32_t reg_addr_base = 0;
+    int32_t number_of_registers = 0;
+    uint8_t idx = 0;
+    // Read parameters.
+    parser_status = PARSER_get_parameter(cli_ctx.at_parser_ptr, STRING_FORMAT_HEXADECIMAL, CLI_CHAR_SEPARATOR, &reg_addr_base);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    parser_status = PARSER_get_parameter(cli_ctx.at_parser_ptr, STRING_FORMAT_DECIMAL, STRING_CHAR_NULL, &number_of_registers);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Check parameters.
+    if ((reg_addr_base < 0) || (reg_addr_base > 0xFF) || (number_of_registers <= 0) || (number_of_registers > CLI_BURST_READ_NUMBER_OF_REGISTERS_MAX)) {
+        status = AT_ERROR_COMMAND_EXECUTION;
+        goto errors;
+    }
+    // Read registers.
+    node_status = NODE_read_registers(NODE_REQUEST_SOURCE_EXTERNAL, (uint8_t) reg_addr_base, reg_value, (uint8_t) number_of_registers);
+    _CLI_check_driver_status(node_status, NODE_SUCCESS, ERROR_BASE_NODE);
+    // Print values.
+    for (idx = 0; idx < number_of_registers; idx++) {
+        if (idx != 0) {
+            AT_reply_add_string(CLI_STRING_SEPARATOR);
+        }
+        AT_reply_add_integer((int32_t) reg_value[idx], STRING_FORMAT_HEXADECIMAL, 0);
+    }
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static AT_status_t _CLI_baud_rate_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_ERROR_COMMAND_EXECUTION;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    int32_t baud_rate = 0;
+    uint8_t idx = 0;
+    // Read parameter.
+    parser_status = PARSER_get_parameter(cli_ctx.at_parser_ptr, STRING_FORMAT_DECIMAL, STRING_CHAR_NULL, &baud_rate);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    // Check baud rate.
+    for (idx = 0; idx < (sizeof(CLI_BAUD_RATE_LIST) / sizeof(uint32_t)); idx++) {
+        if (((uint32_t) baud_rate) == CLI_BAUD_RATE_LIST[idx]) {
+            status = AT_SUCCESS;
+            break;
+        }
+    }
+    if (status != AT_SUCCESS) goto errors;
+    // Switch is performed in the process function, once the reply has been sent with the current baud rate.
+    cli_ctx.baud_rate_request = (uint32_t) baud_rate;
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static void _CLI_binary_rx_callback(void) {
+    // Set local flag.
+    cli_ctx.binary_process_flag = 1;
+}
+#endif
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static NODE_status_t _CLI_binary_read_registers(uint8_t* frame, uint8_t* data_size) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_value[CLI_BINARY_NUMBER_OF_REGISTERS_MAX];
+    uint8_t number_of_registers = frame[CLI_BINARY_FRAME_INDEX_NUMBER_OF_REGISTERS];
+    uint8_t idx = 0;
+    uint8_t byte_idx = 0;
+    // Read registers.
+    status = NODE_read_registers(NODE_REQUEST_SOURCE_EXTERNAL, frame[CLI_BINARY_FRAME_INDEX_REG_ADDR], reg_value, number_of_registers);
+    if (status != NODE_SUCCESS) goto errors;
+    // Build reply data (big endian).
+    for (idx = 0; idx < number_of_registers; idx++) {
+        for (byte_idx = 0; byte_idx < CLI_BINARY_REGISTER_SIZE; byte_idx++) {
+            frame[CLI_BINARY_FRAME_INDEX_DATA + (idx * CLI_BINARY_REGISTER_SIZE) + byte_idx] = (uint8_t) (reg_value[idx] >> (8 * (CLI_BINARY_REGISTER_SIZE - 1 - byte_idx)));
+        }
+    }
+    (*data_size) = (uint8_t) (number_of_registers * CLI_BINARY_REGISTER_SIZE);
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static NODE_status_t _CLI_binary_write_registers(uint8_t* frame) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint8_t reg_addr_base = frame[CLI_BINARY_FRAME_INDEX_REG_ADDR];
+    uint8_t number_of_registers = frame[CLI_BINARY_FRAME_INDEX_NUMBER_OF_REGISTERS];
+    uint32_t reg_value = 0;
+    uint8_t idx = 0;
+    uint8_t byte_idx = 0;
+    // Check all registers before writing any of them, so that a rejected request leaves the node unchanged.
+    for (idx = 0; idx < number_of_registers; idx++) {
+        status = NODE_check_register_write(NODE_REQUEST_SOURCE_EXTERNAL, (uint8_t) (reg_addr_base + idx));
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    // Write registers.
+    for (idx = 0; idx < number_of_registers; idx++) {
+        reg_value = 0;
+        for (byte_idx = 0; byte_idx < CLI_BINARY_REGISTER_SIZE; byte_idx++) {
+            reg_value = (reg_value << 8) | frame[CLI_BINARY_FRAME_INDEX_DATA + (idx * CLI_BINARY_REGISTER_SIZE) + byte_idx];
+        }
+        status = NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, (uint8_t) (reg_addr_base + idx), reg_value, 0xFFFFFFFF);
+        if (status != NODE_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static CLI_status_t _CLI_binary_process(void) {
+    // Local variables.
+    CLI_status_t status = CLI_SUCCESS;
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    NODE_status_t node_status = NODE_ERROR_REGISTER_ADDRESS;
+    uint8_t frame[LMAC_HW_BINARY_DATA_SIZE_MAX];
+    uint8_t frame_size = 0;
+    uint8_t number_of_registers = 0;
+    uint8_t data_size = 0;
+    // Read frame.
+    lmac_status = LMAC_HW_read_binary_frame(frame, &frame_size);
+    LMAC_exit_error(CLI_ERROR_BASE_LMAC);
+    // Note: corrupted frames are not answered.
+    if (frame_size == 0) goto errors;
+    // Check header (malformed requests are reported as a register address error).
+    number_of_registers = frame[CLI_BINARY_FRAME_INDEX_NUMBER_OF_REGISTERS];
+    if ((frame_size >= CLI_BINARY_FRAME_INDEX_DATA) && (number_of_registers != 0) && (number_of_registers <= CLI_BINARY_NUMBER_OF_REGISTERS_MAX) && ((((uint32_t) frame[CLI_BINARY_FRAME_INDEX_REG_ADDR]) + number_of_registers) <= 0x100)) {
+        // Execute request.
+        switch (frame[CLI_BINARY_FRAME_INDEX_OPCODE]) {
+        case CLI_BINARY_OPCODE_READ_REGISTERS:
+            if (frame_size != CLI_BINARY_FRAME_INDEX_DATA) break;
+            node_status = _CLI_binary_read_registers(frame, &data_size);
+            break;
+        case CLI_BINARY_OPCODE_WRITE_REGISTERS:
+            if (frame_size != (CLI_BINARY_FRAME_INDEX_DATA + (number_of_registers * CLI_BINARY_REGISTER_SIZE))) break;
+            node_status = _CLI_binary_write_registers(frame);
+            break;
+        default:
+            break;
+        }
+    }
+    // Build error reply.
+    if (node_status != NODE_SUCCESS) {
+        frame[CLI_BINARY_FRAME_INDEX_OPCODE] = CLI_BINARY_OPCODE_ERROR;
+        data_size = 0;
+        ERROR_stack_add((ERROR_code_t) (ERROR_BASE_NODE + node_status));
+    }
+    // Send reply.
+    lmac_status = LMAC_HW_write_binary_frame(frame, (uint8_t) (CLI_BINARY_FRAME_INDEX_DATA + data_size));
+    LMAC_exit_error(CLI_ERROR_BASE_LMAC);
+errors:
+    return status;
+}
+#endif
+
+#if ((defined UNA_AT_CUSTOM_COMMANDS) && (defined MPMCM) && (defined MPMCM_ANALOG_MEASURE_ENABLE))
+/*******************************************************************/
+static AT_status_t _CLI_measure_statistics_callback(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    MEASURE_status_t measure_status = MEASURE_SUCCESS;
+    MEASURE_pipeline_statistics_t pipeline_statistics;
+    // Read statistics.
+    measure_status = MEASURE_get_pipeline_statistics(&pipeline_statistics);
+    _CLI_check_driver_status(measure_status, MEASURE_SUCCESS, ERROR_BASE_MEASURE);
+    // Print values.
+    AT_reply_add_integer((int32_t) pipeline_statistics.processed_period_count, STRING_FORMAT_DECIMAL, 0);
+    AT_reply_add_string(CLI_STRING_SEPARATOR);
+    AT_reply_add_integer((int32_t) pipeline_statistics.dropped_period_count, STRING_FORMAT_DECIMAL, 0);
+    AT_reply_add_string(CLI_STRING_SEPARATOR);
+    AT_reply_add_integer((int32_t) pipeline_statistics.backlog, STRING_FORMAT_DECIMAL, 0);
+    AT_reply_add_string(CLI_STRING_SEPARATOR);
+    AT_reply_add_integer((int32_t) pipeline_statistics.backlog_max, STRING_FORMAT_DECIMAL, 0);
+#ifdef MPMCM_ANALOG_CYCLE_COUNT
+    AT_reply_add_string(CLI_STRING_SEPARATOR);
+    AT_reply_add_integer((int32_t) pipeline_statistics.period_cycles_last, STRING_FORMAT_DECIMAL, 0);
+    AT_reply_add_string(CLI_STRING_SEPARATOR);
+    AT_reply_add_integer((int32_t) pipeline_statistics.period_cycles_max, STRING_FORMAT_DECIMAL, 0);
+#endif
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
 /*** CLI functions ***/
 
 /*******************************************************************/
@@ -80,14 +373,34 @@ CLI_status_t CLI_init(void) {
     CLI_status_t status = CLI_SUCCESS;
     UNA_AT_status_t una_at_status = UNA_AT_SUCCESS;
     UNA_AT_configuration_t una_at_config;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    AT_status_t at_status = AT_SUCCESS;
+    uint8_t idx = 0;
+#endif
     // Init context.
     cli_ctx.una_at_process_flag = 0;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    cli_ctx.binary_process_flag = 0;
+    cli_ctx.baud_rate_request = 0;
+#endif
     // Init AT driver.
     una_at_config.process_callback = &_CLI_una_at_process_callback;
     una_at_config.write_register_callback = &_CLI_write_register_callback;
     una_at_config.read_register_callback = &_CLI_read_register_callback;
     una_at_status = UNA_AT_init(&una_at_config);
     UNA_AT_exit_error(CLI_ERROR_BASE_UNA_AT);
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    // Get AT parser.
+    una_at_status = UNA_AT_get_parser(&(cli_ctx.at_parser_ptr));
+    UNA_AT_exit_error(CLI_ERROR_BASE_UNA_AT);
+    // Register custom commands.
+    for (idx = 0; idx < (sizeof(CLI_COMMANDS_LIST) / sizeof(AT_command_t)); idx++) {
+        at_status = AT_register_command(&(CLI_COMMANDS_LIST[idx]));
+        AT_exit_error(CLI_ERROR_BASE_AT);
+    }
+    // Binary frames are received on the same node address as AT commands.
+    LMAC_HW_set_binary_rx_callback(&_CLI_binary_rx_callback);
+#endif
 errors:
     return status;
 }
@@ -108,6 +421,9 @@ CLI_status_t CLI_process(void) {
     // Local variables.
     CLI_status_t status = CLI_SUCCESS;
     UNA_AT_status_t una_at_status = UNA_AT_SUCCESS;
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+#endif
     // Check process flag.
     if (cli_ctx.una_at_process_flag != 0) {
         // Clear flag.
@@ -116,6 +432,26 @@ CLI_status_t CLI_process(void) {
         una_at_status = UNA_AT_process();
         UNA_AT_exit_error(CLI_ERROR_BASE_UNA_AT);
     }
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    // Check binary frame.
+    if (cli_ctx.binary_process_flag != 0) {
+        // Clear flag.
+        cli_ctx.binary_process_flag = 0;
+        // Process frame.
+        status = _CLI_binary_process();
+        if (status != CLI_SUCCESS) goto errors;
+    }
+    // Check baud rate switch request.
+    if (cli_ctx.baud_rate_request != 0) {
+        lmac_status = LMAC_HW_set_baud_rate(cli_ctx.baud_rate_request);
+        cli_ctx.baud_rate_request = 0;
+        LMAC_exit_error(CLI_ERROR_BASE_LMAC);
+    }
+    // Fall back to default baud rate when the node has not been addressed for too long.
+    // Note: this check is also performed on each RTC wake-up, so that the node does not remain at a negotiated baud rate when the bus is silent.
+    lmac_status = LMAC_HW_check_baud_rate_fallback();
+    LMAC_exit_error(CLI_ERROR_BASE_LMAC);
+#endif
 errors:
     return status;
 }
@@ -11,6 +11,7 @@
 #include "error.h"
 #include "led.h"
 #include "neom8x.h"
+#include "systick.h"
 #include "types.h"
 
 /*** GPS structures ***/
@@ -23,11 +24,14 @@ typedef enum {
     // Driver errors.
     GPS_SUCCESS = 0,
     GPS_ERROR_NULL_PARAMETER,
+    GPS_ERROR_ACQUISITION_TYPE,
+    GPS_ERROR_STATE,
     // Low level drivers errors.
     GPS_ERROR_BASE_NEOM8N = ERROR_BASE_STEP,
     GPS_ERROR_BASE_LED = (GPS_ERROR_BASE_NEOM8N + NEOM8X_ERROR_BASE_LAST),
+    GPS_ERROR_BASE_SYSTICK = (GPS_ERROR_BASE_LED + LED_ERROR_BASE_LAST),
     // Last base value.
-    GPS_ERROR_BASE_LAST = (GPS_ERROR_BASE_LED + LED_ERROR_BASE_LAST)
+    GPS_ERROR_BASE_LAST = (GPS_ERROR_BASE_SYSTICK + SYSTICK_ERROR_BASE_LAST)
 } GPS_status_t;
 
 #ifdef GPSM
@@ -42,6 +46,42 @@ typedef enum {
     GPS_ACQUISITION_ERROR_LAST
 } GPS_acquisition_status_t;
 
+/*!******************************************************************
+ * \enum GPS_acquisition_type_t
+ * \brief GPS acquisition types list.
+ *******************************************************************/
+typedef enum {
+    GPS_ACQUISITION_TYPE_TIME = 0,
+    GPS_ACQUISITION_TYPE_POSITION,
+    GPS_ACQUISITION_TYPE_LAST
+} GPS_acquisition_type_t;
+
+/*!******************************************************************
+ * \enum GPS_state_t
+ * \brief GPS driver states.
+ *******************************************************************/
+typedef enum {
+    GPS_STATE_IDLE = 0,
+    GPS_STATE_ACQUISITION,
+    GPS_STATE_LAST
+} GPS_state_t;
+
+/*!******************************************************************
+ * \fn GPS_completion_cb_t
+ * \brief GPS acquisition completion callback.
+ *******************************************************************/
+typedef void (*GPS_completion_cb_t)(GPS_acquisition_status_t acquisition_status, uint32_t acquisition_duration_seconds);
+
+/*!******************************************************************
+ * \struct GPS_acquisition_t
+ * \brief GPS acquisition parameters.
+ *******************************************************************/
+typedef struct {
+    GPS_acquisition_type_t type;
+    uint32_t timeout_seconds;
+    GPS_completion_cb_t completion_callback;
+} GPS_acquisition_t;
+
 /*!******************************************************************
  * \typedef GPS_time_t
  * \brief GPS time structure.
@@ -60,6 +100,18 @@ typedef NEOM8X_position_t GPS_position_t;
  *******************************************************************/
 typedef NEOM8X_timepulse_configuration_t GPS_timepulse_configuration_t;
 
+/*!******************************************************************
+ * \struct GPS_statistics_t
+ * \brief GPS acquisition diagnostic counters.
+ *******************************************************************/
+typedef struct {
+    uint32_t uart_rx_byte_count;
+    uint32_t uart_rx_irq_count;
+    uint32_t uart_rx_overrun_count;
+    uint32_t wake_up_count;
+    uint32_t sleep_time_ms;
+} GPS_statistics_t;
+
 /*** GPS functions ***/
 
 /*!******************************************************************
@@ -81,26 +133,67 @@ GPS_status_t GPS_init(void);
 GPS_status_t GPS_de_init(void);
 
 /*!******************************************************************
- * \fn GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status)
- * \brief Perform GPS position acquisition.
- * \param[in]   timeout_seconds: Fix timeout in seconds.
- * \param[out]  gps_time: Pointer to the GPS time if found.
- * \param[out]  acquisition_duration_seconds; Pointer to integer that will contain the GPS acquisition duration in seconds.
- * \param[out]  acquisition_success: Pointer to the acquisition success flag.
+ * \fn GPS_status_t GPS_start_acquisition(GPS_acquisition_t* acquisition)
+ * \brief Start GPS acquisition.
+ * \param[in]   acquisition: Pointer to the acquisition parameters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_start_acquisition(GPS_acquisition_t* acquisition);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_stop_acquisition(void)
+ * \brief Abort current GPS acquisition (the completion callback is not called).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_stop_acquisition(void);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_process(void)
+ * \brief Process GPS acquisition, this function has to be called after each MCU wake-up while an acquisition is running.
+ * \param[in]   none
+ * \param[out]  none
  * \retval      Function execution status.
  *******************************************************************/
-GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status);
+GPS_status_t GPS_process(void);
+
+/*!******************************************************************
+ * \fn GPS_state_t GPS_get_state(void)
+ * \brief Get GPS driver state.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current GPS state.
+ *******************************************************************/
+GPS_state_t GPS_get_state(void);
 
 /*!******************************************************************
- * \fn GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status)
- * \brief Perform GPS position acquisition.
- * \param[in]   timeout_seconds: Fix timeout in seconds.
- * \param[out]  gps_position: Pointer to the GPS position if found.
- * \param[out]  acquisition_duration_seconds; Pointer to integer that will contain the GPS acquisition duration in seconds.
- * \param[out]  acquisition_success: Pointer to the acquisition success flag.
+ * \fn GPS_status_t GPS_get_time(GPS_time_t* gps_time)
+ * \brief Read the GPS time of the last successful acquisition.
+ * \param[in]   none
+ * \param[out]  gps_time: Pointer to the GPS time.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_get_time(GPS_time_t* gps_time);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_position(GPS_position_t* gps_position)
+ * \brief Read the GPS position of the last successful acquisition.
+ * \param[in]   none
+ * \param[out]  gps_position: Pointer to the GPS position.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_get_position(GPS_position_t* gps_position);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_statistics(GPS_statistics_t* statistics)
+ * \brief Read the diagnostic counters of the last or current acquisition.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the acquisition statistics.
  * \retval      Function execution status.
  *******************************************************************/
-GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status);
+GPS_status_t GPS_get_statistics(GPS_statistics_t* statistics);
 
 /*!******************************************************************
  * \fn GPS_status_t GPS_set_backup_voltage(uint8_t state)
@@ -7,88 +7,421 @@
 
 #include "gps.h"
 
+#include "dsm_flags.h"
 #include "error.h"
 #include "error_base.h"
-#include "iwdg.h"
 #include "neom8x.h"
-#include "pwr.h"
+#include "neom8x_hw.h"
+#ifdef GPSM_UART_DMA
+#include "neom8x_hw_dma.h"
+#endif
+#include "neom8x_hw_statistics.h"
+#ifdef GPSM_UBX_PROTOCOL
+#include "neom8x_hw_ubx.h"
+#endif
 #include "rtc.h"
+#include "systick.h"
 #include "types.h"
 
 #ifdef GPSM
 
+/*** GPS local macros ***/
+
+#ifdef GPSM_UBX_PROTOCOL
+#define GPS_UBX_SYNC_CHAR_1                         0xB5
+#define GPS_UBX_SYNC_CHAR_2                         0x62
+
+#define GPS_UBX_HEADER_SIZE_BYTES                   4
+#define GPS_UBX_CHECKSUM_SIZE_BYTES                 2
+
+#define GPS_UBX_CLASS_NAV                           0x01
+#define GPS_UBX_CLASS_CFG                           0x06
+#define GPS_UBX_CLASS_NMEA                          0xF0
+
+#define GPS_UBX_ID_NAV_PVT                          0x07
+#define GPS_UBX_ID_NAV_TIMEUTC                      0x21
+#define GPS_UBX_ID_CFG_MSG                          0x01
+
+#define GPS_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES          3
+#define GPS_UBX_CFG_MSG_FRAME_SIZE_BYTES            (2 + GPS_UBX_HEADER_SIZE_BYTES + GPS_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES + GPS_UBX_CHECKSUM_SIZE_BYTES)
+
+#define GPS_UBX_NAV_TIMEUTC_PAYLOAD_SIZE_BYTES      20
+#define GPS_UBX_NAV_TIMEUTC_VALID_UTC               0x04
+
+#define GPS_UBX_NAV_PVT_PAYLOAD_SIZE_BYTES          92
+#define GPS_UBX_NAV_PVT_FIX_TYPE_3D                 3
+#define GPS_UBX_NAV_PVT_FIX_TYPE_GNSS_DR            4
+#define GPS_UBX_NAV_PVT_FLAGS_GNSS_FIX_OK           0x01
+
+#define GPS_UBX_PAYLOAD_SIZE_MAX_BYTES              GPS_UBX_NAV_PVT_PAYLOAD_SIZE_BYTES
+
+#define GPS_UBX_COORDINATE_DEGREE_SCALE             10000000
+#define GPS_UBX_ALTITUDE_MM_PER_M                   1000
+
+#define GPS_UBX_ALTITUDE_STABILITY_FIX_COUNT        5
+#define GPS_UBX_ALTITUDE_STABILITY_DELTA_METERS     2
+#endif
+
 /*** GPS local structures ***/
 
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+typedef enum {
+    GPS_UBX_PARSER_STATE_SYNC_1 = 0,
+    GPS_UBX_PARSER_STATE_SYNC_2,
+    GPS_UBX_PARSER_STATE_HEADER,
+    GPS_UBX_PARSER_STATE_PAYLOAD,
+    GPS_UBX_PARSER_STATE_CHECKSUM_A,
+    GPS_UBX_PARSER_STATE_CHECKSUM_B,
+    GPS_UBX_PARSER_STATE_LAST
+} GPS_ubx_parser_state_t;
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+typedef struct {
+    volatile GPS_ubx_parser_state_t state;
+    volatile uint8_t frame_ready_flag;
+    uint8_t header[GPS_UBX_HEADER_SIZE_BYTES];
+    uint8_t payload[GPS_UBX_PAYLOAD_SIZE_MAX_BYTES];
+    uint16_t payload_size;
+    uint16_t idx;
+    uint8_t ck_a;
+    uint8_t ck_b;
+} GPS_ubx_parser_t;
+#endif
+
 /*******************************************************************/
 typedef struct {
+    GPS_state_t state;
     volatile uint8_t process_flag;
     NEOM8X_acquisition_status_t acquisition_status;
+    NEOM8X_acquisition_status_t expected_acquisition_status;
+    uint32_t start_time_seconds;
+    uint32_t timeout_seconds;
+    GPS_completion_cb_t completion_callback;
+    uint32_t wake_up_count;
+    uint32_t sleep_time_ms;
+    uint32_t sleep_time_remainder_us;
+    uint32_t sleep_start_timestamp;
+#ifdef GPSM_UBX_PROTOCOL
+    GPS_acquisition_type_t acquisition_type;
+    GPS_ubx_parser_t ubx_parser;
+    GPS_time_t gps_time;
+    GPS_position_t gps_position;
+    int32_t previous_altitude;
+    uint8_t stable_fix_count;
+#endif
 } GPS_context_t;
 
 /*** GPS local global variables ***/
 
 static GPS_context_t gps_ctx = {
+    .state = GPS_STATE_IDLE,
     .process_flag = 0,
-    .acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL
+    .acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL,
+    .expected_acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL,
+    .start_time_seconds = 0,
+    .timeout_seconds = 0,
+    .completion_callback = NULL,
+    .wake_up_count = 0,
+    .sleep_time_ms = 0,
+    .sleep_time_remainder_us = 0,
+    .sleep_start_timestamp = 0
+};
+
+#ifdef GPSM_UBX_PROTOCOL
+// NMEA sentences enabled by default on the receiver UART.
+static const uint8_t GPS_UBX_NMEA_ID[] = {
+    0x00, // GGA.
+    0x01, // GLL.
+    0x02, // GSA.
+    0x03, // GSV.
+    0x04, // RMC.
+    0x05  // VTG.
 };
+#endif
 
 /*** GPS local functions ***/
 
+#ifndef GPSM_UBX_PROTOCOL
 /*******************************************************************/
 static void _GPS_process_callback(void) {
     // Set local flag.
     gps_ctx.process_flag = 1;
 }
+#endif
 
+#ifndef GPSM_UBX_PROTOCOL
 /*******************************************************************/
 static void _GPS_completion_callback(NEOM8X_acquisition_status_t acquisition_status) {
     // Update global variable.
     gps_ctx.acquisition_status = acquisition_status;
 }
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _GPS_ubx_update_checksum(uint8_t data, uint8_t* ck_a, uint8_t* ck_b) {
+    // 8-bit Fletcher algorithm.
+    (*ck_a) = (uint8_t) ((*ck_a) + data);
+    (*ck_b) = (uint8_t) ((*ck_b) + (*ck_a));
+}
+#endif
 
+#ifdef GPSM_UBX_PROTOCOL
 /*******************************************************************/
-static GPS_status_t _GPS_perform_acquisition(NEOM8X_gps_data_t gps_data, NEOM8X_acquisition_status_t expected_acquisition_status, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds) {
+static void _GPS_ubx_reset_parser(void) {
+    // Reset parser.
+    gps_ctx.ubx_parser.idx = 0;
+    gps_ctx.ubx_parser.payload_size = 0;
+    gps_ctx.ubx_parser.ck_a = 0;
+    gps_ctx.ubx_parser.ck_b = 0;
+    gps_ctx.ubx_parser.frame_ready_flag = 0;
+    gps_ctx.ubx_parser.state = GPS_UBX_PARSER_STATE_SYNC_1;
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _GPS_ubx_rx_irq_callback(uint8_t data) {
     // Local variables.
-    GPS_status_t status = GPS_SUCCESS;
-    LED_status_t led_status = LED_SUCCESS;
-    NEOM8X_status_t neom8x_status;
-    NEOM8X_acquisition_t gps_acquisition;
-    uint32_t start_time = RTC_get_uptime_seconds();
-    // Reset data.
-    gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
-    (*acquisition_duration_seconds) = 0;
-    // Configure GPS acquisition.
-    gps_acquisition.gps_data = gps_data;
-    gps_acquisition.completion_callback = &_GPS_completion_callback;
-    gps_acquisition.process_callback = &_GPS_process_callback;
-    // Start acquisition.
-    neom8x_status = NEOM8X_start_acquisition(&gps_acquisition);
-    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-    // Processing loop.
-    while (RTC_get_uptime_seconds() < (start_time + timeout_seconds)) {
-        // Enter sleep mode.
-        IWDG_reload();
-        PWR_enter_sleep_mode(PWR_SLEEP_MODE_NORMAL);
-        // Update acquisition duration.
-        (*acquisition_duration_seconds) = (RTC_get_uptime_seconds() - start_time);
-        // Check flag.
-        if (gps_ctx.process_flag != 0) {
-            // Process driver.
-            neom8x_status = NEOM8X_process();
-            NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-            // Blink LED.
-            led_status = LED_start_single_blink(500, LED_COLOR_YELLOW);
-            LED_exit_error(GPS_ERROR_BASE_LED);
+    GPS_ubx_parser_t* parser = &gps_ctx.ubx_parser;
+    // Ignore incoming bytes until the last frame has been decoded.
+    if ((parser->frame_ready_flag) != 0) return;
+    // Frame parser.
+    switch (parser->state) {
+    case GPS_UBX_PARSER_STATE_SYNC_1:
+        if (data == GPS_UBX_SYNC_CHAR_1) {
+            parser->state = GPS_UBX_PARSER_STATE_SYNC_2;
+        }
+        break;
+    case GPS_UBX_PARSER_STATE_SYNC_2:
+        if (data == GPS_UBX_SYNC_CHAR_2) {
+            parser->idx = 0;
+            parser->ck_a = 0;
+            parser->ck_b = 0;
+            parser->state = GPS_UBX_PARSER_STATE_HEADER;
+        }
+        else if (data != GPS_UBX_SYNC_CHAR_1) {
+            parser->state = GPS_UBX_PARSER_STATE_SYNC_1;
+        }
+        break;
+    case GPS_UBX_PARSER_STATE_HEADER:
+        // Class, ID and little-endian payload length.
+        parser->header[parser->idx++] = data;
+        _GPS_ubx_update_checksum(data, &(parser->ck_a), &(parser->ck_b));
+        if ((parser->idx) < GPS_UBX_HEADER_SIZE_BYTES) break;
+        parser->payload_size = (uint16_t) ((parser->header[2]) | ((parser->header[3]) << 8));
+        parser->idx = 0;
+        // Discard messages which are not used by the driver.
+        if ((parser->payload_size) > GPS_UBX_PAYLOAD_SIZE_MAX_BYTES) {
+            parser->state = GPS_UBX_PARSER_STATE_SYNC_1;
+        }
+        else {
+            parser->state = ((parser->payload_size) == 0) ? GPS_UBX_PARSER_STATE_CHECKSUM_A : GPS_UBX_PARSER_STATE_PAYLOAD;
+        }
+        break;
+    case GPS_UBX_PARSER_STATE_PAYLOAD:
+        parser->payload[parser->idx++] = data;
+        _GPS_ubx_update_checksum(data, &(parser->ck_a), &(parser->ck_b));
+        if ((parser->idx) >= (parser->payload_size)) {
+            parser->state = GPS_UBX_PARSER_STATE_CHECKSUM_A;
         }
-        // Check acquisition status.
-        if (gps_ctx.acquisition_status == expected_acquisition_status) break;
+        break;
+    case GPS_UBX_PARSER_STATE_CHECKSUM_A:
+        parser->state = (data == (parser->ck_a)) ? GPS_UBX_PARSER_STATE_CHECKSUM_B : GPS_UBX_PARSER_STATE_SYNC_1;
+        break;
+    case GPS_UBX_PARSER_STATE_CHECKSUM_B:
+        // Valid frame: wake-up the process.
+        if (data == (parser->ck_b)) {
+            parser->frame_ready_flag = 1;
+            gps_ctx.process_flag = 1;
+        }
+        parser->state = GPS_UBX_PARSER_STATE_SYNC_1;
+        break;
+    default:
+        parser->state = GPS_UBX_PARSER_STATE_SYNC_1;
+        break;
     }
-    neom8x_status = NEOM8X_stop_acquisition();
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static GPS_status_t _GPS_ubx_set_message_rate(uint8_t message_class, uint8_t message_id, uint8_t rate) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    uint8_t frame[GPS_UBX_CFG_MSG_FRAME_SIZE_BYTES];
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    uint8_t idx = 0;
+    // Build UBX-CFG-MSG frame.
+    frame[0] = GPS_UBX_SYNC_CHAR_1;
+    frame[1] = GPS_UBX_SYNC_CHAR_2;
+    frame[2] = GPS_UBX_CLASS_CFG;
+    frame[3] = GPS_UBX_ID_CFG_MSG;
+    frame[4] = GPS_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES;
+    frame[5] = 0x00;
+    frame[6] = message_class;
+    frame[7] = message_id;
+    frame[8] = rate;
+    // Compute checksum from class to the end of the payload.
+    for (idx = 2; idx < (GPS_UBX_CFG_MSG_FRAME_SIZE_BYTES - GPS_UBX_CHECKSUM_SIZE_BYTES); idx++) {
+        _GPS_ubx_update_checksum(frame[idx], &ck_a, &ck_b);
+    }
+    frame[GPS_UBX_CFG_MSG_FRAME_SIZE_BYTES - 2] = ck_a;
+    frame[GPS_UBX_CFG_MSG_FRAME_SIZE_BYTES - 1] = ck_b;
+    // Send message.
+    neom8x_status = NEOM8X_HW_send_message(frame, GPS_UBX_CFG_MSG_FRAME_SIZE_BYTES);
     NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
 errors:
-    NEOM8X_stop_acquisition();
     return status;
 }
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static GPS_status_t _GPS_ubx_configure(GPS_acquisition_type_t acquisition_type) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    uint8_t idx = 0;
+    // Note: the configuration is not saved in the receiver non-volatile memory since it is powered off between acquisitions.
+    for (idx = 0; idx < sizeof(GPS_UBX_NMEA_ID); idx++) {
+        status = _GPS_ubx_set_message_rate(GPS_UBX_CLASS_NMEA, GPS_UBX_NMEA_ID[idx], 0);
+        if (status != GPS_SUCCESS) goto errors;
+    }
+    // Enable the navigation message required by the acquisition.
+    status = _GPS_ubx_set_message_rate(GPS_UBX_CLASS_NAV, GPS_UBX_ID_NAV_TIMEUTC, (acquisition_type == GPS_ACQUISITION_TYPE_TIME) ? 1 : 0);
+    if (status != GPS_SUCCESS) goto errors;
+    status = _GPS_ubx_set_message_rate(GPS_UBX_CLASS_NAV, GPS_UBX_ID_NAV_PVT, (acquisition_type == GPS_ACQUISITION_TYPE_POSITION) ? 1 : 0);
+    if (status != GPS_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static uint32_t _GPS_ubx_read_u32(uint8_t* payload, uint8_t offset) {
+    // Little-endian field.
+    return (((uint32_t) payload[offset]) | ((uint32_t) payload[offset + 1] << 8) | ((uint32_t) payload[offset + 2] << 16) | ((uint32_t) payload[offset + 3] << 24));
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _GPS_ubx_convert_coordinate(int32_t coordinate, uint32_t* degrees, uint32_t* minutes, uint32_t* seconds, uint8_t* positive_flag) {
+    // Local variables.
+    uint32_t coordinate_abs = 0;
+    uint32_t minutes_e5 = 0;
+    // Sign.
+    (*positive_flag) = (coordinate >= 0) ? 1 : 0;
+    coordinate_abs = (coordinate >= 0) ? ((uint32_t) coordinate) : ((uint32_t) (-coordinate));
+    // Convert from 1e-7 degrees to the NMEA ddmm.mmmmm format used by the driver.
+    (*degrees) = (coordinate_abs / GPS_UBX_COORDINATE_DEGREE_SCALE);
+    minutes_e5 = ((coordinate_abs % GPS_UBX_COORDINATE_DEGREE_SCALE) * 60) / 100;
+    (*minutes) = (minutes_e5 / 100000);
+    (*seconds) = (minutes_e5 % 100000);
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _GPS_ubx_decode_nav_timeutc(uint8_t* payload) {
+    // Check validity.
+    if ((payload[19] & GPS_UBX_NAV_TIMEUTC_VALID_UTC) == 0) return;
+    // Update time.
+    gps_ctx.gps_time.year = (uint16_t) (payload[12] | (payload[13] << 8));
+    gps_ctx.gps_time.month = payload[14];
+    gps_ctx.gps_time.date = payload[15];
+    gps_ctx.gps_time.hours = payload[16];
+    gps_ctx.gps_time.minutes = payload[17];
+    gps_ctx.gps_time.seconds = payload[18];
+    gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FOUND;
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _GPS_ubx_decode_nav_pvt(uint8_t* payload) {
+    // Local variables.
+    uint32_t degrees = 0;
+    uint32_t minutes = 0;
+    uint32_t seconds = 0;
+    uint8_t positive_flag = 0;
+    int32_t altitude = 0;
+    int32_t altitude_delta = 0;
+    // Check fix.
+    if ((((payload[20]) != GPS_UBX_NAV_PVT_FIX_TYPE_3D) && ((payload[20]) != GPS_UBX_NAV_PVT_FIX_TYPE_GNSS_DR)) || (((payload[21]) & GPS_UBX_NAV_PVT_FLAGS_GNSS_FIX_OK) == 0)) {
+        gps_ctx.stable_fix_count = 0;
+        return;
+    }
+    // Latitude.
+    _GPS_ubx_convert_coordinate((int32_t) _GPS_ubx_read_u32(payload, 28), &degrees, &minutes, &seconds, &positive_flag);
+    gps_ctx.gps_position.lat_degrees = degrees;
+    gps_ctx.gps_position.lat_minutes = minutes;
+    gps_ctx.gps_position.lat_seconds = seconds;
+    gps_ctx.gps_position.lat_north_flag = positive_flag;
+    // Longitude.
+    _GPS_ubx_convert_coordinate((int32_t) _GPS_ubx_read_u32(payload, 24), &degrees, &minutes, &seconds, &positive_flag);
+    gps_ctx.gps_position.long_degrees = degrees;
+    gps_ctx.gps_position.long_minutes = minutes;
+    gps_ctx.gps_position.long_seconds = seconds;
+    gps_ctx.gps_position.long_east_flag = positive_flag;
+    // Altitude above mean sea level.
+    altitude = (((int32_t) _GPS_ubx_read_u32(payload, 36)) / GPS_UBX_ALTITUDE_MM_PER_M);
+    gps_ctx.gps_position.altitude = (altitude > 0) ? ((uint32_t) altitude) : 0;
+    // Altitude stability filter.
+    altitude_delta = (altitude - gps_ctx.previous_altitude);
+    if ((gps_ctx.acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) && (altitude_delta <= GPS_UBX_ALTITUDE_STABILITY_DELTA_METERS) && (altitude_delta >= (-GPS_UBX_ALTITUDE_STABILITY_DELTA_METERS))) {
+        gps_ctx.stable_fix_count++;
+    }
+    else {
+        gps_ctx.stable_fix_count = 0;
+    }
+    gps_ctx.previous_altitude = altitude;
+    gps_ctx.acquisition_status = (gps_ctx.stable_fix_count >= GPS_UBX_ALTITUDE_STABILITY_FIX_COUNT) ? NEOM8X_ACQUISITION_STATUS_STABLE : NEOM8X_ACQUISITION_STATUS_FOUND;
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _GPS_ubx_decode_frame(void) {
+    // Local variables.
+    GPS_ubx_parser_t* parser = &gps_ctx.ubx_parser;
+    // Check frame.
+    if ((parser->frame_ready_flag) == 0) return;
+    if ((parser->header[0]) == GPS_UBX_CLASS_NAV) {
+        // Check message.
+        if (((parser->header[1]) == GPS_UBX_ID_NAV_TIMEUTC) && ((parser->payload_size) == GPS_UBX_NAV_TIMEUTC_PAYLOAD_SIZE_BYTES) && (gps_ctx.acquisition_type == GPS_ACQUISITION_TYPE_TIME)) {
+            _GPS_ubx_decode_nav_timeutc(parser->payload);
+        }
+        if (((parser->header[1]) == GPS_UBX_ID_NAV_PVT) && ((parser->payload_size) == GPS_UBX_NAV_PVT_PAYLOAD_SIZE_BYTES) && (gps_ctx.acquisition_type == GPS_ACQUISITION_TYPE_POSITION)) {
+            _GPS_ubx_decode_nav_pvt(parser->payload);
+        }
+    }
+    // Release buffer.
+    parser->frame_ready_flag = 0;
+}
+#endif
+
+/*******************************************************************/
+static NEOM8X_status_t _GPS_stop_driver(void) {
+    // Local variables.
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#ifdef GPSM_UBX_PROTOCOL
+    // Release UART.
+    NEOM8X_HW_set_ubx_rx_irq_callback(NULL);
+    neom8x_status = NEOM8X_HW_stop_rx();
+#else
+    neom8x_status = NEOM8X_stop_acquisition();
+#endif
+    // Stop time-in-sleep measurement.
+    SYSTICK_stop();
+    return neom8x_status;
+}
 
 /*** GPS functions ***/
 
@@ -109,64 +442,244 @@ GPS_status_t GPS_de_init(void) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
     NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
-    // Init GPS module.
+    // Abort pending acquisition.
+    if (gps_ctx.state != GPS_STATE_IDLE) {
+        gps_ctx.state = GPS_STATE_IDLE;
+        neom8x_status = _GPS_stop_driver();
+        NEOM8X_stack_error(ERROR_BASE_GPS + GPS_ERROR_BASE_NEOM8N);
+    }
+    // Release GPS module.
     neom8x_status = NEOM8X_de_init();
     NEOM8X_stack_error(ERROR_BASE_GPS + GPS_ERROR_BASE_NEOM8N);
     return status;
 }
 
 /*******************************************************************/
-GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
+GPS_status_t GPS_start_acquisition(GPS_acquisition_t* acquisition) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
     NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    SYSTICK_status_t systick_status = SYSTICK_SUCCESS;
+#ifndef GPSM_UBX_PROTOCOL
+    NEOM8X_acquisition_t gps_acquisition;
+#endif
     // Check parameters.
-    if ((acquisition_status == NULL) || (acquisition_status == NULL)) {
+    if ((acquisition == NULL) || ((acquisition->completion_callback) == NULL)) {
         status = GPS_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Reset output data.
-    (*acquisition_duration_seconds) = 0;
-    (*acquisition_status) = GPS_ACQUISITION_ERROR_TIMEOUT;
-    // Perform time acquisition.
-    status = _GPS_perform_acquisition(NEOM8X_GPS_DATA_TIME, NEOM8X_ACQUISITION_STATUS_FOUND, timeout_seconds, acquisition_duration_seconds);
+    // Check state.
+    if (gps_ctx.state != GPS_STATE_IDLE) {
+        status = GPS_ERROR_STATE;
+        goto errors;
+    }
+    // Check acquisition type.
+    switch (acquisition->type) {
+    case GPS_ACQUISITION_TYPE_TIME:
+#ifndef GPSM_UBX_PROTOCOL
+        gps_acquisition.gps_data = NEOM8X_GPS_DATA_TIME;
+#endif
+        gps_ctx.expected_acquisition_status = NEOM8X_ACQUISITION_STATUS_FOUND;
+        break;
+    case GPS_ACQUISITION_TYPE_POSITION:
+#ifndef GPSM_UBX_PROTOCOL
+        gps_acquisition.gps_data = NEOM8X_GPS_DATA_POSITION;
+#endif
+        gps_ctx.expected_acquisition_status = NEOM8X_ACQUISITION_STATUS_STABLE;
+        break;
+    default:
+        status = GPS_ERROR_ACQUISITION_TYPE;
+        goto errors;
+    }
+    // Reset data.
+    gps_ctx.process_flag = 0;
+    gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+    gps_ctx.start_time_seconds = RTC_get_uptime_seconds();
+    gps_ctx.timeout_seconds = (acquisition->timeout_seconds);
+    gps_ctx.completion_callback = (acquisition->completion_callback);
+    gps_ctx.wake_up_count = 0;
+    gps_ctx.sleep_time_ms = 0;
+    gps_ctx.sleep_time_remainder_us = 0;
+    NEOM8X_HW_reset_statistics();
+#ifdef GPSM_UBX_PROTOCOL
+    gps_ctx.acquisition_type = (acquisition->type);
+    gps_ctx.previous_altitude = 0;
+    gps_ctx.stable_fix_count = 0;
+    _GPS_ubx_reset_parser();
+    // Select UBX navigation messages.
+    status = _GPS_ubx_configure(acquisition->type);
     if (status != GPS_SUCCESS) goto errors;
-    // Check status.
-    if (gps_ctx.acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) {
-        // Read data.
-        neom8x_status = NEOM8X_get_time(gps_time);
+    // Redirect received bytes to the UBX parser.
+    NEOM8X_HW_set_ubx_rx_irq_callback(&_GPS_ubx_rx_irq_callback);
+    neom8x_status = NEOM8X_HW_start_rx();
+    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#else
+    // Configure GPS acquisition.
+    gps_acquisition.completion_callback = &_GPS_completion_callback;
+    gps_acquisition.process_callback = &_GPS_process_callback;
+    // Start acquisition.
+    neom8x_status = NEOM8X_start_acquisition(&gps_acquisition);
+    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#endif
+    // Start time-in-sleep measurement.
+    // Note: the measurement is only a diagnostic, the acquisition is not aborted in case of failure.
+    systick_status = SYSTICK_start();
+    SYSTICK_stack_error(ERROR_BASE_GPS + GPS_ERROR_BASE_SYSTICK);
+    gps_ctx.sleep_start_timestamp = SYSTICK_get_timestamp();
+    // Update state.
+    gps_ctx.state = GPS_STATE_ACQUISITION;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_stop_acquisition(void) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    // Check state.
+    if (gps_ctx.state == GPS_STATE_IDLE) goto errors;
+    // Update state.
+    gps_ctx.state = GPS_STATE_IDLE;
+    // Stop acquisition.
+    neom8x_status = _GPS_stop_driver();
+    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_process(void) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    LED_status_t led_status = LED_SUCCESS;
+#ifndef GPSM_UBX_PROTOCOL
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#endif
+    GPS_acquisition_status_t acquisition_status = GPS_ACQUISITION_ERROR_TIMEOUT;
+    uint32_t acquisition_duration_seconds = 0;
+    // Check state.
+    if (gps_ctx.state == GPS_STATE_IDLE) goto end;
+    // Update acquisition duration and statistics.
+    acquisition_duration_seconds = (RTC_get_uptime_seconds() - gps_ctx.start_time_seconds);
+    gps_ctx.wake_up_count++;
+    // Time elapsed since the previous call is spent in sleep mode, except for the other main loop tasks.
+    // Note: the RTC wakes the MCU up every second, so the interval never exceeds the SysTick period.
+    gps_ctx.sleep_time_remainder_us += SYSTICK_get_elapsed_us(gps_ctx.sleep_start_timestamp);
+    gps_ctx.sleep_time_ms += (gps_ctx.sleep_time_remainder_us / 1000);
+    gps_ctx.sleep_time_remainder_us %= 1000;
+#ifdef GPSM_UART_DMA
+    // Extract received bytes in main context.
+    NEOM8X_HW_flush_rx_buffer();
+#endif
+    // Check flag.
+    if (gps_ctx.process_flag != 0) {
+        // Clear flag.
+        gps_ctx.process_flag = 0;
+#ifdef GPSM_UBX_PROTOCOL
+        // Decode received frame.
+        _GPS_ubx_decode_frame();
+#else
+        // Process driver.
+        neom8x_status = NEOM8X_process();
         NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-        // Update status.
-        (*acquisition_status) = GPS_ACQUISITION_SUCCESS;
+#endif
+        // Blink LED.
+        led_status = LED_start_single_blink(500, LED_COLOR_YELLOW);
+        LED_exit_error(GPS_ERROR_BASE_LED);
+    }
+    // Check acquisition status and timeout.
+    if ((gps_ctx.acquisition_status != gps_ctx.expected_acquisition_status) && (acquisition_duration_seconds < gps_ctx.timeout_seconds)) {
+        // Start next sleep period.
+        gps_ctx.sleep_start_timestamp = SYSTICK_get_timestamp();
+        goto end;
     }
+    // Stop acquisition.
+    status = GPS_stop_acquisition();
+    if (status != GPS_SUCCESS) goto errors;
+    // Update status.
+    if (gps_ctx.acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) {
+        acquisition_status = GPS_ACQUISITION_SUCCESS;
+    }
+    // Notify upper layer.
+    gps_ctx.completion_callback(acquisition_status, acquisition_duration_seconds);
+end:
+    return status;
 errors:
+    // Abort acquisition.
+    gps_ctx.state = GPS_STATE_IDLE;
+    _GPS_stop_driver();
     return status;
 }
 
 /*******************************************************************/
-GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
+GPS_state_t GPS_get_state(void) {
+    return (gps_ctx.state);
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_time(GPS_time_t* gps_time) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
+#ifndef GPSM_UBX_PROTOCOL
     NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#endif
     // Check parameters.
-    if ((acquisition_duration_seconds == NULL) || (acquisition_status == NULL)) {
+    if (gps_time == NULL) {
         status = GPS_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Reset output data.
-    (*acquisition_duration_seconds) = 0;
-    (*acquisition_status) = GPS_ACQUISITION_ERROR_TIMEOUT;
-    // Perform position acquisition.
-    status = _GPS_perform_acquisition(NEOM8X_GPS_DATA_POSITION, NEOM8X_ACQUISITION_STATUS_STABLE, timeout_seconds, acquisition_duration_seconds);
-    if (status != GPS_SUCCESS) goto errors;
-    // Check status.
-    if (gps_ctx.acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) {
-        // Read data.
-        neom8x_status = NEOM8X_get_position(gps_position);
-        NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-        // Update status.
-        (*acquisition_status) = GPS_ACQUISITION_SUCCESS;
+    // Read data.
+#ifdef GPSM_UBX_PROTOCOL
+    (*gps_time) = gps_ctx.gps_time;
+#else
+    neom8x_status = NEOM8X_get_time(gps_time);
+    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#endif
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_position(GPS_position_t* gps_position) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+#ifndef GPSM_UBX_PROTOCOL
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#endif
+    // Check parameters.
+    if (gps_position == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Read data.
+#ifdef GPSM_UBX_PROTOCOL
+    (*gps_position) = gps_ctx.gps_position;
+#else
+    neom8x_status = NEOM8X_get_position(gps_position);
+    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#endif
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_statistics(GPS_statistics_t* statistics) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    NEOM8X_HW_statistics_t neom8x_hw_statistics;
+    // Check parameters.
+    if (statistics == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
     }
+    // Read counters.
+    NEOM8X_HW_get_statistics(&neom8x_hw_statistics);
+    statistics->uart_rx_byte_count = neom8x_hw_statistics.rx_byte_count;
+    statistics->uart_rx_irq_count = neom8x_hw_statistics.rx_irq_count;
+    statistics->uart_rx_overrun_count = neom8x_hw_statistics.rx_overrun_count;
+    statistics->wake_up_count = gps_ctx.wake_up_count;
+    statistics->sleep_time_ms = gps_ctx.sleep_time_ms;
 errors:
     return status;
 }
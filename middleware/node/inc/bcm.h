@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  BCM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        BCM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   BCM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         BCM_init_registers
+#define NODE_UPDATE_REGISTER        BCM_update_register
+#define NODE_CHECK_REGISTER         BCM_check_register
+#define NODE_MTRG_CALLBACK          BCM_mtrg_callback
 
 /*** BCM functions ***/
 
@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  BPSM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        BPSM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   BPSM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         BPSM_init_registers
+#define NODE_UPDATE_REGISTER        BPSM_update_register
+#define NODE_CHECK_REGISTER         BPSM_check_register
+#define NODE_MTRG_CALLBACK          BPSM_mtrg_callback
 
 /*** BPSM functions ***/
 
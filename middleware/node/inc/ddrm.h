@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  DDRM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        DDRM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   DDRM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         DDRM_init_registers
+#define NODE_UPDATE_REGISTER        DDRM_update_register
+#define NODE_CHECK_REGISTER         DDRM_check_register
+#define NODE_MTRG_CALLBACK          DDRM_mtrg_callback
 
 /*** DDRM functions ***/
 
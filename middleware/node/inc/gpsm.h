@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  GPSM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        GPSM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   GPSM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         GPSM_init_registers
+#define NODE_UPDATE_REGISTER        GPSM_update_register
+#define NODE_CHECK_REGISTER         GPSM_check_register
+#define NODE_MTRG_CALLBACK          GPSM_mtrg_callback
 
 /*** GPSM functions ***/
 
@@ -60,6 +64,24 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask);
  *******************************************************************/
 NODE_status_t GPSM_mtrg_callback(void);
 
+/*!******************************************************************
+ * \fn NODE_status_t GPSM_process(void)
+ * \brief Process pending GPS acquisition.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t GPSM_process(void);
+
+/*!******************************************************************
+ * \fn NODE_state_t GPSM_get_state(void)
+ * \brief Get GPSM acquisition state.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current GPSM state.
+ *******************************************************************/
+NODE_state_t GPSM_get_state(void);
+
 #endif /* GPSM */
 
 #endif /* __GPSM_H__ */
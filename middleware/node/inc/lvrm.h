@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  LVRM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        LVRM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   LVRM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         LVRM_init_registers
+#define NODE_UPDATE_REGISTER        LVRM_update_register
+#define NODE_CHECK_REGISTER         LVRM_check_register
+#define NODE_MTRG_CALLBACK          LVRM_mtrg_callback
 
 /*** LVRM functions ***/
 
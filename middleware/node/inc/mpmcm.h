@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  MPMCM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        MPMCM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   MPMCM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         MPMCM_init_registers
+#define NODE_UPDATE_REGISTER        MPMCM_update_register
+#define NODE_CHECK_REGISTER         MPMCM_check_register
+#define NODE_MTRG_CALLBACK          MPMCM_mtrg_callback
 
 /*** MPMCM functions ***/
 
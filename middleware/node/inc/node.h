@@ -10,6 +10,7 @@
 
 #include "analog.h"
 #include "digital.h"
+#include "dsm_flags.h"
 #include "error.h"
 #include "gps.h"
 #include "measure.h"
@@ -44,6 +45,7 @@ typedef enum {
     NODE_ERROR_SIGFOX_MCU_API,
     NODE_ERROR_SIGFOX_RF_API,
     NODE_ERROR_SIGFOX_EP_API,
+    NODE_ERROR_GPS_STATE,
     // Low level drivers errors.
     NODE_ERROR_BASE_NVM = ERROR_BASE_STEP,
     NODE_ERROR_BASE_LPTIM = (NODE_ERROR_BASE_NVM + NVM_ERROR_BASE_LAST),
@@ -82,6 +84,32 @@ typedef enum {
     NODE_REQUEST_SOURCE_LAST
 } NODE_request_source_t;
 
+#ifndef MPMCM
+/*!******************************************************************
+ * \struct NODE_nvm_statistics_t
+ * \brief NODE registers persistence statistics.
+ *******************************************************************/
+typedef struct {
+    uint32_t write_count;
+    uint32_t skip_count;
+    uint32_t programming_time_us;
+} NODE_nvm_statistics_t;
+#endif
+
+#ifdef DSM_NVM_JOURNAL
+/*!******************************************************************
+ * \struct NODE_nvm_journal_statistics_t
+ * \brief NODE registers journal statistics.
+ *******************************************************************/
+typedef struct {
+    uint32_t append_count;
+    uint32_t compaction_count;
+    uint32_t word_write_count;
+    uint32_t restore_entry_count;
+    uint32_t spill_count;
+} NODE_nvm_journal_statistics_t;
+#endif
+
 /*** NODE functions ***/
 
 /*!******************************************************************
@@ -131,6 +159,16 @@ NODE_status_t NODE_tick_second(void);
  *******************************************************************/
 NODE_state_t NODE_get_state(void);
 
+/*!******************************************************************
+ * \fn NODE_status_t NODE_check_register_write(NODE_request_source_t request_source, uint8_t reg_addr)
+ * \brief Check node register address and access rights without writing it.
+ * \param[in]   request_source: Request source.
+ * \param[in]   reg_addr: Address of the register to check.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t NODE_check_register_write(NODE_request_source_t request_source, uint8_t reg_addr);
+
 /*!******************************************************************
  * \fn NODE_status_t NODE_write_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask)
  * \brief Write node register.
@@ -157,7 +195,7 @@ NODE_status_t NODE_write_byte_array(NODE_request_source_t request_source, uint8_
 
 /*!******************************************************************
  * \fn NODE_status_t NODE_write_nvm(uint8_t reg_addr, uint32_t reg_value)
- * \brief Write register in NVM.
+ * \brief Write register in NVM (deferred to the end of the current register write on data EEPROM boards).
  * \param[in]   reg_addr: Address of the register to write.
  * \param[in]   reg_value: Value to write in NVM.
  * \param[out]  none
@@ -165,6 +203,28 @@ NODE_status_t NODE_write_byte_array(NODE_request_source_t request_source, uint8_
  *******************************************************************/
 NODE_status_t NODE_write_nvm(uint8_t reg_addr, uint32_t reg_value);
 
+#ifndef MPMCM
+/*!******************************************************************
+ * \fn NODE_status_t NODE_get_nvm_statistics(NODE_nvm_statistics_t* nvm_statistics)
+ * \brief Get registers persistence statistics.
+ * \param[in]   none
+ * \param[out]  nvm_statistics: Pointer to the persistence statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t NODE_get_nvm_statistics(NODE_nvm_statistics_t* nvm_statistics);
+#endif
+
+#ifdef DSM_NVM_JOURNAL
+/*!******************************************************************
+ * \fn NODE_status_t NODE_get_nvm_journal_statistics(NODE_nvm_journal_statistics_t* nvm_journal_statistics)
+ * \brief Get registers journal statistics.
+ * \param[in]   none
+ * \param[out]  nvm_journal_statistics: Pointer to the journal statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t NODE_get_nvm_journal_statistics(NODE_nvm_journal_statistics_t* nvm_journal_statistics);
+#endif
+
 /*!******************************************************************
  * \fn NODE_status_t NODE_read_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t* reg_value)
  * \brief Read node register.
@@ -175,6 +235,17 @@ NODE_status_t NODE_write_nvm(uint8_t reg_addr, uint32_t reg_value);
  *******************************************************************/
 NODE_status_t NODE_read_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t* reg_value);
 
+/*!******************************************************************
+ * \fn NODE_status_t NODE_read_registers(NODE_request_source_t request_source, uint8_t reg_addr_base, uint32_t* reg_value, uint8_t number_of_registers)
+ * \brief Read multiple consecutive node registers.
+ * \param[in]   request_source: Request source.
+ * \param[in]   reg_addr_base: Address of the first register to read.
+ * \param[in]   number_of_registers: Number of registers to read.
+ * \param[out]  reg_value: Pointer to the registers value.
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t NODE_read_registers(NODE_request_source_t request_source, uint8_t reg_addr_base, uint32_t* reg_value, uint8_t number_of_registers);
+
 /*!******************************************************************
  * \fn NODE_status_t NODE_read_byte_array(NODE_request_source_t request_source, uint8_t reg_addr_base, uint8_t* data, uint8_t data_size_byte)
  * \brief Read multiple registers in a byte array.
@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  RRM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        RRM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   RRM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         RRM_init_registers
+#define NODE_UPDATE_REGISTER        RRM_update_register
+#define NODE_CHECK_REGISTER         RRM_check_register
+#define NODE_MTRG_CALLBACK          RRM_mtrg_callback
 
 /*** RRM functions ***/
 
@@ -20,6 +20,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  SM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        SM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   SM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         SM_init_registers
+#define NODE_UPDATE_REGISTER        SM_update_register
+#define NODE_CHECK_REGISTER         SM_check_register
+#define NODE_MTRG_CALLBACK          SM_mtrg_callback
 
 /*** SM functions ***/
 
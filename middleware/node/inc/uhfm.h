@@ -21,6 +21,10 @@
 #define NODE_REGISTER_ADDRESS_LAST  UHFM_REGISTER_ADDRESS_LAST
 #define NODE_REGISTER_ACCESS        UHFM_REGISTER_ACCESS
 #define NODE_REGISTER_ERROR_VALUE   UHFM_REGISTER_ERROR_VALUE
+#define NODE_INIT_REGISTERS         UHFM_init_registers
+#define NODE_UPDATE_REGISTER        UHFM_update_register
+#define NODE_CHECK_REGISTER         UHFM_check_register
+#define NODE_MTRG_CALLBACK          UHFM_mtrg_callback
 
 /*** UHFM functions ***/
 
@@ -61,6 +65,24 @@ NODE_status_t UHFM_check_register(uint8_t reg_addr, uint32_t reg_mask);
  *******************************************************************/
 NODE_status_t UHFM_mtrg_callback(void);
 
+/*!******************************************************************
+ * \fn NODE_status_t UHFM_process(void)
+ * \brief Process asynchronous Sigfox message or test mode.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t UHFM_process(void);
+
+/*!******************************************************************
+ * \fn NODE_state_t UHFM_get_state(void)
+ * \brief Get UHFM Sigfox state.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current UHFM state.
+ *******************************************************************/
+NODE_state_t UHFM_get_state(void);
+
 #endif /* UHFM */
 
 #endif /* __UHFM_H__ */
@@ -32,6 +32,7 @@
 
 #ifdef UNA_AT_MODE_SLAVE
 
+// Warning: requires the UNA_AT_get_parser() function of the una-at submodule.
 //#define UNA_AT_CUSTOM_COMMANDS
 
 #endif /* UNA_AT_MODE_SLAVE */
@@ -54,33 +54,7 @@ static NODE_status_t _COMMON_mtrg_callback(void) {
     // Write register.
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, COMMON_REGISTER_ADDRESS_ANALOG_DATA_0, reg_analog_data_0, reg_analog_data_0_mask);
     // Specific analog data.
-#ifdef LVRM
-    status = LVRM_mtrg_callback();
-#endif
-#ifdef BPSM
-    status = BPSM_mtrg_callback();
-#endif
-#ifdef DDRM
-    status = DDRM_mtrg_callback();
-#endif
-#ifdef UHFM
-    status = UHFM_mtrg_callback();
-#endif
-#ifdef GPSM
-    status = GPSM_mtrg_callback();
-#endif
-#ifdef SM
-    status = SM_mtrg_callback();
-#endif
-#ifdef RRM
-    status = RRM_mtrg_callback();
-#endif
-#ifdef MPMCM
-    status = MPMCM_mtrg_callback();
-#endif
-#ifdef BCM
-    status = BCM_mtrg_callback();
-#endif
+    status = NODE_MTRG_CALLBACK();
     if (status != NODE_SUCCESS) goto errors;
 errors:
     POWER_disable(POWER_REQUESTER_ID_COMMON, POWER_DOMAIN_ANALOG);
@@ -21,6 +21,12 @@
 #include "types.h"
 #include "una.h"
 
+/*** GPSM local macros ***/
+
+#ifdef GPSM_ACQUISITION_DIAGNOSTICS_ENABLE
+#define GPSM_DIAGNOSTIC_COUNT_MAX   0xFFFF
+#endif
+
 /*** GPSM local structures ***/
 
 /*******************************************************************/
@@ -30,6 +36,7 @@ typedef union {
         unsigned tpen :1;
         unsigned pwmd :1;
         unsigned pwen :1;
+        unsigned acquisition :1;
     };
     uint8_t all;
 } GPSM_flags_t;
@@ -38,13 +45,21 @@ typedef union {
 typedef struct {
     GPSM_flags_t flags;
     UNA_bit_representation_t bkenst;
+    GPS_acquisition_type_t acquisition_type;
+    volatile uint8_t completion_flag;
+    GPS_acquisition_status_t acquisition_status;
+    uint32_t acquisition_duration_seconds;
 } GPSM_context_t;
 
 /*** GPSM local global variables ***/
 
 static GPSM_context_t gpsm_ctx = {
     .flags.all = 0,
-    .bkenst = UNA_BIT_ERROR
+    .bkenst = UNA_BIT_ERROR,
+    .acquisition_type = GPS_ACQUISITION_TYPE_LAST,
+    .completion_flag = 0,
+    .acquisition_status = GPS_ACQUISITION_ERROR_LAST,
+    .acquisition_duration_seconds = 0
 };
 
 /*** GPSM local functions ***/
@@ -115,7 +130,7 @@ static NODE_status_t _GPSM_power_request(uint8_t state) {
     // Check power mode.
     if ((reg_control_1 & GPSM_REGISTER_CONTROL_1_MASK_PWMD) == 0) {
         // Power managed by the node.
-        if ((state == 0) && ((reg_control_1 & (GPSM_REGISTER_CONTROL_1_MASK_TTRG | GPSM_REGISTER_CONTROL_1_MASK_GTRG | GPSM_REGISTER_CONTROL_1_MASK_TPEN)) == 0)) {
+        if ((state == 0) && ((reg_control_1 & (GPSM_REGISTER_CONTROL_1_MASK_TTRG | GPSM_REGISTER_CONTROL_1_MASK_GTRG | GPSM_REGISTER_CONTROL_1_MASK_TPEN)) == 0) && (gpsm_ctx.flags.acquisition == 0)) {
             _GPSM_power_control(0);
         }
         if (state != 0) {
@@ -135,72 +150,51 @@ errors:
 }
 
 /*******************************************************************/
-static NODE_status_t _GPSM_ttrg_callback(void) {
+static void _GPSM_gps_completion_callback(GPS_acquisition_status_t acquisition_status, uint32_t acquisition_duration_seconds) {
+    // Store result.
+    gpsm_ctx.acquisition_status = acquisition_status;
+    gpsm_ctx.acquisition_duration_seconds = acquisition_duration_seconds;
+    // Set local flag.
+    gpsm_ctx.completion_flag = 1;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_write_time_data(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     GPS_status_t gps_status = GPS_SUCCESS;
-    GPS_acquisition_status_t gps_acquisition_status = GPS_ACQUISITION_ERROR_LAST;
     GPS_time_t gps_time;
-    uint32_t time_fix_duration = 0;
-    uint32_t reg_timeout = 0;
-    uint32_t reg_status_1 = 0;
-    uint32_t reg_status_1_mask = 0;
     uint32_t reg_time_data_0 = 0;
     uint32_t reg_time_data_0_mask = 0;
     uint32_t reg_time_data_1 = 0;
     uint32_t reg_time_data_1_mask = 0;
     uint32_t reg_time_data_2 = 0;
     uint32_t reg_time_data_2_mask = 0;
-    // Read status and timeout.
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, &reg_status_1);
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_0, &reg_timeout);
-    // Reset status flag.
-    SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_TFS);
-    // Turn GPS on.
-    status = _GPSM_power_request(1);
-    if (status != NODE_SUCCESS) goto errors;
-    // Perform time fix.
-    gps_status = GPS_get_time(&gps_time, SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_0_MASK_TIME_TIMEOUT), &time_fix_duration, &gps_acquisition_status);
+    // Read time.
+    gps_status = GPS_get_time(&gps_time);
     GPS_exit_error(NODE_ERROR_BASE_GPS);
-    // Check acquisition status.
-    if (gps_acquisition_status == GPS_ACQUISITION_SUCCESS) {
-        // Update status flag.
-        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b1, GPSM_REGISTER_STATUS_1_MASK_TFS);
-        // Fill registers with time data.
-        SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) UNA_convert_year(gps_time.year), GPSM_REGISTER_TIME_DATA_0_MASK_YEAR);
-        SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) gps_time.month, GPSM_REGISTER_TIME_DATA_0_MASK_MONTH);
-        SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) gps_time.date, GPSM_REGISTER_TIME_DATA_0_MASK_DATE);
-        SWREG_write_field(&reg_time_data_1, &reg_time_data_1_mask, (uint32_t) gps_time.hours, GPSM_REGISTER_TIME_DATA_1_MASK_HOUR);
-        SWREG_write_field(&reg_time_data_1, &reg_time_data_1_mask, (uint32_t) gps_time.minutes, GPSM_REGISTER_TIME_DATA_1_MASK_MINUTE);
-        SWREG_write_field(&reg_time_data_1, &reg_time_data_1_mask, (uint32_t) gps_time.seconds, GPSM_REGISTER_TIME_DATA_1_MASK_SECOND);
-        SWREG_write_field(&reg_time_data_2, &reg_time_data_2_mask, time_fix_duration, GPSM_REGISTER_TIME_DATA_2_MASK_FIX_DURATION);
-        // Write registers.
-        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_0, reg_time_data_0, reg_time_data_0_mask);
-        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_1, reg_time_data_1, reg_time_data_1_mask);
-        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_2, reg_time_data_2, reg_time_data_2_mask);
-    }
-    // Turn GPS off is possible.
-    status = _GPSM_power_request(0);
-    if (status != NODE_SUCCESS) goto errors;
+    // Fill registers with time data.
+    SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) UNA_convert_year(gps_time.year), GPSM_REGISTER_TIME_DATA_0_MASK_YEAR);
+    SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) gps_time.month, GPSM_REGISTER_TIME_DATA_0_MASK_MONTH);
+    SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) gps_time.date, GPSM_REGISTER_TIME_DATA_0_MASK_DATE);
+    SWREG_write_field(&reg_time_data_1, &reg_time_data_1_mask, (uint32_t) gps_time.hours, GPSM_REGISTER_TIME_DATA_1_MASK_HOUR);
+    SWREG_write_field(&reg_time_data_1, &reg_time_data_1_mask, (uint32_t) gps_time.minutes, GPSM_REGISTER_TIME_DATA_1_MASK_MINUTE);
+    SWREG_write_field(&reg_time_data_1, &reg_time_data_1_mask, (uint32_t) gps_time.seconds, GPSM_REGISTER_TIME_DATA_1_MASK_SECOND);
+    SWREG_write_field(&reg_time_data_2, &reg_time_data_2_mask, gpsm_ctx.acquisition_duration_seconds, GPSM_REGISTER_TIME_DATA_2_MASK_FIX_DURATION);
+    // Write registers.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_0, reg_time_data_0, reg_time_data_0_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_1, reg_time_data_1, reg_time_data_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_2, reg_time_data_2, reg_time_data_2_mask);
 errors:
-    // Update status.
-    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, UNA_REGISTER_MASK_ALL);
-    // Turn GPS off is possible.
-    _GPSM_power_request(0);
     return status;
 }
 
 /*******************************************************************/
-static NODE_status_t _GPSM_gtrg_callback(void) {
+static NODE_status_t _GPSM_write_geoloc_data(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     GPS_status_t gps_status = GPS_SUCCESS;
-    GPS_acquisition_status_t gps_acquisition_status = GPS_ACQUISITION_ERROR_LAST;
     GPS_position_t gps_position;
-    uint32_t geoloc_fix_duration = 0;
-    uint32_t reg_timeout = 0;
-    uint32_t reg_status_1 = 0;
-    uint32_t reg_status_1_mask = 0;
     uint32_t reg_geoloc_data_0 = 0;
     uint32_t reg_geoloc_data_0_mask = 0;
     uint32_t reg_geoloc_data_1 = 0;
@@ -209,49 +203,178 @@ static NODE_status_t _GPSM_gtrg_callback(void) {
     uint32_t reg_geoloc_data_2_mask = 0;
     uint32_t reg_geoloc_data_3 = 0;
     uint32_t reg_geoloc_data_3_mask = 0;
-    // Read status and timeout.
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, &reg_status_1);
+    // Read position.
+    gps_status = GPS_get_position(&gps_position);
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Fill registers with geoloc data.
+    SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, (uint32_t) gps_position.lat_north_flag, GPSM_REGISTER_GEOLOC_DATA_0_MASK_NF);
+    SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, gps_position.lat_seconds, GPSM_REGISTER_GEOLOC_DATA_0_MASK_SECOND);
+    SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, (uint32_t) gps_position.lat_minutes, GPSM_REGISTER_GEOLOC_DATA_0_MASK_MINUTE);
+    SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, (uint32_t) gps_position.lat_degrees, GPSM_REGISTER_GEOLOC_DATA_0_MASK_DEGREE);
+    SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, (uint32_t) gps_position.long_east_flag, GPSM_REGISTER_GEOLOC_DATA_1_MASK_EF);
+    SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, gps_position.long_seconds, GPSM_REGISTER_GEOLOC_DATA_1_MASK_SECOND);
+    SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, (uint32_t) gps_position.long_minutes, GPSM_REGISTER_GEOLOC_DATA_1_MASK_MINUTE);
+    SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, (uint32_t) gps_position.long_degrees, GPSM_REGISTER_GEOLOC_DATA_1_MASK_DEGREE);
+    SWREG_write_field(&reg_geoloc_data_2, &reg_geoloc_data_2_mask, gps_position.altitude, GPSM_REGISTER_GEOLOC_DATA_2_MASK_ALTITUDE);
+    SWREG_write_field(&reg_geoloc_data_3, &reg_geoloc_data_3_mask, gpsm_ctx.acquisition_duration_seconds, GPSM_REGISTER_GEOLOC_DATA_3_MASK_FIX_DURATION);
+    // Write registers.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0, reg_geoloc_data_0, reg_geoloc_data_0_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1, reg_geoloc_data_1, reg_geoloc_data_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_2, reg_geoloc_data_2, reg_geoloc_data_2_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_3, reg_geoloc_data_3, reg_geoloc_data_3_mask);
+errors:
+    return status;
+}
+
+#ifdef GPSM_ACQUISITION_DIAGNOSTICS_ENABLE
+/*******************************************************************/
+static void _GPSM_write_diagnostic_data(void) {
+    // Local variables.
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_statistics_t gps_statistics;
+    uint32_t reg_diagnostic_0 = 0;
+    uint32_t reg_diagnostic_0_mask = 0;
+    uint32_t reg_diagnostic_1 = 0;
+    uint32_t reg_diagnostic_1_mask = 0;
+    uint32_t reg_diagnostic_2 = 0;
+    uint32_t reg_diagnostic_2_mask = 0;
+    // Read acquisition statistics.
+    gps_status = GPS_get_statistics(&gps_statistics);
+    GPS_stack_error(ERROR_BASE_NODE + NODE_ERROR_BASE_GPS);
+    if (gps_status != GPS_SUCCESS) goto errors;
+    // Saturate 16-bits counters.
+    if (gps_statistics.uart_rx_irq_count > GPSM_DIAGNOSTIC_COUNT_MAX) {
+        gps_statistics.uart_rx_irq_count = GPSM_DIAGNOSTIC_COUNT_MAX;
+    }
+    if (gps_statistics.wake_up_count > GPSM_DIAGNOSTIC_COUNT_MAX) {
+        gps_statistics.wake_up_count = GPSM_DIAGNOSTIC_COUNT_MAX;
+    }
+    // Fill registers.
+    SWREG_write_field(&reg_diagnostic_0, &reg_diagnostic_0_mask, gps_statistics.uart_rx_irq_count, GPSM_REGISTER_DIAGNOSTIC_0_MASK_UART_IRQ_COUNT);
+    SWREG_write_field(&reg_diagnostic_0, &reg_diagnostic_0_mask, gps_statistics.wake_up_count, GPSM_REGISTER_DIAGNOSTIC_0_MASK_WAKE_UP_COUNT);
+    SWREG_write_field(&reg_diagnostic_1, &reg_diagnostic_1_mask, gps_statistics.uart_rx_byte_count, GPSM_REGISTER_DIAGNOSTIC_1_MASK_UART_BYTE_COUNT);
+    SWREG_write_field(&reg_diagnostic_2, &reg_diagnostic_2_mask, gps_statistics.sleep_time_ms, GPSM_REGISTER_DIAGNOSTIC_2_MASK_SLEEP_TIME);
+    // Write registers.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DIAGNOSTIC_0, reg_diagnostic_0, reg_diagnostic_0_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DIAGNOSTIC_1, reg_diagnostic_1, reg_diagnostic_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DIAGNOSTIC_2, reg_diagnostic_2, reg_diagnostic_2_mask);
+errors:
+    return;
+}
+#endif
+
+/*******************************************************************/
+static void _GPSM_clear_trigger(GPS_acquisition_type_t acquisition_type) {
+    // Local variables.
+    uint32_t trigger_mask = (acquisition_type == GPS_ACQUISITION_TYPE_TIME) ? GPSM_REGISTER_CONTROL_1_MASK_TTRG : GPSM_REGISTER_CONTROL_1_MASK_GTRG;
+    // Trigger bit is cleared once the acquisition is completed.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, 0b0, trigger_mask);
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_start_acquisition(GPS_acquisition_type_t acquisition_type) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_acquisition_t gps_acquisition;
+    uint32_t reg_timeout = 0;
+    uint32_t reg_status_1 = 0;
+    uint32_t reg_status_1_mask = 0;
+    // Check state.
+    if (gpsm_ctx.flags.acquisition != 0) {
+        // Keep the trigger bit of the pending acquisition.
+        if (acquisition_type != gpsm_ctx.acquisition_type) {
+            _GPSM_clear_trigger(acquisition_type);
+        }
+        status = NODE_ERROR_GPS_STATE;
+        goto end;
+    }
+    // Read timeout.
     NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_0, &reg_timeout);
     // Reset status flag.
-    SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_GFS);
+    if (acquisition_type == GPS_ACQUISITION_TYPE_TIME) {
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_TFS);
+        gps_acquisition.timeout_seconds = SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_0_MASK_TIME_TIMEOUT);
+    }
+    else {
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_GFS);
+        gps_acquisition.timeout_seconds = SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_0_MASK_GEOLOC_TIMEOUT);
+    }
     // Turn GPS on.
     status = _GPSM_power_request(1);
     if (status != NODE_SUCCESS) goto errors;
-    // Perform time fix.
-    gps_status = GPS_get_position(&gps_position, SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_0_MASK_GEOLOC_TIMEOUT), &geoloc_fix_duration, &gps_acquisition_status);
+    // Start acquisition.
+    gps_acquisition.type = acquisition_type;
+    gps_acquisition.completion_callback = &_GPSM_gps_completion_callback;
+    gpsm_ctx.completion_flag = 0;
+    gps_status = GPS_start_acquisition(&gps_acquisition);
     GPS_exit_error(NODE_ERROR_BASE_GPS);
-    // Check acquisition status.
-    if (gps_acquisition_status == GPS_ACQUISITION_SUCCESS) {
-        // Update status flag.
-        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b1, GPSM_REGISTER_STATUS_1_MASK_GFS);
-        // Fill registers with geoloc data.
-        SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, (uint32_t) gps_position.lat_north_flag, GPSM_REGISTER_GEOLOC_DATA_0_MASK_NF);
-        SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, gps_position.lat_seconds, GPSM_REGISTER_GEOLOC_DATA_0_MASK_SECOND);
-        SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, (uint32_t) gps_position.lat_minutes, GPSM_REGISTER_GEOLOC_DATA_0_MASK_MINUTE);
-        SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, (uint32_t) gps_position.lat_degrees, GPSM_REGISTER_GEOLOC_DATA_0_MASK_DEGREE);
-        SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, (uint32_t) gps_position.long_east_flag, GPSM_REGISTER_GEOLOC_DATA_1_MASK_EF);
-        SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, gps_position.long_seconds, GPSM_REGISTER_GEOLOC_DATA_1_MASK_SECOND);
-        SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, (uint32_t) gps_position.long_minutes, GPSM_REGISTER_GEOLOC_DATA_1_MASK_MINUTE);
-        SWREG_write_field(&reg_geoloc_data_1, &reg_geoloc_data_1_mask, (uint32_t) gps_position.long_degrees, GPSM_REGISTER_GEOLOC_DATA_1_MASK_DEGREE);
-        SWREG_write_field(&reg_geoloc_data_2, &reg_geoloc_data_2_mask, gps_position.altitude, GPSM_REGISTER_GEOLOC_DATA_2_MASK_ALTITUDE);
-        SWREG_write_field(&reg_geoloc_data_3, &reg_geoloc_data_3_mask, geoloc_fix_duration, GPSM_REGISTER_GEOLOC_DATA_3_MASK_FIX_DURATION);
-        // Write registers.
-        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0, reg_geoloc_data_0, reg_geoloc_data_0_mask);
-        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1, reg_geoloc_data_1, reg_geoloc_data_1_mask);
-        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_2, reg_geoloc_data_2, reg_geoloc_data_2_mask);
-        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_3, reg_geoloc_data_3, reg_geoloc_data_3_mask);
+    // Update context.
+    gpsm_ctx.acquisition_type = acquisition_type;
+    gpsm_ctx.flags.acquisition = 1;
+errors:
+    // Update status.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
+    if (status != NODE_SUCCESS) {
+        _GPSM_clear_trigger(acquisition_type);
     }
     // Turn GPS off is possible.
-    status = _GPSM_power_request(0);
-    if (status != NODE_SUCCESS) goto errors;
+    _GPSM_power_request(0);
+end:
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_end_acquisition(NODE_status_t process_status) {
+    // Local variables.
+    NODE_status_t status = process_status;
+    uint32_t reg_status_1 = 0;
+    uint32_t reg_status_1_mask = 0;
+    // Update state.
+    gpsm_ctx.flags.acquisition = 0;
+    // Check process status and acquisition result.
+    if ((status != NODE_SUCCESS) || (gpsm_ctx.acquisition_status != GPS_ACQUISITION_SUCCESS)) goto errors;
+    // Write data.
+    if (gpsm_ctx.acquisition_type == GPS_ACQUISITION_TYPE_TIME) {
+        status = _GPSM_write_time_data();
+        if (status != NODE_SUCCESS) goto errors;
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b1, GPSM_REGISTER_STATUS_1_MASK_TFS);
+    }
+    else {
+        status = _GPSM_write_geoloc_data();
+        if (status != NODE_SUCCESS) goto errors;
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b1, GPSM_REGISTER_STATUS_1_MASK_GFS);
+    }
 errors:
+#ifdef GPSM_ACQUISITION_DIAGNOSTICS_ENABLE
+    // Acquisition diagnostics are written whatever the result.
+    _GPSM_write_diagnostic_data();
+#endif
     // Update status.
-    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, UNA_REGISTER_MASK_ALL);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
+    _GPSM_clear_trigger(gpsm_ctx.acquisition_type);
     // Turn GPS off is possible.
     _GPSM_power_request(0);
     return status;
 }
 
+/*******************************************************************/
+static void _GPSM_abort_acquisition(void) {
+    // Local variables.
+    GPS_status_t gps_status = GPS_SUCCESS;
+    // Check state.
+    if (gpsm_ctx.flags.acquisition == 0) goto errors;
+    // Stop GPS acquisition.
+    gps_status = GPS_stop_acquisition();
+    GPS_stack_error(ERROR_BASE_NODE + NODE_ERROR_BASE_GPS);
+    // Acquisition is reported as failed.
+    gpsm_ctx.completion_flag = 0;
+    gpsm_ctx.acquisition_status = GPS_ACQUISITION_ERROR_TIMEOUT;
+    _GPSM_end_acquisition(NODE_SUCCESS);
+errors:
+    return;
+}
+
 /*******************************************************************/
 static NODE_status_t _GPSM_tpen_callback(uint8_t state) {
     // Local variables.
@@ -389,10 +512,9 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
         if ((reg_mask & GPSM_REGISTER_CONTROL_1_MASK_TTRG) != 0) {
             // Read bit.
             if (SWREG_read_field(reg_value, GPSM_REGISTER_CONTROL_1_MASK_TTRG) != 0) {
-                // Clear request.
-                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, 0b0, GPSM_REGISTER_CONTROL_1_MASK_TTRG);
                 // Start GPS time fix.
-                status = _GPSM_ttrg_callback();
+                // Note: the request bit is cleared once the acquisition is completed.
+                status = _GPSM_start_acquisition(GPS_ACQUISITION_TYPE_TIME);
                 if (status != NODE_SUCCESS) goto errors;
             }
         }
@@ -400,10 +522,9 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
         if ((reg_mask & GPSM_REGISTER_CONTROL_1_MASK_GTRG) != 0) {
             // Read bit.
             if (SWREG_read_field(reg_value, GPSM_REGISTER_CONTROL_1_MASK_GTRG) != 0) {
-                // Clear request.
-                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, 0b0, GPSM_REGISTER_CONTROL_1_MASK_GTRG);
                 // Start GPS geolocation fix.
-                status = _GPSM_gtrg_callback();
+                // Note: the request bit is cleared once the acquisition is completed.
+                status = _GPSM_start_acquisition(GPS_ACQUISITION_TYPE_POSITION);
                 if (status != NODE_SUCCESS) goto errors;
             }
         }
@@ -430,6 +551,10 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
             pwmd = SWREG_read_field(reg_value, GPSM_REGISTER_CONTROL_1_MASK_PWMD);
             // Check PWMD bit change.
             if ((pwmd != 0) && (gpsm_ctx.flags.pwmd == 0)) {
+                // Abort pending acquisition before turning GPS off.
+                if (pwen == 0) {
+                    _GPSM_abort_acquisition();
+                }
                 // Apply PWEN bit.
                 _GPSM_power_control(pwen);
                 // Update local flag.
@@ -452,6 +577,10 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                 pwen = SWREG_read_field(reg_value, GPSM_REGISTER_CONTROL_1_MASK_PWEN);
                 // Compare to current state.
                 if (pwen != gpsm_ctx.flags.pwen) {
+                    // Abort pending acquisition before turning GPS off.
+                    if (pwen == 0) {
+                        _GPSM_abort_acquisition();
+                    }
                     // Apply PWEN bit.
                     _GPSM_power_control(pwen);
                     // Update local flag.
@@ -524,4 +653,35 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+NODE_status_t GPSM_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    // Check state.
+    if (gpsm_ctx.flags.acquisition == 0) goto end;
+    // Process GPS acquisition.
+    gps_status = GPS_process();
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Check completion flag.
+    if (gpsm_ctx.completion_flag != 0) {
+        // Clear flag.
+        gpsm_ctx.completion_flag = 0;
+        // Write results.
+        status = _GPSM_end_acquisition(NODE_SUCCESS);
+    }
+end:
+    return status;
+errors:
+    // Acquisition has been aborted by the GPS driver.
+    _GPSM_end_acquisition(status);
+    return status;
+}
+
+/*******************************************************************/
+NODE_state_t GPSM_get_state(void) {
+    // GPS UART and DMA are not clocked in stop mode.
+    return ((gpsm_ctx.flags.acquisition == 0) ? NODE_STATE_IDLE : NODE_STATE_RUNNING);
+}
+
 #endif /* GPSM */
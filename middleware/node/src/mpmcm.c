@@ -21,6 +21,23 @@
 #include "types.h"
 #include "una.h"
 
+/*** MPMCM local macros ***/
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+#define MPMCM_NUMBER_OF_REGISTERS_PER_HARMONIC  2
+#define MPMCM_HARMONIC_ERROR_VALUE              0xFFFF
+#define MPMCM_HARMONIC_VALUE_MAX                (MPMCM_HARMONIC_ERROR_VALUE - 1)
+#endif
+
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+#define MPMCM_PHASE_ANGLE_ERROR_VALUE           0x8000
+#define MPMCM_PHASE_ANGLE_MASK                  0xFFFF
+#endif
+
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+#define MPMCM_CAPTURE_WINDOW_SIZE               8
+#endif
+
 /*** MPMCM local functions ***/
 
 /*******************************************************************/
@@ -113,6 +130,108 @@ static void _MPMCM_set_tic_sampling_period(void) {
     TIC_stack_error(ERROR_BASE_TIC);
 }
 
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+/*******************************************************************/
+static uint32_t _MPMCM_convert_phase_angle(float64_t phase_angle_degrees) {
+    // Local variables.
+    int32_t phase_angle_ddeg = (int32_t) (phase_angle_degrees * 10.0);
+    // Convert to 16-bits two's complement in 0.1 degree unit.
+    return (((uint32_t) phase_angle_ddeg) & MPMCM_PHASE_ANGLE_MASK);
+}
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+static uint32_t _MPMCM_convert_harmonic_percent(float64_t harmonic_percent) {
+    // Local variables.
+    uint32_t field_value = 0;
+    // Convert to 0.1% unit and clamp.
+    field_value = (uint32_t) (harmonic_percent * 10.0);
+    if (field_value > MPMCM_HARMONIC_VALUE_MAX) {
+        field_value = MPMCM_HARMONIC_VALUE_MAX;
+    }
+    return field_value;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+static void _MPMCM_write_harmonic_run_register(uint8_t reg_addr, DATA_run_t* run_data) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t field_value = 0;
+    // Run value.
+    field_value = (run_data->number_of_samples > 0) ? _MPMCM_convert_harmonic_percent(run_data->value) : MPMCM_HARMONIC_ERROR_VALUE;
+    SWREG_write_field(&reg_value, &reg_mask, field_value, MPMCM_REGISTER_MASK_RUN);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, reg_value, reg_mask);
+}
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+static void _MPMCM_write_harmonic_accumulated_registers(uint8_t reg_addr, DATA_accumulated_t* accumulated_data) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t field_value = 0;
+    // Mean value.
+    field_value = (accumulated_data->number_of_samples > 0) ? _MPMCM_convert_harmonic_percent(accumulated_data->mean) : MPMCM_HARMONIC_ERROR_VALUE;
+    SWREG_write_field(&reg_value, &reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, reg_value, reg_mask);
+    // Min and max values.
+    reg_value = 0;
+    reg_mask = 0;
+    field_value = (accumulated_data->number_of_samples > 0) ? _MPMCM_convert_harmonic_percent(accumulated_data->min) : MPMCM_HARMONIC_ERROR_VALUE;
+    SWREG_write_field(&reg_value, &reg_mask, field_value, MPMCM_REGISTER_MASK_MIN);
+    field_value = (accumulated_data->number_of_samples > 0) ? _MPMCM_convert_harmonic_percent(accumulated_data->max) : MPMCM_HARMONIC_ERROR_VALUE;
+    SWREG_write_field(&reg_value, &reg_mask, field_value, MPMCM_REGISTER_MASK_MAX);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 1), reg_value, reg_mask);
+}
+#endif
+
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+/*******************************************************************/
+static NODE_status_t _MPMCM_load_capture_window(uint32_t chunk_index) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    MEASURE_status_t measure_status = MEASURE_SUCCESS;
+    MEASURE_capture_state_t capture_state = MEASURE_CAPTURE_STATE_IDLE;
+    uint16_t number_of_samples = 0;
+    uint32_t sample_index = 0;
+    int16_t acv_sample = 0;
+    int16_t aci_sample = 0;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint8_t idx = 0;
+    // Read capture state.
+    measure_status = MEASURE_get_capture_state(&capture_state, &number_of_samples);
+    MEASURE_exit_error(NODE_ERROR_BASE_MEASURE);
+    // Fill window registers.
+    for (idx = 0; idx < MPMCM_CAPTURE_WINDOW_SIZE; idx++) {
+        // Compute sample index.
+        sample_index = (chunk_index * MPMCM_CAPTURE_WINDOW_SIZE) + idx;
+        reg_value = 0;
+        reg_mask = 0;
+        // Check index.
+        if (sample_index < number_of_samples) {
+            // Read samples.
+            measure_status = MEASURE_read_capture((uint16_t) sample_index, &acv_sample, &aci_sample);
+            MEASURE_exit_error(NODE_ERROR_BASE_MEASURE);
+            // Note: samples are written in 16-bits two's complement.
+            SWREG_write_field(&reg_value, &reg_mask, (((uint32_t) acv_sample) & 0xFFFF), MPMCM_REGISTER_CAPTURE_DATA_MASK_ACV);
+            SWREG_write_field(&reg_value, &reg_mask, (((uint32_t) aci_sample) & 0xFFFF), MPMCM_REGISTER_CAPTURE_DATA_MASK_ACI);
+        }
+        else {
+            SWREG_write_field(&reg_value, &reg_mask, 0, UNA_REGISTER_MASK_ALL);
+        }
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CAPTURE_DATA_0 + idx), reg_value, reg_mask);
+    }
+errors:
+    return status;
+}
+#endif
+
 /*** MPMCM functions ***/
 
 /*******************************************************************/
@@ -165,6 +284,10 @@ NODE_status_t MPMCM_update_register(uint8_t reg_addr) {
     uint32_t reg_mask = 0;
     uint8_t channel_idx = 0;
     uint8_t generic_u8 = 0;
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+    MEASURE_capture_state_t capture_state = MEASURE_CAPTURE_STATE_IDLE;
+    uint16_t number_of_samples = 0;
+#endif
     // Check address.
     switch (reg_addr) {
     case MPMCM_REGISTER_ADDRESS_STATUS_1:
@@ -187,6 +310,16 @@ NODE_status_t MPMCM_update_register(uint8_t reg_addr) {
         // Update field.
         SWREG_write_field(&reg_value, &reg_mask, (uint32_t) generic_u8, MPMCM_REGISTER_STATUS_1_MASK_TICD);
         break;
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+    case MPMCM_REGISTER_ADDRESS_CAPTURE_STATUS:
+        // Read capture state.
+        measure_status = MEASURE_get_capture_state(&capture_state, &number_of_samples);
+        MEASURE_exit_error(NODE_ERROR_BASE_MEASURE);
+        // Update fields.
+        SWREG_write_field(&reg_value, &reg_mask, ((capture_state == MEASURE_CAPTURE_STATE_DONE) ? 0b1 : 0b0), MPMCM_REGISTER_CAPTURE_STATUS_MASK_CAPR);
+        SWREG_write_field(&reg_value, &reg_mask, (uint32_t) number_of_samples, MPMCM_REGISTER_CAPTURE_STATUS_MASK_NUMBER_OF_SAMPLES);
+        break;
+#endif
     default:
         // Nothing to do for other registers.
         break;
@@ -213,6 +346,11 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
     uint32_t new_reg_mask = 0;
     uint32_t data_reg_value = 0;
     uint32_t data_reg_mask = 0;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    DATA_accumulated_harmonics_t harmonics_data;
+    uint8_t signal_idx = 0;
+    uint8_t harmonic_idx = 0;
+#endif
     // Read register.
     NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, &reg_value);
     // Check address.
@@ -237,6 +375,27 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
             _MPMCM_set_tic_sampling_period();
         }
         break;
+#if ((defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined MPMCM_ANALOG_CAPTURE_ENABLE))
+    case MPMCM_REGISTER_ADDRESS_CAPTURE_CONTROL:
+        // CAPS.
+        if ((reg_mask & MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CAPS) != 0) {
+            // Check bit.
+            if (SWREG_read_field(reg_value, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CAPS) != 0) {
+                // Clear request.
+                SWREG_write_field(&new_reg_value, &new_reg_mask, 0b0, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CAPS);
+                // Start capture.
+                measure_status = MEASURE_start_capture((uint8_t) SWREG_read_field(reg_value, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CHANNEL), (uint8_t) SWREG_read_field(reg_value, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_NUMBER_OF_PERIODS));
+                MEASURE_exit_error(NODE_ERROR_BASE_MEASURE);
+            }
+        }
+        // Chunk index.
+        if ((reg_mask & MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CHUNK_INDEX) != 0) {
+            // Load window registers.
+            status = _MPMCM_load_capture_window(SWREG_read_field(reg_value, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CHUNK_INDEX));
+            if (status != NODE_SUCCESS) goto errors;
+        }
+        break;
+#endif
     case MPMCM_REGISTER_ADDRESS_CONTROL_1:
         // FRQS.
         if ((reg_mask & MPMCM_REGISTER_CONTROL_1_MASK_FRQS) != 0) {
@@ -250,7 +409,7 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                 // Write registers.
                 data_reg_value = 0;
                 data_reg_mask = 0;
-                field_value = (single_data.number_of_samples > 0) ? (uint32_t) (single_data.rolling_mean / 10.0) : UNA_MAINS_FREQUENCY_ERROR_VALUE;
+                field_value = (single_data.number_of_samples > 0) ? (uint32_t) (single_data.mean / 10.0) : UNA_MAINS_FREQUENCY_ERROR_VALUE;
                 SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
                 NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, MPMCM_REGISTER_ADDRESS_MAINS_FREQUENCY_0, data_reg_value, data_reg_mask);
                 data_reg_value = 0;
@@ -262,6 +421,30 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                 NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, MPMCM_REGISTER_ADDRESS_MAINS_FREQUENCY_1, data_reg_value, data_reg_mask);
             }
         }
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+        // HRMS.
+        if ((reg_mask & MPMCM_REGISTER_CONTROL_1_MASK_HRMS) != 0) {
+            // Check bit.
+            if (SWREG_read_field(reg_value, MPMCM_REGISTER_CONTROL_1_MASK_HRMS) != 0) {
+                // Clear request.
+                SWREG_write_field(&new_reg_value, &new_reg_mask, 0b0, MPMCM_REGISTER_CONTROL_1_MASK_HRMS);
+                // Update harmonics registers of all signals.
+                for (signal_idx = 0; signal_idx < MEASURE_HARMONICS_SIGNAL_LAST; signal_idx++) {
+                    // Read and reset measurements.
+                    measure_status = MEASURE_get_harmonics_accumulated_data(signal_idx, &harmonics_data);
+                    MEASURE_exit_error(NODE_ERROR_BASE_MEASURE);
+                    // Compute registers offset.
+                    reg_offset = (MPMCM_NUMBER_OF_REGISTERS_PER_HARMONICS_DATA * signal_idx);
+                    // Total harmonic distortion.
+                    _MPMCM_write_harmonic_accumulated_registers((MPMCM_REGISTER_ADDRESS_ACV_THD_0 + reg_offset), &(harmonics_data.thd_percent));
+                    // Odd harmonics.
+                    for (harmonic_idx = 0; harmonic_idx < DATA_NUMBER_OF_HARMONICS; harmonic_idx++) {
+                        _MPMCM_write_harmonic_accumulated_registers((MPMCM_REGISTER_ADDRESS_ACV_H3_0 + reg_offset + (MPMCM_NUMBER_OF_REGISTERS_PER_HARMONIC * harmonic_idx)), &(harmonics_data.odd_harmonic_percent[harmonic_idx]));
+                    }
+                }
+            }
+        }
+#endif
         // CHxS and TICS.
         for (channel_idx = 0; channel_idx < (MEASURE_NUMBER_OF_ACI_CHANNELS + 1); channel_idx++) {
             //  Check mask.
@@ -286,7 +469,7 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     // Active power.
                     data_reg_value = 0;
                     data_reg_mask = 0;
-                    field_value = (channel_data.active_power_mw.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.active_power_mw.rolling_mean) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
+                    field_value = (channel_data.active_power_mw.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.active_power_mw.mean) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
                     SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
                     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0 + reg_offset), data_reg_value, data_reg_mask);
                     data_reg_value = 0;
@@ -299,7 +482,7 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     // RMS voltage.
                     data_reg_value = 0;
                     data_reg_mask = 0;
-                    field_value = (channel_data.rms_voltage_mv.number_of_samples > 0) ? UNA_convert_mv((int32_t) channel_data.rms_voltage_mv.rolling_mean) : UNA_VOLTAGE_ERROR_VALUE;
+                    field_value = (channel_data.rms_voltage_mv.number_of_samples > 0) ? UNA_convert_mv((int32_t) channel_data.rms_voltage_mv.mean) : UNA_VOLTAGE_ERROR_VALUE;
                     SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
                     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_RMS_VOLTAGE_0 + reg_offset), data_reg_value, data_reg_mask);
                     data_reg_value = 0;
@@ -312,7 +495,7 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     // RMS current.
                     data_reg_value = 0;
                     data_reg_mask = 0;
-                    field_value = (channel_data.rms_current_ma.number_of_samples > 0) ? UNA_convert_ua((int32_t) (channel_data.rms_current_ma.rolling_mean * 1000.0)) : UNA_CURRENT_ERROR_VALUE;
+                    field_value = (channel_data.rms_current_ma.number_of_samples > 0) ? UNA_convert_ua((int32_t) (channel_data.rms_current_ma.mean * 1000.0)) : UNA_CURRENT_ERROR_VALUE;
                     SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
                     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_RMS_CURRENT_0 + reg_offset), data_reg_value, data_reg_mask);
                     data_reg_value = 0;
@@ -325,7 +508,7 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     // Apparent power.
                     data_reg_value = 0;
                     data_reg_mask = 0;
-                    field_value = (channel_data.apparent_power_mva.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.apparent_power_mva.rolling_mean) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
+                    field_value = (channel_data.apparent_power_mva.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.apparent_power_mva.mean) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
                     SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
                     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_APPARENT_POWER_0 + reg_offset), data_reg_value, data_reg_mask);
                     data_reg_value = 0;
@@ -338,7 +521,7 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     // Power factor.
                     data_reg_value = 0;
                     data_reg_mask = 0;
-                    field_value = (channel_data.power_factor.number_of_samples > 0) ? UNA_convert_power_factor((int32_t) channel_data.power_factor.rolling_mean) : UNA_POWER_FACTOR_ERROR_VALUE;
+                    field_value = (channel_data.power_factor.number_of_samples > 0) ? UNA_convert_power_factor((int32_t) channel_data.power_factor.mean) : UNA_POWER_FACTOR_ERROR_VALUE;
                     SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
                     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_POWER_FACTOR_0 + reg_offset), data_reg_value, data_reg_mask);
                     data_reg_value = 0;
@@ -348,6 +531,34 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     field_value = (channel_data.power_factor.number_of_samples > 0) ? UNA_convert_power_factor((int32_t) channel_data.power_factor.max) : UNA_POWER_FACTOR_ERROR_VALUE;
                     SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MAX);
                     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_POWER_FACTOR_1 + reg_offset), data_reg_value, data_reg_mask);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+                    // Reactive power.
+                    data_reg_value = 0;
+                    data_reg_mask = 0;
+                    field_value = (channel_data.reactive_power_mvar.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.reactive_power_mvar.mean) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
+                    SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
+                    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_0 + reg_offset), data_reg_value, data_reg_mask);
+                    data_reg_value = 0;
+                    data_reg_mask = 0;
+                    field_value = (channel_data.reactive_power_mvar.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.reactive_power_mvar.min) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
+                    SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MIN);
+                    field_value = (channel_data.reactive_power_mvar.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.reactive_power_mvar.max) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
+                    SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MAX);
+                    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_1 + reg_offset), data_reg_value, data_reg_mask);
+                    // Phase angle.
+                    data_reg_value = 0;
+                    data_reg_mask = 0;
+                    field_value = (channel_data.phase_angle_degrees.number_of_samples > 0) ? _MPMCM_convert_phase_angle(channel_data.phase_angle_degrees.mean) : MPMCM_PHASE_ANGLE_ERROR_VALUE;
+                    SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MEAN);
+                    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_0 + reg_offset), data_reg_value, data_reg_mask);
+                    data_reg_value = 0;
+                    data_reg_mask = 0;
+                    field_value = (channel_data.phase_angle_degrees.number_of_samples > 0) ? _MPMCM_convert_phase_angle(channel_data.phase_angle_degrees.min) : MPMCM_PHASE_ANGLE_ERROR_VALUE;
+                    SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MIN);
+                    field_value = (channel_data.phase_angle_degrees.number_of_samples > 0) ? _MPMCM_convert_phase_angle(channel_data.phase_angle_degrees.max) : MPMCM_PHASE_ANGLE_ERROR_VALUE;
+                    SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_MAX);
+                    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_1 + reg_offset), data_reg_value, data_reg_mask);
+#endif
                     // Active and apparent energy.
                     data_reg_value = 0;
                     data_reg_mask = 0;
@@ -356,6 +567,14 @@ NODE_status_t MPMCM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     field_value = (channel_data.apparent_energy_mvah.number_of_samples > 0) ? UNA_convert_mwh_mvah((int32_t) channel_data.apparent_energy_mvah.value) : UNA_ELECTRICAL_ENERGY_ERROR_VALUE;
                     SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_APPARENT_ENERGY);
                     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_ENERGY + reg_offset), data_reg_value, data_reg_mask);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+                    // Reactive energy.
+                    data_reg_value = 0;
+                    data_reg_mask = 0;
+                    field_value = (channel_data.reactive_energy_mvarh.number_of_samples > 0) ? UNA_convert_mwh_mvah((int32_t) channel_data.reactive_energy_mvarh.value) : UNA_ELECTRICAL_ENERGY_ERROR_VALUE;
+                    SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_REACTIVE_ENERGY);
+                    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_ENERGY + reg_offset), data_reg_value, data_reg_mask);
+#endif
                 }
             }
         }
@@ -381,6 +600,11 @@ NODE_status_t MPMCM_mtrg_callback(void) {
     uint32_t data_reg_value = 0;
     uint32_t data_reg_mask = 0;
     uint8_t channel_idx = 0;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    DATA_run_harmonics_t harmonics_data;
+    uint8_t signal_idx = 0;
+    uint8_t harmonic_idx = 0;
+#endif
     // Mains frequency.
     measure_status = MEASURE_get_run_data(MEASURE_DATA_INDEX_MAINS_FREQUENCY_MHZ, &single_data);
     MEASURE_exit_error(NODE_ERROR_BASE_MEASURE);
@@ -434,7 +658,37 @@ NODE_status_t MPMCM_mtrg_callback(void) {
         field_value = (channel_data.power_factor.number_of_samples > 0) ? UNA_convert_power_factor((int32_t) channel_data.power_factor.value) : UNA_POWER_FACTOR_ERROR_VALUE;
         SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_RUN);
         NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_POWER_FACTOR_0 + reg_offset), data_reg_value, data_reg_mask);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        // Reactive power.
+        data_reg_value = 0;
+        data_reg_mask = 0;
+        field_value = (channel_data.reactive_power_mvar.number_of_samples > 0) ? UNA_convert_mw_mva((int32_t) channel_data.reactive_power_mvar.value) : UNA_ELECTRICAL_POWER_ERROR_VALUE;
+        SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_RUN);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_0 + reg_offset), data_reg_value, data_reg_mask);
+        // Phase angle.
+        data_reg_value = 0;
+        data_reg_mask = 0;
+        field_value = (channel_data.phase_angle_degrees.number_of_samples > 0) ? _MPMCM_convert_phase_angle(channel_data.phase_angle_degrees.value) : MPMCM_PHASE_ANGLE_ERROR_VALUE;
+        SWREG_write_field(&data_reg_value, &data_reg_mask, field_value, MPMCM_REGISTER_MASK_RUN);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_0 + reg_offset), data_reg_value, data_reg_mask);
+#endif
     }
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    // Update harmonics run registers for all signals.
+    for (signal_idx = 0; signal_idx < MEASURE_HARMONICS_SIGNAL_LAST; signal_idx++) {
+        // Read run data.
+        measure_status = MEASURE_get_harmonics_run_data(signal_idx, &harmonics_data);
+        MEASURE_exit_error(NODE_ERROR_BASE_MEASURE);
+        // Compute registers offset.
+        reg_offset = (MPMCM_NUMBER_OF_REGISTERS_PER_HARMONICS_DATA * signal_idx);
+        // Total harmonic distortion.
+        _MPMCM_write_harmonic_run_register((MPMCM_REGISTER_ADDRESS_ACV_THD_0 + reg_offset), &(harmonics_data.thd_percent));
+        // Odd harmonics.
+        for (harmonic_idx = 0; harmonic_idx < DATA_NUMBER_OF_HARMONICS; harmonic_idx++) {
+            _MPMCM_write_harmonic_run_register((MPMCM_REGISTER_ADDRESS_ACV_H3_0 + reg_offset + (MPMCM_NUMBER_OF_REGISTERS_PER_HARMONIC * harmonic_idx)), &(harmonics_data.odd_harmonic_percent[harmonic_idx]));
+        }
+    }
+#endif
 errors:
     return status;
 }
@@ -35,12 +35,27 @@
 #include "sm.h"
 #include "sm_registers.h"
 #include "swreg.h"
+#ifndef MPMCM
+#include "systick.h"
+#endif
 #include "uhfm.h"
 #include "uhfm_registers.h"
 #include "una.h"
+#ifndef UNA_AT_DISABLE_FLAGS_FILE
+#include "una_at_flags.h"
+#endif
+#if ((defined MPMCM) && (defined UNA_AT_CUSTOM_COMMANDS))
+#include "lmac.h"
+#include "lmac_hw_baud_rate.h"
+#endif
 
 /*** NODE local macros ***/
 
+#if ((defined MPMCM) && (defined MPMCM_ANALOG_MEASURE_ENABLE) && (defined UNA_AT_CUSTOM_COMMANDS))
+// Measure start and stop switch the system clock, a negotiated RS485 baud rate has to be recomputed.
+#define NODE_RS485_CLOCK_UPDATE
+#endif
+
 #ifdef DSM_IOUT_INDICATOR
 #ifdef BCM
 #define NODE_IOUT_CHANNEL_INPUT_VOLTAGE         ANALOG_CHANNEL_VSRC_MV
@@ -56,6 +71,33 @@
 #define NODE_IOUT_INDICATOR_BLINK_DURATION_MS   2000
 #endif
 
+#define NODE_REGISTER_FLAGS_SIZE                ((NODE_REGISTER_ADDRESS_LAST + 31) >> 5)
+
+#ifdef MPMCM
+#define NODE_NVM_WORD_ADDRESS(base, word_offset)    ((base) + (word_offset))
+#else
+#define NODE_NVM_WORD_ADDRESS(base, word_offset)    ((base) + ((word_offset) << 2))
+#endif
+#if ((defined MPMCM) || (defined DSM_NVM_WORD_WRITE))
+#define NODE_NVM_WORD_ACCESS
+#endif
+
+#ifdef DSM_NVM_JOURNAL
+#define NODE_NVM_JOURNAL_NUMBER_OF_BANKS        2
+#define NODE_NVM_JOURNAL_BANK_SIZE_ENTRIES      32
+#define NODE_NVM_JOURNAL_ENTRY_SIZE_WORDS       2
+#define NODE_NVM_JOURNAL_BANK_MARKER            0xA5
+#define NODE_NVM_JOURNAL_ENTRY_MARKER           0x5A
+#define NODE_NVM_JOURNAL_SEQUENCE_MASK          0x00FFFFFF
+#define NODE_NVM_JOURNAL_ERASED_WORD            0x00000000
+// Entries left free after a compaction, the other journaled registers are moved to their fixed address.
+#define NODE_NVM_JOURNAL_COMPACTION_FREE_ENTRIES    8
+#define NODE_NVM_JOURNAL_COMPACTION_MAX_ENTRIES     (NODE_NVM_JOURNAL_BANK_SIZE_ENTRIES - 1 - NODE_NVM_JOURNAL_COMPACTION_FREE_ENTRIES)
+#define NODE_NVM_JOURNAL_ENTRY_CRC_DATA_SIZE_BYTES  8
+#define NODE_NVM_JOURNAL_ENTRY_CRC_POLYNOMIAL   0x1021
+#define NODE_NVM_JOURNAL_ENTRY_CRC_INIT         0xFFFF
+#endif
+
 /*** NODE local structures ***/
 
 #ifdef DSM_IOUT_INDICATOR
@@ -66,15 +108,42 @@ typedef struct {
 } NODE_iout_indicator_t;
 #endif
 
+/*******************************************************************/
+typedef NODE_status_t (*NODE_update_register_cb_t)(uint8_t reg_addr);
+typedef NODE_status_t (*NODE_check_register_cb_t)(uint8_t reg_addr, uint32_t reg_mask);
+
+/*******************************************************************/
+typedef struct {
+    NODE_update_register_cb_t update_register;
+    NODE_check_register_cb_t check_register;
+} NODE_register_handler_t;
+
 /*******************************************************************/
 typedef struct {
     volatile uint32_t registers[NODE_REGISTER_ADDRESS_LAST];
+#ifndef MPMCM
+    uint32_t nvm_pending_value[NODE_REGISTER_ADDRESS_LAST];
+    uint32_t nvm_dirty_flags[NODE_REGISTER_FLAGS_SIZE];
+    uint8_t nvm_flush_request;
+    NODE_nvm_statistics_t nvm_statistics;
+#endif
+#ifdef DSM_NVM_JOURNAL
+    uint32_t nvm_journal_value[NODE_REGISTER_ADDRESS_LAST];
+    uint32_t nvm_journal_valid_flags[NODE_REGISTER_FLAGS_SIZE];
+    uint32_t nvm_journal_sequence;
+    uint8_t nvm_journal_bank;
+    uint8_t nvm_journal_entry_idx;
+    NODE_nvm_journal_statistics_t nvm_journal_statistics;
+#endif
 #ifdef DSM_IOUT_INDICATOR
     uint32_t iout_measurements_next_time_seconds;
     uint32_t iout_indicator_next_time_seconds;
     int32_t input_voltage_mv;
     int32_t iout_ua;
 #endif
+#ifdef NODE_RS485_CLOCK_UPDATE
+    MEASURE_state_t measure_state;
+#endif
 } NODE_context_t;
 
 /*** NODE local global variables ***/
@@ -91,14 +160,37 @@ static const NODE_iout_indicator_t LVRM_IOUT_INDICATOR[NODE_IOUT_INDICATOR_RANGE
 };
 #endif
 
+// Note: common registers are always located before the board specific registers.
+static const NODE_register_handler_t NODE_REGISTER_HANDLER[NODE_REGISTER_ADDRESS_LAST] = {
+    [0 ... (COMMON_REGISTER_ADDRESS_LAST - 1)] = { &COMMON_update_register, &COMMON_check_register },
+    [COMMON_REGISTER_ADDRESS_LAST ... (NODE_REGISTER_ADDRESS_LAST - 1)] = { &NODE_UPDATE_REGISTER, &NODE_CHECK_REGISTER }
+};
+
 static NODE_context_t node_ctx = {
     .registers = { [0 ... (NODE_REGISTER_ADDRESS_LAST - 1)] = 0x00000000 },
+#ifndef MPMCM
+    .nvm_pending_value = { [0 ... (NODE_REGISTER_ADDRESS_LAST - 1)] = 0x00000000 },
+    .nvm_dirty_flags = { [0 ... (NODE_REGISTER_FLAGS_SIZE - 1)] = 0x00000000 },
+    .nvm_flush_request = 0,
+    .nvm_statistics = { .write_count = 0, .skip_count = 0, .programming_time_us = 0 },
+#endif
+#ifdef DSM_NVM_JOURNAL
+    .nvm_journal_value = { [0 ... (NODE_REGISTER_ADDRESS_LAST - 1)] = 0x00000000 },
+    .nvm_journal_valid_flags = { [0 ... (NODE_REGISTER_FLAGS_SIZE - 1)] = 0x00000000 },
+    .nvm_journal_sequence = 0,
+    .nvm_journal_bank = 0,
+    .nvm_journal_entry_idx = 0,
+    .nvm_journal_statistics = { .append_count = 0, .compaction_count = 0, .word_write_count = 0, .restore_entry_count = 0, .spill_count = 0 },
+#endif
 #ifdef DSM_IOUT_INDICATOR
     .iout_measurements_next_time_seconds = 0,
     .iout_indicator_next_time_seconds = 0,
     .input_voltage_mv = 0,
     .iout_ua = 0,
 #endif
+#ifdef NODE_RS485_CLOCK_UPDATE
+    .measure_state = MEASURE_STATE_OFF,
+#endif
 };
 
 /*** NODE local functions ***/
@@ -153,83 +245,416 @@ errors:
 }
 #endif
 
+#ifdef DSM_NVM_JOURNAL
 /*******************************************************************/
-static NODE_status_t _NODE_update_register(uint8_t reg_addr) {
+static NODE_status_t _NODE_journal_read_word(uint8_t bank, uint8_t entry_idx, uint8_t word_idx, uint32_t* word) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
-    // Update common registers.
-    status = COMMON_update_register(reg_addr);
-    if (status != NODE_SUCCESS) goto errors;
-    // Update specific registers.
-#ifdef LVRM
-    status = LVRM_update_register(reg_addr);
-#endif
-#ifdef BPSM
-    status = BPSM_update_register(reg_addr);
-#endif
-#ifdef DDRM
-    status = DDRM_update_register(reg_addr);
+    NVM_status_t nvm_status = NVM_SUCCESS;
+    uint32_t word_offset = ((((uint32_t) bank) * NODE_NVM_JOURNAL_BANK_SIZE_ENTRIES) + ((uint32_t) entry_idx)) * NODE_NVM_JOURNAL_ENTRY_SIZE_WORDS + ((uint32_t) word_idx);
+#ifndef NODE_NVM_WORD_ACCESS
+    uint8_t nvm_byte = 0;
+    uint8_t idx = 0;
 #endif
-#ifdef UHFM
-    status = UHFM_update_register(reg_addr);
+#ifdef NODE_NVM_WORD_ACCESS
+    // Read word.
+    nvm_status = NVM_read_word(NODE_NVM_WORD_ADDRESS(NVM_ADDRESS_REGISTERS_JOURNAL, word_offset), word);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+#else
+    // Byte loop.
+    (*word) = 0;
+    for (idx = 0; idx < 4; idx++) {
+        nvm_status = NVM_read_byte((NODE_NVM_WORD_ADDRESS(NVM_ADDRESS_REGISTERS_JOURNAL, word_offset) + idx), &nvm_byte);
+        NVM_exit_error(NODE_ERROR_BASE_NVM);
+        (*word) |= ((uint32_t) nvm_byte) << (idx << 3);
+    }
 #endif
-#ifdef GPSM
-    status = GPSM_update_register(reg_addr);
+errors:
+    return status;
+}
 #endif
-#ifdef SM
-    status = SM_update_register(reg_addr);
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static NODE_status_t _NODE_journal_write_word(uint8_t bank, uint8_t entry_idx, uint8_t word_idx, uint32_t word) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    NVM_status_t nvm_status = NVM_SUCCESS;
+    uint32_t word_offset = ((((uint32_t) bank) * NODE_NVM_JOURNAL_BANK_SIZE_ENTRIES) + ((uint32_t) entry_idx)) * NODE_NVM_JOURNAL_ENTRY_SIZE_WORDS + ((uint32_t) word_idx);
+#ifndef NODE_NVM_WORD_ACCESS
+    uint8_t idx = 0;
 #endif
-#ifdef RRM
-    status = RRM_update_register(reg_addr);
+#ifdef NODE_NVM_WORD_ACCESS
+    // Write word.
+    nvm_status = NVM_write_word(NODE_NVM_WORD_ADDRESS(NVM_ADDRESS_REGISTERS_JOURNAL, word_offset), word);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+#else
+    // Byte loop.
+    for (idx = 0; idx < 4; idx++) {
+        nvm_status = NVM_write_byte((NODE_NVM_WORD_ADDRESS(NVM_ADDRESS_REGISTERS_JOURNAL, word_offset) + idx), (uint8_t) ((word >> (idx << 3)) & 0x000000FF));
+        NVM_exit_error(NODE_ERROR_BASE_NVM);
+    }
 #endif
-#ifdef MPMCM
-    status = MPMCM_update_register(reg_addr);
+    node_ctx.nvm_journal_statistics.word_write_count++;
+errors:
+    return status;
+}
 #endif
-#ifdef BCM
-    status = BCM_update_register(reg_addr);
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static uint32_t _NODE_journal_entry_header(uint8_t reg_addr, uint32_t reg_value, uint32_t sequence) {
+    // Local variables.
+    uint8_t data[NODE_NVM_JOURNAL_ENTRY_CRC_DATA_SIZE_BYTES];
+    uint16_t crc = NODE_NVM_JOURNAL_ENTRY_CRC_INIT;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // Build CRC data: address, value and full bank sequence.
+    data[0] = reg_addr;
+    for (idx = 0; idx < 4; idx++) {
+        data[1 + idx] = (uint8_t) ((reg_value >> (idx << 3)) & 0x000000FF);
+    }
+    for (idx = 0; idx < 3; idx++) {
+        data[5 + idx] = (uint8_t) ((sequence >> (idx << 3)) & 0x000000FF);
+    }
+    // Compute CRC16-CCITT.
+    for (idx = 0; idx < NODE_NVM_JOURNAL_ENTRY_CRC_DATA_SIZE_BYTES; idx++) {
+        crc ^= (((uint16_t) data[idx]) << 8);
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x8000) != 0) ? ((uint16_t) ((crc << 1) ^ NODE_NVM_JOURNAL_ENTRY_CRC_POLYNOMIAL)) : ((uint16_t) (crc << 1));
+        }
+    }
+    // Header is marker, address and CRC.
+    // Note: the CRC covers the bank sequence to reject entries remaining from a previous bank cycle.
+    return ((((uint32_t) NODE_NVM_JOURNAL_ENTRY_MARKER) << 24) | (((uint32_t) reg_addr) << 16) | ((uint32_t) crc));
+}
 #endif
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static NODE_status_t _NODE_journal_write_entry(uint8_t bank, uint8_t entry_idx, uint8_t reg_addr, uint32_t reg_value, uint32_t sequence) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    // Write value first, the header validates the entry.
+    status = _NODE_journal_write_word(bank, entry_idx, 1, reg_value);
+    if (status != NODE_SUCCESS) goto errors;
+    status = _NODE_journal_write_word(bank, entry_idx, 0, _NODE_journal_entry_header(reg_addr, reg_value, sequence));
+    if (status != NODE_SUCCESS) goto errors;
 errors:
     return status;
 }
+#endif
 
+#ifdef DSM_NVM_JOURNAL
 /*******************************************************************/
-static NODE_status_t _NODE_check_register(uint8_t reg_addr, uint32_t reg_mask) {
+static NODE_status_t _NODE_journal_write_bank_header(uint8_t bank, uint32_t sequence) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
-    // Check common registers.
-    status = COMMON_check_register(reg_addr, reg_mask);
+    uint32_t header = ((((uint32_t) NODE_NVM_JOURNAL_BANK_MARKER) << 24) | (sequence & NODE_NVM_JOURNAL_SEQUENCE_MASK));
+    // Bank header is valid when both words match.
+    status = _NODE_journal_write_word(bank, 0, 1, (~header));
     if (status != NODE_SUCCESS) goto errors;
-    // Check specific registers.
-#ifdef LVRM
-    status = LVRM_check_register(reg_addr, reg_mask);
+    status = _NODE_journal_write_word(bank, 0, 0, header);
+    if (status != NODE_SUCCESS) goto errors;
+errors:
+    return status;
+}
 #endif
-#ifdef BPSM
-    status = BPSM_check_register(reg_addr, reg_mask);
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static NODE_status_t _NODE_journal_erase_bank(uint8_t bank) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t word = 0;
+    uint8_t entry_idx = 0;
+    uint8_t word_idx = 0;
+    // Invalidate bank header first, then all entries headers.
+    // Note: value words do not need to be erased since they are only used behind a valid header.
+    for (entry_idx = 0; entry_idx < NODE_NVM_JOURNAL_BANK_SIZE_ENTRIES; entry_idx++) {
+        for (word_idx = 0; word_idx < ((entry_idx == 0) ? 2 : 1); word_idx++) {
+            status = _NODE_journal_read_word(bank, entry_idx, word_idx, &word);
+            if (status != NODE_SUCCESS) goto errors;
+            // Program erased words only if needed.
+            if (word == NODE_NVM_JOURNAL_ERASED_WORD) continue;
+            status = _NODE_journal_write_word(bank, entry_idx, word_idx, NODE_NVM_JOURNAL_ERASED_WORD);
+            if (status != NODE_SUCCESS) goto errors;
+        }
+    }
+errors:
+    return status;
+}
 #endif
-#ifdef DDRM
-    status = DDRM_check_register(reg_addr, reg_mask);
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static NODE_status_t _NODE_journal_spill(uint8_t reg_addr, uint32_t reg_value) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    NVM_status_t nvm_status = NVM_SUCCESS;
+#ifndef MPMCM
+    uint8_t nvm_byte = 0;
+    uint8_t idx = 0;
 #endif
-#ifdef UHFM
-    status = UHFM_check_register(reg_addr, reg_mask);
+    // Store value at the fixed address of the register.
+#ifdef MPMCM
+    nvm_status = NVM_write_word((NVM_ADDRESS_REGISTERS + reg_addr), reg_value);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+#else
+    for (idx = 0; idx < 4; idx++) {
+        nvm_status = NVM_read_byte((NVM_ADDRESS_REGISTERS + (reg_addr << 2) + idx), &nvm_byte);
+        NVM_exit_error(NODE_ERROR_BASE_NVM);
+        // Program modified bytes only.
+        if (nvm_byte == ((uint8_t) ((reg_value >> (idx << 3)) & 0x000000FF))) continue;
+        nvm_status = NVM_write_byte((NVM_ADDRESS_REGISTERS + (reg_addr << 2) + idx), (uint8_t) ((reg_value >> (idx << 3)) & 0x000000FF));
+        NVM_exit_error(NODE_ERROR_BASE_NVM);
+    }
 #endif
-#ifdef GPSM
-    status = GPSM_check_register(reg_addr, reg_mask);
+    // Register is now read from its fixed address.
+    node_ctx.nvm_journal_valid_flags[reg_addr >> 5] &= ~(1UL << (reg_addr & 0x1F));
+    node_ctx.nvm_journal_statistics.spill_count++;
+errors:
+    return status;
+}
 #endif
-#ifdef SM
-    status = SM_check_register(reg_addr, reg_mask);
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static NODE_status_t _NODE_journal_restore(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t header = 0;
+    uint32_t header_complement = 0;
+    uint32_t reg_value = 0;
+    uint32_t sequence = 0;
+    uint8_t bank_found = 0;
+    uint8_t bank = 0;
+    uint8_t entry_idx = 0;
+    uint8_t reg_addr = 0;
+    uint8_t idx = 0;
+    // Reset cache.
+    for (idx = 0; idx < NODE_REGISTER_FLAGS_SIZE; idx++) {
+        node_ctx.nvm_journal_valid_flags[idx] = 0;
+    }
+    node_ctx.nvm_journal_statistics.restore_entry_count = 0;
+    // Search active bank.
+    for (bank = 0; bank < NODE_NVM_JOURNAL_NUMBER_OF_BANKS; bank++) {
+        status = _NODE_journal_read_word(bank, 0, 0, &header);
+        if (status != NODE_SUCCESS) goto errors;
+        status = _NODE_journal_read_word(bank, 0, 1, &header_complement);
+        if (status != NODE_SUCCESS) goto errors;
+        // Check header.
+        if (((header >> 24) != NODE_NVM_JOURNAL_BANK_MARKER) || (header_complement != (~header))) continue;
+        // Keep most recent bank.
+        sequence = (header & NODE_NVM_JOURNAL_SEQUENCE_MASK);
+        if ((bank_found == 0) || (sequence > node_ctx.nvm_journal_sequence)) {
+            node_ctx.nvm_journal_sequence = sequence;
+            node_ctx.nvm_journal_bank = bank;
+            bank_found = 1;
+        }
+    }
+    // Format journal if needed.
+    if (bank_found == 0) {
+        node_ctx.nvm_journal_sequence = 0;
+        node_ctx.nvm_journal_bank = 0;
+        node_ctx.nvm_journal_entry_idx = 1;
+        status = _NODE_journal_erase_bank(node_ctx.nvm_journal_bank);
+        if (status != NODE_SUCCESS) goto errors;
+        status = _NODE_journal_write_bank_header(node_ctx.nvm_journal_bank, node_ctx.nvm_journal_sequence);
+        goto errors;
+    }
+    // Replay entries until the first invalid one.
+    // Note: restore time is bounded by the bank size.
+    for (entry_idx = 1; entry_idx < NODE_NVM_JOURNAL_BANK_SIZE_ENTRIES; entry_idx++) {
+        status = _NODE_journal_read_word(node_ctx.nvm_journal_bank, entry_idx, 0, &header);
+        if (status != NODE_SUCCESS) goto errors;
+        status = _NODE_journal_read_word(node_ctx.nvm_journal_bank, entry_idx, 1, &reg_value);
+        if (status != NODE_SUCCESS) goto errors;
+        node_ctx.nvm_journal_statistics.restore_entry_count++;
+        // Check entry.
+        reg_addr = (uint8_t) ((header >> 16) & 0x000000FF);
+        if (header != _NODE_journal_entry_header(reg_addr, reg_value, node_ctx.nvm_journal_sequence)) break;
+        // Update cache.
+        if (reg_addr < NODE_REGISTER_ADDRESS_LAST) {
+            node_ctx.nvm_journal_value[reg_addr] = reg_value;
+            node_ctx.nvm_journal_valid_flags[reg_addr >> 5] |= (1UL << (reg_addr & 0x1F));
+        }
+    }
+    node_ctx.nvm_journal_entry_idx = entry_idx;
+errors:
+    return status;
+}
 #endif
-#ifdef RRM
-    status = RRM_check_register(reg_addr, reg_mask);
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static NODE_status_t _NODE_journal_compact(uint8_t last_reg_addr) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t sequence = ((node_ctx.nvm_journal_sequence + 1) & NODE_NVM_JOURNAL_SEQUENCE_MASK);
+    uint8_t bank = ((node_ctx.nvm_journal_bank + 1) % NODE_NVM_JOURNAL_NUMBER_OF_BANKS);
+    uint8_t entry_idx = 1;
+    uint8_t reg_addr = 0;
+    // Erase next bank.
+    status = _NODE_journal_erase_bank(bank);
+    if (status != NODE_SUCCESS) goto errors;
+    // Write the last register first since the current bank does not contain its new value.
+    // Note: all spilled registers are still valid in the current bank, so that an interrupted spill is harmless.
+    status = _NODE_journal_write_entry(bank, entry_idx, last_reg_addr, node_ctx.nvm_journal_value[last_reg_addr], sequence);
+    if (status != NODE_SUCCESS) goto errors;
+    entry_idx++;
+    // Copy last value of each register in the next bank.
+    for (reg_addr = 0; reg_addr < NODE_REGISTER_ADDRESS_LAST; reg_addr++) {
+        // Check flag.
+        if ((reg_addr == last_reg_addr) || ((node_ctx.nvm_journal_valid_flags[reg_addr >> 5] & (1UL << (reg_addr & 0x1F))) == 0)) continue;
+        // Check space.
+        if (entry_idx > NODE_NVM_JOURNAL_COMPACTION_MAX_ENTRIES) {
+            // Keep free entries for the next appends, remaining registers are moved to their fixed address.
+            status = _NODE_journal_spill(reg_addr, node_ctx.nvm_journal_value[reg_addr]);
+            if (status != NODE_SUCCESS) goto errors;
+            continue;
+        }
+        status = _NODE_journal_write_entry(bank, entry_idx, reg_addr, node_ctx.nvm_journal_value[reg_addr], sequence);
+        if (status != NODE_SUCCESS) goto errors;
+        entry_idx++;
+    }
+    // Switch to new bank once all entries are written.
+    status = _NODE_journal_write_bank_header(bank, sequence);
+    if (status != NODE_SUCCESS) goto errors;
+    node_ctx.nvm_journal_sequence = sequence;
+    node_ctx.nvm_journal_bank = bank;
+    node_ctx.nvm_journal_entry_idx = entry_idx;
+    node_ctx.nvm_journal_statistics.compaction_count++;
+errors:
+    return status;
+}
 #endif
-#ifdef MPMCM
-    status = MPMCM_check_register(reg_addr, reg_mask);
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static NODE_status_t _NODE_journal_append(uint8_t reg_addr, uint32_t reg_value) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    // Update cache.
+    node_ctx.nvm_journal_value[reg_addr] = reg_value;
+    node_ctx.nvm_journal_valid_flags[reg_addr >> 5] |= (1UL << (reg_addr & 0x1F));
+    node_ctx.nvm_journal_statistics.append_count++;
+    // Check remaining space.
+    if (node_ctx.nvm_journal_entry_idx >= NODE_NVM_JOURNAL_BANK_SIZE_ENTRIES) {
+        // Compaction stores the new value.
+        status = _NODE_journal_compact(reg_addr);
+        goto errors;
+    }
+    // Append entry.
+    status = _NODE_journal_write_entry(node_ctx.nvm_journal_bank, node_ctx.nvm_journal_entry_idx, reg_addr, reg_value, node_ctx.nvm_journal_sequence);
+    if (status != NODE_SUCCESS) goto errors;
+    node_ctx.nvm_journal_entry_idx++;
+errors:
+    return status;
+}
 #endif
-#ifdef BCM
-    status = BCM_check_register(reg_addr, reg_mask);
+
+#ifndef MPMCM
+/*******************************************************************/
+static NODE_status_t _NODE_flush_nvm(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+#ifndef DSM_NVM_JOURNAL
+    NVM_status_t nvm_status = NVM_SUCCESS;
 #endif
+    uint32_t nvm_value = 0;
+    uint32_t reg_value = 0;
+    uint32_t diff = 0;
+    SYSTICK_status_t systick_status = SYSTICK_SUCCESS;
+    uint32_t systick_start = 0;
+    uint8_t systick_running = 0;
+    uint8_t reg_addr = 0;
+    uint8_t idx = 0;
+    uint8_t diff_count = 0;
+    // Check request.
+    if (node_ctx.nvm_flush_request == 0) goto errors;
+    // Dirty registers loop.
+    for (reg_addr = 0; reg_addr < NODE_REGISTER_ADDRESS_LAST; reg_addr++) {
+        // Check flag.
+        if ((node_ctx.nvm_dirty_flags[reg_addr >> 5] & (1UL << (reg_addr & 0x1F))) == 0) continue;
+        // Read current NVM content.
+        status = NODE_read_nvm(reg_addr, &nvm_value);
+        if (status != NODE_SUCCESS) goto errors;
+        // Count modified bytes.
+        reg_value = node_ctx.nvm_pending_value[reg_addr];
+        diff = (reg_value ^ nvm_value);
+        diff_count = 0;
+        for (idx = 0; idx < 4; idx++) {
+            if (((diff >> (idx << 3)) & 0x000000FF) != 0) {
+                diff_count++;
+            }
+        }
+        if (diff_count == 0) {
+            // Value is already stored.
+            node_ctx.nvm_statistics.skip_count++;
+        }
+        else {
+            // Start programming time measurement on first write.
+            // Note: SysTick is not restarted if it is already used by another layer (GPS time-in-sleep measurement for example).
+            if ((systick_running == 0) && (SYSTICK_is_running() == 0)) {
+                systick_status = SYSTICK_start();
+                SYSTICK_stack_error(ERROR_BASE_SYSTICK);
+                systick_running = 1;
+            }
+            systick_start = SYSTICK_get_timestamp();
+#ifdef DSM_NVM_JOURNAL
+            // Append value in journal.
+            status = _NODE_journal_append(reg_addr, reg_value);
+            if (status != NODE_SUCCESS) goto errors;
+            node_ctx.nvm_statistics.write_count++;
+#else
+            for (idx = 0; idx < 4; idx++) {
+#ifdef DSM_NVM_WORD_WRITE
+                if (diff_count > 1) {
+                    // Program the whole word at once.
+                    nvm_status = NVM_write_word((NVM_ADDRESS_REGISTERS + (reg_addr << 2)), reg_value);
+                    NVM_exit_error(NODE_ERROR_BASE_NVM);
+                    node_ctx.nvm_statistics.write_count++;
+                    break;
+                }
+#endif
+                // Program the modified bytes only.
+                if (((diff >> (idx << 3)) & 0x000000FF) == 0) continue;
+                nvm_status = NVM_write_byte((NVM_ADDRESS_REGISTERS + (reg_addr << 2) + idx), (uint8_t) ((reg_value >> (idx << 3)) & 0x000000FF));
+                NVM_exit_error(NODE_ERROR_BASE_NVM);
+                node_ctx.nvm_statistics.write_count++;
+            }
+#endif
+            node_ctx.nvm_statistics.programming_time_us += SYSTICK_get_elapsed_us(systick_start);
+        }
+        // Clear flag once the value is stored.
+        node_ctx.nvm_dirty_flags[reg_addr >> 5] &= ~(1UL << (reg_addr & 0x1F));
+    }
+    node_ctx.nvm_flush_request = 0;
 errors:
+    // Stop programming time measurement.
+    if (systick_running != 0) {
+        SYSTICK_stop();
+    }
     return status;
 }
+#endif
+
+#ifdef NODE_RS485_CLOCK_UPDATE
+/*******************************************************************/
+static void _NODE_update_rs485_clock(void) {
+    // Local variables.
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    MEASURE_state_t measure_state = MEASURE_get_state();
+    // Check measure start or stop.
+    if ((measure_state == MEASURE_STATE_ACTIVE) == (node_ctx.measure_state == MEASURE_STATE_ACTIVE)) goto errors;
+    // Recompute RS485 baud rate register with the new system clock.
+    lmac_status = LMAC_HW_update_clock();
+    LMAC_stack_error(ERROR_BASE_LMAC);
+errors:
+    node_ctx.measure_state = measure_state;
+}
+#endif
 
 /*** NODE functions ***/
 
@@ -256,12 +681,24 @@ NODE_status_t NODE_init(void) {
     for (idx = 0; idx < NODE_REGISTER_ADDRESS_LAST; idx++) {
         node_ctx.registers[idx] = NODE_REGISTER_ERROR_VALUE[idx];
     }
+#ifndef MPMCM
+    for (idx = 0; idx < NODE_REGISTER_FLAGS_SIZE; idx++) {
+        node_ctx.nvm_dirty_flags[idx] = 0;
+    }
+    node_ctx.nvm_flush_request = 0;
+    node_ctx.nvm_statistics.write_count = 0;
+    node_ctx.nvm_statistics.skip_count = 0;
+    node_ctx.nvm_statistics.programming_time_us = 0;
+#endif
 #ifdef DSM_IOUT_INDICATOR
     node_ctx.iout_measurements_next_time_seconds = 0;
     node_ctx.iout_indicator_next_time_seconds = 0;
     node_ctx.input_voltage_mv = 0;
     node_ctx.iout_ua = 0;
 #endif
+#ifdef NODE_RS485_CLOCK_UPDATE
+    node_ctx.measure_state = MEASURE_STATE_OFF;
+#endif
 #ifdef DSM_NVM_FACTORY_RESET
 #ifdef MPMCM
     nvm_status = NVM_write_word(NVM_ADDRESS_SELF_ADDRESS, (uint32_t) DSM_NODE_ADDRESS);
@@ -278,6 +715,11 @@ NODE_status_t NODE_init(void) {
     nvm_status = NVM_read_byte(NVM_ADDRESS_SELF_ADDRESS, &self_address);
 #endif
     NVM_exit_error(NODE_ERROR_BASE_NVM);
+#ifdef DSM_NVM_JOURNAL
+    // Restore journaled registers.
+    status = _NODE_journal_restore();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
 #ifdef DSM_LOAD_CONTROL
     LOAD_init();
 #endif
@@ -299,33 +741,7 @@ NODE_status_t NODE_init(void) {
     status = COMMON_init_registers(self_address);
     if (status != NODE_SUCCESS) goto errors;
     // Init specific registers.
-#ifdef LVRM
-    status = LVRM_init_registers();
-#endif
-#ifdef BPSM
-    status = BPSM_init_registers();
-#endif
-#ifdef DDRM
-    status = DDRM_init_registers();
-#endif
-#ifdef UHFM
-    status = UHFM_init_registers();
-#endif
-#ifdef GPSM
-    status = GPSM_init_registers();
-#endif
-#ifdef SM
-    status = SM_init_registers();
-#endif
-#ifdef RRM
-    status = RRM_init_registers();
-#endif
-#ifdef MPMCM
-    status = MPMCM_init_registers();
-#endif
-#ifdef BCM
-    status = BCM_init_registers();
-#endif
+    status = NODE_INIT_REGISTERS();
     if (status != NODE_SUCCESS) goto errors;
 errors:
     return status;
@@ -365,14 +781,27 @@ NODE_status_t NODE_de_init(void) {
 NODE_status_t NODE_process(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
-#if (((defined LVRM) && (defined LVRM_MODE_BMS)) || (defined BPSM) || (defined BCM))
+#ifndef MPMCM
     NODE_status_t node_status = NODE_SUCCESS;
 #endif
+#if ((defined MPMCM) && (defined MPMCM_ANALOG_MEASURE_ENABLE))
+    MEASURE_status_t measure_status = MEASURE_SUCCESS;
+#endif
 #if ((defined MPMCM) && (defined MPMCM_LINKY_TIC_ENABLE))
     TIC_status_t tic_status = TIC_SUCCESS;
+#endif
+#ifndef MPMCM
+    // Store registers written during the last transactions.
+    node_status = _NODE_flush_nvm();
+    NODE_stack_error(ERROR_BASE_NODE);
 #endif
     // Read RTRG bit.
     if (SWREG_read_field(node_ctx.registers[COMMON_REGISTER_ADDRESS_CONTROL_0], COMMON_REGISTER_CONTROL_0_MASK_RTRG) != 0) {
+#ifndef MPMCM
+        // Retry to store pending registers before reset.
+        node_status = _NODE_flush_nvm();
+        NODE_stack_error(ERROR_BASE_NODE);
+#endif
         // Reset MCU.
         PWR_software_reset();
     }
@@ -388,6 +817,14 @@ NODE_status_t NODE_process(void) {
     NODE_stack_error(ERROR_BASE_NODE);
 #endif
 #endif
+#if ((defined MPMCM) && (defined MPMCM_ANALOG_MEASURE_ENABLE))
+    // Process analog measure.
+    measure_status = MEASURE_process();
+    MEASURE_stack_error(ERROR_BASE_MEASURE);
+#ifdef NODE_RS485_CLOCK_UPDATE
+    _NODE_update_rs485_clock();
+#endif
+#endif
 #if ((defined MPMCM) && (defined MPMCM_LINKY_TIC_ENABLE))
     // Process TIC interface.
     tic_status = TIC_process();
@@ -401,6 +838,14 @@ NODE_status_t NODE_process(void) {
     NODE_stack_error(ERROR_BASE_NODE);
 #endif
 #endif
+#ifdef UHFM
+    node_status = UHFM_process();
+    NODE_stack_error(ERROR_BASE_NODE);
+#endif
+#ifdef GPSM
+    node_status = GPSM_process();
+    NODE_stack_error(ERROR_BASE_NODE);
+#endif
 #ifdef DSM_IOUT_INDICATOR
     // Check measurements period.
     if (RTC_get_uptime_seconds() >= node_ctx.iout_measurements_next_time_seconds) {
@@ -438,6 +883,9 @@ NODE_status_t NODE_tick_second(void) {
 #ifdef MPMCM_ANALOG_MEASURE_ENABLE
     // Call measure tick.
     measure_status = MEASURE_tick_second();
+#ifdef NODE_RS485_CLOCK_UPDATE
+    _NODE_update_rs485_clock();
+#endif
     MEASURE_exit_error(ERROR_BASE_MEASURE);
 #endif
 #ifdef MPMCM_ANALOG_MEASURE_ENABLE
@@ -457,12 +905,19 @@ NODE_state_t NODE_get_state(void) {
 #ifdef DSM_IOUT_INDICATOR
     state = (LED_get_state() == LED_STATE_OFF) ? NODE_STATE_IDLE : NODE_STATE_RUNNING;
 #endif
+#ifdef UHFM
+    // Sigfox timers are not running in stop mode.
+    state = UHFM_get_state();
+#endif
+#ifdef GPSM
+    state = GPSM_get_state();
+#endif
 #endif
     return state;
 }
 
 /*******************************************************************/
-NODE_status_t NODE_write_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+NODE_status_t NODE_check_register_write(NODE_request_source_t request_source, uint8_t reg_addr) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     // Check address.
@@ -475,13 +930,29 @@ NODE_status_t NODE_write_register(NODE_request_source_t request_source, uint8_t
         status = NODE_ERROR_REGISTER_READ_ONLY;
         goto errors;
     }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NODE_status_t NODE_write_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    // Check address and access.
+    status = NODE_check_register_write(request_source, reg_addr);
+    if (status != NODE_SUCCESS) goto errors;
     // Write register.
     SWREG_modify_register((uint32_t*) &(node_ctx.registers[reg_addr]), reg_value, reg_mask);
     // Check actions.
     if (request_source == NODE_REQUEST_SOURCE_EXTERNAL) {
         // Check control bits.
-        status = _NODE_check_register(reg_addr, reg_mask);
+        status = NODE_REGISTER_HANDLER[reg_addr].check_register(reg_addr, reg_mask);
         if (status != NODE_SUCCESS) goto errors;
+#ifndef MPMCM
+        // Store configuration registers before replying to the master.
+        status = _NODE_flush_nvm();
+        if (status != NODE_SUCCESS) goto errors;
+#endif
     }
 errors:
     return status;
@@ -520,27 +991,66 @@ errors:
 NODE_status_t NODE_write_nvm(uint8_t reg_addr, uint32_t reg_value) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
+#if ((defined MPMCM) && !(defined DSM_NVM_JOURNAL))
     NVM_status_t nvm_status = NVM_SUCCESS;
-#ifndef MPMCM
-    uint8_t nvm_byte = 0;
-    uint8_t idx = 0;
 #endif
+    // Check address.
+    if (reg_addr >= NODE_REGISTER_ADDRESS_LAST) {
+        status = NODE_ERROR_REGISTER_ADDRESS;
+        goto errors;
+    }
 #ifdef MPMCM
+#ifdef DSM_NVM_JOURNAL
+    // Append value in journal.
+    status = _NODE_journal_append(reg_addr, reg_value);
+    if (status != NODE_SUCCESS) goto errors;
+#else
     nvm_status = NVM_write_word((NVM_ADDRESS_REGISTERS + reg_addr), reg_value);
     NVM_exit_error(NODE_ERROR_BASE_NVM);
+#endif
 #else
-    // Byte loop.
-    for (idx = 0; idx < 4; idx++) {
-        // Compute byte.
-        nvm_byte = (uint8_t) (((reg_value) >> (idx << 3)) & 0x000000FF);
-        // Write NVM.
-        nvm_status = NVM_write_byte((NVM_ADDRESS_REGISTERS + (reg_addr << 2) + idx), nvm_byte);
-        NVM_exit_error(NODE_ERROR_BASE_NVM);
+    // Defer programming to the end of the current transaction.
+    node_ctx.nvm_pending_value[reg_addr] = reg_value;
+    node_ctx.nvm_dirty_flags[reg_addr >> 5] |= (1UL << (reg_addr & 0x1F));
+    node_ctx.nvm_flush_request = 1;
+#endif
+errors:
+    return status;
+}
+
+#ifndef MPMCM
+/*******************************************************************/
+NODE_status_t NODE_get_nvm_statistics(NODE_nvm_statistics_t* nvm_statistics) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    // Check parameter.
+    if (nvm_statistics == NULL) {
+        status = NODE_ERROR_NULL_PARAMETER;
+        goto errors;
     }
+    // Copy statistics.
+    (*nvm_statistics) = node_ctx.nvm_statistics;
+errors:
+    return status;
+}
 #endif
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+NODE_status_t NODE_get_nvm_journal_statistics(NODE_nvm_journal_statistics_t* nvm_journal_statistics) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    // Check parameter.
+    if (nvm_journal_statistics == NULL) {
+        status = NODE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Copy statistics.
+    (*nvm_journal_statistics) = node_ctx.nvm_journal_statistics;
 errors:
     return status;
 }
+#endif
 
 /*******************************************************************/
 NODE_status_t NODE_read_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t* reg_value) {
@@ -558,7 +1068,7 @@ NODE_status_t NODE_read_register(NODE_request_source_t request_source, uint8_t r
     // Check update type.
     if (request_source == NODE_REQUEST_SOURCE_EXTERNAL) {
         // Update register.
-        status = _NODE_update_register(reg_addr);
+        status = NODE_REGISTER_HANDLER[reg_addr].update_register(reg_addr);
         if (status != NODE_SUCCESS) goto errors;
     }
     // Read register.
@@ -567,6 +1077,29 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+NODE_status_t NODE_read_registers(NODE_request_source_t request_source, uint8_t reg_addr_base, uint32_t* reg_value, uint8_t number_of_registers) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((number_of_registers == 0) || ((reg_addr_base + number_of_registers) > NODE_REGISTER_ADDRESS_LAST)) {
+        status = NODE_ERROR_REGISTER_ADDRESS;
+        goto errors;
+    }
+    if (reg_value == NULL) {
+        status = NODE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Register loop.
+    for (idx = 0; idx < number_of_registers; idx++) {
+        status = NODE_read_register(request_source, (reg_addr_base + idx), &(reg_value[idx]));
+        if (status != NODE_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+
 /*******************************************************************/
 NODE_status_t NODE_read_byte_array(NODE_request_source_t request_source, uint8_t reg_addr_base, uint8_t* data, uint8_t data_size_byte) {
     // Local variables.
@@ -585,8 +1118,10 @@ NODE_status_t NODE_read_byte_array(NODE_request_source_t request_source, uint8_t
         // Compute address and mask.
         reg_addr = (reg_addr_base + (idx >> 2));
         reg_mask = (0xFF << ((idx % 4) << 3));
-        // Read byte.
-        status = NODE_read_register(request_source, reg_addr, &reg_value);
+        // Read register only once for all its bytes.
+        if ((idx % 4) == 0) {
+            status = NODE_read_register(request_source, reg_addr, &reg_value);
+        }
         // Fill data.
         data[idx] = (uint8_t) SWREG_read_field(reg_value, reg_mask);
     }
@@ -610,6 +1145,14 @@ NODE_status_t NODE_read_nvm(uint8_t reg_addr, uint32_t* reg_value) {
     }
     // Reset output value.
     (*reg_value) = 0;
+#ifdef DSM_NVM_JOURNAL
+    // Read last journaled value if any.
+    if ((reg_addr < NODE_REGISTER_ADDRESS_LAST) && ((node_ctx.nvm_journal_valid_flags[reg_addr >> 5] & (1UL << (reg_addr & 0x1F))) != 0)) {
+        (*reg_value) = node_ctx.nvm_journal_value[reg_addr];
+        goto errors;
+    }
+    // Otherwise fall back on the fixed address storage.
+#endif
 #ifdef MPMCM
     nvm_status = NVM_read_word((NVM_ADDRESS_REGISTERS + reg_addr), reg_value);
     NVM_exit_error(NODE_ERROR_BASE_NVM);
@@ -16,6 +16,7 @@
 #include "load.h"
 #include "manuf/mcu_api.h"
 #include "manuf/rf_api.h"
+#include "mcu_api_timer.h"
 #include "node.h"
 #include "nvm.h"
 #include "nvm_address.h"
@@ -47,12 +48,37 @@ typedef union {
     uint8_t all;
 } UHFM_flags_t;
 
+/*******************************************************************/
+typedef enum {
+    UHFM_SIGFOX_STATE_IDLE = 0,
+    UHFM_SIGFOX_STATE_MESSAGE,
+    UHFM_SIGFOX_STATE_TEST_MODE,
+    UHFM_SIGFOX_STATE_LAST
+} UHFM_sigfox_state_t;
+
+/*******************************************************************/
+typedef struct {
+    UHFM_sigfox_state_t state;
+    volatile uint8_t process_flag;
+    volatile uint8_t completion_flag;
+    sfx_bool bidirectional_flag;
+    uint32_t message_counter;
+} UHFM_sigfox_context_t;
+
 /*** UHFM local global variables ***/
 
 static UHFM_flags_t uhfm_flags = {
     .all = 0
 };
 
+static UHFM_sigfox_context_t uhfm_sigfox_ctx = {
+    .state = UHFM_SIGFOX_STATE_IDLE,
+    .process_flag = 0,
+    .completion_flag = 0,
+    .bidirectional_flag = SIGFOX_FALSE,
+    .message_counter = 0
+};
+
 /*** UHFM local functions ***/
 
 /*******************************************************************/
@@ -101,7 +127,7 @@ static NODE_status_t _UHFM_is_radio_free(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     // Compare state.
-    if (POWER_get_state(POWER_DOMAIN_RADIO) != 0) {
+    if ((POWER_get_state(POWER_DOMAIN_RADIO) != 0) || (uhfm_sigfox_ctx.state != UHFM_SIGFOX_STATE_IDLE)) {
         status = NODE_ERROR_RADIO_STATE;
         goto errors;
     }
@@ -109,6 +135,79 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+static void _UHFM_sigfox_process_callback(void) {
+    // Set local flag.
+    uhfm_sigfox_ctx.process_flag = 1;
+}
+
+/*******************************************************************/
+static void _UHFM_sigfox_completion_callback(void) {
+    // Set local flag.
+    uhfm_sigfox_ctx.completion_flag = 1;
+}
+
+/*******************************************************************/
+static void _UHFM_end_operation(uint32_t trigger_mask, SIGFOX_EP_API_message_status_t message_status, NODE_status_t operation_status_code) {
+    // Report failure with the execution error flag.
+    if (operation_status_code != NODE_SUCCESS) {
+        message_status.field.execution_error = 1;
+    }
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATUS_1, (uint32_t) (message_status.all), UHFM_REGISTER_STATUS_1_MASK_MESSAGE_STATUS);
+    // Trigger bit is cleared once the operation is completed.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_CONTROL_1, 0b0, trigger_mask);
+}
+
+/*******************************************************************/
+static NODE_status_t _UHFM_end_message(NODE_status_t message_status_code) {
+    // Local variables.
+    NODE_status_t status = message_status_code;
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+    SIGFOX_EP_API_message_status_t message_status;
+    uint32_t reg_status_1 = 0;
+    uint32_t reg_status_1_mask = 0;
+    sfx_u8 dl_payload[SIGFOX_DL_PAYLOAD_SIZE_BYTES];
+    sfx_s16 dl_rssi_dbm = 0;
+    // Read message status.
+    message_status = SIGFOX_EP_API_get_message_status();
+    if (status != NODE_SUCCESS) goto errors;
+    // Check bidirectional flag.
+    if ((uhfm_sigfox_ctx.bidirectional_flag != 0) && (message_status.field.dl_frame != 0)) {
+        // Read downlink data.
+        sigfox_ep_api_status = SIGFOX_EP_API_get_dl_payload(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
+        SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
+        // Write DL payload registers and RSSI.
+        NODE_write_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_DL_PAYLOAD_0, (uint8_t*) dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES);
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, UNA_convert_dbm(dl_rssi_dbm), UHFM_REGISTER_STATUS_1_MASK_DL_RSSI);
+    }
+errors:
+    // Close library.
+    SIGFOX_EP_API_close();
+    uhfm_sigfox_ctx.state = UHFM_SIGFOX_STATE_IDLE;
+    // Update bidirectional message counter.
+    if ((uhfm_sigfox_ctx.bidirectional_flag == SIGFOX_TRUE) && (message_status.all != 0)) {
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, (uhfm_sigfox_ctx.message_counter + 1), UHFM_REGISTER_STATUS_1_MASK_BIDIRECTIONAL_MC);
+    }
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
+    // Update message status.
+    _UHFM_end_operation(UHFM_REGISTER_CONTROL_1_MASK_STRG, message_status, status);
+    // Return status.
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _UHFM_end_test_mode(NODE_status_t test_mode_status_code) {
+    // Local variables.
+    SIGFOX_EP_API_message_status_t message_status;
+    // Close addon.
+    SIGFOX_EP_ADDON_RFP_API_close();
+    uhfm_sigfox_ctx.state = UHFM_SIGFOX_STATE_IDLE;
+    // Update status.
+    message_status.all = 0;
+    _UHFM_end_operation(UHFM_REGISTER_CONTROL_1_MASK_TTRG, message_status, test_mode_status_code);
+    return test_mode_status_code;
+}
+
 /*******************************************************************/
 static NODE_status_t _UHFM_strg_callback(void) {
     // Local variables.
@@ -116,23 +215,20 @@ static NODE_status_t _UHFM_strg_callback(void) {
     SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
     MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
     SIGFOX_EP_API_config_t lib_config;
+    SIGFOX_EP_API_message_status_t message_status;
     SIGFOX_EP_API_application_message_t application_message;
 #ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
     SIGFOX_EP_API_control_message_t control_message;
 #endif
-    SIGFOX_EP_API_message_status_t message_status;
-    uint32_t reg_status_1 = 0;
-    uint32_t reg_status_1_mask = 0;
     uint32_t reg_config_0 = 0;
-    sfx_bool bidirectional_flag = 0;
     sfx_u8 ul_payload[SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES];
     sfx_u8 ul_payload_size = 0;
-    sfx_u8 dl_payload[SIGFOX_DL_PAYLOAD_SIZE_BYTES];
-    sfx_s16 dl_rssi_dbm = 0;
     sfx_u8 nvm_data[SIGFOX_NVM_DATA_SIZE_BYTES];
-    uint32_t message_counter = 0;
-    // Reset status.
-    message_status.all = 0;
+    // Reset context.
+    uhfm_sigfox_ctx.bidirectional_flag = SIGFOX_FALSE;
+    uhfm_sigfox_ctx.message_counter = 0;
+    uhfm_sigfox_ctx.process_flag = 0;
+    uhfm_sigfox_ctx.completion_flag = 0;
     // Read configuration registers.
     NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_CONFIGURATION_0, &reg_config_0);
     // Check radio state.
@@ -140,8 +236,12 @@ static NODE_status_t _UHFM_strg_callback(void) {
     if (status != NODE_SUCCESS) goto errors;
     // Open library.
     lib_config.rc = &SIGFOX_RC1;
+    lib_config.process_cb = &_UHFM_sigfox_process_callback;
     sigfox_ep_api_status = SIGFOX_EP_API_open(&lib_config);
     SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
+    uhfm_sigfox_ctx.state = UHFM_SIGFOX_STATE_MESSAGE;
+    // Message status is cleared while the operation is in progress.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATUS_1, 0, UHFM_REGISTER_STATUS_1_MASK_MESSAGE_STATUS);
 #ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
     // Check control message flag.
     if (SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_CMSG) == 0) {
@@ -151,15 +251,15 @@ static NODE_status_t _UHFM_strg_callback(void) {
         // Read UL payload.
         NODE_read_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_UL_PAYLOAD_0, (uint8_t*) ul_payload, ul_payload_size);
         // Update bidirectional flag.
-        bidirectional_flag = (sfx_bool) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BF);
+        uhfm_sigfox_ctx.bidirectional_flag = (sfx_bool) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BF);
         // Read current message counter.
-        if (bidirectional_flag == SIGFOX_TRUE) {
+        if (uhfm_sigfox_ctx.bidirectional_flag == SIGFOX_TRUE) {
             // Read memory.
             mcu_api_status = MCU_API_get_nvm((sfx_u8*) nvm_data, SIGFOX_NVM_DATA_SIZE_BYTES);
             MCU_API_check_status(NODE_ERROR_SIGFOX_MCU_API);
             // Compute message counter.
-            message_counter = (sfx_u32) (message_counter | ((((sfx_u32) nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB]) << 8) & 0xFF00));
-            message_counter = (sfx_u32) (message_counter | ((((sfx_u32) nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB]) << 0) & 0x00FF));
+            uhfm_sigfox_ctx.message_counter |= ((((sfx_u32) nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB]) << 8) & 0xFF00);
+            uhfm_sigfox_ctx.message_counter |= ((((sfx_u32) nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB]) << 0) & 0x00FF);
         }
         // Build message structure.
         application_message.common_parameters.number_of_frames = (sfx_u8) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_NFR);
@@ -168,23 +268,15 @@ static NODE_status_t _UHFM_strg_callback(void) {
         application_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
 #endif
         application_message.type = (SIGFOX_application_message_type_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_MSGT);
-        application_message.bidirectional_flag = bidirectional_flag;
+        application_message.bidirectional_flag = uhfm_sigfox_ctx.bidirectional_flag;
         application_message.ul_payload = (sfx_u8*) ul_payload;
         application_message.ul_payload_size_bytes = ul_payload_size;
-        // Send message.
+        application_message.uplink_cplt_cb = SIGFOX_NULL;
+        application_message.downlink_cplt_cb = SIGFOX_NULL;
+        application_message.message_cplt_cb = &_UHFM_sigfox_completion_callback;
+        // Start message, the sequence is then performed by the process function.
         sigfox_ep_api_status = SIGFOX_EP_API_send_application_message(&application_message);
         SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
-        // Read message status.
-        message_status = SIGFOX_EP_API_get_message_status();
-        // Check bidirectional flag.
-        if ((application_message.bidirectional_flag != 0) && (message_status.field.dl_frame != 0)) {
-            // Read downlink data.
-            sigfox_ep_api_status = SIGFOX_EP_API_get_dl_payload(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
-            SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
-            // Write DL payload registers and RSSI.
-            NODE_write_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_DL_PAYLOAD_0, (uint8_t*) dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES);
-            SWREG_write_field(&reg_status_1, &reg_status_1_mask, UNA_convert_dbm(dl_rssi_dbm), UHFM_REGISTER_STATUS_1_MASK_DL_RSSI);
-        }
 #ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
     }
     else {
@@ -192,24 +284,22 @@ static NODE_status_t _UHFM_strg_callback(void) {
         control_message.common_parameters.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
         control_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
         control_message.type = SIGFOX_CONTROL_MESSAGE_TYPE_KEEP_ALIVE;
-        // Send message.
+        control_message.uplink_cplt_cb = SIGFOX_NULL;
+        control_message.message_cplt_cb = &_UHFM_sigfox_completion_callback;
+        // Start message.
         sigfox_ep_api_status = SIGFOX_EP_API_send_control_message(&control_message);
         SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
-        // Read message status.
-        message_status = SIGFOX_EP_API_get_message_status();
     }
 #endif
+    return status;
 errors:
-    // Close library.
-    SIGFOX_EP_API_close();
-    // Update message status.
-    SWREG_write_field(&reg_status_1, &reg_status_1_mask, (uint32_t) (message_status.all), UHFM_REGISTER_STATUS_1_MASK_MESSAGE_STATUS);
-    // Update bidirectional message counter.
-    if ((bidirectional_flag == SIGFOX_TRUE) && (message_status.all != 0)) {
-        SWREG_write_field(&reg_status_1, &reg_status_1_mask, (message_counter + 1), UHFM_REGISTER_STATUS_1_MASK_BIDIRECTIONAL_MC);
+    if (uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_MESSAGE) {
+        _UHFM_end_message(status);
+    }
+    else {
+        message_status.all = 0;
+        _UHFM_end_operation(UHFM_REGISTER_CONTROL_1_MASK_STRG, message_status, status);
     }
-    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
-    // Return status.
     return status;
 }
 
@@ -220,7 +310,11 @@ static NODE_status_t _UHFM_ttrg_callback(void) {
     SIGFOX_EP_ADDON_RFP_API_status_t sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
     SIGFOX_EP_ADDON_RFP_API_config_t addon_config;
     SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode;
+    SIGFOX_EP_API_message_status_t message_status;
     uint32_t reg_config_0 = 0;
+    // Reset context.
+    uhfm_sigfox_ctx.process_flag = 0;
+    uhfm_sigfox_ctx.completion_flag = 0;
     // Read configuration registers.
     NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_CONFIGURATION_0, &reg_config_0);
     // Check radio state.
@@ -228,17 +322,27 @@ static NODE_status_t _UHFM_ttrg_callback(void) {
     if (status != NODE_SUCCESS) goto errors;
     // Open addon.
     addon_config.rc = &SIGFOX_RC1;
+    addon_config.process_cb = &_UHFM_sigfox_process_callback;
     sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_open(&addon_config);
     _UHFM_sigfox_ep_addon_rfp_exit_error();
-    // Call test mode function.
+    uhfm_sigfox_ctx.state = UHFM_SIGFOX_STATE_TEST_MODE;
+    // Message status is cleared while the operation is in progress.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATUS_1, 0, UHFM_REGISTER_STATUS_1_MASK_MESSAGE_STATUS);
+    // Start test mode, the sequence is then performed by the process function.
     test_mode.test_mode_reference = (SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_RFP_TEST_MODE);
     test_mode.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
+    test_mode.cplt_cb = &_UHFM_sigfox_completion_callback;
     sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_test_mode(&test_mode);
     _UHFM_sigfox_ep_addon_rfp_exit_error();
+    return status;
 errors:
-    // Close addon.
-    SIGFOX_EP_ADDON_RFP_API_close();
-    // Return status.
+    if (uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_TEST_MODE) {
+        _UHFM_end_test_mode(status);
+    }
+    else {
+        message_status.all = 0;
+        _UHFM_end_operation(UHFM_REGISTER_CONTROL_1_MASK_TTRG, message_status, status);
+    }
     return status;
 }
 
@@ -371,6 +475,9 @@ NODE_status_t UHFM_init_registers(void) {
 #endif
     // Init flags.
     uhfm_flags.all = 0;
+    uhfm_sigfox_ctx.state = UHFM_SIGFOX_STATE_IDLE;
+    uhfm_sigfox_ctx.process_flag = 0;
+    uhfm_sigfox_ctx.completion_flag = 0;
     // Sigfox EP ID register.
     for (idx = 0; idx < SIGFOX_EP_ID_SIZE_BYTES; idx++) {
         NVM_read_byte((NVM_ADDRESS_SIGFOX_EP_ID + idx), &(sigfox_ep_tab[idx]));
@@ -443,9 +550,8 @@ NODE_status_t UHFM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
         if ((reg_mask & UHFM_REGISTER_CONTROL_1_MASK_STRG) != 0) {
             // Read bit.
             if (SWREG_read_field(reg_value, UHFM_REGISTER_CONTROL_1_MASK_STRG) != 0) {
-                // Clear request.
-                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_CONTROL_1, 0b0, UHFM_REGISTER_CONTROL_1_MASK_STRG);
-                // Send Sigfox message.
+                // Start Sigfox message.
+                // Note: the request bit is cleared once the message is completed.
                 status = _UHFM_strg_callback();
                 if (status != NODE_SUCCESS) goto errors;
             }
@@ -454,9 +560,8 @@ NODE_status_t UHFM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
         if ((reg_mask & UHFM_REGISTER_CONTROL_1_MASK_TTRG)) {
             // Read bit.
             if (SWREG_read_field(reg_value, UHFM_REGISTER_CONTROL_1_MASK_TTRG) != 0) {
-                // Clear request.
-                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_CONTROL_1, 0b0, UHFM_REGISTER_CONTROL_1_MASK_TTRG);
-                // Perform Sigfox test mode.
+                // Start Sigfox test mode.
+                // Note: the request bit is cleared once the test mode is completed.
                 status = _UHFM_ttrg_callback();
                 if (status != NODE_SUCCESS) goto errors;
             }
@@ -565,4 +670,54 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+NODE_status_t UHFM_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_API_status_t sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    // Check state.
+    if (uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_IDLE) goto errors;
+#ifdef SIGFOX_EP_TIMER_REQUIRED
+    // Check timers completion since the last wake-up.
+    MCU_API_check_timers();
+#endif
+    // Check process flag.
+    if (uhfm_sigfox_ctx.process_flag != 0) {
+        // Clear flag.
+        uhfm_sigfox_ctx.process_flag = 0;
+        // Process library.
+        if (uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_MESSAGE) {
+            sigfox_ep_api_status = SIGFOX_EP_API_process();
+            SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
+        }
+        else {
+            sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_process();
+            _UHFM_sigfox_ep_addon_rfp_exit_error();
+        }
+    }
+    // Check completion flag.
+    if (uhfm_sigfox_ctx.completion_flag != 0) {
+        // Clear flag.
+        uhfm_sigfox_ctx.completion_flag = 0;
+        // Close library.
+        status = (uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_MESSAGE) ? _UHFM_end_message(NODE_SUCCESS) : _UHFM_end_test_mode(NODE_SUCCESS);
+    }
+    return status;
+errors:
+    // Abort current operation.
+    if (uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_MESSAGE) {
+        _UHFM_end_message(status);
+    }
+    if (uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_TEST_MODE) {
+        _UHFM_end_test_mode(status);
+    }
+    return status;
+}
+
+/*******************************************************************/
+NODE_state_t UHFM_get_state(void) {
+    return ((uhfm_sigfox_ctx.state == UHFM_SIGFOX_STATE_IDLE) ? NODE_STATE_IDLE : NODE_STATE_RUNNING);
+}
+
 #endif /* UHFM */
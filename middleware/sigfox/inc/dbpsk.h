@@ -0,0 +1,59 @@
+/*
+ * dbpsk.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __DBPSK_H__
+#define __DBPSK_H__
+
+#include "types.h"
+
+/*** DBPSK macros ***/
+
+// Number of samples per symbol.
+#define DBPSK_SYMBOL_PROFILE_SIZE_BYTES     40
+// Each sample is made of a deviation and a PA output power byte (S2LP polar mode FIFO format).
+#define DBPSK_SYMBOL_SIZE_BYTES             (DBPSK_SYMBOL_PROFILE_SIZE_BYTES << 1)
+
+/*** DBPSK functions ***/
+
+/*!******************************************************************
+ * \fn void DBPSK_start(uint8_t* bitstream, uint8_t bitstream_size_bytes)
+ * \brief Start the modulation of a new bitstream.
+ * \param[in]   bitstream: Pointer to the bitstream to modulate (must remain valid until the end of the modulation).
+ * \param[in]   bitstream_size_bytes: Size of the bitstream in bytes.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void DBPSK_start(uint8_t* bitstream, uint8_t bitstream_size_bytes);
+
+/*!******************************************************************
+ * \fn uint8_t DBPSK_fill_buffer(uint8_t* buffer, uint8_t size_bytes)
+ * \brief Write the next samples of the modulated stream (ramp-up, bits, ramp-down and padding symbols).
+ * \param[in]   size_bytes: Maximum number of bytes to write.
+ * \param[out]  buffer: Pointer to the samples buffer.
+ * \retval      Number of bytes written, lower than size_bytes at the end of the stream.
+ *******************************************************************/
+uint8_t DBPSK_fill_buffer(uint8_t* buffer, uint8_t size_bytes);
+
+/*!******************************************************************
+ * \fn uint8_t DBPSK_get_byte_index(void)
+ * \brief Get the index of the bitstream byte currently modulated.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current byte index.
+ *******************************************************************/
+uint8_t DBPSK_get_byte_index(void);
+
+/*!******************************************************************
+ * \fn uint8_t DBPSK_is_complete(void)
+ * \brief Check if all the samples of the current stream have been written.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if samples are remaining, 1 otherwise.
+ *******************************************************************/
+uint8_t DBPSK_is_complete(void);
+
+#endif /* __DBPSK_H__ */
@@ -0,0 +1,30 @@
+/*
+ * mcu_api_timer.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MCU_API_TIMER_H__
+#define __MCU_API_TIMER_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+
+/*** MCU API timer functions ***/
+
+#if (defined SIGFOX_EP_ASYNCHRONOUS) && (defined SIGFOX_EP_TIMER_REQUIRED)
+/*!******************************************************************
+ * \fn void MCU_API_check_timers(void)
+ * \brief Check Sigfox timers completion in asynchronous mode.
+ * \brief The timer driver has no completion callback: this function has to be called after each MCU wake-up while a message is in progress.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void MCU_API_check_timers(void);
+#endif
+
+#endif /* __MCU_API_TIMER_H__ */
@@ -0,0 +1,30 @@
+/*
+ * rf_api_voltage.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RF_API_VOLTAGE_H__
+#define __RF_API_VOLTAGE_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+
+/*** RF API voltage functions ***/
+
+/*!******************************************************************
+ * \fn sfx_bool RF_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u16* voltage_tx_mv, sfx_s16* temperature_tenth_degrees)
+ * \brief Read the supply voltages and temperature sampled during the current message.
+ * \brief Idle values are sampled before the first power amplifier activation, TX voltage at the middle of the first frame. Measurements are cleared once read and when the radio is opened.
+ * \param[in]   none
+ * \param[out]  voltage_idle_mv: Pointer to the MCU supply voltage before transmission.
+ * \param[out]  voltage_tx_mv: Pointer to the MCU supply voltage during transmission.
+ * \param[out]  temperature_tenth_degrees: Pointer to the MCU temperature.
+ * \retval      SIGFOX_TRUE if all measurements are available, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool RF_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u16* voltage_tx_mv, sfx_s16* temperature_tenth_degrees);
+
+#endif /* __RF_API_VOLTAGE_H__ */
@@ -109,7 +109,7 @@
  * \def SIGFOX_EP_ASYNCHRONOUS
  * \brief Asynchronous mode if defined, blocking mode otherwise.
  *******************************************************************/
-//#define SIGFOX_EP_ASYNCHRONOUS
+#define SIGFOX_EP_ASYNCHRONOUS
 
 /*!******************************************************************
  * \def SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
@@ -177,7 +177,7 @@
  * \def SIGFOX_EP_CRC_HW
  * \brief If defined, enable hardware CRC through MCU API functions. Otherwise the embedded driver is used.
  *******************************************************************/
-//#define SIGFOX_EP_CRC_HW
+#define SIGFOX_EP_CRC_HW
 
 /*!******************************************************************
  * \def SIGFOX_EP_MESSAGE_COUNTER_ROLLOVER
@@ -0,0 +1,166 @@
+/*
+ * dbpsk.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "dbpsk.h"
+
+#include "types.h"
+
+/*** DBPSK local macros ***/
+
+#define DBPSK_FDEV_NEGATIVE     0x7F
+#define DBPSK_FDEV_POSITIVE     0x81
+
+/*** DBPSK local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    DBPSK_SYMBOL_RAMP_UP = 0,
+    DBPSK_SYMBOL_BIT_0,
+    DBPSK_SYMBOL_BIT_1,
+    DBPSK_SYMBOL_RAMP_DOWN,
+    DBPSK_SYMBOL_PADDING,
+    DBPSK_SYMBOL_END
+} DBPSK_symbol_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t* bitstream;
+    uint8_t bitstream_size_bytes;
+    volatile uint8_t byte_idx;
+    uint8_t bit_idx;
+    DBPSK_symbol_t symbol;
+    const uint8_t* symbol_ptr;
+    uint8_t symbol_byte_idx;
+    uint8_t fdev;
+} DBPSK_context_t;
+
+/*** DBPSK local global variables ***/
+
+// Symbols are stored as interleaved (deviation, PA output power) samples, ready to be copied into the S2LP FIFO.
+// Ramp-up.
+static const uint8_t DBPSK_SYMBOL_RAMP_UP_SAMPLES[DBPSK_SYMBOL_SIZE_BYTES] = { 0, 220, 0, 60, 0, 39, 0, 31, 0, 25, 0, 19, 0, 14, 0, 10, 0, 7, 0, 5, 0, 3, 0, 3, 0, 2, 0, 2, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+// Ramp-down.
+static const uint8_t DBPSK_SYMBOL_RAMP_DOWN_SAMPLES[DBPSK_SYMBOL_SIZE_BYTES] = { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2, 0, 2, 0, 2, 0, 3, 0, 3, 0, 5, 0, 7, 0, 10, 0, 14, 0, 19, 0, 25, 0, 31, 0, 39, 0, 60, 0, 220 };
+// Bit 0 with negative phase shift and amplitude shaping.
+static const uint8_t DBPSK_SYMBOL_BIT0_FDEV_NEGATIVE_SAMPLES[DBPSK_SYMBOL_SIZE_BYTES] = { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2, 0, 2, 0, 2, 0, 3, 0, 3, 0, 5, 0, 7, 0, 10, 0, 14, 0, 19, 0, 25, 0, 31, 0, 39, 0, 60, 0, 220, DBPSK_FDEV_NEGATIVE, 220, 0, 60, 0, 39, 0, 31, 0, 25, 0, 19, 0, 14, 0, 10, 0, 7, 0, 5, 0, 3, 0, 3, 0, 2, 0, 2, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+// Bit 0 with positive phase shift and amplitude shaping.
+static const uint8_t DBPSK_SYMBOL_BIT0_FDEV_POSITIVE_SAMPLES[DBPSK_SYMBOL_SIZE_BYTES] = { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2, 0, 2, 0, 2, 0, 3, 0, 3, 0, 5, 0, 7, 0, 10, 0, 14, 0, 19, 0, 25, 0, 31, 0, 39, 0, 60, 0, 220, DBPSK_FDEV_POSITIVE, 220, 0, 60, 0, 39, 0, 31, 0, 25, 0, 19, 0, 14, 0, 10, 0, 7, 0, 5, 0, 3, 0, 3, 0, 2, 0, 2, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+// Bit 1 (constant CW).
+static const uint8_t DBPSK_SYMBOL_BIT1_SAMPLES[DBPSK_SYMBOL_SIZE_BYTES] = { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+// Padding symbol to ensure last ramp down is completely transmitted.
+static const uint8_t DBPSK_SYMBOL_PADDING_SAMPLES[DBPSK_SYMBOL_SIZE_BYTES] = { 0 };
+
+static DBPSK_context_t dbpsk_ctx = {
+    .bitstream = NULL,
+    .bitstream_size_bytes = 0,
+    .byte_idx = 0,
+    .bit_idx = 0,
+    .symbol = DBPSK_SYMBOL_END,
+    .symbol_ptr = NULL,
+    .symbol_byte_idx = 0,
+    .fdev = 0
+};
+
+/*** DBPSK local functions ***/
+
+/*******************************************************************/
+static void _DBPSK_start_symbol(void) {
+    // Check current symbol.
+    switch (dbpsk_ctx.symbol) {
+    case DBPSK_SYMBOL_RAMP_UP:
+    case DBPSK_SYMBOL_BIT_0:
+    case DBPSK_SYMBOL_BIT_1:
+        // Check end of bitstream.
+        if (dbpsk_ctx.byte_idx >= dbpsk_ctx.bitstream_size_bytes) {
+            dbpsk_ctx.symbol = DBPSK_SYMBOL_RAMP_DOWN;
+            dbpsk_ctx.symbol_ptr = DBPSK_SYMBOL_RAMP_DOWN_SAMPLES;
+            break;
+        }
+        // Check bit.
+        if ((dbpsk_ctx.bitstream[dbpsk_ctx.byte_idx] & (1 << (7 - dbpsk_ctx.bit_idx))) == 0) {
+            // Phase shift required.
+            dbpsk_ctx.fdev = (dbpsk_ctx.fdev == DBPSK_FDEV_NEGATIVE) ? DBPSK_FDEV_POSITIVE : DBPSK_FDEV_NEGATIVE; // Toggle deviation.
+            dbpsk_ctx.symbol = DBPSK_SYMBOL_BIT_0;
+            dbpsk_ctx.symbol_ptr = (dbpsk_ctx.fdev == DBPSK_FDEV_NEGATIVE) ? DBPSK_SYMBOL_BIT0_FDEV_NEGATIVE_SAMPLES : DBPSK_SYMBOL_BIT0_FDEV_POSITIVE_SAMPLES;
+        }
+        else {
+            dbpsk_ctx.symbol = DBPSK_SYMBOL_BIT_1;
+            dbpsk_ctx.symbol_ptr = DBPSK_SYMBOL_BIT1_SAMPLES;
+        }
+        // Increment bit index.
+        dbpsk_ctx.bit_idx++;
+        if (dbpsk_ctx.bit_idx >= 8) {
+            dbpsk_ctx.bit_idx = 0;
+            dbpsk_ctx.byte_idx++;
+        }
+        break;
+    case DBPSK_SYMBOL_RAMP_DOWN:
+        dbpsk_ctx.symbol = DBPSK_SYMBOL_PADDING;
+        dbpsk_ctx.symbol_ptr = DBPSK_SYMBOL_PADDING_SAMPLES;
+        break;
+    default:
+        dbpsk_ctx.symbol = DBPSK_SYMBOL_END;
+        dbpsk_ctx.symbol_ptr = NULL;
+        break;
+    }
+}
+
+/*** DBPSK functions ***/
+
+/*******************************************************************/
+void DBPSK_start(uint8_t* bitstream, uint8_t bitstream_size_bytes) {
+    // Init context.
+    // Note: the deviation sign is kept from the previous stream, the phase reference is restarted by the ramp-up anyway.
+    dbpsk_ctx.bitstream = bitstream;
+    dbpsk_ctx.bitstream_size_bytes = ((bitstream != NULL) ? bitstream_size_bytes : 0);
+    dbpsk_ctx.byte_idx = 0;
+    dbpsk_ctx.bit_idx = 0;
+    dbpsk_ctx.symbol = DBPSK_SYMBOL_RAMP_UP;
+    dbpsk_ctx.symbol_ptr = DBPSK_SYMBOL_RAMP_UP_SAMPLES;
+    dbpsk_ctx.symbol_byte_idx = 0;
+}
+
+/*******************************************************************/
+uint8_t DBPSK_fill_buffer(uint8_t* buffer, uint8_t size_bytes) {
+    // Local variables.
+    uint8_t buffer_idx = 0;
+    uint8_t copy_size_bytes = 0;
+    uint8_t idx = 0;
+    // Check parameter.
+    if (buffer == NULL) goto errors;
+    // Copy precomputed symbols, a buffer can cover several symbols.
+    while ((buffer_idx < size_bytes) && (dbpsk_ctx.symbol != DBPSK_SYMBOL_END)) {
+        // Compute block size.
+        copy_size_bytes = (DBPSK_SYMBOL_SIZE_BYTES - dbpsk_ctx.symbol_byte_idx);
+        if (copy_size_bytes > (size_bytes - buffer_idx)) {
+            copy_size_bytes = (size_bytes - buffer_idx);
+        }
+        // Copy block.
+        for (idx = 0; idx < copy_size_bytes; idx++) {
+            buffer[buffer_idx + idx] = dbpsk_ctx.symbol_ptr[dbpsk_ctx.symbol_byte_idx + idx];
+        }
+        buffer_idx += copy_size_bytes;
+        dbpsk_ctx.symbol_byte_idx += copy_size_bytes;
+        // Check end of symbol.
+        if (dbpsk_ctx.symbol_byte_idx >= DBPSK_SYMBOL_SIZE_BYTES) {
+            dbpsk_ctx.symbol_byte_idx = 0;
+            _DBPSK_start_symbol();
+        }
+    }
+errors:
+    return buffer_idx;
+}
+
+/*******************************************************************/
+uint8_t DBPSK_get_byte_index(void) {
+    return dbpsk_ctx.byte_idx;
+}
+
+/*******************************************************************/
+uint8_t DBPSK_is_complete(void) {
+    return ((dbpsk_ctx.symbol == DBPSK_SYMBOL_END) ? 1 : 0);
+}
@@ -44,16 +44,35 @@
 
 #include "aes.h"
 #include "analog.h"
+#ifdef SIGFOX_EP_CRC_HW
+#include "crc.h"
+#endif
 #include "error.h"
 #include "error_base.h"
+#include "mcu_api_timer.h"
 #include "mcu_mapping.h"
 #include "nvic_priority.h"
 #include "nvm.h"
 #include "nvm_address.h"
 #include "power.h"
+#include "rf_api_voltage.h"
 #include "tim.h"
 #include "types.h"
 
+/*** MCU API local macros ***/
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+#define MCU_API_TIMER_NUMBER    4
+#endif
+#if (defined SIGFOX_EP_AES_HW) && (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
+// AES peripheral and key are kept during the whole Sigfox session.
+#define MCU_API_AES_SESSION
+#endif
+#if (defined SIGFOX_EP_CRC_HW) && (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
+// CRC peripheral is kept during the whole Sigfox session.
+#define MCU_API_CRC_SESSION
+#endif
+
 /*** MCU API local structures ***/
 
 typedef enum {
@@ -61,13 +80,32 @@ typedef enum {
     MCU_API_ERROR_NULL_PARAMETER = (MCU_API_SUCCESS + 1),
     MCU_API_ERROR_EP_KEY,
     MCU_API_ERROR_LATENCY_TYPE,
+    MCU_API_ERROR_TIMER_INSTANCE,
     // Low level drivers errors.
     MCU_API_ERROR_DRIVER_ANALOG,
     MCU_API_ERROR_DRIVER_AES,
     MCU_API_ERROR_DRIVER_NVM,
-    MCU_API_ERROR_DRIVER_TIM
+    MCU_API_ERROR_DRIVER_TIM,
+    MCU_API_ERROR_DRIVER_CRC
 } MCU_API_custom_status_t;
 
+#if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined MCU_API_AES_SESSION)
+/*******************************************************************/
+typedef struct {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    MCU_API_process_cb_t process_cb;
+    MCU_API_error_cb_t error_cb;
+    MCU_API_timer_cplt_cb_t timer_cplt_cb[MCU_API_TIMER_NUMBER];
+    sfx_u8 timer_running_mask;
+    volatile sfx_u8 timer_elapsed_mask;
+#endif
+#ifdef MCU_API_AES_SESSION
+    sfx_u8 ep_key[SIGFOX_EP_KEY_SIZE_BYTES];
+    sfx_u8 ep_key_cached;
+#endif
+} MCU_API_context_t;
+#endif
+
 /*** MCU API local global variables ***/
 
 #if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION) && (defined SIGFOX_EP_BIDIRECTIONAL)
@@ -75,6 +113,41 @@ static sfx_u32 MCU_API_LATENCY_MS[MCU_API_LATENCY_LAST] = {
     ADC_INIT_DELAY_MS // Get voltage and temperature function.
 };
 #endif
+#if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined MCU_API_AES_SESSION)
+static MCU_API_context_t mcu_api_ctx;
+#endif
+
+/*** MCU API local functions ***/
+
+#ifdef SIGFOX_EP_AES_HW
+/*******************************************************************/
+static MCU_API_status_t _MCU_API_read_ep_key(uint8_t* ep_key) {
+    // Local variables.
+    MCU_API_status_t status = MCU_API_SUCCESS;
+    NVM_status_t nvm_status = NVM_SUCCESS;
+    uint8_t idx = 0;
+    // Read private key from NVM.
+    for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
+        nvm_status = NVM_read_byte((NVM_ADDRESS_SIGFOX_EP_KEY + idx), &(ep_key[idx]));
+        NVM_stack_exit_error(ERROR_BASE_NVM, (MCU_API_status_t) MCU_API_ERROR_DRIVER_NVM);
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef MCU_API_AES_SESSION
+/*******************************************************************/
+static void _MCU_API_clear_ep_key(void) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Erase key from RAM.
+    for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
+        mcu_api_ctx.ep_key[idx] = 0x00;
+    }
+    mcu_api_ctx.ep_key_cached = 0;
+}
+#endif
 
 /*** MCU API functions ***/
 
@@ -84,8 +157,34 @@ MCU_API_status_t MCU_API_open(MCU_API_config_t* mcu_api_config) {
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
     TIM_status_t tim_status = TIM_SUCCESS;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sfx_u8 idx = 0;
+    // Check parameter.
+    if (mcu_api_config == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((MCU_API_status_t) MCU_API_ERROR_NULL_PARAMETER);
+    }
+    // Store callbacks.
+    mcu_api_ctx.process_cb = (mcu_api_config->process_cb);
+    mcu_api_ctx.error_cb = (mcu_api_config->error_cb);
+    for (idx = 0; idx < MCU_API_TIMER_NUMBER; idx++) {
+        mcu_api_ctx.timer_cplt_cb[idx] = SIGFOX_NULL;
+    }
+    mcu_api_ctx.timer_running_mask = 0;
+    mcu_api_ctx.timer_elapsed_mask = 0;
+#else
     // Ignore unused parameters.
     SIGFOX_UNUSED(mcu_api_config);
+#endif
+#ifdef MCU_API_AES_SESSION
+    // Key will be read from NVM on first encryption.
+    _MCU_API_clear_ep_key();
+    // Init AES peripheral.
+    AES_init();
+#endif
+#ifdef MCU_API_CRC_SESSION
+    // Init CRC peripheral.
+    CRC_init();
+#endif
     // Init timer.
     tim_status = TIM_MCH_init(TIM_INSTANCE_MCU_API, NVIC_PRIORITY_SIGFOX_TIMER);
     TIM_stack_exit_error(ERROR_BASE_TIM_MCU_API, (MCU_API_status_t) MCU_API_ERROR_DRIVER_TIM);
@@ -100,6 +199,15 @@ MCU_API_status_t MCU_API_close(void) {
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
     TIM_status_t tim_status = TIM_SUCCESS;
+#ifdef MCU_API_AES_SESSION
+    // Erase key and release AES peripheral.
+    _MCU_API_clear_ep_key();
+    AES_de_init();
+#endif
+#ifdef MCU_API_CRC_SESSION
+    // Release CRC peripheral.
+    CRC_de_init();
+#endif
     // Release timer.
     tim_status = TIM_MCH_de_init(TIM_INSTANCE_MCU_API);
     // Check status.
@@ -116,6 +224,16 @@ MCU_API_status_t MCU_API_close(void) {
 MCU_API_status_t MCU_API_process(void) {
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
+    sfx_u8 idx = 0;
+    // Call completion callback of elapsed timers.
+    for (idx = 0; idx < MCU_API_TIMER_NUMBER; idx++) {
+        if ((mcu_api_ctx.timer_elapsed_mask & (1 << idx)) != 0) {
+            mcu_api_ctx.timer_elapsed_mask &= (sfx_u8) ~(1 << idx);
+            if (mcu_api_ctx.timer_cplt_cb[idx] != SIGFOX_NULL) {
+                mcu_api_ctx.timer_cplt_cb[idx]();
+            }
+        }
+    }
     SIGFOX_RETURN();
 }
 #endif
@@ -131,17 +249,30 @@ MCU_API_status_t MCU_API_timer_start(MCU_API_timer_t* timer) {
     if (timer == SIGFOX_NULL) {
         SIGFOX_EXIT_ERROR((MCU_API_status_t) MCU_API_ERROR_NULL_PARAMETER);
     }
-#ifdef SIGFOX_EP_BIDIRECTIONAL
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && !(defined SIGFOX_EP_ASYNCHRONOUS)
     // Update waiting mode according to timer reason.
+    // Note: in asynchronous mode, all timers use the low power waiting mode so that the channel interrupt wakes-up the MCU for MCU_API_check_timers().
     if ((timer->reason) == MCU_API_TIMER_REASON_T_RX) {
         // T_RX completion is directly checked with the raw timer status within the RF_API_receive() function.
         // All other timers completion are checked with the MCU_API_timer_wait_cplt() function, using low power sleep waiting mode.
         tim_waiting_mode = TIM_WAITING_MODE_ACTIVE;
     }
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Check instance.
+    if ((timer->instance) >= MCU_API_TIMER_NUMBER) {
+        SIGFOX_EXIT_ERROR((MCU_API_status_t) MCU_API_ERROR_TIMER_INSTANCE);
+    }
+    // Store completion callback.
+    mcu_api_ctx.timer_cplt_cb[timer->instance] = (timer->cplt_cb);
+    mcu_api_ctx.timer_elapsed_mask &= (sfx_u8) ~(1 << (timer->instance));
 #endif
     // Start timer.
     tim_status = TIM_MCH_start_channel(TIM_INSTANCE_MCU_API, (TIM_channel_t) (timer->instance), (timer->duration_ms), tim_waiting_mode);
     TIM_stack_exit_error(ERROR_BASE_TIM_MCU_API, (MCU_API_status_t) MCU_API_ERROR_DRIVER_TIM);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    mcu_api_ctx.timer_running_mask |= (sfx_u8) (1 << (timer->instance));
+#endif
 errors:
     SIGFOX_RETURN();
 }
@@ -153,6 +284,13 @@ MCU_API_status_t MCU_API_timer_stop(MCU_API_timer_instance_t timer_instance) {
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
     TIM_status_t tim_status = TIM_SUCCESS;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Clear flags.
+    if (timer_instance < MCU_API_TIMER_NUMBER) {
+        mcu_api_ctx.timer_running_mask &= (sfx_u8) ~(1 << timer_instance);
+        mcu_api_ctx.timer_elapsed_mask &= (sfx_u8) ~(1 << timer_instance);
+    }
+#endif
     // Stop timer.
     tim_status = TIM_MCH_stop_channel(TIM_INSTANCE_MCU_API, (TIM_channel_t) timer_instance);
     TIM_stack_exit_error(ERROR_BASE_TIM_MCU_API, (MCU_API_status_t) MCU_API_ERROR_DRIVER_TIM);
@@ -194,45 +332,55 @@ errors:
 MCU_API_status_t MCU_API_aes_128_cbc_encrypt(MCU_API_encryption_data_t* aes_data) {
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
-    NVM_status_t nvm_status = NVM_SUCCESS;
     AES_status_t aes_status = AES_SUCCESS;
-    uint8_t idx = 0;
+    uint8_t* key_ptr = SIGFOX_NULL;
+#ifndef MCU_API_AES_SESSION
     uint8_t local_key[SIGFOX_EP_KEY_SIZE_BYTES];
+#endif
     // Get right key.
 #ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
     switch (aes_data -> key) {
     case SIGFOX_EP_KEY_PRIVATE:
-        // Retrieve private key from NVM.
-        for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
-            nvm_status = NVM_read_byte((NVM_ADDRESS_SIGFOX_EP_KEY + idx), &(local_key[idx]));
-            NVM_stack_exit_error(ERROR_BASE_NVM, (MCU_API_status_t) MCU_API_ERROR_DRIVER_NVM);
-        }
         break;
     case SIGFOX_EP_KEY_PUBLIC:
         // Use public key.
-        for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
-            local_key[idx] = SIGFOX_EP_PUBLIC_KEY[idx];
-        }
+        key_ptr = (uint8_t*) SIGFOX_EP_PUBLIC_KEY;
         break;
     default:
         SIGFOX_EXIT_ERROR((MCU_API_status_t) MCU_API_ERROR_EP_KEY);
         break;
     }
+    if (key_ptr == SIGFOX_NULL) {
+#endif
+#ifdef MCU_API_AES_SESSION
+        // Retrieve private key from NVM only once per session.
+        if (mcu_api_ctx.ep_key_cached == 0) {
+            status = _MCU_API_read_ep_key(mcu_api_ctx.ep_key);
+            SIGFOX_CHECK_STATUS(MCU_API_SUCCESS);
+            mcu_api_ctx.ep_key_cached = 1;
+        }
+        key_ptr = (uint8_t*) mcu_api_ctx.ep_key;
 #else
-    // Retrieve private key from NVM.
-    for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
-        nvm_status = NVM_read_byte((NVM_ADDRESS_SIGFOX_EP_KEY + idx), &(local_key[idx]));
-        NVM_stack_exit_error(ERROR_BASE_NVM, (MCU_API_status_t) MCU_API_ERROR_DRIVER_NVM);
+        // Retrieve private key from NVM.
+        status = _MCU_API_read_ep_key(local_key);
+        SIGFOX_CHECK_STATUS(MCU_API_SUCCESS);
+        key_ptr = local_key;
+#endif
+#ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
     }
 #endif
+#ifndef MCU_API_AES_SESSION
     // Init peripheral.
     AES_init();
+#endif
     // Perform AES.
-    aes_status = AES_encrypt((aes_data->data), (aes_data->data), local_key);
+    aes_status = AES_encrypt((aes_data->data), (aes_data->data), key_ptr);
     AES_stack_exit_error(ERROR_BASE_AES, (MCU_API_status_t) MCU_API_ERROR_DRIVER_AES);
 errors:
+#ifndef MCU_API_AES_SESSION
     // Release peripheral.
     AES_de_init();
+#endif
     SIGFOX_RETURN();
 }
 #endif
@@ -242,10 +390,25 @@ errors:
 MCU_API_status_t MCU_API_compute_crc16(sfx_u8 *data, sfx_u8 data_size, sfx_u16 polynom, sfx_u16 *crc) {
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
-    SIGFOX_UNUSED(data);
-    SIGFOX_UNUSED(data_size);
-    SIGFOX_UNUSED(polynom);
-    SIGFOX_UNUSED(crc);
+    CRC_status_t crc_status = CRC_SUCCESS;
+    uint32_t crc_u32 = 0;
+    // Check parameter.
+    if (crc == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((MCU_API_status_t) MCU_API_ERROR_NULL_PARAMETER);
+    }
+#ifndef MCU_API_CRC_SESSION
+    // Init peripheral.
+    CRC_init();
+#endif
+    // Compute CRC with null initial value, as the library software implementation.
+    crc_status = CRC_compute(data, data_size, CRC_POLYNOMIAL_SIZE_16, polynom, 0, &crc_u32);
+    CRC_stack_exit_error(ERROR_BASE_CRC, (MCU_API_status_t) MCU_API_ERROR_DRIVER_CRC);
+    (*crc) = (sfx_u16) crc_u32;
+errors:
+#ifndef MCU_API_CRC_SESSION
+    // Release peripheral.
+    CRC_de_init();
+#endif
     SIGFOX_RETURN();
 }
 #endif
@@ -255,10 +418,25 @@ MCU_API_status_t MCU_API_compute_crc16(sfx_u8 *data, sfx_u8 data_size, sfx_u16 p
 MCU_API_status_t MCU_API_compute_crc8(sfx_u8 *data, sfx_u8 data_size, sfx_u16 polynom, sfx_u8 *crc) {
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
-    SIGFOX_UNUSED(data);
-    SIGFOX_UNUSED(data_size);
-    SIGFOX_UNUSED(polynom);
-    SIGFOX_UNUSED(crc);
+    CRC_status_t crc_status = CRC_SUCCESS;
+    uint32_t crc_u32 = 0;
+    // Check parameter.
+    if (crc == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((MCU_API_status_t) MCU_API_ERROR_NULL_PARAMETER);
+    }
+#ifndef MCU_API_CRC_SESSION
+    // Init peripheral.
+    CRC_init();
+#endif
+    // Compute CRC with null initial value, as the library software implementation.
+    crc_status = CRC_compute(data, data_size, CRC_POLYNOMIAL_SIZE_8, polynom, 0, &crc_u32);
+    CRC_stack_exit_error(ERROR_BASE_CRC, (MCU_API_status_t) MCU_API_ERROR_DRIVER_CRC);
+    (*crc) = (sfx_u8) crc_u32;
+errors:
+#ifndef MCU_API_CRC_SESSION
+    // Release peripheral.
+    CRC_de_init();
+#endif
     SIGFOX_RETURN();
 }
 #endif
@@ -326,6 +504,8 @@ MCU_API_status_t MCU_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u
     MCU_API_status_t status = MCU_API_SUCCESS;
     ANALOG_status_t analog_status = ANALOG_SUCCESS;
     int32_t data = 0;
+    // Use measurements performed during the last transmission when available.
+    if (RF_API_get_voltage_temperature(voltage_idle_mv, voltage_tx_mv, temperature_tenth_degrees) == SIGFOX_TRUE) goto end;
     // Perform analog measurements.
     POWER_enable(POWER_REQUESTER_ID_MCU_API, POWER_DOMAIN_ANALOG, LPTIM_DELAY_MODE_SLEEP);
     // Get MCU supply voltage.
@@ -339,6 +519,7 @@ MCU_API_status_t MCU_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u
     (*temperature_tenth_degrees) = ((sfx_s16) data) * 10;
 errors:
     POWER_disable(POWER_REQUESTER_ID_MCU_API, POWER_DOMAIN_ANALOG);
+end:
     SIGFOX_RETURN();
 }
 #endif
@@ -390,3 +571,37 @@ void MCU_API_error(void) {
 #endif
 }
 #endif
+
+#if (defined SIGFOX_EP_ASYNCHRONOUS) && (defined SIGFOX_EP_TIMER_REQUIRED)
+/*******************************************************************/
+void MCU_API_check_timers(void) {
+    // Local variables.
+    TIM_status_t tim_status = TIM_SUCCESS;
+    uint8_t timer_has_elapsed = 0;
+    sfx_u8 idx = 0;
+    // Timers loop.
+    for (idx = 0; idx < MCU_API_TIMER_NUMBER; idx++) {
+        // Check running timers only.
+        if ((mcu_api_ctx.timer_running_mask & (1 << idx)) == 0) continue;
+        // Read status.
+        tim_status = TIM_MCH_get_channel_status(TIM_INSTANCE_MCU_API, (TIM_channel_t) idx, &timer_has_elapsed);
+        if (tim_status != TIM_SUCCESS) {
+            TIM_stack_error(ERROR_BASE_TIM_MCU_API);
+            // Report error to the library.
+            if (mcu_api_ctx.error_cb != SIGFOX_NULL) {
+                mcu_api_ctx.error_cb();
+            }
+            continue;
+        }
+        if (timer_has_elapsed != 0) {
+            // Update flags.
+            mcu_api_ctx.timer_running_mask &= (sfx_u8) ~(1 << idx);
+            mcu_api_ctx.timer_elapsed_mask |= (sfx_u8) (1 << idx);
+            // Ask the library to call the process function.
+            if (mcu_api_ctx.process_cb != SIGFOX_NULL) {
+                mcu_api_ctx.process_cb();
+            }
+        }
+    }
+}
+#endif
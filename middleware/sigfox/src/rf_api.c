@@ -42,6 +42,8 @@
 #include "sigfox_types.h"
 #include "sigfox_error.h"
 
+#include "analog.h"
+#include "dbpsk.h"
 #include "error.h"
 #include "error_base.h"
 #include "exti.h"
@@ -52,25 +54,28 @@
 #include "nvic_priority.h"
 #include "power.h"
 #include "pwr.h"
+#include "rf_api_voltage.h"
 #include "rfe.h"
 #include "s2lp.h"
+#include "systick.h"
 #include "types.h"
 
 /*** RF API local macros ***/
 
-#define RF_API_SYMBOL_PROFILE_SIZE_BYTES        40
-#define RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES    (RF_API_SYMBOL_PROFILE_SIZE_BYTES << 1)
+#define RF_API_SYMBOL_PROFILE_SIZE_BYTES        DBPSK_SYMBOL_PROFILE_SIZE_BYTES
+#define RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES    DBPSK_SYMBOL_SIZE_BYTES
 
 #define RF_API_POLAR_DATARATE_MULTIPLIER        8
 
-#define RF_API_FDEV_NEGATIVE                    0x7F
-#define RF_API_FDEV_POSITIVE                    0x81
-
-#define RF_API_FIFO_BUFFER_FDEV_IDX             (RF_API_SYMBOL_PROFILE_SIZE_BYTES >> 1)
-
+#define RF_API_S2LP_FIFO_SIZE_BYTES             128
+// Half symbol: the FIFO is refilled in the GPIO interrupt, so the margin (833us at 600bps) only has to cover the interrupt latency.
 #define RF_API_FIFO_TX_ALMOST_EMPTY_THRESHOLD   (RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES >> 1)
 
 #define RF_API_SMPS_FREQUENCY_HZ_TX             5500000
+
+#define RF_API_MEASUREMENT_FLAG_IDLE            0b01
+#define RF_API_MEASUREMENT_FLAG_TX              0b10
+#define RF_API_MEASUREMENT_FLAG_ALL             (RF_API_MEASUREMENT_FLAG_IDLE | RF_API_MEASUREMENT_FLAG_TX)
 #ifdef SIGFOX_EP_BIDIRECTIONAL
 #define RF_API_SMPS_FREQUENCY_HZ_RX             1500000
 #endif
@@ -81,8 +86,6 @@
 #define RF_API_DOWNLINK_RSSI_THRESHOLD_DBM      -139
 #endif
 
-static const sfx_u8 RF_API_RAMP_AMPLITUDE_PROFILE[RF_API_SYMBOL_PROFILE_SIZE_BYTES] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 5, 7, 10, 14, 19, 25, 31, 39, 60, 220 };
-static const sfx_u8 RF_API_BIT0_AMPLITUDE_PROFILE[RF_API_SYMBOL_PROFILE_SIZE_BYTES] = { 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 5, 7, 10, 14, 19, 25, 31, 39, 60, 220, 220, 60, 39, 31, 25, 19, 14, 10, 7, 5, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1 };
 #ifdef SIGFOX_EP_BIDIRECTIONAL
 static const sfx_u8 RF_API_DL_FT[SIGFOX_DL_FT_SIZE_BYTES] = SIGFOX_DL_FT;
 #endif
@@ -109,8 +112,6 @@ typedef enum {
     RF_API_STATE_READY = 0,
     RF_API_STATE_TX_RAMP_UP,
     RF_API_STATE_TX_BITSTREAM,
-    RF_API_STATE_TX_RAMP_DOWN,
-    RF_API_STATE_TX_PADDING_BIT,
     RF_API_STATE_TX_END,
 #ifdef SIGFOX_EP_BIDIRECTIONAL
     RF_API_STATE_RX_START,
@@ -133,14 +134,25 @@ typedef struct {
     // Common.
     RF_API_state_t state;
     volatile RF_API_flags_t flags;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    RF_API_process_cb_t process_cb;
+    RF_API_tx_cplt_cb_t tx_cplt_cb;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    RF_API_rx_data_received_cb_t rx_data_received_cb;
+#endif
+#endif
     // TX.
-    sfx_u8 symbol_fifo_buffer[RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES];
-    sfx_u8 ramp_fifo_buffer[RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES];
+    sfx_u8 tx_fifo_buffer[RF_API_S2LP_FIFO_SIZE_BYTES];
     sfx_u8 tx_bitstream[SIGFOX_UL_BITSTREAM_SIZE_BYTES];
     sfx_u8 tx_bitstream_size_bytes;
-    sfx_u8 tx_byte_idx;
-    sfx_u8 tx_bit_idx;
-    sfx_u8 tx_fdev;
+    volatile RF_API_status_t tx_status;
+    // Supply monitoring.
+    sfx_u8 measurement_flags;
+    sfx_u16 voltage_idle_mv;
+    sfx_u16 voltage_tx_mv;
+    sfx_s16 temperature_tenth_degrees;
+    sfx_u32 adc_conversion_time_us;
+    sfx_u32 tx_refill_period_us;
 #ifdef SIGFOX_EP_BIDIRECTIONAL
     // RX.
     sfx_u8 dl_phy_content[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
@@ -170,10 +182,140 @@ static RF_API_context_t rf_api_ctx;
 
 /*** RF API local functions ***/
 
+/*******************************************************************/
+static void _RF_API_measure_idle(void) {
+    // Local variables.
+    ANALOG_status_t analog_status = ANALOG_SUCCESS;
+    SYSTICK_status_t systick_status = SYSTICK_SUCCESS;
+    int32_t data = 0;
+    uint32_t systick_start = 0;
+    // Measure the conversion time.
+    systick_status = SYSTICK_start();
+    SYSTICK_stack_error(ERROR_BASE_SYSTICK);
+    systick_start = SYSTICK_get_timestamp();
+    // Get MCU supply voltage before power amplifier activation.
+    analog_status = ANALOG_convert_channel(ANALOG_CHANNEL_VMCU_MV, &data);
+    rf_api_ctx.adc_conversion_time_us = SYSTICK_get_elapsed_us(systick_start);
+    SYSTICK_stop();
+    if (analog_status != ANALOG_SUCCESS) {
+        ANALOG_stack_error(ERROR_BASE_ANALOG);
+        goto errors;
+    }
+    rf_api_ctx.voltage_idle_mv = (sfx_u16) data;
+    // Get MCU internal temperature.
+    analog_status = ANALOG_convert_channel(ANALOG_CHANNEL_TMCU_DEGREES, &data);
+    if (analog_status != ANALOG_SUCCESS) {
+        ANALOG_stack_error(ERROR_BASE_ANALOG);
+        goto errors;
+    }
+    rf_api_ctx.temperature_tenth_degrees = ((sfx_s16) data) * 10;
+    // Update flags.
+    rf_api_ctx.measurement_flags |= RF_API_MEASUREMENT_FLAG_IDLE;
+errors:
+    return;
+}
+
+/*******************************************************************/
+static void _RF_API_measure_tx(void) {
+    // Local variables.
+    ANALOG_status_t analog_status = ANALOG_SUCCESS;
+    int32_t data = 0;
+    // Get MCU supply voltage under radio load.
+    analog_status = ANALOG_convert_channel(ANALOG_CHANNEL_VMCU_MV, &data);
+    if (analog_status != ANALOG_SUCCESS) {
+        ANALOG_stack_error(ERROR_BASE_ANALOG);
+        goto errors;
+    }
+    rf_api_ctx.voltage_tx_mv = (sfx_u16) data;
+    // Update flags.
+    rf_api_ctx.measurement_flags |= RF_API_MEASUREMENT_FLAG_TX;
+errors:
+    return;
+}
+
+/*******************************************************************/
+static RF_API_status_t _RF_API_fill_tx_fifo(sfx_u8 size_bytes) {
+    // Local variables.
+    RF_API_status_t status = RF_API_SUCCESS;
+    S2LP_status_t s2lp_status = S2LP_SUCCESS;
+    sfx_u8 fifo_idx = 0;
+    // Copy precomputed symbols, a FIFO write can cover several symbols.
+    fifo_idx = DBPSK_fill_buffer((sfx_u8*) rf_api_ctx.tx_fifo_buffer, size_bytes);
+    // Load samples into FIFO.
+    if (fifo_idx != 0) {
+        s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.tx_fifo_buffer, fifo_idx);
+        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static RF_API_status_t _RF_API_tx_irq_process(void) {
+    // Local variables.
+    RF_API_status_t status = RF_API_SUCCESS;
+    S2LP_status_t s2lp_status = S2LP_SUCCESS;
+    // Perform TX state machine.
+    switch (rf_api_ctx.state) {
+    case RF_API_STATE_TX_BITSTREAM:
+        // Note: the FIFO almost empty interrupt is the only one enabled in TX mode, so the GPIO interrupt directly identifies the event.
+        status = _RF_API_fill_tx_fifo(RF_API_S2LP_FIFO_SIZE_BYTES - RF_API_FIFO_TX_ALMOST_EMPTY_THRESHOLD);
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+        // Check end of stream.
+        if (DBPSK_is_complete() != 0) {
+            rf_api_ctx.state = RF_API_STATE_TX_END;
+        }
+        // Clear flag.
+        // Note: the S2LP keeps nIRQ asserted until the IRQ status registers are read, so the next threshold crossing would not generate any falling edge otherwise.
+        s2lp_status = S2LP_clear_all_irq();
+        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
+        break;
+    case RF_API_STATE_TX_END:
+        // Last threshold crossing occurs within the padding symbol, so the ramp-down has been completely transmitted.
+        s2lp_status = S2LP_send_command(S2LP_COMMAND_SABORT);
+        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
+        // Disable interrupt.
+        rf_api_ctx.flags.field.gpio_irq_enable = 0;
+        s2lp_status = S2LP_clear_all_irq();
+        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
+        // Update state.
+        rf_api_ctx.state = RF_API_STATE_READY;
+        break;
+    default:
+        SIGFOX_EXIT_ERROR((RF_API_status_t) RF_API_ERROR_STATE);
+        break;
+    }
+errors:
+    // Stop refilling on failure.
+    if (status != RF_API_SUCCESS) {
+        rf_api_ctx.flags.field.gpio_irq_enable = 0;
+    }
+    SIGFOX_RETURN();
+}
+
 /*******************************************************************/
 static void _RF_API_s2lp_gpio_irq_callback(void) {
-    // Set flag if IRQ is enabled.
-    rf_api_ctx.flags.field.gpio_irq_flag = rf_api_ctx.flags.field.gpio_irq_enable;
+    // Local variables.
+    sfx_u8 tx_byte_idx = DBPSK_get_byte_index();
+    sfx_u8 tx_middle_byte_idx = (rf_api_ctx.tx_bitstream_size_bytes >> 1);
+    // Check if IRQ is enabled.
+    if (rf_api_ctx.flags.field.gpio_irq_enable == 0) goto errors;
+    // Refill the TX FIFO directly in interrupt context, independently of the main loop latency.
+    if ((rf_api_ctx.state == RF_API_STATE_TX_BITSTREAM) || (rf_api_ctx.state == RF_API_STATE_TX_END)) {
+        rf_api_ctx.tx_status = _RF_API_tx_irq_process();
+        // Wake-up the main loop only at the end of transmission, on error, or once at the middle of the frame to sample the supply voltage.
+        if ((rf_api_ctx.tx_status == RF_API_SUCCESS) && (rf_api_ctx.state != RF_API_STATE_READY) && ((tx_byte_idx >= tx_middle_byte_idx) || (DBPSK_get_byte_index() < tx_middle_byte_idx))) goto errors;
+    }
+    // Set flag.
+    rf_api_ctx.flags.field.gpio_irq_flag = 1;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Ask the library to call the process function.
+    if (rf_api_ctx.process_cb != SIGFOX_NULL) {
+        rf_api_ctx.process_cb();
+    }
+#endif
+errors:
+    return;
 }
 
 /*******************************************************************/
@@ -208,29 +350,22 @@ static RF_API_status_t _RF_API_internal_process(void) {
     S2LP_status_t s2lp_status = S2LP_SUCCESS;
 #ifdef SIGFOX_EP_BIDIRECTIONAL
     RFE_status_t rfe_status = RFE_SUCCESS;
-#endif
     sfx_u8 s2lp_irq_flag = 0;
-    sfx_u8 idx = 0;
+#endif
     // Perform state machine.
     switch (rf_api_ctx.state) {
     case RF_API_STATE_READY:
         // Nothing to do.
         break;
     case RF_API_STATE_TX_RAMP_UP:
-        // Fill ramp-up.
-        for (idx = 0; idx < RF_API_SYMBOL_PROFILE_SIZE_BYTES; idx++) {
-            rf_api_ctx.ramp_fifo_buffer[(2 * idx)] = 0; // Deviation.
-            rf_api_ctx.ramp_fifo_buffer[(2 * idx) + 1] = RF_API_RAMP_AMPLITUDE_PROFILE[RF_API_SYMBOL_PROFILE_SIZE_BYTES - idx - 1]; // PA output power.
-        }
-        // Load ramp-up buffer into FIFO.
+        // Fill the whole FIFO before starting transmission.
         s2lp_status = S2LP_send_command(S2LP_COMMAND_FLUSHTXFIFO);
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.ramp_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
-        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        // Enable external GPIO interrupt.
+        status = _RF_API_fill_tx_fifo(RF_API_S2LP_FIFO_SIZE_BYTES);
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+        // Clear flags.
         s2lp_status = S2LP_clear_all_irq();
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        rf_api_ctx.flags.field.gpio_irq_enable = 1;
         // Lock PLL.
         s2lp_status = S2LP_send_command(S2LP_COMMAND_LOCKTX);
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
@@ -242,108 +377,20 @@ static RF_API_status_t _RF_API_internal_process(void) {
         s2lp_status = S2LP_wait_for_state(S2LP_STATE_TX);
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
         // Update state.
-        rf_api_ctx.state = RF_API_STATE_TX_BITSTREAM;
+        rf_api_ctx.state = (DBPSK_is_complete() != 0) ? RF_API_STATE_TX_END : RF_API_STATE_TX_BITSTREAM;
+        // Enable external GPIO interrupt once the SPI is no longer used by the main loop.
+        // Note: the first threshold crossing occurs after the transmission of the whole refill size, so it cannot be missed.
+        rf_api_ctx.flags.field.gpio_irq_enable = 1;
         break;
     case RF_API_STATE_TX_BITSTREAM:
-        // Read FIFO flag.
-        s2lp_status = S2LP_get_irq_flag(S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY, &s2lp_irq_flag);
-        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        // Check flag.
-        if (s2lp_irq_flag != 0) {
-            // Check bit.
-            if ((rf_api_ctx.tx_bitstream[rf_api_ctx.tx_byte_idx] & (1 << (7 - rf_api_ctx.tx_bit_idx))) == 0) {
-                // Phase shift and amplitude shaping required.
-                rf_api_ctx.tx_fdev = (rf_api_ctx.tx_fdev == RF_API_FDEV_NEGATIVE) ? RF_API_FDEV_POSITIVE : RF_API_FDEV_NEGATIVE; // Toggle deviation.
-                for (idx = 0; idx < RF_API_SYMBOL_PROFILE_SIZE_BYTES; idx++) {
-                    rf_api_ctx.symbol_fifo_buffer[(2 * idx)] = (idx == RF_API_FIFO_BUFFER_FDEV_IDX) ? rf_api_ctx.tx_fdev : 0; // Deviation.
-                    rf_api_ctx.symbol_fifo_buffer[(2 * idx) + 1] = RF_API_BIT0_AMPLITUDE_PROFILE[idx]; // PA output power.
-                }
-            }
-            else {
-                // Constant CW.
-                for (idx = 0; idx < RF_API_SYMBOL_PROFILE_SIZE_BYTES; idx++) {
-                    rf_api_ctx.symbol_fifo_buffer[(2 * idx)] = 0; // Deviation.
-                    rf_api_ctx.symbol_fifo_buffer[(2 * idx) + 1] = RF_API_BIT0_AMPLITUDE_PROFILE[0]; // PA output power.
-                }
-            }
-            // Load bit into FIFO.
-            s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.symbol_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-            // Increment bit index.
-            rf_api_ctx.tx_bit_idx++;
-            if (rf_api_ctx.tx_bit_idx >= 8) {
-                // Reset bit index.
-                rf_api_ctx.tx_bit_idx = 0;
-                // Increment byte index.
-                rf_api_ctx.tx_byte_idx++;
-                // Check end of bitstream.
-                if (rf_api_ctx.tx_byte_idx >= (rf_api_ctx.tx_bitstream_size_bytes)) {
-                    rf_api_ctx.tx_byte_idx = 0;
-                    // Update state.
-                    rf_api_ctx.state = RF_API_STATE_TX_RAMP_DOWN;
-                }
-            }
-            // Clear flag.
-            s2lp_status = S2LP_clear_all_irq();
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        }
-        break;
-    case RF_API_STATE_TX_RAMP_DOWN:
-        // Read FIFO flag.
-        s2lp_status = S2LP_get_irq_flag(S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY, &s2lp_irq_flag);
-        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        // Check flag.
-        if (s2lp_irq_flag != 0) {
-            // Fill ramp-down.
-            for (idx = 0; idx < RF_API_SYMBOL_PROFILE_SIZE_BYTES; idx++) {
-                rf_api_ctx.ramp_fifo_buffer[(2 * idx)] = 0; // FDEV.
-                rf_api_ctx.ramp_fifo_buffer[(2 * idx) + 1] = RF_API_RAMP_AMPLITUDE_PROFILE[idx]; // PA output power for ramp-down.
-            }
-            // Load ramp-down buffer into FIFO.
-            s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.ramp_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-            // Update state.
-            rf_api_ctx.state = RF_API_STATE_TX_PADDING_BIT;
-            // Clear flag.
-            s2lp_status = S2LP_clear_all_irq();
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        }
-        break;
-    case RF_API_STATE_TX_PADDING_BIT:
-        // Read FIFO flag.
-        s2lp_status = S2LP_get_irq_flag(S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY, &s2lp_irq_flag);
-        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        // Check flag.
-        if (s2lp_irq_flag != 0) {
-            // Padding bit to ensure last ramp down is completely transmitted.
-            for (idx = 0; idx < RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES; idx++) {
-                rf_api_ctx.symbol_fifo_buffer[idx] = 0x00;
-            }
-            // Load padding buffer into FIFO.
-            s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.symbol_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-            // Update state.
-            rf_api_ctx.state = RF_API_STATE_TX_END;
-            // Clear flag.
-            s2lp_status = S2LP_clear_all_irq();
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        }
-        break;
     case RF_API_STATE_TX_END:
-        // Read FIFO flag.
-        s2lp_status = S2LP_get_irq_flag(S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY, &s2lp_irq_flag);
-        S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        // Check flag.
-        if (s2lp_irq_flag != 0) {
-            // Stop radio.
-            s2lp_status = S2LP_send_command(S2LP_COMMAND_SABORT);
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-            // Disable interrupt.
-            rf_api_ctx.flags.field.gpio_irq_enable = 0;
-            s2lp_status = S2LP_clear_all_irq();
-            S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-            // Update state.
-            rf_api_ctx.state = RF_API_STATE_READY;
+        // Check FIFO refill status.
+        status = rf_api_ctx.tx_status;
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+        // Sample supply voltage at the middle of the frame, the FIFO refill interrupt preempts the conversion.
+        // Note: the blocking conversion is skipped if its measured duration exceeds the refill period, the sample would not reflect the middle of the frame.
+        if (((rf_api_ctx.measurement_flags & RF_API_MEASUREMENT_FLAG_TX) == 0) && (DBPSK_get_byte_index() >= (rf_api_ctx.tx_bitstream_size_bytes >> 1)) && (rf_api_ctx.adc_conversion_time_us < rf_api_ctx.tx_refill_period_us)) {
+            _RF_API_measure_tx();
         }
         break;
 #ifdef SIGFOX_EP_BIDIRECTIONAL
@@ -407,8 +454,26 @@ errors:
 RF_API_status_t RF_API_open(RF_API_config_t* rf_api_config) {
     // Local variables.
     RF_API_status_t status = RF_API_SUCCESS;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Check parameter.
+    if (rf_api_config == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) RF_API_ERROR_NULL_PARAMETER);
+    }
+    // Store callbacks.
+    rf_api_ctx.process_cb = (rf_api_config->process_cb);
+    rf_api_ctx.tx_cplt_cb = SIGFOX_NULL;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    rf_api_ctx.rx_data_received_cb = SIGFOX_NULL;
+#endif
+#else
     // Ignore unused parameters.
     UNUSED(rf_api_config);
+#endif
+    // Discard measurements which have not been read during the previous session.
+    rf_api_ctx.measurement_flags = 0;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+errors:
+#endif
     // Return.
     SIGFOX_RETURN();
 }
@@ -428,6 +493,42 @@ RF_API_status_t RF_API_close(void) {
 RF_API_status_t RF_API_process(void) {
     // Local variables.
     RF_API_status_t status = RF_API_SUCCESS;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    sfx_bool rx_flag = SIGFOX_FALSE;
+#endif
+    // Check GPIO flag.
+    if (rf_api_ctx.flags.field.gpio_irq_flag == 0) goto errors;
+    // Clear flag.
+    rf_api_ctx.flags.field.gpio_irq_flag = 0;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    rx_flag = ((rf_api_ctx.state == RF_API_STATE_RX_START) || (rf_api_ctx.state == RF_API_STATE_RX)) ? SIGFOX_TRUE : SIGFOX_FALSE;
+#endif
+    // Call internal process.
+    status = _RF_API_internal_process();
+    if (status != RF_API_SUCCESS) {
+        _RF_API_disable_s2lp_nirq();
+        goto errors;
+    }
+    // Check end of transmission or reception.
+    if (rf_api_ctx.state == RF_API_STATE_READY) {
+        // Disable GPIO interrupt.
+        _RF_API_disable_s2lp_nirq();
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+        if (rx_flag == SIGFOX_TRUE) {
+            if (rf_api_ctx.rx_data_received_cb != SIGFOX_NULL) {
+                rf_api_ctx.rx_data_received_cb();
+            }
+        }
+        else {
+#endif
+            if (rf_api_ctx.tx_cplt_cb != SIGFOX_NULL) {
+                rf_api_ctx.tx_cplt_cb();
+            }
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+        }
+#endif
+    }
+errors:
     SIGFOX_RETURN();
 }
 #endif
@@ -534,11 +635,25 @@ RF_API_status_t RF_API_init(RF_API_radio_parameters_t* radio_parameters) {
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
         s2lp_status = S2LP_set_fifo_threshold(S2LP_FIFO_THRESHOLD_TX_EMPTY, RF_API_FIFO_TX_ALMOST_EMPTY_THRESHOLD);
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
+        // Supply voltage is only monitored until both samples of the message have been acquired.
+        if ((rf_api_ctx.measurement_flags & RF_API_MEASUREMENT_FLAG_ALL) != RF_API_MEASUREMENT_FLAG_ALL) {
+            // Keep analog domain on during transmission.
+            POWER_enable(POWER_REQUESTER_ID_RF_API, POWER_DOMAIN_ANALOG, LPTIM_DELAY_MODE_SLEEP);
+            // Idle sample is performed before the first frame only.
+            if ((rf_api_ctx.measurement_flags & RF_API_MEASUREMENT_FLAG_IDLE) == 0) {
+                _RF_API_measure_idle();
+            }
+        }
+        // Time between two FIFO refill requests (continuous wave does not use the FIFO).
+        rf_api_ctx.tx_refill_period_us = 0;
+        if ((radio_parameters->bit_rate_bps) != 0) {
+            rf_api_ctx.tx_refill_period_us = ((1000000 * (RF_API_S2LP_FIFO_SIZE_BYTES - RF_API_FIFO_TX_ALMOST_EMPTY_THRESHOLD)) / (RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES * ((sfx_u32) (radio_parameters->bit_rate_bps))));
+        }
 #if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
         // Start latency = ramp-up.
         RF_API_LATENCY_MS[RF_API_LATENCY_SEND_START] = ((1000) / ((sfx_u32) (radio_parameters->bit_rate_bps)));
-        // Stop latency = ramp-down + half of padding bit (since IRQ is raised at the middle of the symbol).
-        RF_API_LATENCY_MS[RF_API_LATENCY_SEND_STOP] = ((1500) / ((sfx_u32) (radio_parameters->bit_rate_bps)));
+        // Stop latency = ramp-down + padding bit until the FIFO threshold (since IRQ is raised when the threshold is reached).
+        RF_API_LATENCY_MS[RF_API_LATENCY_SEND_STOP] = (((1000) * ((2 * RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES) - RF_API_FIFO_TX_ALMOST_EMPTY_THRESHOLD)) / (RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES * ((sfx_u32) (radio_parameters->bit_rate_bps))));
 #endif
         // Switch to TX.
         rfe_status = RFE_set_path(RFE_PATH_TX);
@@ -585,6 +700,14 @@ RF_API_status_t RF_API_de_init(void) {
     RF_API_status_t status = RF_API_SUCCESS;
     S2LP_status_t s2lp_status = S2LP_SUCCESS;
     RFE_status_t rfe_status = RFE_SUCCESS;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Stop pending reception (downlink timeout).
+    if (rf_api_ctx.state != RF_API_STATE_READY) {
+        rf_api_ctx.flags.all = 0;
+        _RF_API_disable_s2lp_nirq();
+        rf_api_ctx.state = RF_API_STATE_READY;
+    }
+#endif
     // Turn transceiver off.
     s2lp_status = S2LP_shutdown(1);
     // Check status.
@@ -599,6 +722,7 @@ RF_API_status_t RF_API_de_init(void) {
         RFE_stack_error(ERROR_BASE_RFE);
         status = (RF_API_status_t) RF_API_ERROR_DRIVER_RFE;
     }
+    POWER_disable(POWER_REQUESTER_ID_RF_API, POWER_DOMAIN_ANALOG);
     POWER_disable(POWER_REQUESTER_ID_RF_API, POWER_DOMAIN_RADIO);
     SIGFOX_RETURN();
 }
@@ -617,13 +741,20 @@ RF_API_status_t RF_API_send(RF_API_tx_data_t* tx_data) {
     status = _RF_API_enable_s2lp_nirq(S2LP_FIFO_FLAG_DIRECTION_TX);
     SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
     // Init state.
-    rf_api_ctx.tx_bit_idx = 0;
-    rf_api_ctx.tx_byte_idx = 0;
+    DBPSK_start((sfx_u8*) rf_api_ctx.tx_bitstream, rf_api_ctx.tx_bitstream_size_bytes);
     rf_api_ctx.state = RF_API_STATE_TX_RAMP_UP;
     rf_api_ctx.flags.all = 0;
+    rf_api_ctx.tx_status = RF_API_SUCCESS;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    rf_api_ctx.tx_cplt_cb = (tx_data->cplt_cb);
+#endif
     // Trigger TX.
     status = _RF_API_internal_process();
     SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // End of transmission is managed by the process function.
+    SIGFOX_RETURN();
+#else
     // Wait for transmission to complete.
     while (rf_api_ctx.state != RF_API_STATE_READY) {
         // Wait for GPIO interrupt.
@@ -637,6 +768,7 @@ RF_API_status_t RF_API_send(RF_API_tx_data_t* tx_data) {
         status = _RF_API_internal_process();
         SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
     }
+#endif
 errors:
     // Disable GPIO interrupt.
     _RF_API_disable_s2lp_nirq();
@@ -648,20 +780,30 @@ errors:
 RF_API_status_t RF_API_receive(RF_API_rx_data_t* rx_data) {
     // Local variables.
     RF_API_status_t status = RF_API_SUCCESS;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
     MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
     S2LP_status_t s2lp_status = S2LP_SUCCESS;
     sfx_bool dl_timeout = SIGFOX_FALSE;
+#endif
     // Enable GPIO interrupt.
     status = _RF_API_enable_s2lp_nirq(S2LP_FIFO_FLAG_DIRECTION_RX);
     SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    rf_api_ctx.rx_data_received_cb = (rx_data->data_received_cb);
+#else
     // Reset flag.
     (rx_data->data_received) = SIGFOX_FALSE;
+#endif
     // Init state.
     rf_api_ctx.state = RF_API_STATE_RX_START;
     rf_api_ctx.flags.all = 0;
     // Trigger RX.
     status = _RF_API_internal_process();
     SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Reception and downlink timeout are managed by the process function and the library.
+    SIGFOX_RETURN();
+#else
     // Wait for reception to complete.
     while (rf_api_ctx.state != RF_API_STATE_READY) {
         // Wait for GPIO interrupt.
@@ -689,6 +831,7 @@ RF_API_status_t RF_API_receive(RF_API_rx_data_t* rx_data) {
     }
     // Update status flag.
     (rx_data->data_received) = SIGFOX_TRUE;
+#endif
 errors:
     // Disable GPIO interrupt.
     _RF_API_disable_s2lp_nirq();
@@ -783,6 +926,28 @@ void RF_API_error(void) {
     // Force all front-end off.
     S2LP_shutdown(1);
     RFE_set_path(RFE_PATH_NONE);
+    POWER_disable(POWER_REQUESTER_ID_RF_API, POWER_DOMAIN_ANALOG);
     POWER_disable(POWER_REQUESTER_ID_RF_API, POWER_DOMAIN_RADIO);
+    // Discard measurements of the aborted message.
+    rf_api_ctx.measurement_flags = 0;
 }
 #endif
+
+/*******************************************************************/
+sfx_bool RF_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u16* voltage_tx_mv, sfx_s16* temperature_tenth_degrees) {
+    // Local variables.
+    sfx_bool measurements_available = SIGFOX_FALSE;
+    // Check parameters.
+    if ((voltage_idle_mv == SIGFOX_NULL) || (voltage_tx_mv == SIGFOX_NULL) || (temperature_tenth_degrees == SIGFOX_NULL)) goto errors;
+    // Check flags.
+    if ((rf_api_ctx.measurement_flags & RF_API_MEASUREMENT_FLAG_ALL) != RF_API_MEASUREMENT_FLAG_ALL) goto errors;
+    // Read measurements.
+    (*voltage_idle_mv) = rf_api_ctx.voltage_idle_mv;
+    (*voltage_tx_mv) = rf_api_ctx.voltage_tx_mv;
+    (*temperature_tenth_degrees) = rf_api_ctx.temperature_tenth_degrees;
+    measurements_available = SIGFOX_TRUE;
+    // Measurements are consumed.
+    rf_api_ctx.measurement_flags = 0;
+errors:
+    return measurements_available;
+}
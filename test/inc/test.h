@@ -0,0 +1,86 @@
+/*
+ * test.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TEST_H__
+#define __TEST_H__
+
+#include "types.h"
+
+/*** TEST functions ***/
+
+/*!******************************************************************
+ * \fn void TEST_start(const char_t* suite_name)
+ * \brief Start a test suite.
+ * \param[in]   suite_name: Name of the suite printed in the report.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TEST_start(const char_t* suite_name);
+
+/*!******************************************************************
+ * \fn void TEST_check(uint8_t condition, const char_t* check_name)
+ * \brief Check a boolean condition.
+ * \param[in]   condition: Condition to check.
+ * \param[in]   check_name: Name of the check printed in the report.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TEST_check(uint8_t condition, const char_t* check_name);
+
+/*!******************************************************************
+ * \fn void TEST_check_value(float64_t value, float64_t expected, float64_t tolerance, const char_t* check_name)
+ * \brief Check a value against an expected value with an absolute tolerance.
+ * \param[in]   value: Value to check.
+ * \param[in]   expected: Expected value.
+ * \param[in]   tolerance: Maximum absolute error.
+ * \param[in]   check_name: Name of the check printed in the report.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TEST_check_value(float64_t value, float64_t expected, float64_t tolerance, const char_t* check_name);
+
+/*!******************************************************************
+ * \fn void TEST_check_relative(float64_t value, float64_t expected, float64_t tolerance_percent, const char_t* check_name)
+ * \brief Check a value against an expected value with a relative tolerance.
+ * \param[in]   value: Value to check.
+ * \param[in]   expected: Expected value.
+ * \param[in]   tolerance_percent: Maximum relative error in percent.
+ * \param[in]   check_name: Name of the check printed in the report.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TEST_check_relative(float64_t value, float64_t expected, float64_t tolerance_percent, const char_t* check_name);
+
+/*!******************************************************************
+ * \fn uint64_t TEST_get_time_ns(void)
+ * \brief Read the host monotonic clock.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current time in nanoseconds.
+ *******************************************************************/
+uint64_t TEST_get_time_ns(void);
+
+/*!******************************************************************
+ * \fn void TEST_bench(const char_t* bench_name, const char_t* format, ...)
+ * \brief Print a benchmark result line.
+ * \param[in]   bench_name: Name of the benchmark.
+ * \param[in]   format: printf-like format of the result.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TEST_bench(const char_t* bench_name, const char_t* format, ...);
+
+/*!******************************************************************
+ * \fn int TEST_end(void)
+ * \brief End the current test suite and print the summary.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Process exit code (0 if all checks passed).
+ *******************************************************************/
+int TEST_end(void);
+
+#endif /* __TEST_H__ */
@@ -0,0 +1,139 @@
+/*
+ * adc.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ADC_H__
+#define __ADC_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** ADC macros ***/
+
+#define ADC_FULL_SCALE      4095
+#define ADC_INIT_DELAY_MS   1
+
+/*** ADC structures ***/
+
+/*!******************************************************************
+ * \enum ADC_status_t
+ * \brief ADC driver error codes.
+ *******************************************************************/
+typedef enum {
+    ADC_SUCCESS = 0,
+    ADC_ERROR_NULL_PARAMETER,
+    ADC_ERROR_INSTANCE,
+    ADC_ERROR_BASE_LAST = ERROR_BASE_STEP
+} ADC_status_t;
+
+/*!******************************************************************
+ * \enum ADC_instance_t
+ * \brief ADC instances list.
+ *******************************************************************/
+typedef enum {
+    ADC_INSTANCE_ADC1 = 0,
+    ADC_INSTANCE_LAST
+} ADC_instance_t;
+
+/*!******************************************************************
+ * \enum ADC_channel_t
+ * \brief ADC channels list.
+ *******************************************************************/
+typedef enum {
+    ADC_CHANNEL_IN1 = 1,
+    ADC_CHANNEL_IN2,
+    ADC_CHANNEL_IN3,
+    ADC_CHANNEL_IN4,
+    ADC_CHANNEL_IN5,
+    ADC_CHANNEL_LAST
+} ADC_channel_t;
+
+/*!******************************************************************
+ * \enum ADC_clock_t
+ * \brief ADC clock sources.
+ *******************************************************************/
+typedef enum {
+    ADC_CLOCK_SYSCLK = 0,
+    ADC_CLOCK_PLL,
+    ADC_CLOCK_LAST
+} ADC_clock_t;
+
+/*!******************************************************************
+ * \enum ADC_clock_prescaler_t
+ * \brief ADC clock prescalers.
+ *******************************************************************/
+typedef enum {
+    ADC_CLOCK_PRESCALER_NONE = 0,
+    ADC_CLOCK_PRESCALER_LAST
+} ADC_clock_prescaler_t;
+
+/*!******************************************************************
+ * \enum ADC_trigger_t
+ * \brief ADC trigger sources.
+ *******************************************************************/
+typedef enum {
+    ADC_TRIGGER_SOFTWARE = 0,
+    ADC_TRIGGER_TIM6_TRGO,
+    ADC_TRIGGER_LAST
+} ADC_trigger_t;
+
+/*!******************************************************************
+ * \enum ADC_trigger_detection_t
+ * \brief ADC trigger edges.
+ *******************************************************************/
+typedef enum {
+    ADC_TRIGGER_DETECTION_RISING_EDGE = 0,
+    ADC_TRIGGER_DETECTION_LAST
+} ADC_trigger_detection_t;
+
+/*!******************************************************************
+ * \struct ADC_gpio_t
+ * \brief ADC GPIO pins list.
+ *******************************************************************/
+typedef struct {
+    uint8_t list_size;
+} ADC_gpio_t;
+
+/*!******************************************************************
+ * \struct ADC_channel_configuration_t
+ * \brief ADC sequence element.
+ *******************************************************************/
+typedef struct {
+    ADC_channel_t channel;
+    int32_t offset;
+} ADC_channel_configuration_t;
+
+/*!******************************************************************
+ * \struct ADC_SQC_configuration_t
+ * \brief ADC sequence configuration.
+ *******************************************************************/
+typedef struct {
+    ADC_clock_t clock;
+    ADC_clock_prescaler_t clock_prescaler;
+    ADC_channel_configuration_t* master_sequence;
+    ADC_channel_configuration_t* slave_sequence;
+    uint8_t sequence_length;
+    uint32_t sampling_frequency_hz;
+    ADC_trigger_t trigger;
+    ADC_trigger_detection_t trigger_detection;
+} ADC_SQC_configuration_t;
+
+/*** ADC functions ***/
+
+ADC_status_t ADC_SQC_init(ADC_instance_t instance, const ADC_gpio_t* pins, ADC_SQC_configuration_t* configuration);
+ADC_status_t ADC_SQC_de_init(ADC_instance_t instance);
+ADC_status_t ADC_SQC_start(ADC_instance_t instance);
+ADC_status_t ADC_SQC_stop(ADC_instance_t instance);
+uint32_t ADC_get_master_dr_register_address(ADC_instance_t instance);
+uint32_t ADC_get_slave_dr_register_address(ADC_instance_t instance);
+
+/*******************************************************************/
+#define ADC_exit_error(base) { ERROR_check_exit(adc_status, ADC_SUCCESS, base) }
+
+/*******************************************************************/
+#define ADC_stack_error(base) { ERROR_check_stack(adc_status, ADC_SUCCESS, base) }
+
+#endif /* __ADC_H__ */
@@ -0,0 +1,79 @@
+/*
+ * aes.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __AES_H__
+#define __AES_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** AES macros ***/
+
+#define AES_BLOCK_SIZE_BYTES    16
+
+/*** AES structures ***/
+
+/*!******************************************************************
+ * \enum AES_status_t
+ * \brief AES driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    AES_SUCCESS = 0,
+    AES_ERROR_NULL_PARAMETER,
+    AES_ERROR_TIMEOUT,
+    // Last base value.
+    AES_ERROR_BASE_LAST = ERROR_BASE_STEP
+} AES_status_t;
+
+/*** AES functions ***/
+
+void AES_init(void);
+void AES_de_init(void);
+AES_status_t AES_encrypt(uint8_t* data_in, uint8_t* data_out, uint8_t* key);
+
+/*** AES mock functions ***/
+
+// Note: the peripheral is emulated with a software AES-128 block cipher (FIPS-197).
+
+/*!******************************************************************
+ * \fn void AES_MOCK_reset_counters(void)
+ * \brief Reset the peripheral operations counters.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void AES_MOCK_reset_counters(void);
+
+/*!******************************************************************
+ * \fn uint32_t AES_MOCK_get_init_count(void)
+ * \brief Get the number of peripheral initializations since the last reset.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of AES_init() calls.
+ *******************************************************************/
+uint32_t AES_MOCK_get_init_count(void);
+
+/*!******************************************************************
+ * \fn uint8_t AES_MOCK_is_enabled(void)
+ * \brief Check if the peripheral is currently initialized.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if the peripheral is enabled, 0 otherwise.
+ *******************************************************************/
+uint8_t AES_MOCK_is_enabled(void);
+
+/*******************************************************************/
+#define AES_exit_error(base) { ERROR_check_exit(aes_status, AES_SUCCESS, base) }
+
+/*******************************************************************/
+#define AES_stack_error(base) { ERROR_check_stack(aes_status, AES_SUCCESS, base) }
+
+/*******************************************************************/
+#define AES_stack_exit_error(base, code) { ERROR_check_stack_exit(aes_status, AES_SUCCESS, base, code) }
+
+#endif /* __AES_H__ */
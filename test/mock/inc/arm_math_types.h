@@ -0,0 +1,33 @@
+/*
+ * arm_math_types.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ARM_MATH_TYPES_H__
+#define __ARM_MATH_TYPES_H__
+
+// Note: host reference implementation of the CMSIS-DSP subset used by the firmware.
+#include "stdint.h"
+
+/*** ARM MATH structures ***/
+
+typedef int8_t q7_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+typedef float float32_t;
+typedef double float64_t;
+
+/*!******************************************************************
+ * \enum arm_status
+ * \brief CMSIS-DSP functions status.
+ *******************************************************************/
+typedef enum {
+    ARM_MATH_SUCCESS = 0,
+    ARM_MATH_ARGUMENT_ERROR = -1,
+    ARM_MATH_LENGTH_ERROR = -2
+} arm_status;
+
+#endif /* __ARM_MATH_TYPES_H__ */
@@ -0,0 +1,13 @@
+/*
+ * bcm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __BCM_REGISTERS_H__
+#define __BCM_REGISTERS_H__
+
+// Note: board not selected in host tests.
+
+#endif /* __BCM_REGISTERS_H__ */
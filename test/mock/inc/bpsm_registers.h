@@ -0,0 +1,13 @@
+/*
+ * bpsm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __BPSM_REGISTERS_H__
+#define __BPSM_REGISTERS_H__
+
+// Note: board not selected in host tests.
+
+#endif /* __BPSM_REGISTERS_H__ */
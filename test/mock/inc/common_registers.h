@@ -0,0 +1,32 @@
+/*
+ * common_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __COMMON_REGISTERS_H__
+#define __COMMON_REGISTERS_H__
+
+#include "una.h"
+
+/*** COMMON registers ***/
+
+// Note: reduced map of the dinfox-registers submodule for host tests.
+typedef enum {
+    COMMON_REGISTER_ADDRESS_NODE_ID = 0,
+    COMMON_REGISTER_ADDRESS_HW_VERSION,
+    COMMON_REGISTER_ADDRESS_SW_VERSION_0,
+    COMMON_REGISTER_ADDRESS_SW_VERSION_1,
+    COMMON_REGISTER_ADDRESS_FLAGS_0,
+    COMMON_REGISTER_ADDRESS_ERROR_STACK,
+    COMMON_REGISTER_ADDRESS_CONTROL_0,
+    COMMON_REGISTER_ADDRESS_STATUS_0,
+    COMMON_REGISTER_ADDRESS_ANALOG_DATA_0,
+    COMMON_REGISTER_ADDRESS_LAST
+} COMMON_register_address_t;
+
+#define COMMON_REGISTER_CONTROL_0_MASK_RTRG     0x00000001
+#define COMMON_REGISTER_CONTROL_0_MASK_MTRG     0x00000002
+
+#endif /* __COMMON_REGISTERS_H__ */
@@ -0,0 +1,55 @@
+/*
+ * crc_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __CRC_REGISTERS_H__
+#define __CRC_REGISTERS_H__
+
+#include "types.h"
+
+/*** CRC registers ***/
+
+/*!******************************************************************
+ * \struct CRC_registers_t
+ * \brief CRC registers map.
+ *******************************************************************/
+typedef struct {
+    volatile uint32_t DR;
+    volatile uint32_t IDR;
+    volatile uint32_t CR;
+    volatile uint32_t RESERVED0;
+    volatile uint32_t INIT;
+    volatile uint32_t POL;
+} CRC_registers_t;
+
+/*** CRC base address ***/
+
+// Note: the page is mapped on the host by CRC_MOCK_init() and each access is trapped to emulate the peripheral.
+#define CRC_MOCK_BASE_ADDRESS   0x40023000
+
+#define CRC                     ((CRC_registers_t*) CRC_MOCK_BASE_ADDRESS)
+
+/*** CRC mock functions ***/
+
+/*!******************************************************************
+ * \fn uint8_t CRC_MOCK_init(void)
+ * \brief Map the CRC registers page and install the access traps.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if the emulation is available, 0 otherwise.
+ *******************************************************************/
+uint8_t CRC_MOCK_init(void);
+
+/*!******************************************************************
+ * \fn uint32_t CRC_MOCK_get_access_count(void)
+ * \brief Get the number of CRC registers accesses.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of trapped accesses since init.
+ *******************************************************************/
+uint32_t CRC_MOCK_get_access_count(void);
+
+#endif /* __CRC_REGISTERS_H__ */
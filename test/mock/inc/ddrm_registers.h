@@ -0,0 +1,13 @@
+/*
+ * ddrm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __DDRM_REGISTERS_H__
+#define __DDRM_REGISTERS_H__
+
+// Note: board not selected in host tests.
+
+#endif /* __DDRM_REGISTERS_H__ */
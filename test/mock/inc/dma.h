@@ -0,0 +1,171 @@
+/*
+ * dma.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __DMA_H__
+#define __DMA_H__
+
+#include "dmamux.h"
+#include "error.h"
+#include "types.h"
+
+/*** DMA macros ***/
+
+// Note: STM32L0 request name used by the GPS UART driver.
+#define DMA_REQUEST_ID_USART2_RX    DMAMUX_PERIPHERAL_REQUEST_USART2_RX
+
+/*** DMA structures ***/
+
+/*!******************************************************************
+ * \enum DMA_status_t
+ * \brief DMA driver error codes.
+ *******************************************************************/
+typedef enum {
+    DMA_SUCCESS = 0,
+    DMA_ERROR_NULL_PARAMETER,
+    DMA_ERROR_INSTANCE,
+    DMA_ERROR_CHANNEL,
+    DMA_ERROR_UNINITIALIZED,
+    DMA_ERROR_BASE_LAST = ERROR_BASE_STEP
+} DMA_status_t;
+
+/*!******************************************************************
+ * \enum DMA_instance_t
+ * \brief DMA instances list.
+ *******************************************************************/
+typedef enum {
+    DMA_INSTANCE_DMA1 = 0,
+    DMA_INSTANCE_DMA2,
+    DMA_INSTANCE_LAST
+} DMA_instance_t;
+
+/*!******************************************************************
+ * \enum DMA_channel_t
+ * \brief DMA channels list.
+ *******************************************************************/
+typedef enum {
+    DMA_CHANNEL_1 = 0,
+    DMA_CHANNEL_2,
+    DMA_CHANNEL_3,
+    DMA_CHANNEL_4,
+    DMA_CHANNEL_5,
+    DMA_CHANNEL_6,
+    DMA_CHANNEL_LAST
+} DMA_channel_t;
+
+/*!******************************************************************
+ * \enum DMA_direction_t
+ * \brief DMA transfer directions.
+ *******************************************************************/
+typedef enum {
+    DMA_DIRECTION_PERIPHERAL_TO_MEMORY = 0,
+    DMA_DIRECTION_MEMORY_TO_PERIPHERAL,
+    DMA_DIRECTION_LAST
+} DMA_direction_t;
+
+/*!******************************************************************
+ * \enum DMA_data_size_t
+ * \brief DMA data sizes.
+ *******************************************************************/
+typedef enum {
+    DMA_DATA_SIZE_8_BITS = 0,
+    DMA_DATA_SIZE_16_BITS,
+    DMA_DATA_SIZE_32_BITS,
+    DMA_DATA_SIZE_LAST
+} DMA_data_size_t;
+
+/*!******************************************************************
+ * \enum DMA_priority_t
+ * \brief DMA channel priorities.
+ *******************************************************************/
+typedef enum {
+    DMA_PRIORITY_LOW = 0,
+    DMA_PRIORITY_MEDIUM,
+    DMA_PRIORITY_HIGH,
+    DMA_PRIORITY_VERY_HIGH,
+    DMA_PRIORITY_LAST
+} DMA_priority_t;
+
+/*!******************************************************************
+ * \fn DMA_transfer_complete_cb_t
+ * \brief DMA transfer complete callback.
+ *******************************************************************/
+typedef void (*DMA_transfer_complete_cb_t)(void);
+
+/*!******************************************************************
+ * \struct DMA_configuration_t
+ * \brief DMA channel configuration.
+ *******************************************************************/
+typedef struct {
+    DMA_direction_t direction;
+    union {
+        struct {
+            unsigned memory_increment : 1;
+            unsigned peripheral_increment : 1;
+            unsigned circular_mode : 1;
+        };
+        uint8_t all;
+    } flags;
+    uint32_t memory_address;
+    DMA_data_size_t memory_data_size;
+    uint32_t peripheral_address;
+    DMA_data_size_t peripheral_data_size;
+    uint16_t number_of_data;
+    DMA_priority_t priority;
+    DMAMUX_peripheral_request_t request_id;
+    DMA_transfer_complete_cb_t tc_irq_callback;
+    uint8_t nvic_priority;
+} DMA_configuration_t;
+
+/*** DMA functions ***/
+
+DMA_status_t DMA_init(DMA_instance_t instance, DMA_channel_t channel, DMA_configuration_t* configuration);
+DMA_status_t DMA_de_init(DMA_instance_t instance, DMA_channel_t channel);
+DMA_status_t DMA_start(DMA_instance_t instance, DMA_channel_t channel);
+DMA_status_t DMA_stop(DMA_instance_t instance, DMA_channel_t channel);
+DMA_status_t DMA_set_memory_address(DMA_instance_t instance, DMA_channel_t channel, uint32_t memory_addr, uint16_t number_of_data);
+DMA_status_t DMA_get_number_of_transfered_data(DMA_instance_t instance, DMA_channel_t channel, uint16_t* number_of_transfered_data);
+
+/*** DMA mock functions ***/
+
+/*!******************************************************************
+ * \fn DMA_status_t DMA_MOCK_transfer(DMA_instance_t instance, DMA_channel_t channel, uint32_t data)
+ * \brief Emulate the transfer of one peripheral data to memory.
+ * \param[in]   instance: DMA instance.
+ * \param[in]   channel: DMA channel.
+ * \param[in]   data: Peripheral data (truncated to the configured memory data size).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DMA_status_t DMA_MOCK_transfer(DMA_instance_t instance, DMA_channel_t channel, uint32_t data);
+
+/*!******************************************************************
+ * \fn void DMA_MOCK_request(DMAMUX_peripheral_request_t request_id, uint32_t data)
+ * \brief Emulate a peripheral request: the data is transferred by the running channel configured with this request.
+ * \param[in]   request_id: Peripheral request.
+ * \param[in]   data: Peripheral data.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void DMA_MOCK_request(DMAMUX_peripheral_request_t request_id, uint32_t data);
+
+/*!******************************************************************
+ * \fn uint8_t DMA_MOCK_is_running(DMA_instance_t instance, DMA_channel_t channel)
+ * \brief Check if a DMA channel is started.
+ * \param[in]   instance: DMA instance.
+ * \param[in]   channel: DMA channel.
+ * \param[out]  none
+ * \retval      1 if the channel is running, 0 otherwise.
+ *******************************************************************/
+uint8_t DMA_MOCK_is_running(DMA_instance_t instance, DMA_channel_t channel);
+
+/*******************************************************************/
+#define DMA_exit_error(base) { ERROR_check_exit(dma_status, DMA_SUCCESS, base) }
+
+/*******************************************************************/
+#define DMA_stack_error(base) { ERROR_check_stack(dma_status, DMA_SUCCESS, base) }
+
+#endif /* __DMA_H__ */
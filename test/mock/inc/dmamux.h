@@ -0,0 +1,27 @@
+/*
+ * dmamux.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __DMAMUX_H__
+#define __DMAMUX_H__
+
+/*** DMAMUX structures ***/
+
+/*!******************************************************************
+ * \enum DMAMUX_peripheral_request_t
+ * \brief DMAMUX peripheral requests list (host tests subset).
+ *******************************************************************/
+typedef enum {
+    DMAMUX_PERIPHERAL_REQUEST_NONE = 0,
+    DMAMUX_PERIPHERAL_REQUEST_ADC1 = 5,
+    DMAMUX_PERIPHERAL_REQUEST_USART1_RX = 24,
+    DMAMUX_PERIPHERAL_REQUEST_USART2_RX = 26,
+    DMAMUX_PERIPHERAL_REQUEST_ADC2 = 36,
+    DMAMUX_PERIPHERAL_REQUEST_TIM2_CH1 = 56,
+    DMAMUX_PERIPHERAL_REQUEST_LAST = 116
+} DMAMUX_peripheral_request_t;
+
+#endif /* __DMAMUX_H__ */
@@ -0,0 +1,29 @@
+/*
+ * dsm_flags.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __DSM_FLAGS_H__
+#define __DSM_FLAGS_H__
+
+// Note: host tests version of the board flags.
+// Features flags under test (MPMCM_ANALOG_xxx, etc) are selected by the test Makefile.
+
+/*** Board options ***/
+
+#ifdef MPMCM
+// Transformer settings.
+#define MPMCM_TRANSFORMER_ATTEN             15 // Unit V/V.
+// Current sensors settings.
+#define MPMCM_SCT013_ATTEN                  { 1, 1, 1, 1 } // Unit V/V.
+#endif
+
+/*** Second level compilation flags ***/
+
+#if ((defined GPSM) || (defined MPMCM))
+#define DSM_RGB_LED
+#endif
+
+#endif /* __DSM_FLAGS_H__ */
@@ -0,0 +1,19 @@
+/*
+ * basic_math_functions.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __BASIC_MATH_FUNCTIONS_H__
+#define __BASIC_MATH_FUNCTIONS_H__
+
+#include "arm_math_types.h"
+
+/*** BASIC MATH functions ***/
+
+void arm_mult_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void arm_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result);
+void arm_dot_prod_q15(const q15_t* pSrcA, const q15_t* pSrcB, uint32_t blockSize, q63_t* result);
+
+#endif /* __BASIC_MATH_FUNCTIONS_H__ */
@@ -0,0 +1,17 @@
+/*
+ * complex_math_functions.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __COMPLEX_MATH_FUNCTIONS_H__
+#define __COMPLEX_MATH_FUNCTIONS_H__
+
+#include "arm_math_types.h"
+
+/*** COMPLEX MATH functions ***/
+
+void arm_cmplx_mag_squared_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples);
+
+#endif /* __COMPLEX_MATH_FUNCTIONS_H__ */
@@ -0,0 +1,18 @@
+/*
+ * fast_math_functions.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __FAST_MATH_FUNCTIONS_H__
+#define __FAST_MATH_FUNCTIONS_H__
+
+#include "arm_math_types.h"
+
+/*** FAST MATH functions ***/
+
+arm_status arm_sqrt_f32(float32_t in, float32_t* pOut);
+arm_status arm_atan2_f32(float32_t y, float32_t x, float32_t* result);
+
+#endif /* __FAST_MATH_FUNCTIONS_H__ */
@@ -0,0 +1,19 @@
+/*
+ * statistics_functions.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __STATISTICS_FUNCTIONS_H__
+#define __STATISTICS_FUNCTIONS_H__
+
+#include "arm_math_types.h"
+
+/*** STATISTICS functions ***/
+
+void arm_mean_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult);
+void arm_rms_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult);
+void arm_power_q15(const q15_t* pSrc, uint32_t blockSize, q63_t* pResult);
+
+#endif /* __STATISTICS_FUNCTIONS_H__ */
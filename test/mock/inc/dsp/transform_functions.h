@@ -0,0 +1,28 @@
+/*
+ * transform_functions.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TRANSFORM_FUNCTIONS_H__
+#define __TRANSFORM_FUNCTIONS_H__
+
+#include "arm_math_types.h"
+
+/*** TRANSFORM structures ***/
+
+/*!******************************************************************
+ * \struct arm_rfft_fast_instance_f32
+ * \brief Real FFT instance (only the length is used by the host implementation).
+ *******************************************************************/
+typedef struct {
+    uint16_t fftLenRFFT;
+} arm_rfft_fast_instance_f32;
+
+/*** TRANSFORM functions ***/
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32* S, uint16_t fftLen);
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut, uint8_t ifftFlag);
+
+#endif /* __TRANSFORM_FUNCTIONS_H__ */
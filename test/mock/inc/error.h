@@ -0,0 +1,79 @@
+/*
+ * error.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ERROR_H__
+#define __ERROR_H__
+
+#include "types.h"
+
+/*** ERROR macros ***/
+
+#define ERROR_BASE_STEP     0x0100
+#define ERROR_STACK_DEPTH   32
+
+/*** ERROR structures ***/
+
+/*!******************************************************************
+ * \type ERROR_code_t
+ * \brief Error code type.
+ *******************************************************************/
+typedef uint16_t ERROR_code_t;
+
+/*** ERROR functions ***/
+
+/*!******************************************************************
+ * \fn void ERROR_stack_init(void)
+ * \brief Init error stack.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void ERROR_stack_init(void);
+
+/*!******************************************************************
+ * \fn void ERROR_stack_add(ERROR_code_t code)
+ * \brief Add error to stack.
+ * \param[in]   code: Error to add.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void ERROR_stack_add(ERROR_code_t code);
+
+/*!******************************************************************
+ * \fn uint8_t ERROR_stack_is_empty(void)
+ * \brief Check if error stack is empty.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if the error stack is empty, 0 otherwise.
+ *******************************************************************/
+uint8_t ERROR_stack_is_empty(void);
+
+/*******************************************************************/
+#define ERROR_check_exit(error, success, base) { \
+    if (error != success) { \
+        status = (base + error); \
+        goto errors; \
+    } \
+}
+
+/*******************************************************************/
+#define ERROR_check_stack(error, success, base) { \
+    if (error != success) { \
+        ERROR_stack_add((ERROR_code_t) (base + error)); \
+    } \
+}
+
+/*******************************************************************/
+#define ERROR_check_stack_exit(error, success, base, code) { \
+    if (error != success) { \
+        ERROR_stack_add((ERROR_code_t) (base + error)); \
+        status = code; \
+        goto errors; \
+    } \
+}
+
+#endif /* __ERROR_H__ */
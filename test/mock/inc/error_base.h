@@ -0,0 +1,38 @@
+/*
+ * error_base.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ERROR_BASE_H__
+#define __ERROR_BASE_H__
+
+/*** ERROR BASE structures ***/
+
+/*!******************************************************************
+ * \enum ERROR_base_t
+ * \brief Board error bases (host tests subset).
+ *******************************************************************/
+typedef enum {
+    SUCCESS = 0,
+    ERROR_BASE_NVM = 0x1000,
+    ERROR_BASE_LED = 0x2000,
+    ERROR_BASE_TIC = 0x3000,
+    ERROR_BASE_MEASURE = 0x4000,
+    ERROR_BASE_NODE = 0x5000,
+    ERROR_BASE_CLI = 0x6000,
+    ERROR_BASE_GPS = 0x7000,
+    ERROR_BASE_LMAC = 0x8000,
+    ERROR_BASE_AES = 0x9000,
+    ERROR_BASE_TIM_MCU_API = 0xA000,
+    ERROR_BASE_S2LP = 0xB000,
+    ERROR_BASE_ANALOG = 0xC000,
+    ERROR_BASE_RFE = 0xD000,
+    ERROR_BASE_SYSTICK = 0xE000,
+    ERROR_BASE_CRC = 0xF000,
+    ERROR_BASE_NEOM8N = 0x10000,
+    ERROR_BASE_LAST = 0x11000
+} ERROR_base_t;
+
+#endif /* __ERROR_BASE_H__ */
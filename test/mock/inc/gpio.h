@@ -0,0 +1,88 @@
+/*
+ * gpio.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+#include "types.h"
+
+/*** GPIO structures ***/
+
+/*!******************************************************************
+ * \enum GPIO_mode_t
+ * \brief GPIO modes.
+ *******************************************************************/
+typedef enum {
+    GPIO_MODE_INPUT = 0,
+    GPIO_MODE_OUTPUT,
+    GPIO_MODE_ALTERNATE_FUNCTION,
+    GPIO_MODE_ANALOG,
+    GPIO_MODE_LAST
+} GPIO_mode_t;
+
+/*!******************************************************************
+ * \enum GPIO_output_type_t
+ * \brief GPIO output types.
+ *******************************************************************/
+typedef enum {
+    GPIO_TYPE_PUSH_PULL = 0,
+    GPIO_TYPE_OPEN_DRAIN,
+    GPIO_TYPE_LAST
+} GPIO_output_type_t;
+
+/*!******************************************************************
+ * \enum GPIO_output_speed_t
+ * \brief GPIO output speeds.
+ *******************************************************************/
+typedef enum {
+    GPIO_SPEED_LOW = 0,
+    GPIO_SPEED_MEDIUM,
+    GPIO_SPEED_HIGH,
+    GPIO_SPEED_VERY_HIGH,
+    GPIO_SPEED_LAST
+} GPIO_output_speed_t;
+
+/*!******************************************************************
+ * \enum GPIO_pull_resistor_t
+ * \brief GPIO pull resistors.
+ *******************************************************************/
+typedef enum {
+    GPIO_PULL_NONE = 0,
+    GPIO_PULL_UP,
+    GPIO_PULL_DOWN,
+    GPIO_PULL_LAST
+} GPIO_pull_resistor_t;
+
+/*!******************************************************************
+ * \struct GPIO_pin_t
+ * \brief GPIO pin descriptor.
+ * \note The mock state replaces the port registers.
+ *******************************************************************/
+typedef struct {
+    uint8_t port;
+    uint8_t pin;
+} GPIO_pin_t;
+
+/*** GPIO functions ***/
+
+void GPIO_configure(const GPIO_pin_t* gpio, GPIO_mode_t mode, GPIO_output_type_t output_type, GPIO_output_speed_t output_speed, GPIO_pull_resistor_t pull_resistor);
+void GPIO_write(const GPIO_pin_t* gpio, uint8_t state);
+uint8_t GPIO_read(const GPIO_pin_t* gpio);
+
+/*** GPIO mock functions ***/
+
+/*!******************************************************************
+ * \fn void GPIO_MOCK_set_input(const GPIO_pin_t* gpio, uint8_t state)
+ * \brief Set the level seen on an input GPIO.
+ * \param[in]   gpio: GPIO to set.
+ * \param[in]   state: Input level.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void GPIO_MOCK_set_input(const GPIO_pin_t* gpio, uint8_t state);
+
+#endif /* __GPIO_H__ */
@@ -0,0 +1,13 @@
+/*
+ * gpsm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __GPSM_REGISTERS_H__
+#define __GPSM_REGISTERS_H__
+
+// Note: board not selected in host tests.
+
+#endif /* __GPSM_REGISTERS_H__ */
@@ -0,0 +1,17 @@
+/*
+ * iwdg.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __IWDG_H__
+#define __IWDG_H__
+
+#include "types.h"
+
+/*** IWDG functions ***/
+
+void IWDG_reload(void);
+
+#endif /* __IWDG_H__ */
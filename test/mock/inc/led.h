@@ -0,0 +1,56 @@
+/*
+ * led.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LED_H__
+#define __LED_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** LED structures ***/
+
+/*!******************************************************************
+ * \enum LED_status_t
+ * \brief LED driver error codes.
+ *******************************************************************/
+typedef enum {
+    LED_SUCCESS = 0,
+    LED_ERROR_NULL_DURATION,
+    LED_ERROR_COLOR,
+    LED_ERROR_BASE_LAST = ERROR_BASE_STEP
+} LED_status_t;
+
+/*!******************************************************************
+ * \enum LED_color_t
+ * \brief LED colors list.
+ *******************************************************************/
+typedef enum {
+    LED_COLOR_OFF = 0,
+    LED_COLOR_RED,
+    LED_COLOR_GREEN,
+    LED_COLOR_YELLOW,
+    LED_COLOR_BLUE,
+    LED_COLOR_MAGENTA,
+    LED_COLOR_CYAN,
+    LED_COLOR_WHITE,
+    LED_COLOR_LAST
+} LED_color_t;
+
+/*** LED functions ***/
+
+LED_status_t LED_init(void);
+LED_status_t LED_de_init(void);
+LED_status_t LED_single_pulse(uint32_t pulse_duration_ms, LED_color_t color, uint8_t pulse_completion_event);
+LED_status_t LED_start_single_blink(uint32_t blink_duration_ms, LED_color_t color);
+
+/*******************************************************************/
+#define LED_exit_error(base) { ERROR_check_exit(led_status, LED_SUCCESS, base) }
+
+/*******************************************************************/
+#define LED_stack_error(base) { ERROR_check_stack(led_status, LED_SUCCESS, base) }
+
+#endif /* __LED_H__ */
@@ -0,0 +1,44 @@
+/*
+ * lmac.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LMAC_H__
+#define __LMAC_H__
+
+#include "error.h"
+#include "lmac_driver_flags.h"
+#include "types.h"
+
+/*** LMAC structures ***/
+
+/*!******************************************************************
+ * \enum LMAC_status_t
+ * \brief LMAC driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    LMAC_SUCCESS = 0,
+    LMAC_ERROR_NULL_PARAMETER,
+    // Low level drivers errors.
+    LMAC_ERROR_BASE_HW_INTERFACE = ERROR_BASE_STEP,
+    LMAC_ERROR_BASE_NVM = (LMAC_ERROR_BASE_HW_INTERFACE + LMAC_DRIVER_HW_INTERFACE_ERROR_BASE_LAST),
+    // Last base value.
+    LMAC_ERROR_BASE_LAST = (LMAC_ERROR_BASE_NVM + LMAC_DRIVER_NVM_ERROR_BASE_LAST)
+} LMAC_status_t;
+
+/*!******************************************************************
+ * \fn LMAC_rx_irq_cb_t
+ * \brief Byte reception interrupt callback.
+ *******************************************************************/
+typedef void (*LMAC_rx_irq_cb_t)(uint8_t data);
+
+/*******************************************************************/
+#define LMAC_exit_error(base) { ERROR_check_exit(lmac_status, LMAC_SUCCESS, base) }
+
+/*******************************************************************/
+#define LMAC_stack_error(base) { ERROR_check_stack(lmac_status, LMAC_SUCCESS, base) }
+
+#endif /* __LMAC_H__ */
@@ -0,0 +1,23 @@
+/*
+ * lmac_hw.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LMAC_HW_H__
+#define __LMAC_HW_H__
+
+#include "lmac.h"
+#include "types.h"
+
+/*** LMAC HW functions ***/
+
+LMAC_status_t LMAC_HW_init(uint32_t baud_rate, LMAC_rx_irq_cb_t rx_irq_callback, uint8_t* self_address);
+LMAC_status_t LMAC_HW_de_init(void);
+LMAC_status_t LMAC_HW_enable_rx(void);
+LMAC_status_t LMAC_HW_disable_rx(void);
+LMAC_status_t LMAC_HW_write(uint8_t* data, uint32_t data_size_bytes);
+void LMAC_HW_stack_error(LMAC_status_t status);
+
+#endif /* __LMAC_HW_H__ */
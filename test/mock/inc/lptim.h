@@ -0,0 +1,50 @@
+/*
+ * lptim.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LPTIM_H__
+#define __LPTIM_H__
+
+#include "error.h"
+// Note: real driver headers chain provides RTC_get_uptime_seconds() to the measure driver.
+#include "rtc.h"
+#include "types.h"
+
+/*** LPTIM structures ***/
+
+/*!******************************************************************
+ * \enum LPTIM_status_t
+ * \brief LPTIM driver error codes.
+ *******************************************************************/
+typedef enum {
+    LPTIM_SUCCESS = 0,
+    LPTIM_ERROR_DELAY_UNDERFLOW,
+    LPTIM_ERROR_DELAY_OVERFLOW,
+    LPTIM_ERROR_BASE_LAST = ERROR_BASE_STEP
+} LPTIM_status_t;
+
+/*!******************************************************************
+ * \enum LPTIM_delay_mode_t
+ * \brief LPTIM delay waiting modes.
+ *******************************************************************/
+typedef enum {
+    LPTIM_DELAY_MODE_ACTIVE = 0,
+    LPTIM_DELAY_MODE_SLEEP,
+    LPTIM_DELAY_MODE_STOP,
+    LPTIM_DELAY_MODE_LAST
+} LPTIM_delay_mode_t;
+
+/*** LPTIM functions ***/
+
+LPTIM_status_t LPTIM_delay_milliseconds(uint32_t delay_ms, LPTIM_delay_mode_t delay_mode);
+
+/*******************************************************************/
+#define LPTIM_exit_error(base) { ERROR_check_exit(lptim_status, LPTIM_SUCCESS, base) }
+
+/*******************************************************************/
+#define LPTIM_stack_error(base) { ERROR_check_stack(lptim_status, LPTIM_SUCCESS, base) }
+
+#endif /* __LPTIM_H__ */
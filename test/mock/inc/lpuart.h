@@ -0,0 +1,123 @@
+/*
+ * lpuart.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LPUART_H__
+#define __LPUART_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** LPUART macros ***/
+
+#define LPUART_MOCK_TX_BUFFER_SIZE  256
+
+/*** LPUART structures ***/
+
+/*!******************************************************************
+ * \enum LPUART_status_t
+ * \brief LPUART driver error codes.
+ *******************************************************************/
+typedef enum {
+    LPUART_SUCCESS = 0,
+    LPUART_ERROR_NULL_PARAMETER,
+    LPUART_ERROR_BAUD_RATE,
+    LPUART_ERROR_UNINITIALIZED,
+    LPUART_ERROR_BASE_LAST = ERROR_BASE_STEP
+} LPUART_status_t;
+
+/*!******************************************************************
+ * \struct LPUART_gpio_t
+ * \brief LPUART GPIO pins list.
+ *******************************************************************/
+typedef struct {
+    uint8_t instance;
+} LPUART_gpio_t;
+
+/*!******************************************************************
+ * \enum LPUART_rs485_mode_t
+ * \brief LPUART RS485 modes list.
+ *******************************************************************/
+typedef enum {
+    LPUART_RS485_MODE_ADDRESSED = 0,
+    LPUART_RS485_MODE_DIRECT,
+    LPUART_RS485_MODE_LAST
+} LPUART_rs485_mode_t;
+
+/*!******************************************************************
+ * \fn LPUART_rx_irq_cb_t
+ * \brief LPUART RX interrupt callback.
+ *******************************************************************/
+typedef void (*LPUART_rx_irq_cb_t)(uint8_t data);
+
+/*!******************************************************************
+ * \struct LPUART_configuration_t
+ * \brief LPUART configuration structure.
+ *******************************************************************/
+typedef struct {
+    uint32_t baud_rate;
+    uint8_t nvic_priority;
+    LPUART_rx_irq_cb_t rxne_irq_callback;
+    uint8_t self_address;
+    LPUART_rs485_mode_t rs485_mode;
+} LPUART_configuration_t;
+
+/*** LPUART functions ***/
+
+LPUART_status_t LPUART_init(const LPUART_gpio_t* pins, LPUART_configuration_t* configuration);
+LPUART_status_t LPUART_de_init(const LPUART_gpio_t* pins);
+LPUART_status_t LPUART_enable_rx(void);
+LPUART_status_t LPUART_disable_rx(void);
+LPUART_status_t LPUART_write(uint8_t* data, uint32_t data_size_bytes);
+
+/*** LPUART mock functions ***/
+
+/*!******************************************************************
+ * \fn uint32_t LPUART_MOCK_receive(uint32_t baud_rate, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Emulate bytes sent on the bus by the master.
+ * \param[in]   baud_rate: Baud rate used by the master.
+ * \param[in]   data: Bytes to send.
+ * \param[in]   data_size_bytes: Number of bytes to send.
+ * \param[out]  none
+ * \retval      Number of bytes received by the LPUART (0 if the receiver is disabled or if the baud rate does not match).
+ *******************************************************************/
+uint32_t LPUART_MOCK_receive(uint32_t baud_rate, uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn uint32_t LPUART_MOCK_read_bus(uint32_t baud_rate, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Emulate the reception of the bytes written by the LPUART on the master side, and clear them.
+ * \param[in]   baud_rate: Baud rate used by the master.
+ * \param[in]   data_size_bytes: Size of the data buffer.
+ * \param[out]  data: Received bytes.
+ * \retval      Number of received bytes (0 if the baud rate does not match).
+ *******************************************************************/
+uint32_t LPUART_MOCK_read_bus(uint32_t baud_rate, uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn uint32_t LPUART_MOCK_get_baud_rate(void)
+ * \brief Get the LPUART configured baud rate.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current baud rate (0 if the LPUART is not initialized).
+ *******************************************************************/
+uint32_t LPUART_MOCK_get_baud_rate(void);
+
+/*!******************************************************************
+ * \fn uint32_t LPUART_MOCK_get_init_count(void)
+ * \brief Get the number of LPUART initializations.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of LPUART_init() calls.
+ *******************************************************************/
+uint32_t LPUART_MOCK_get_init_count(void);
+
+/*******************************************************************/
+#define LPUART_exit_error(base) { ERROR_check_exit(lpuart_status, LPUART_SUCCESS, base) }
+
+/*******************************************************************/
+#define LPUART_stack_error(base) { ERROR_check_stack(lpuart_status, LPUART_SUCCESS, base) }
+
+#endif /* __LPUART_H__ */
@@ -0,0 +1,13 @@
+/*
+ * lvrm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LVRM_REGISTERS_H__
+#define __LVRM_REGISTERS_H__
+
+// Note: board not selected in host tests.
+
+#endif /* __LVRM_REGISTERS_H__ */
@@ -0,0 +1,162 @@
+/*
+ * mcu_api.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MCU_API_H__
+#define __MCU_API_H__
+
+#include "sigfox_types.h"
+
+/*** MCU API structures ***/
+
+// Note: subset of the Sigfox end-point library MCU API used by the host tests.
+
+/*!******************************************************************
+ * \enum MCU_API_status_t
+ * \brief MCU API error codes.
+ *******************************************************************/
+typedef enum {
+    MCU_API_SUCCESS = 0,
+    MCU_API_ERROR
+} MCU_API_status_t;
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn MCU_API_process_cb_t
+ * \brief MCU API process callback.
+ *******************************************************************/
+typedef void (*MCU_API_process_cb_t)(void);
+
+/*!******************************************************************
+ * \fn MCU_API_error_cb_t
+ * \brief MCU API error callback.
+ *******************************************************************/
+typedef void (*MCU_API_error_cb_t)(void);
+#endif
+
+/*!******************************************************************
+ * \struct MCU_API_config_t
+ * \brief MCU API configuration structure.
+ *******************************************************************/
+typedef struct {
+    void* rc;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    MCU_API_process_cb_t process_cb;
+    MCU_API_error_cb_t error_cb;
+#endif
+} MCU_API_config_t;
+
+#ifdef SIGFOX_EP_TIMER_REQUIRED
+/*!******************************************************************
+ * \enum MCU_API_timer_instance_t
+ * \brief MCU API timer instances.
+ *******************************************************************/
+typedef enum {
+    MCU_API_TIMER_1 = 0,
+    MCU_API_TIMER_2,
+    MCU_API_TIMER_3,
+    MCU_API_TIMER_4,
+    MCU_API_TIMER_LAST
+} MCU_API_timer_instance_t;
+
+/*!******************************************************************
+ * \enum MCU_API_timer_reason_t
+ * \brief MCU API timer reasons.
+ *******************************************************************/
+typedef enum {
+    MCU_API_TIMER_REASON_T_IFU = 0,
+    MCU_API_TIMER_REASON_T_CONF,
+    MCU_API_TIMER_REASON_T_W,
+    MCU_API_TIMER_REASON_T_RX,
+    MCU_API_TIMER_REASON_LAST
+} MCU_API_timer_reason_t;
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn MCU_API_timer_cplt_cb_t
+ * \brief MCU API timer completion callback.
+ *******************************************************************/
+typedef void (*MCU_API_timer_cplt_cb_t)(void);
+#endif
+
+/*!******************************************************************
+ * \struct MCU_API_timer_t
+ * \brief MCU API timer structure.
+ *******************************************************************/
+typedef struct {
+    MCU_API_timer_instance_t instance;
+    sfx_u32 duration_ms;
+    MCU_API_timer_reason_t reason;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    MCU_API_timer_cplt_cb_t cplt_cb;
+#endif
+} MCU_API_timer_t;
+#endif
+
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION) && (defined SIGFOX_EP_BIDIRECTIONAL)
+/*!******************************************************************
+ * \enum MCU_API_latency_t
+ * \brief MCU API latency types.
+ *******************************************************************/
+typedef enum {
+    MCU_API_LATENCY_GET_VOLTAGE_TEMPERATURE = 0,
+    MCU_API_LATENCY_LAST
+} MCU_API_latency_t;
+#endif
+
+/*!******************************************************************
+ * \struct MCU_API_encryption_data_t
+ * \brief MCU API encryption data structure.
+ *******************************************************************/
+typedef struct {
+    sfx_u8* data;
+    SIGFOX_ep_key_t key;
+} MCU_API_encryption_data_t;
+
+/*** MCU API functions ***/
+
+#if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
+MCU_API_status_t MCU_API_open(MCU_API_config_t* mcu_api_config);
+#endif
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+MCU_API_status_t MCU_API_close(void);
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+MCU_API_status_t MCU_API_process(void);
+#endif
+#ifdef SIGFOX_EP_TIMER_REQUIRED
+MCU_API_status_t MCU_API_timer_start(MCU_API_timer_t* timer);
+MCU_API_status_t MCU_API_timer_stop(MCU_API_timer_instance_t timer_instance);
+#endif
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+MCU_API_status_t MCU_API_timer_status(MCU_API_timer_instance_t timer_instance, sfx_bool* timer_has_elapsed);
+MCU_API_status_t MCU_API_timer_wait_cplt(MCU_API_timer_instance_t timer_instance);
+#endif
+#ifdef SIGFOX_EP_AES_HW
+MCU_API_status_t MCU_API_aes_128_cbc_encrypt(MCU_API_encryption_data_t* aes_data);
+#else
+MCU_API_status_t MCU_API_get_ep_key(sfx_u8* ep_key, sfx_u8 ep_key_size_bytes);
+#endif
+MCU_API_status_t MCU_API_get_ep_id(sfx_u8* ep_id, sfx_u8 ep_id_size_bytes);
+MCU_API_status_t MCU_API_get_nvm(sfx_u8* nvm_data, sfx_u8 nvm_data_size_bytes);
+MCU_API_status_t MCU_API_set_nvm(sfx_u8* nvm_data, sfx_u8 nvm_data_size_bytes);
+#ifdef SIGFOX_EP_CRC_HW
+MCU_API_status_t MCU_API_compute_crc16(sfx_u8* data, sfx_u8 data_size, sfx_u16 polynom, sfx_u16* crc);
+#endif
+#if (defined SIGFOX_EP_CRC_HW) && (defined SIGFOX_EP_BIDIRECTIONAL)
+MCU_API_status_t MCU_API_compute_crc8(sfx_u8* data, sfx_u8 data_size, sfx_u16 polynom, sfx_u8* crc);
+#endif
+#if (defined SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE) || (defined SIGFOX_EP_BIDIRECTIONAL)
+MCU_API_status_t MCU_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u16* voltage_tx_mv, sfx_s16* temperature_tenth_degrees);
+#endif
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION) && (defined SIGFOX_EP_BIDIRECTIONAL)
+MCU_API_status_t MCU_API_get_latency(MCU_API_latency_t latency_type, sfx_u32* latency_ms);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+void MCU_API_error(void);
+#endif
+
+#endif /* __MCU_API_H__ */
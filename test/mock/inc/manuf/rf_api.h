@@ -0,0 +1,178 @@
+/*
+ * rf_api.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RF_API_H__
+#define __RF_API_H__
+
+#include "sigfox_types.h"
+
+/*** RF API structures ***/
+
+// Note: subset of the Sigfox end-point library RF API used by the host tests.
+
+/*!******************************************************************
+ * \enum RF_API_status_t
+ * \brief RF API error codes.
+ *******************************************************************/
+typedef enum {
+    RF_API_SUCCESS = 0,
+    RF_API_ERROR
+} RF_API_status_t;
+
+/*!******************************************************************
+ * \fn RF_API_process_cb_t
+ * \brief RF API process callback.
+ *******************************************************************/
+typedef void (*RF_API_process_cb_t)(void);
+
+/*!******************************************************************
+ * \fn RF_API_error_cb_t
+ * \brief RF API error callback.
+ *******************************************************************/
+typedef void (*RF_API_error_cb_t)(void);
+
+/*!******************************************************************
+ * \fn RF_API_tx_cplt_cb_t
+ * \brief RF API transmission completion callback.
+ *******************************************************************/
+typedef void (*RF_API_tx_cplt_cb_t)(void);
+
+/*!******************************************************************
+ * \fn RF_API_rx_data_received_cb_t
+ * \brief RF API reception callback.
+ *******************************************************************/
+typedef void (*RF_API_rx_data_received_cb_t)(void);
+
+/*!******************************************************************
+ * \enum RF_API_mode_t
+ * \brief RF modes list.
+ *******************************************************************/
+typedef enum {
+    RF_API_MODE_TX = 0,
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    RF_API_MODE_RX,
+#endif
+    RF_API_MODE_LAST
+} RF_API_mode_t;
+
+/*!******************************************************************
+ * \enum RF_API_modulation_t
+ * \brief RF modulations list.
+ *******************************************************************/
+typedef enum {
+    RF_API_MODULATION_NONE = 0,
+    RF_API_MODULATION_DBPSK,
+    RF_API_MODULATION_GFSK,
+    RF_API_MODULATION_LAST
+} RF_API_modulation_t;
+
+/*!******************************************************************
+ * \struct RF_API_config_t
+ * \brief RF API configuration structure.
+ *******************************************************************/
+typedef struct {
+    const void* rc;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    RF_API_process_cb_t process_cb;
+    RF_API_error_cb_t error_cb;
+#endif
+} RF_API_config_t;
+
+/*!******************************************************************
+ * \struct RF_API_radio_parameters_t
+ * \brief Radio parameters structure.
+ *******************************************************************/
+typedef struct {
+    RF_API_mode_t rf_mode;
+    sfx_u32 frequency_hz;
+    RF_API_modulation_t modulation;
+    sfx_u16 bit_rate_bps;
+    sfx_s8 tx_power_dbm_eirp;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    sfx_u32 deviation_hz;
+#endif
+} RF_API_radio_parameters_t;
+
+/*!******************************************************************
+ * \struct RF_API_tx_data_t
+ * \brief RF API transmission data.
+ *******************************************************************/
+typedef struct {
+    sfx_u8* bitstream;
+    sfx_u8 bitstream_size_bytes;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    RF_API_tx_cplt_cb_t cplt_cb;
+#endif
+} RF_API_tx_data_t;
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*!******************************************************************
+ * \struct RF_API_rx_data_t
+ * \brief RF API reception data.
+ *******************************************************************/
+typedef struct {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    RF_API_rx_data_received_cb_t data_received_cb;
+#else
+    sfx_bool data_received;
+#endif
+} RF_API_rx_data_t;
+#endif
+
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
+/*!******************************************************************
+ * \enum RF_API_latency_t
+ * \brief RF API latency sources.
+ *******************************************************************/
+typedef enum {
+    RF_API_LATENCY_WAKE_UP = 0,
+    RF_API_LATENCY_INIT_TX,
+    RF_API_LATENCY_SEND_START,
+    RF_API_LATENCY_SEND_STOP,
+    RF_API_LATENCY_DE_INIT_TX,
+    RF_API_LATENCY_SLEEP,
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    RF_API_LATENCY_INIT_RX,
+    RF_API_LATENCY_RECEIVE_START,
+    RF_API_LATENCY_RECEIVE_STOP,
+    RF_API_LATENCY_DE_INIT_RX,
+#endif
+    RF_API_LATENCY_LAST
+} RF_API_latency_t;
+#endif
+
+/*** RF API functions ***/
+
+#if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
+RF_API_status_t RF_API_open(RF_API_config_t* rf_api_config);
+#endif
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+RF_API_status_t RF_API_close(void);
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+RF_API_status_t RF_API_process(void);
+#endif
+RF_API_status_t RF_API_wake_up(void);
+RF_API_status_t RF_API_sleep(void);
+RF_API_status_t RF_API_init(RF_API_radio_parameters_t* radio_parameters);
+RF_API_status_t RF_API_de_init(void);
+RF_API_status_t RF_API_send(RF_API_tx_data_t* tx_data);
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+RF_API_status_t RF_API_receive(RF_API_rx_data_t* rx_data);
+RF_API_status_t RF_API_get_dl_phy_content_and_rssi(sfx_u8* dl_phy_content, sfx_u8 dl_phy_content_size, sfx_s16* dl_rssi_dbm);
+#endif
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
+RF_API_status_t RF_API_get_latency(RF_API_latency_t latency_type, sfx_u32* latency_ms);
+#endif
+#ifdef SIGFOX_EP_CERTIFICATION
+RF_API_status_t RF_API_start_continuous_wave(void);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+void RF_API_error(void);
+#endif
+
+#endif /* __RF_API_H__ */
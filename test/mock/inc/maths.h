@@ -0,0 +1,41 @@
+/*
+ * maths.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MATHS_H__
+#define __MATHS_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** MATH macros ***/
+
+#define MATH_U32_MAX    0xFFFFFFFF
+
+/*** MATH structures ***/
+
+/*!******************************************************************
+ * \enum MATH_status_t
+ * \brief MATH driver error codes.
+ *******************************************************************/
+typedef enum {
+    MATH_SUCCESS = 0,
+    MATH_ERROR_NULL_PARAMETER,
+    MATH_ERROR_BASE_LAST = ERROR_BASE_STEP
+} MATH_status_t;
+
+/*** MATH global variables ***/
+
+extern const uint32_t MATH_POWER_10[10];
+
+/*** MATH functions ***/
+
+/*******************************************************************/
+#define MATH_abs(x, result, type) { \
+    result = (type) (((x) < 0) ? (-(x)) : (x)); \
+}
+
+#endif /* __MATHS_H__ */
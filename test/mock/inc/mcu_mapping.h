@@ -0,0 +1,62 @@
+/*
+ * mcu_mapping.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MCU_MAPPING_H__
+#define __MCU_MAPPING_H__
+
+#include "adc.h"
+#include "dma.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "tim.h"
+#include "usart.h"
+
+/*** MCU MAPPING macros ***/
+
+// Note: MPMCM mapping of the peripherals used by the host tests.
+#define ADC_INSTANCE_ACX_SAMPLING   ADC_INSTANCE_ADC1
+#define ADC_CHANNEL_ACV_SAMPLING    ADC_CHANNEL_IN1
+#define ADC_CHANNEL_ACI1_SAMPLING   ADC_CHANNEL_IN2
+#define ADC_CHANNEL_ACI2_SAMPLING   ADC_CHANNEL_IN3
+#define ADC_CHANNEL_ACI3_SAMPLING   ADC_CHANNEL_IN4
+#define ADC_CHANNEL_ACI4_SAMPLING   ADC_CHANNEL_IN5
+
+#define DMA_INSTANCE_ACV_SAMPLING   DMA_INSTANCE_DMA1
+#define DMA_CHANNEL_ACV_SAMPLING    DMA_CHANNEL_1
+#define DMA_INSTANCE_ACI_SAMPLING   DMA_INSTANCE_DMA1
+#define DMA_CHANNEL_ACI_SAMPLING    DMA_CHANNEL_2
+#define DMA_INSTANCE_ACV_FREQUENCY  DMA_INSTANCE_DMA1
+#define DMA_CHANNEL_ACV_FREQUENCY   DMA_CHANNEL_3
+
+#define TIM_INSTANCE_ADC_TRIGGER    TIM_INSTANCE_TIM6
+#define TIM_INSTANCE_SIMULATION     TIM_INSTANCE_TIM15
+#define TIM_INSTANCE_ACV_FREQUENCY  TIM_INSTANCE_TIM2
+#define TIM_CHANNEL_ACV_FREQUENCY   TIM_CHANNEL_1
+
+// Note: UHFM mapping of the Sigfox timer.
+#define TIM_INSTANCE_MCU_API        TIM_INSTANCE_TIM2
+
+// Note: GPSM mapping of the GPS UART.
+#define USART_INSTANCE_GPS          USART_INSTANCE_USART2
+#define DMA_INSTANCE_GPS_RX         DMA_INSTANCE_DMA1
+#define DMA_CHANNEL_GPS_RX          DMA_CHANNEL_5
+
+/*** MCU MAPPING global variables ***/
+
+extern const ADC_gpio_t ADC_GPIO;
+extern const LPUART_gpio_t LPUART_GPIO_RS485;
+extern const TIM_gpio_t TIM_GPIO_ACV_FREQUENCY;
+extern const GPIO_pin_t GPIO_ZERO_CROSS_PULSE;
+extern const GPIO_pin_t GPIO_ACI1_DETECT;
+extern const GPIO_pin_t GPIO_ACI2_DETECT;
+extern const GPIO_pin_t GPIO_ACI3_DETECT;
+extern const GPIO_pin_t GPIO_ACI4_DETECT;
+extern const GPIO_pin_t GPIO_S2LP_GPIO0;
+extern const USART_gpio_t USART_GPIO_GPS;
+extern const GPIO_pin_t GPIO_GPS_VBCKP;
+
+#endif /* __MCU_MAPPING_H__ */
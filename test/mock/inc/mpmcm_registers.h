@@ -0,0 +1,118 @@
+/*
+ * mpmcm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MPMCM_REGISTERS_H__
+#define __MPMCM_REGISTERS_H__
+
+#include "common_registers.h"
+#include "una.h"
+
+#ifdef MPMCM
+
+/*** MPMCM registers ***/
+
+// Note: reduced map of the dinfox-registers submodule for host tests.
+// It includes the harmonics, reactive power and waveform capture registers which are not yet part of the submodule.
+#define MPMCM_NUMBER_OF_REGISTERS_PER_DATA              16
+#define MPMCM_NUMBER_OF_REGISTERS_PER_HARMONICS_DATA    8
+#define MPMCM_NUMBER_OF_CAPTURE_DATA_REGISTERS          8
+
+typedef enum {
+    MPMCM_REGISTER_ADDRESS_FLAGS_1 = COMMON_REGISTER_ADDRESS_LAST,
+    MPMCM_REGISTER_ADDRESS_FLAGS_2,
+    MPMCM_REGISTER_ADDRESS_CONFIGURATION_0,
+    MPMCM_REGISTER_ADDRESS_CONFIGURATION_1,
+    MPMCM_REGISTER_ADDRESS_CONFIGURATION_2,
+    MPMCM_REGISTER_ADDRESS_CONFIGURATION_3,
+    MPMCM_REGISTER_ADDRESS_STATUS_1,
+    MPMCM_REGISTER_ADDRESS_CAPTURE_STATUS,
+    MPMCM_REGISTER_ADDRESS_CONTROL_1,
+    MPMCM_REGISTER_ADDRESS_CAPTURE_CONTROL,
+    MPMCM_REGISTER_ADDRESS_MAINS_FREQUENCY_0,
+    MPMCM_REGISTER_ADDRESS_MAINS_FREQUENCY_1,
+    MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0,
+    MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_1,
+    MPMCM_REGISTER_ADDRESS_CH1_RMS_VOLTAGE_0,
+    MPMCM_REGISTER_ADDRESS_CH1_RMS_VOLTAGE_1,
+    MPMCM_REGISTER_ADDRESS_CH1_RMS_CURRENT_0,
+    MPMCM_REGISTER_ADDRESS_CH1_RMS_CURRENT_1,
+    MPMCM_REGISTER_ADDRESS_CH1_APPARENT_POWER_0,
+    MPMCM_REGISTER_ADDRESS_CH1_APPARENT_POWER_1,
+    MPMCM_REGISTER_ADDRESS_CH1_POWER_FACTOR_0,
+    MPMCM_REGISTER_ADDRESS_CH1_POWER_FACTOR_1,
+    MPMCM_REGISTER_ADDRESS_CH1_ENERGY,
+    MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_0,
+    MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_1,
+    MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_0,
+    MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_1,
+    MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_ENERGY,
+    // Channels 2 to 4 and Linky TIC.
+    MPMCM_REGISTER_ADDRESS_ACV_THD_0 = (MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0 + (5 * MPMCM_NUMBER_OF_REGISTERS_PER_DATA)),
+    MPMCM_REGISTER_ADDRESS_ACV_THD_1,
+    MPMCM_REGISTER_ADDRESS_ACV_H3_0,
+    MPMCM_REGISTER_ADDRESS_ACV_H3_1,
+    MPMCM_REGISTER_ADDRESS_ACV_H5_0,
+    MPMCM_REGISTER_ADDRESS_ACV_H5_1,
+    MPMCM_REGISTER_ADDRESS_ACV_H7_0,
+    MPMCM_REGISTER_ADDRESS_ACV_H7_1,
+    // Current channels 1 to 4.
+    MPMCM_REGISTER_ADDRESS_CAPTURE_DATA_0 = (MPMCM_REGISTER_ADDRESS_ACV_THD_0 + (5 * MPMCM_NUMBER_OF_REGISTERS_PER_HARMONICS_DATA)),
+    MPMCM_REGISTER_ADDRESS_LAST = (MPMCM_REGISTER_ADDRESS_CAPTURE_DATA_0 + MPMCM_NUMBER_OF_CAPTURE_DATA_REGISTERS)
+} MPMCM_register_address_t;
+
+#define MPMCM_REGISTER_FLAGS_1_MASK_AME                             0x00000001
+#define MPMCM_REGISTER_FLAGS_1_MASK_LTE                             0x00000002
+#define MPMCM_REGISTER_FLAGS_1_MASK_LTM                             0x00000004
+#define MPMCM_REGISTER_FLAGS_1_MASK_TRANSFORMER_ATTEN               0x0000FF00
+
+#define MPMCM_REGISTER_FLAGS_2_MASK_CH1_CURRENT_SENSOR_ATTEN        0x000000FF
+#define MPMCM_REGISTER_FLAGS_2_MASK_CH2_CURRENT_SENSOR_ATTEN        0x0000FF00
+#define MPMCM_REGISTER_FLAGS_2_MASK_CH3_CURRENT_SENSOR_ATTEN        0x00FF0000
+#define MPMCM_REGISTER_FLAGS_2_MASK_CH4_CURRENT_SENSOR_ATTEN        0xFF000000
+
+#define MPMCM_REGISTER_CONFIGURATION_0_MASK_TRANSFORMER_GAIN        0x0000FFFF
+
+#define MPMCM_REGISTER_CONFIGURATION_1_MASK_CH1_CURRENT_SENSOR_GAIN 0x0000FFFF
+#define MPMCM_REGISTER_CONFIGURATION_1_MASK_CH2_CURRENT_SENSOR_GAIN 0xFFFF0000
+
+#define MPMCM_REGISTER_CONFIGURATION_2_MASK_CH3_CURRENT_SENSOR_GAIN 0x0000FFFF
+#define MPMCM_REGISTER_CONFIGURATION_2_MASK_CH4_CURRENT_SENSOR_GAIN 0xFFFF0000
+
+#define MPMCM_REGISTER_CONFIGURATION_3_MASK_TIC_SAMPLING_PERIOD     0x000000FF
+
+#define MPMCM_REGISTER_STATUS_1_MASK_MVD                            0x00000010
+#define MPMCM_REGISTER_STATUS_1_MASK_TICD                           0x00000020
+
+#define MPMCM_REGISTER_CAPTURE_STATUS_MASK_CAPR                     0x00000001
+#define MPMCM_REGISTER_CAPTURE_STATUS_MASK_NUMBER_OF_SAMPLES        0xFFFF0000
+
+#define MPMCM_REGISTER_CONTROL_1_MASK_FRQS                          0x00000020
+#define MPMCM_REGISTER_CONTROL_1_MASK_HRMS                          0x00000040
+
+#define MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CAPS                    0x00000001
+#define MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CHANNEL                 0x00000006
+#define MPMCM_REGISTER_CAPTURE_CONTROL_MASK_NUMBER_OF_PERIODS       0x0000FF00
+#define MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CHUNK_INDEX             0xFFFF0000
+
+#define MPMCM_REGISTER_MASK_RUN                                     0x0000FFFF
+#define MPMCM_REGISTER_MASK_MEAN                                    0xFFFF0000
+#define MPMCM_REGISTER_MASK_MIN                                     0x0000FFFF
+#define MPMCM_REGISTER_MASK_MAX                                     0xFFFF0000
+
+#define MPMCM_REGISTER_MASK_ACTIVE_ENERGY                           0x0000FFFF
+#define MPMCM_REGISTER_MASK_APPARENT_ENERGY                         0xFFFF0000
+#define MPMCM_REGISTER_MASK_REACTIVE_ENERGY                         0x0000FFFF
+
+#define MPMCM_REGISTER_CAPTURE_DATA_MASK_ACV                        0x0000FFFF
+#define MPMCM_REGISTER_CAPTURE_DATA_MASK_ACI                        0xFFFF0000
+
+extern const UNA_register_access_t MPMCM_REGISTER_ACCESS[MPMCM_REGISTER_ADDRESS_LAST];
+extern const uint32_t MPMCM_REGISTER_ERROR_VALUE[MPMCM_REGISTER_ADDRESS_LAST];
+
+#endif /* MPMCM */
+
+#endif /* __MPMCM_REGISTERS_H__ */
@@ -0,0 +1,158 @@
+/*
+ * neom8x.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_H__
+#define __NEOM8X_H__
+
+#include "error.h"
+#include "neom8x_driver_flags.h"
+#include "types.h"
+
+/*** NEOM8X structures ***/
+
+/*!******************************************************************
+ * \enum NEOM8X_status_t
+ * \brief NEOM8X driver error codes.
+ *******************************************************************/
+typedef enum {
+    NEOM8X_SUCCESS = 0,
+    NEOM8X_ERROR_NULL_PARAMETER,
+    // Low level drivers errors.
+    NEOM8X_ERROR_BASE_GPIO = ERROR_BASE_STEP,
+    NEOM8X_ERROR_BASE_UART = (NEOM8X_ERROR_BASE_GPIO + NEOM8X_DRIVER_GPIO_ERROR_BASE_LAST),
+    NEOM8X_ERROR_BASE_DELAY = (NEOM8X_ERROR_BASE_UART + NEOM8X_DRIVER_UART_ERROR_BASE_LAST),
+    // Last base value.
+    NEOM8X_ERROR_BASE_LAST = (NEOM8X_ERROR_BASE_DELAY + NEOM8X_DRIVER_DELAY_ERROR_BASE_LAST)
+} NEOM8X_status_t;
+
+/*!******************************************************************
+ * \enum NEOM8X_gps_data_t
+ * \brief GPS data types list.
+ *******************************************************************/
+typedef enum {
+    NEOM8X_GPS_DATA_TIME = 0,
+    NEOM8X_GPS_DATA_POSITION,
+    NEOM8X_GPS_DATA_LAST
+} NEOM8X_gps_data_t;
+
+/*!******************************************************************
+ * \enum NEOM8X_acquisition_status_t
+ * \brief GPS acquisition status.
+ *******************************************************************/
+typedef enum {
+    NEOM8X_ACQUISITION_STATUS_FAIL = 0,
+    NEOM8X_ACQUISITION_STATUS_FOUND,
+    NEOM8X_ACQUISITION_STATUS_STABLE,
+    NEOM8X_ACQUISITION_STATUS_LAST
+} NEOM8X_acquisition_status_t;
+
+/*!******************************************************************
+ * \fn NEOM8X_process_cb_t
+ * \brief NMEA sentence reception callback.
+ *******************************************************************/
+typedef void (*NEOM8X_process_cb_t)(void);
+
+/*!******************************************************************
+ * \fn NEOM8X_completion_cb_t
+ * \brief NMEA sentence decoding completion callback.
+ *******************************************************************/
+typedef void (*NEOM8X_completion_cb_t)(NEOM8X_acquisition_status_t acquisition_status);
+
+/*!******************************************************************
+ * \struct NEOM8X_acquisition_t
+ * \brief GPS acquisition parameters.
+ *******************************************************************/
+typedef struct {
+    NEOM8X_gps_data_t gps_data;
+    NEOM8X_completion_cb_t completion_callback;
+    NEOM8X_process_cb_t process_callback;
+} NEOM8X_acquisition_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_time_t
+ * \brief GPS time structure.
+ *******************************************************************/
+typedef struct {
+    uint16_t year;
+    uint8_t month;
+    uint8_t date;
+    uint8_t hours;
+    uint8_t minutes;
+    uint8_t seconds;
+} NEOM8X_time_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_position_t
+ * \brief GPS position structure.
+ *******************************************************************/
+typedef struct {
+    uint8_t lat_degrees;
+    uint8_t lat_minutes;
+    uint32_t lat_seconds;
+    uint8_t lat_north_flag;
+    uint8_t long_degrees;
+    uint8_t long_minutes;
+    uint32_t long_seconds;
+    uint8_t long_east_flag;
+    uint32_t altitude;
+} NEOM8X_position_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_timepulse_configuration_t
+ * \brief Timepulse parameters structure.
+ *******************************************************************/
+typedef struct {
+    uint8_t active;
+    uint32_t frequency_hz;
+    uint8_t duty_cycle_percent;
+} NEOM8X_timepulse_configuration_t;
+
+/*** NEOM8X functions ***/
+
+NEOM8X_status_t NEOM8X_init(void);
+NEOM8X_status_t NEOM8X_de_init(void);
+NEOM8X_status_t NEOM8X_start_acquisition(NEOM8X_acquisition_t* acquisition);
+NEOM8X_status_t NEOM8X_stop_acquisition(void);
+NEOM8X_status_t NEOM8X_process(void);
+NEOM8X_status_t NEOM8X_get_time(NEOM8X_time_t* gps_time);
+NEOM8X_status_t NEOM8X_get_position(NEOM8X_position_t* gps_position);
+NEOM8X_status_t NEOM8X_set_backup_voltage(uint8_t state);
+uint8_t NEOM8X_get_backup_voltage(void);
+NEOM8X_status_t NEOM8X_set_timepulse(NEOM8X_timepulse_configuration_t* configuration);
+
+/*** NEOM8X mock functions ***/
+
+/*!******************************************************************
+ * \fn void NEOM8X_MOCK_receive_sentence(NEOM8X_acquisition_status_t acquisition_status, NEOM8X_time_t* gps_time, NEOM8X_position_t* gps_position)
+ * \brief Emulate the reception of a NMEA sentence: the process callback is called and the sentence is decoded by the next NEOM8X_process() call.
+ * \param[in]   acquisition_status: Acquisition status reported by the decoding.
+ * \param[in]   gps_time: Pointer to the decoded time, NULL to keep the previous one.
+ * \param[in]   gps_position: Pointer to the decoded position, NULL to keep the previous one.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_MOCK_receive_sentence(NEOM8X_acquisition_status_t acquisition_status, NEOM8X_time_t* gps_time, NEOM8X_position_t* gps_position);
+
+/*!******************************************************************
+ * \fn uint8_t NEOM8X_MOCK_is_acquisition_running(void)
+ * \brief Check if the NMEA acquisition is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if the acquisition is running, 0 otherwise.
+ *******************************************************************/
+uint8_t NEOM8X_MOCK_is_acquisition_running(void);
+
+/*******************************************************************/
+#define NEOM8X_exit_error(base) { ERROR_check_exit(neom8x_status, NEOM8X_SUCCESS, base) }
+
+/*******************************************************************/
+#define NEOM8X_stack_error(base) { ERROR_check_stack(neom8x_status, NEOM8X_SUCCESS, base) }
+
+/*******************************************************************/
+#define NEOM8X_stack_exit_error(base, code) { ERROR_check_stack_exit(neom8x_status, NEOM8X_SUCCESS, base, code) }
+
+#endif /* __NEOM8X_H__ */
@@ -0,0 +1,74 @@
+/*
+ * neom8x_hw.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_HW_H__
+#define __NEOM8X_HW_H__
+
+#include "neom8x.h"
+#include "types.h"
+
+/*** NEOM8X HW structures ***/
+
+/*!******************************************************************
+ * \fn NEOM8X_HW_rx_irq_cb_t
+ * \brief Byte reception interrupt callback.
+ *******************************************************************/
+typedef void (*NEOM8X_HW_rx_irq_cb_t)(uint8_t data);
+
+/*!******************************************************************
+ * \struct NEOM8X_HW_configuration_t
+ * \brief NEOM8X hardware interface parameters.
+ *******************************************************************/
+typedef struct {
+    uint32_t uart_baud_rate;
+    NEOM8X_HW_rx_irq_cb_t rx_irq_callback;
+} NEOM8X_HW_configuration_t;
+
+/*** NEOM8X HW functions ***/
+
+NEOM8X_status_t NEOM8X_HW_init(NEOM8X_HW_configuration_t* configuration);
+NEOM8X_status_t NEOM8X_HW_de_init(void);
+NEOM8X_status_t NEOM8X_HW_send_message(uint8_t* message, uint32_t message_size_bytes);
+NEOM8X_status_t NEOM8X_HW_start_rx(void);
+NEOM8X_status_t NEOM8X_HW_stop_rx(void);
+NEOM8X_status_t NEOM8X_HW_delay_milliseconds(uint32_t delay_ms);
+NEOM8X_status_t NEOM8X_HW_set_backup_voltage(uint8_t state);
+uint8_t NEOM8X_HW_get_backup_voltage(void);
+
+/*** NEOM8X HW mock functions ***/
+
+// Note: the following functions are only available with the mocked hardware interface (the real one is built with GPSM_UART_DMA).
+
+/*!******************************************************************
+ * \fn void NEOM8X_HW_MOCK_receive(uint8_t* data, uint32_t data_size_bytes)
+ * \brief Emulate the reception of bytes on the GPS UART.
+ * \param[in]   data: Received bytes.
+ * \param[in]   data_size_bytes: Number of received bytes.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_HW_MOCK_receive(uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn uint32_t NEOM8X_HW_MOCK_get_sent_messages(uint8_t** messages)
+ * \brief Read the bytes sent on the GPS UART since the last reception stop.
+ * \param[in]   none
+ * \param[out]  messages: Pointer to the sent bytes buffer.
+ * \retval      Number of sent bytes.
+ *******************************************************************/
+uint32_t NEOM8X_HW_MOCK_get_sent_messages(uint8_t** messages);
+
+/*!******************************************************************
+ * \fn uint8_t NEOM8X_HW_MOCK_is_rx_running(void)
+ * \brief Check if the GPS UART reception is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if the reception is running, 0 otherwise.
+ *******************************************************************/
+uint8_t NEOM8X_HW_MOCK_is_rx_running(void);
+
+#endif /* __NEOM8X_HW_H__ */
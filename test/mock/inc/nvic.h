@@ -0,0 +1,19 @@
+/*
+ * nvic.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NVIC_H__
+#define __NVIC_H__
+
+#include "types.h"
+
+/*** NVIC functions ***/
+
+// Note: interrupts are emulated by direct callback calls on host.
+#define NVIC_enable_interrupt(irq_index, priority)
+#define NVIC_disable_interrupt(irq_index)
+
+#endif /* __NVIC_H__ */
@@ -0,0 +1,88 @@
+/*
+ * nvm.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NVM_H__
+#define __NVM_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** NVM structures ***/
+
+/*!******************************************************************
+ * \enum NVM_status_t
+ * \brief NVM driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    NVM_SUCCESS = 0,
+    NVM_ERROR_NULL_PARAMETER,
+    NVM_ERROR_ADDRESS,
+    // Last base value.
+    NVM_ERROR_BASE_LAST = ERROR_BASE_STEP
+} NVM_status_t;
+
+/*** NVM functions ***/
+
+NVM_status_t NVM_read_byte(uint32_t address, uint8_t* data);
+NVM_status_t NVM_write_byte(uint32_t address, uint8_t data);
+NVM_status_t NVM_read_word(uint32_t address, uint32_t* data);
+NVM_status_t NVM_write_word(uint32_t address, uint32_t data);
+
+/*** NVM mock functions ***/
+
+// Note: the memory is addressed by bytes on STM32L0 (data EEPROM) and by words on STM32G4 (flash emulation).
+#define NVM_MOCK_SIZE_BYTES                 4096
+// Note: each programming operation moves the emulated SysTick counter by the typical data EEPROM programming time (3.2ms at 16MHz).
+#define NVM_MOCK_PROGRAMMING_TIME_CYCLES    51200
+
+/*!******************************************************************
+ * \fn void NVM_MOCK_erase(void)
+ * \brief Erase the whole memory (all bytes read as 0x00, like the data EEPROM).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NVM_MOCK_erase(void);
+
+/*!******************************************************************
+ * \fn uint32_t NVM_MOCK_get_write_count(void)
+ * \brief Get the number of byte or word programming operations since the last erase.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of write operations.
+ *******************************************************************/
+uint32_t NVM_MOCK_get_write_count(void);
+
+/*!******************************************************************
+ * \fn uint32_t NVM_MOCK_get_read_count(void)
+ * \brief Get the number of byte or word read operations since the last erase.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of read operations.
+ *******************************************************************/
+uint32_t NVM_MOCK_get_read_count(void);
+
+/*!******************************************************************
+ * \fn void NVM_MOCK_set_power_loss(uint32_t remaining_write_count)
+ * \brief Emulate a power loss: writes are ignored after the given number of operations.
+ * \param[in]   remaining_write_count: Number of writes to perform before the power loss (0 to disable).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NVM_MOCK_set_power_loss(uint32_t remaining_write_count);
+
+/*******************************************************************/
+#define NVM_exit_error(base) { ERROR_check_exit(nvm_status, NVM_SUCCESS, base) }
+
+/*******************************************************************/
+#define NVM_stack_error(base) { ERROR_check_stack(nvm_status, NVM_SUCCESS, base) }
+
+/*******************************************************************/
+#define NVM_stack_exit_error(base, code) { ERROR_check_stack_exit(nvm_status, NVM_SUCCESS, base, code) }
+
+#endif /* __NVM_H__ */
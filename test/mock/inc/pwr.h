@@ -0,0 +1,28 @@
+/*
+ * pwr.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __PWR_H__
+#define __PWR_H__
+
+#include "types.h"
+
+/*** PWR functions ***/
+
+void PWR_software_reset(void);
+
+/*** PWR mock functions ***/
+
+/*!******************************************************************
+ * \fn uint32_t PWR_MOCK_get_reset_count(void)
+ * \brief Get the number of software reset requests.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of reset requests.
+ *******************************************************************/
+uint32_t PWR_MOCK_get_reset_count(void);
+
+#endif /* __PWR_H__ */
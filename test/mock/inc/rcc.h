@@ -0,0 +1,89 @@
+/*
+ * rcc.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RCC_H__
+#define __RCC_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** RCC structures ***/
+
+/*!******************************************************************
+ * \enum RCC_status_t
+ * \brief RCC driver error codes.
+ *******************************************************************/
+typedef enum {
+    RCC_SUCCESS = 0,
+    RCC_ERROR_NULL_PARAMETER,
+    RCC_ERROR_BASE_LAST = ERROR_BASE_STEP
+} RCC_status_t;
+
+/*!******************************************************************
+ * \enum RCC_clock_t
+ * \brief RCC clock sources.
+ *******************************************************************/
+typedef enum {
+    RCC_CLOCK_NONE = 0,
+    RCC_CLOCK_SYSTEM,
+    RCC_CLOCK_HSI,
+    RCC_CLOCK_HSE,
+    RCC_CLOCK_PLL,
+    RCC_CLOCK_LSI,
+    RCC_CLOCK_LSE,
+    RCC_CLOCK_LAST
+} RCC_clock_t;
+
+/*!******************************************************************
+ * \enum RCC_hse_mode_t
+ * \brief RCC HSE modes.
+ *******************************************************************/
+typedef enum {
+    RCC_HSE_MODE_OSCILLATOR = 0,
+    RCC_HSE_MODE_BYPASS,
+    RCC_HSE_MODE_LAST
+} RCC_hse_mode_t;
+
+/*!******************************************************************
+ * \enum RCC_pll_rq_t
+ * \brief RCC PLL R and Q dividers.
+ *******************************************************************/
+typedef enum {
+    RCC_PLL_RQ_2 = 0,
+    RCC_PLL_RQ_4,
+    RCC_PLL_RQ_6,
+    RCC_PLL_RQ_8,
+    RCC_PLL_RQ_LAST
+} RCC_pll_rq_t;
+
+/*!******************************************************************
+ * \struct RCC_pll_configuration_t
+ * \brief RCC PLL configuration.
+ *******************************************************************/
+typedef struct {
+    RCC_clock_t source;
+    RCC_hse_mode_t hse_mode;
+    uint8_t m;
+    uint8_t n;
+    RCC_pll_rq_t r;
+    uint8_t p;
+    RCC_pll_rq_t q;
+} RCC_pll_configuration_t;
+
+/*** RCC functions ***/
+
+RCC_status_t RCC_switch_to_hsi(void);
+RCC_status_t RCC_switch_to_pll(RCC_pll_configuration_t* pll_configuration);
+RCC_status_t RCC_get_frequency_hz(RCC_clock_t clock, uint32_t* frequency_hz);
+
+/*******************************************************************/
+#define RCC_exit_error(base) { ERROR_check_exit(rcc_status, RCC_SUCCESS, base) }
+
+/*******************************************************************/
+#define RCC_stack_error(base) { ERROR_check_stack(rcc_status, RCC_SUCCESS, base) }
+
+#endif /* __RCC_H__ */
@@ -0,0 +1,30 @@
+/*
+ * rcc_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RCC_REGISTERS_H__
+#define __RCC_REGISTERS_H__
+
+#include "types.h"
+
+/*** RCC registers ***/
+
+/*!******************************************************************
+ * \struct RCC_registers_t
+ * \brief RCC registers map (host tests subset).
+ *******************************************************************/
+typedef struct {
+    volatile uint32_t AHBENR;   // STM32L0 family.
+    volatile uint32_t AHB1ENR;  // STM32G4 family.
+} RCC_registers_t;
+
+/*** RCC base address ***/
+
+extern RCC_registers_t rcc_mock_registers;
+
+#define RCC     (&rcc_mock_registers)
+
+#endif /* __RCC_REGISTERS_H__ */
@@ -0,0 +1,67 @@
+/*
+ * rfe.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RFE_H__
+#define __RFE_H__
+
+#include "error.h"
+#include "s2lp.h"
+#include "types.h"
+
+/*** RFE structures ***/
+
+/*!******************************************************************
+ * \enum RFE_status_t
+ * \brief Radio front-end driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    RFE_SUCCESS = 0,
+    RFE_ERROR_PATH,
+    // Low level drivers errors.
+    RFE_ERROR_BASE_S2LP = ERROR_BASE_STEP,
+    // Last base value.
+    RFE_ERROR_BASE_LAST = (RFE_ERROR_BASE_S2LP + S2LP_ERROR_BASE_LAST)
+} RFE_status_t;
+
+/*!******************************************************************
+ * \enum RFE_path_t
+ * \brief Radio front-end paths list.
+ *******************************************************************/
+typedef enum {
+    RFE_PATH_NONE = 0,
+    RFE_PATH_TX,
+    RFE_PATH_RX,
+    RFE_PATH_LAST
+} RFE_path_t;
+
+/*** RFE functions ***/
+
+RFE_status_t RFE_set_path(RFE_path_t radio_path);
+RFE_status_t RFE_get_rssi(S2LP_rssi_t rssi_type, int16_t* rssi_dbm);
+
+/*** RFE mock functions ***/
+
+/*!******************************************************************
+ * \fn RFE_path_t RFE_MOCK_get_path(void)
+ * \brief Get the current radio front-end path.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current radio path.
+ *******************************************************************/
+RFE_path_t RFE_MOCK_get_path(void);
+
+/*******************************************************************/
+#define RFE_exit_error(base) { ERROR_check_exit(rfe_status, RFE_SUCCESS, base) }
+
+/*******************************************************************/
+#define RFE_stack_error(base) { ERROR_check_stack(rfe_status, RFE_SUCCESS, base) }
+
+/*******************************************************************/
+#define RFE_stack_exit_error(base, code) { ERROR_check_stack_exit(rfe_status, RFE_SUCCESS, base, code) }
+
+#endif /* __RFE_H__ */
@@ -0,0 +1,13 @@
+/*
+ * rrm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RRM_REGISTERS_H__
+#define __RRM_REGISTERS_H__
+
+// Note: board not selected in host tests.
+
+#endif /* __RRM_REGISTERS_H__ */
@@ -0,0 +1,41 @@
+/*
+ * rtc.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RTC_H__
+#define __RTC_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** RTC structures ***/
+
+/*!******************************************************************
+ * \enum RTC_status_t
+ * \brief RTC driver error codes.
+ *******************************************************************/
+typedef enum {
+    RTC_SUCCESS = 0,
+    RTC_ERROR_NULL_PARAMETER,
+    RTC_ERROR_BASE_LAST = ERROR_BASE_STEP
+} RTC_status_t;
+
+/*** RTC functions ***/
+
+uint32_t RTC_get_uptime_seconds(void);
+
+/*** RTC mock functions ***/
+
+/*!******************************************************************
+ * \fn void RTC_MOCK_set_uptime_seconds(uint32_t uptime_seconds)
+ * \brief Set the uptime returned by the RTC driver.
+ * \param[in]   uptime_seconds: Uptime in seconds.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void RTC_MOCK_set_uptime_seconds(uint32_t uptime_seconds);
+
+#endif /* __RTC_H__ */
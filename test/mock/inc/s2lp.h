@@ -0,0 +1,314 @@
+/*
+ * s2lp.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __S2LP_H__
+#define __S2LP_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** S2LP macros ***/
+
+#define S2LP_EXIT_SHUTDOWN_DELAY_MS     1
+#define S2LP_FIFO_SIZE_BYTES            128
+
+// Note: size of the symbol stream recorded by the mock, large enough for the longest uplink frame.
+#define S2LP_MOCK_STREAM_SIZE_BYTES     65536
+
+/*** S2LP structures ***/
+
+/*!******************************************************************
+ * \enum S2LP_status_t
+ * \brief S2LP driver error codes.
+ *******************************************************************/
+typedef enum {
+    S2LP_SUCCESS = 0,
+    S2LP_ERROR_NULL_PARAMETER,
+    S2LP_ERROR_STATE,
+    S2LP_ERROR_FIFO,
+    S2LP_ERROR_BASE_LAST = ERROR_BASE_STEP
+} S2LP_status_t;
+
+/*!******************************************************************
+ * \enum S2LP_command_t
+ * \brief S2LP commands list.
+ *******************************************************************/
+typedef enum {
+    S2LP_COMMAND_TX = 0,
+    S2LP_COMMAND_RX,
+    S2LP_COMMAND_READY,
+    S2LP_COMMAND_LOCKRX,
+    S2LP_COMMAND_LOCKTX,
+    S2LP_COMMAND_SABORT,
+    S2LP_COMMAND_SRES,
+    S2LP_COMMAND_FLUSHRXFIFO,
+    S2LP_COMMAND_FLUSHTXFIFO,
+    S2LP_COMMAND_LAST
+} S2LP_command_t;
+
+/*!******************************************************************
+ * \enum S2LP_state_t
+ * \brief S2LP main states.
+ *******************************************************************/
+typedef enum {
+    S2LP_STATE_READY = 0,
+    S2LP_STATE_LOCK,
+    S2LP_STATE_TX,
+    S2LP_STATE_RX,
+    S2LP_STATE_LAST
+} S2LP_state_t;
+
+/*!******************************************************************
+ * \enum S2LP_oscillator_t
+ * \brief S2LP oscillator types.
+ *******************************************************************/
+typedef enum {
+    S2LP_OSCILLATOR_QUARTZ = 0,
+    S2LP_OSCILLATOR_TCXO,
+    S2LP_OSCILLATOR_LAST
+} S2LP_oscillator_t;
+
+/*!******************************************************************
+ * \enum S2LP_modulation_t
+ * \brief S2LP modulations list.
+ *******************************************************************/
+typedef enum {
+    S2LP_MODULATION_2FSK = 0,
+    S2LP_MODULATION_4FSK,
+    S2LP_MODULATION_2GFSK_BT1,
+    S2LP_MODULATION_4GFSK_BT1,
+    S2LP_MODULATION_ASK_OOK,
+    S2LP_MODULATION_POLAR,
+    S2LP_MODULATION_NONE,
+    S2LP_MODULATION_LAST
+} S2LP_modulation_t;
+
+/*!******************************************************************
+ * \enum S2LP_irq_index_t
+ * \brief S2LP interrupts list.
+ *******************************************************************/
+typedef enum {
+    S2LP_IRQ_INDEX_RX_DATA_READY = 0,
+    S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY,
+    S2LP_IRQ_INDEX_LAST
+} S2LP_irq_index_t;
+
+/*!******************************************************************
+ * \enum S2LP_tx_source_t
+ * \brief S2LP TX data sources.
+ *******************************************************************/
+typedef enum {
+    S2LP_TX_SOURCE_NORMAL = 0,
+    S2LP_TX_SOURCE_FIFO,
+    S2LP_TX_SOURCE_LAST
+} S2LP_tx_source_t;
+
+/*!******************************************************************
+ * \enum S2LP_rx_source_t
+ * \brief S2LP RX data destinations.
+ *******************************************************************/
+typedef enum {
+    S2LP_RX_SOURCE_NORMAL = 0,
+    S2LP_RX_SOURCE_FIFO,
+    S2LP_RX_SOURCE_LAST
+} S2LP_rx_source_t;
+
+/*!******************************************************************
+ * \enum S2LP_fifo_threshold_t
+ * \brief S2LP FIFO thresholds list.
+ *******************************************************************/
+typedef enum {
+    S2LP_FIFO_THRESHOLD_RX_FULL = 0,
+    S2LP_FIFO_THRESHOLD_RX_EMPTY,
+    S2LP_FIFO_THRESHOLD_TX_FULL,
+    S2LP_FIFO_THRESHOLD_TX_EMPTY,
+    S2LP_FIFO_THRESHOLD_LAST
+} S2LP_fifo_threshold_t;
+
+/*!******************************************************************
+ * \enum S2LP_gpio_t
+ * \brief S2LP GPIOs list.
+ *******************************************************************/
+typedef enum {
+    S2LP_GPIO0 = 0,
+    S2LP_GPIO1,
+    S2LP_GPIO2,
+    S2LP_GPIO3,
+    S2LP_GPIO_LAST
+} S2LP_gpio_t;
+
+/*!******************************************************************
+ * \enum S2LP_gpio_mode_t
+ * \brief S2LP GPIO modes.
+ *******************************************************************/
+typedef enum {
+    S2LP_GPIO_MODE_IN = 0,
+    S2LP_GPIO_MODE_OUT_LOW_POWER,
+    S2LP_GPIO_MODE_OUT_HIGH_POWER,
+    S2LP_GPIO_MODE_LAST
+} S2LP_gpio_mode_t;
+
+/*!******************************************************************
+ * \enum S2LP_gpio_output_function_t
+ * \brief S2LP GPIO output functions.
+ *******************************************************************/
+typedef enum {
+    S2LP_GPIO_OUTPUT_FUNCTION_NIRQ = 0,
+    S2LP_GPIO_OUTPUT_FUNCTION_LAST
+} S2LP_gpio_output_function_t;
+
+/*!******************************************************************
+ * \enum S2LP_fifo_flag_direction_t
+ * \brief S2LP FIFO flags direction.
+ *******************************************************************/
+typedef enum {
+    S2LP_FIFO_FLAG_DIRECTION_TX = 0,
+    S2LP_FIFO_FLAG_DIRECTION_RX,
+    S2LP_FIFO_FLAG_DIRECTION_LAST
+} S2LP_fifo_flag_direction_t;
+
+/*!******************************************************************
+ * \enum S2LP_rssi_t
+ * \brief S2LP RSSI types.
+ *******************************************************************/
+typedef enum {
+    S2LP_RSSI_TYPE_RUN = 0,
+    S2LP_RSSI_TYPE_SYNC_WORD,
+    S2LP_RSSI_TYPE_LAST
+} S2LP_rssi_t;
+
+/*!******************************************************************
+ * \enum S2LP_afc_mode_t
+ * \brief S2LP AFC modes.
+ *******************************************************************/
+typedef enum {
+    S2LP_AFC_MODE_DISABLE = 0,
+    S2LP_AFC_MODE_ENABLE,
+    S2LP_AFC_MODE_LAST
+} S2LP_afc_mode_t;
+
+/*!******************************************************************
+ * \enum S2LP_preamble_pattern_t
+ * \brief S2LP preamble patterns.
+ *******************************************************************/
+typedef enum {
+    S2LP_PREAMBLE_PATTERN_0101 = 0,
+    S2LP_PREAMBLE_PATTERN_1010,
+    S2LP_PREAMBLE_PATTERN_LAST
+} S2LP_preamble_pattern_t;
+
+/*!******************************************************************
+ * \enum S2LP_crc_mode_t
+ * \brief S2LP CRC modes.
+ *******************************************************************/
+typedef enum {
+    S2LP_CRC_MODE_DISABLED = 0,
+    S2LP_CRC_MODE_LAST
+} S2LP_crc_mode_t;
+
+/*!******************************************************************
+ * \struct S2LP_MOCK_statistics_t
+ * \brief S2LP mock statistics.
+ *******************************************************************/
+typedef struct {
+    uint32_t spi_transaction_count;
+    uint32_t fifo_write_count;
+    uint32_t irq_clear_count;
+    uint32_t missed_irq_count;
+    uint32_t fifo_error_count;
+    uint32_t transmitted_size_bytes;
+} S2LP_MOCK_statistics_t;
+
+/*** S2LP functions ***/
+
+// Note: each function emulates one SPI transaction.
+S2LP_status_t S2LP_shutdown(uint8_t shutdown_enable);
+S2LP_status_t S2LP_send_command(S2LP_command_t command);
+S2LP_status_t S2LP_wait_for_state(S2LP_state_t new_state);
+S2LP_status_t S2LP_set_oscillator(S2LP_oscillator_t oscillator);
+S2LP_status_t S2LP_wait_for_oscillator(void);
+S2LP_status_t S2LP_set_common_configuration(void);
+S2LP_status_t S2LP_set_rf_frequency(uint32_t frequency_hz);
+S2LP_status_t S2LP_set_rf_output_power(int8_t output_power_dbm);
+S2LP_status_t S2LP_set_modulation(S2LP_modulation_t modulation);
+S2LP_status_t S2LP_set_datarate(uint32_t datarate_bps);
+S2LP_status_t S2LP_set_fsk_deviation(uint32_t deviation_hz);
+S2LP_status_t S2LP_set_smps_frequency(uint32_t frequency_hz);
+S2LP_status_t S2LP_configure_gpio(S2LP_gpio_t gpio, S2LP_gpio_mode_t mode, S2LP_gpio_output_function_t output_function, S2LP_fifo_flag_direction_t fifo_flag_direction);
+S2LP_status_t S2LP_configure_irq(S2LP_irq_index_t irq_index, uint8_t irq_enable);
+S2LP_status_t S2LP_disable_all_irq(void);
+S2LP_status_t S2LP_get_irq_flag(S2LP_irq_index_t irq_index, uint8_t* irq_flag);
+S2LP_status_t S2LP_clear_all_irq(void);
+S2LP_status_t S2LP_set_fifo_threshold(S2LP_fifo_threshold_t fifo_threshold, uint8_t threshold_value);
+S2LP_status_t S2LP_set_tx_source(S2LP_tx_source_t tx_source);
+S2LP_status_t S2LP_write_fifo(uint8_t* tx_data, uint8_t tx_data_size);
+S2LP_status_t S2LP_set_rx_source(S2LP_rx_source_t rx_source);
+S2LP_status_t S2LP_set_rx_bandwidth(uint32_t rxbw_hz, S2LP_afc_mode_t afc_mode);
+S2LP_status_t S2LP_set_rssi_threshold(int16_t rssi_threshold_dbm);
+S2LP_status_t S2LP_set_preamble_detector(uint8_t preamble_length_2bits, S2LP_preamble_pattern_t preamble_pattern);
+S2LP_status_t S2LP_set_sync_word(uint8_t* sync_word, uint8_t sync_word_size_bits);
+S2LP_status_t S2LP_set_packet_format(uint8_t packet_length_bytes, S2LP_crc_mode_t crc_mode);
+S2LP_status_t S2LP_read_fifo(uint8_t* rx_data, uint8_t rx_data_size);
+
+/*** S2LP mock functions ***/
+
+/*!******************************************************************
+ * \fn void S2LP_MOCK_reset(void)
+ * \brief Reset the transceiver model, the recorded stream and the statistics.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void S2LP_MOCK_reset(void);
+
+/*!******************************************************************
+ * \fn void S2LP_MOCK_transmit(uint8_t size_bytes)
+ * \brief Emulate the transmission of FIFO bytes by the radio.
+ * \brief The nIRQ pin is asserted on the TX FIFO almost empty threshold crossing, and released when the IRQ status is cleared.
+ * \param[in]   size_bytes: Number of bytes to transmit.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void S2LP_MOCK_transmit(uint8_t size_bytes);
+
+/*!******************************************************************
+ * \fn S2LP_state_t S2LP_MOCK_get_state(void)
+ * \brief Get the transceiver state.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current transceiver state.
+ *******************************************************************/
+S2LP_state_t S2LP_MOCK_get_state(void);
+
+/*!******************************************************************
+ * \fn uint8_t* S2LP_MOCK_get_stream(uint32_t* stream_size_bytes)
+ * \brief Get the samples written in the TX FIFO since the last reset.
+ * \param[in]   none
+ * \param[out]  stream_size_bytes: Pointer to the number of recorded samples.
+ * \retval      Recorded samples.
+ *******************************************************************/
+uint8_t* S2LP_MOCK_get_stream(uint32_t* stream_size_bytes);
+
+/*!******************************************************************
+ * \fn void S2LP_MOCK_get_statistics(S2LP_MOCK_statistics_t* statistics)
+ * \brief Get the transceiver model statistics.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the statistics.
+ * \retval      none
+ *******************************************************************/
+void S2LP_MOCK_get_statistics(S2LP_MOCK_statistics_t* statistics);
+
+/*******************************************************************/
+#define S2LP_exit_error(base) { ERROR_check_exit(s2lp_status, S2LP_SUCCESS, base) }
+
+/*******************************************************************/
+#define S2LP_stack_error(base) { ERROR_check_stack(s2lp_status, S2LP_SUCCESS, base) }
+
+/*******************************************************************/
+#define S2LP_stack_exit_error(base, code) { ERROR_check_stack_exit(s2lp_status, S2LP_SUCCESS, base, code) }
+
+#endif /* __S2LP_H__ */
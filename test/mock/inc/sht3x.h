@@ -0,0 +1,22 @@
+/*
+ * sht3x.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SHT3X_H__
+#define __SHT3X_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** SHT3X structures ***/
+
+// Note: status only, the driver is not used by host tests.
+typedef enum {
+    SHT3X_SUCCESS = 0,
+    SHT3X_ERROR_BASE_LAST = ERROR_BASE_STEP
+} SHT3X_status_t;
+
+#endif /* __SHT3X_H__ */
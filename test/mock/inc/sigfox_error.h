@@ -0,0 +1,26 @@
+/*
+ * sigfox_error.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SIGFOX_ERROR_H__
+#define __SIGFOX_ERROR_H__
+
+#include "sigfox_types.h"
+
+/*** SIGFOX ERROR macros ***/
+
+// Note: the host tests are always built with SIGFOX_EP_ERROR_CODES, the library error stack is not emulated.
+
+/*******************************************************************/
+#define SIGFOX_EXIT_ERROR(error) { status = error; goto errors; }
+
+/*******************************************************************/
+#define SIGFOX_CHECK_STATUS(success) { if (status != success) goto errors; }
+
+/*******************************************************************/
+#define SIGFOX_RETURN() { return status; }
+
+#endif /* __SIGFOX_ERROR_H__ */
@@ -0,0 +1,60 @@
+/*
+ * sigfox_types.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SIGFOX_TYPES_H__
+#define __SIGFOX_TYPES_H__
+
+#include "types.h"
+
+/*** SIGFOX TYPES macros ***/
+
+// Note: subset of the Sigfox end-point library definitions used by the host tests.
+#define SIGFOX_NULL                         ((void*) 0)
+#define SIGFOX_UNUSED(x)                    ((void) (x))
+
+#define SIGFOX_EP_ID_SIZE_BYTES             4
+#define SIGFOX_EP_KEY_SIZE_BYTES            16
+
+#define SIGFOX_UL_BITSTREAM_SIZE_BYTES      40
+
+#define SIGFOX_DL_FT                        { 0xB2, 0x27 }
+#define SIGFOX_DL_FT_SIZE_BYTES             2
+#define SIGFOX_DL_PHY_CONTENT_SIZE_BYTES    15
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+#define SIGFOX_EP_TIMER_REQUIRED
+#endif
+
+/*** SIGFOX TYPES structures ***/
+
+typedef uint8_t sfx_u8;
+typedef int8_t sfx_s8;
+typedef uint16_t sfx_u16;
+typedef int16_t sfx_s16;
+typedef uint32_t sfx_u32;
+typedef int32_t sfx_s32;
+
+/*!******************************************************************
+ * \enum sfx_bool
+ * \brief Sigfox boolean type.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_FALSE = 0,
+    SIGFOX_TRUE
+} sfx_bool;
+
+/*!******************************************************************
+ * \enum SIGFOX_ep_key_t
+ * \brief Sigfox end-point keys list.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_KEY_PRIVATE = 0,
+    SIGFOX_EP_KEY_PUBLIC,
+    SIGFOX_EP_KEY_LAST
+} SIGFOX_ep_key_t;
+
+#endif /* __SIGFOX_TYPES_H__ */
@@ -0,0 +1,28 @@
+/*
+ * sm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SM_REGISTERS_H__
+#define __SM_REGISTERS_H__
+
+#include "common_registers.h"
+#include "una.h"
+
+/*** SM registers ***/
+
+// Note: reduced map of the dinfox-registers submodule for host tests.
+// The number of registers is chosen above 32 to cover multiple words flags, and fills the data EEPROM registers area (0x40 to 0x100).
+#define SM_NUMBER_OF_SPECIFIC_REGISTERS     39
+
+typedef enum {
+    SM_REGISTER_ADDRESS_CONFIGURATION_0 = COMMON_REGISTER_ADDRESS_LAST,
+    SM_REGISTER_ADDRESS_LAST = (COMMON_REGISTER_ADDRESS_LAST + SM_NUMBER_OF_SPECIFIC_REGISTERS)
+} SM_register_address_t;
+
+extern const UNA_register_access_t SM_REGISTER_ACCESS[SM_REGISTER_ADDRESS_LAST];
+extern const uint32_t SM_REGISTER_ERROR_VALUE[SM_REGISTER_ADDRESS_LAST];
+
+#endif /* __SM_REGISTERS_H__ */
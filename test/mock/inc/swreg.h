@@ -0,0 +1,19 @@
+/*
+ * swreg.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SWREG_H__
+#define __SWREG_H__
+
+#include "types.h"
+
+/*** SWREG functions ***/
+
+void SWREG_modify_register(uint32_t* reg_value, uint32_t new_value, uint32_t mask);
+uint32_t SWREG_read_field(uint32_t reg_value, uint32_t field_mask);
+void SWREG_write_field(uint32_t* reg_value, uint32_t* reg_mask, uint32_t field_value, uint32_t field_mask);
+
+#endif /* __SWREG_H__ */
@@ -0,0 +1,138 @@
+/*
+ * tim.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TIM_H__
+#define __TIM_H__
+
+#include "error.h"
+#include "rcc.h"
+#include "types.h"
+
+/*** TIM structures ***/
+
+/*!******************************************************************
+ * \enum TIM_status_t
+ * \brief TIM driver error codes.
+ *******************************************************************/
+typedef enum {
+    TIM_SUCCESS = 0,
+    TIM_ERROR_NULL_PARAMETER,
+    TIM_ERROR_INSTANCE,
+    TIM_ERROR_CHANNEL,
+    TIM_ERROR_BASE_LAST = ERROR_BASE_STEP
+} TIM_status_t;
+
+/*!******************************************************************
+ * \enum TIM_instance_t
+ * \brief TIM instances list.
+ *******************************************************************/
+typedef enum {
+    TIM_INSTANCE_TIM1 = 0,
+    TIM_INSTANCE_TIM2,
+    TIM_INSTANCE_TIM6,
+    TIM_INSTANCE_TIM15,
+    TIM_INSTANCE_LAST
+} TIM_instance_t;
+
+/*!******************************************************************
+ * \enum TIM_channel_t
+ * \brief TIM channels list.
+ *******************************************************************/
+typedef enum {
+    TIM_CHANNEL_1 = 0,
+    TIM_CHANNEL_2,
+    TIM_CHANNEL_3,
+    TIM_CHANNEL_4,
+    TIM_CHANNEL_LAST
+} TIM_channel_t;
+
+/*!******************************************************************
+ * \enum TIM_unit_t
+ * \brief TIM period units.
+ *******************************************************************/
+typedef enum {
+    TIM_UNIT_MS = 0,
+    TIM_UNIT_US,
+    TIM_UNIT_NS,
+    TIM_UNIT_LAST
+} TIM_unit_t;
+
+/*!******************************************************************
+ * \enum TIM_capture_prescaler_t
+ * \brief TIM input capture prescalers.
+ *******************************************************************/
+typedef enum {
+    TIM_CAPTURE_PRESCALER_1 = 0,
+    TIM_CAPTURE_PRESCALER_2,
+    TIM_CAPTURE_PRESCALER_4,
+    TIM_CAPTURE_PRESCALER_8,
+    TIM_CAPTURE_PRESCALER_LAST
+} TIM_capture_prescaler_t;
+
+/*!******************************************************************
+ * \struct TIM_gpio_t
+ * \brief TIM GPIO pins list.
+ *******************************************************************/
+typedef struct {
+    uint8_t list_size;
+} TIM_gpio_t;
+
+/*!******************************************************************
+ * \enum TIM_waiting_mode_t
+ * \brief TIM multi-channel completion waiting modes.
+ *******************************************************************/
+typedef enum {
+    TIM_WAITING_MODE_ACTIVE = 0,
+    TIM_WAITING_MODE_SLEEP,
+    TIM_WAITING_MODE_LOW_POWER_SLEEP,
+    TIM_WAITING_MODE_LAST
+} TIM_waiting_mode_t;
+
+/*!******************************************************************
+ * \fn TIM_completion_irq_cb_t
+ * \brief TIM completion callback.
+ *******************************************************************/
+typedef void (*TIM_completion_irq_cb_t)(void);
+
+/*** TIM functions ***/
+
+TIM_status_t TIM_STD_init(TIM_instance_t instance, uint8_t nvic_priority);
+TIM_status_t TIM_STD_de_init(TIM_instance_t instance);
+TIM_status_t TIM_STD_start(TIM_instance_t instance, RCC_clock_t clock_source, uint32_t period, TIM_unit_t unit, TIM_completion_irq_cb_t irq_callback);
+TIM_status_t TIM_STD_stop(TIM_instance_t instance);
+TIM_status_t TIM_IC_init(TIM_instance_t instance, TIM_gpio_t* pins);
+TIM_status_t TIM_IC_de_init(TIM_instance_t instance, TIM_gpio_t* pins);
+TIM_status_t TIM_IC_start_channel(TIM_instance_t instance, TIM_channel_t channel, uint32_t capture_frequency_hz, TIM_capture_prescaler_t capture_prescaler);
+TIM_status_t TIM_IC_stop_channel(TIM_instance_t instance, TIM_channel_t channel);
+uint32_t TIM_get_ccr_register_address(TIM_instance_t instance, TIM_channel_t channel);
+TIM_status_t TIM_MCH_init(TIM_instance_t instance, uint8_t nvic_priority);
+TIM_status_t TIM_MCH_de_init(TIM_instance_t instance);
+TIM_status_t TIM_MCH_start_channel(TIM_instance_t instance, TIM_channel_t channel, uint32_t duration_ms, TIM_waiting_mode_t waiting_mode);
+TIM_status_t TIM_MCH_stop_channel(TIM_instance_t instance, TIM_channel_t channel);
+TIM_status_t TIM_MCH_get_channel_status(TIM_instance_t instance, TIM_channel_t channel, uint8_t* channel_has_elapsed);
+
+/*** TIM mock functions ***/
+
+/*!******************************************************************
+ * \fn void TIM_MOCK_trigger(TIM_instance_t instance)
+ * \brief Emulate a timer period event.
+ * \param[in]   instance: Timer instance.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TIM_MOCK_trigger(TIM_instance_t instance);
+
+/*******************************************************************/
+#define TIM_exit_error(base) { ERROR_check_exit(tim_status, TIM_SUCCESS, base) }
+
+/*******************************************************************/
+#define TIM_stack_error(base) { ERROR_check_stack(tim_status, TIM_SUCCESS, base) }
+
+/*******************************************************************/
+#define TIM_stack_exit_error(base, code) { ERROR_check_stack_exit(tim_status, TIM_SUCCESS, base, code) }
+
+#endif /* __TIM_H__ */
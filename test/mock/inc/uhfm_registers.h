@@ -0,0 +1,13 @@
+/*
+ * uhfm_registers.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UHFM_REGISTERS_H__
+#define __UHFM_REGISTERS_H__
+
+// Note: board not selected in host tests.
+
+#endif /* __UHFM_REGISTERS_H__ */
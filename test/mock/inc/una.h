@@ -0,0 +1,73 @@
+/*
+ * una.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_H__
+#define __UNA_H__
+
+#include "types.h"
+
+/*** UNA macros ***/
+
+#define UNA_REGISTER_MASK_ALL               0xFFFFFFFF
+
+// Note: data fields are 16-bits wide in the reduced host register map.
+#define UNA_VOLTAGE_ERROR_VALUE             0xFFFF
+#define UNA_CURRENT_ERROR_VALUE             0xFFFF
+#define UNA_ELECTRICAL_POWER_ERROR_VALUE    0xFFFF
+#define UNA_ELECTRICAL_ENERGY_ERROR_VALUE   0xFFFF
+#define UNA_POWER_FACTOR_ERROR_VALUE        0xFFFF
+#define UNA_MAINS_FREQUENCY_ERROR_VALUE     0xFFFF
+
+/*** UNA structures ***/
+
+/*!******************************************************************
+ * \typedef UNA_node_address_t
+ * \brief Node address type.
+ *******************************************************************/
+typedef uint8_t UNA_node_address_t;
+
+/*!******************************************************************
+ * \enum UNA_register_access_t
+ * \brief Register access types.
+ *******************************************************************/
+typedef enum {
+    UNA_REGISTER_ACCESS_READ_ONLY = 0,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_LAST
+} UNA_register_access_t;
+
+/*!******************************************************************
+ * \enum UNA_board_id_t
+ * \brief Board identifiers.
+ *******************************************************************/
+typedef enum {
+    UNA_BOARD_ID_LVRM = 0,
+    UNA_BOARD_ID_BPSM,
+    UNA_BOARD_ID_DDRM,
+    UNA_BOARD_ID_UHFM,
+    UNA_BOARD_ID_GPSM,
+    UNA_BOARD_ID_SM,
+    UNA_BOARD_ID_RRM,
+    UNA_BOARD_ID_DMM,
+    UNA_BOARD_ID_MPMCM,
+    UNA_BOARD_ID_R4S8CR,
+    UNA_BOARD_ID_BCM,
+    UNA_BOARD_ID_LAST
+} UNA_board_id_t;
+
+/*** UNA functions ***/
+
+// Note: the host conversions keep the raw value (without unit encoding) to simplify registers checks.
+uint32_t UNA_convert_mv(int32_t voltage_mv);
+uint32_t UNA_convert_ua(int32_t current_ua);
+uint32_t UNA_convert_mw_mva(int32_t power_mw_mva);
+uint32_t UNA_convert_mwh_mvah(int32_t energy_mwh_mvah);
+uint32_t UNA_convert_power_factor(int32_t power_factor);
+uint32_t UNA_convert_seconds(uint32_t time_seconds);
+uint32_t UNA_get_seconds(uint32_t una_time);
+
+#endif /* __UNA_H__ */
@@ -0,0 +1,125 @@
+/*
+ * usart.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __USART_H__
+#define __USART_H__
+
+#include "error.h"
+#include "rcc.h"
+#include "types.h"
+
+/*** USART macros ***/
+
+#define USART_MOCK_TX_BUFFER_SIZE   256
+
+/*** USART structures ***/
+
+/*!******************************************************************
+ * \enum USART_status_t
+ * \brief USART driver error codes.
+ *******************************************************************/
+typedef enum {
+    USART_SUCCESS = 0,
+    USART_ERROR_NULL_PARAMETER,
+    USART_ERROR_INSTANCE,
+    USART_ERROR_BAUD_RATE,
+    USART_ERROR_UNINITIALIZED,
+    USART_ERROR_BASE_LAST = ERROR_BASE_STEP
+} USART_status_t;
+
+/*!******************************************************************
+ * \enum USART_instance_t
+ * \brief USART instances list.
+ *******************************************************************/
+typedef enum {
+    USART_INSTANCE_USART1 = 0,
+    USART_INSTANCE_USART2,
+    USART_INSTANCE_LAST
+} USART_instance_t;
+
+/*!******************************************************************
+ * \struct USART_gpio_t
+ * \brief USART GPIO pins list.
+ *******************************************************************/
+typedef struct {
+    uint8_t instance;
+} USART_gpio_t;
+
+/*!******************************************************************
+ * \fn USART_rx_irq_cb_t
+ * \brief USART RX interrupt callback.
+ *******************************************************************/
+typedef void (*USART_rx_irq_cb_t)(uint8_t data);
+
+/*!******************************************************************
+ * \fn USART_event_irq_cb_t
+ * \brief USART character match and idle line interrupts callback.
+ *******************************************************************/
+typedef void (*USART_event_irq_cb_t)(void);
+
+/*!******************************************************************
+ * \struct USART_configuration_t
+ * \brief USART configuration structure.
+ *******************************************************************/
+typedef struct {
+    RCC_clock_t clock;
+    uint32_t baud_rate;
+    uint8_t nvic_priority;
+    USART_rx_irq_cb_t rxne_irq_callback;
+    USART_event_irq_cb_t cm_irq_callback;
+    uint8_t match_character;
+    USART_event_irq_cb_t idle_irq_callback;
+} USART_configuration_t;
+
+/*** USART functions ***/
+
+USART_status_t USART_init(USART_instance_t instance, const USART_gpio_t* pins, USART_configuration_t* configuration);
+USART_status_t USART_de_init(USART_instance_t instance, const USART_gpio_t* pins);
+USART_status_t USART_enable_rx(USART_instance_t instance);
+USART_status_t USART_disable_rx(USART_instance_t instance);
+USART_status_t USART_write(USART_instance_t instance, uint8_t* data, uint32_t data_size_bytes);
+uint32_t USART_get_rdr_register_address(USART_instance_t instance);
+
+/*** USART mock functions ***/
+
+/*!******************************************************************
+ * \fn void USART_MOCK_receive(USART_instance_t instance, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Emulate the reception of a bytes burst followed by an idle line.
+ * \brief Bytes are given to the RXNE callback if defined, or to the DMA channel linked to the instance RX request otherwise.
+ * \param[in]   instance: USART instance.
+ * \param[in]   data: Received bytes.
+ * \param[in]   data_size_bytes: Number of received bytes.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void USART_MOCK_receive(USART_instance_t instance, uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn uint32_t USART_MOCK_get_sent_data(USART_instance_t instance, uint8_t** data)
+ * \brief Read the bytes sent since the last reception stop.
+ * \param[in]   instance: USART instance.
+ * \param[out]  data: Pointer to the sent bytes buffer.
+ * \retval      Number of sent bytes.
+ *******************************************************************/
+uint32_t USART_MOCK_get_sent_data(USART_instance_t instance, uint8_t** data);
+
+/*!******************************************************************
+ * \fn uint8_t USART_MOCK_is_rx_enabled(USART_instance_t instance)
+ * \brief Check if the receiver is enabled.
+ * \param[in]   instance: USART instance.
+ * \param[out]  none
+ * \retval      1 if the receiver is enabled, 0 otherwise.
+ *******************************************************************/
+uint8_t USART_MOCK_is_rx_enabled(USART_instance_t instance);
+
+/*******************************************************************/
+#define USART_exit_error(base) { ERROR_check_exit(usart_status, USART_SUCCESS, base) }
+
+/*******************************************************************/
+#define USART_stack_error(base) { ERROR_check_stack(usart_status, USART_SUCCESS, base) }
+
+#endif /* __USART_H__ */
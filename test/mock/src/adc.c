@@ -0,0 +1,58 @@
+/*
+ * adc.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "adc.h"
+
+#include "types.h"
+
+/*** ADC functions ***/
+
+// Note: conversions are emulated by the tests through the DMA mock.
+
+/*******************************************************************/
+ADC_status_t ADC_SQC_init(ADC_instance_t instance, const ADC_gpio_t* pins, ADC_SQC_configuration_t* configuration) {
+    // Local variables.
+    ADC_status_t status = ADC_SUCCESS;
+    // Check parameters.
+    if (instance >= ADC_INSTANCE_LAST) {
+        status = ADC_ERROR_INSTANCE;
+        goto errors;
+    }
+    if ((pins == NULL) || (configuration == NULL)) {
+        status = ADC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+ADC_status_t ADC_SQC_de_init(ADC_instance_t instance) {
+    return ((instance < ADC_INSTANCE_LAST) ? ADC_SUCCESS : ADC_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+ADC_status_t ADC_SQC_start(ADC_instance_t instance) {
+    return ((instance < ADC_INSTANCE_LAST) ? ADC_SUCCESS : ADC_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+ADC_status_t ADC_SQC_stop(ADC_instance_t instance) {
+    return ((instance < ADC_INSTANCE_LAST) ? ADC_SUCCESS : ADC_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+uint32_t ADC_get_master_dr_register_address(ADC_instance_t instance) {
+    UNUSED(instance);
+    return 0;
+}
+
+/*******************************************************************/
+uint32_t ADC_get_slave_dr_register_address(ADC_instance_t instance) {
+    UNUSED(instance);
+    return 0;
+}
@@ -0,0 +1,198 @@
+/*
+ * aes.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "aes.h"
+
+#include "types.h"
+
+/*** AES local macros ***/
+
+#define AES_NUMBER_OF_ROUNDS        10
+#define AES_ROUND_KEYS_SIZE_BYTES   (AES_BLOCK_SIZE_BYTES * (AES_NUMBER_OF_ROUNDS + 1))
+
+/*** AES local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t enabled_flag;
+    uint32_t init_count;
+} AES_context_t;
+
+/*** AES local global variables ***/
+
+static const uint8_t AES_SBOX[256] = {
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+static const uint8_t AES_RCON[AES_NUMBER_OF_ROUNDS] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36 };
+
+static AES_context_t aes_ctx = {
+    .enabled_flag = 0,
+    .init_count = 0
+};
+
+/*** AES local functions ***/
+
+/*******************************************************************/
+static uint8_t _AES_xtime(uint8_t x) {
+    return (uint8_t) ((x << 1) ^ (((x & 0x80) != 0) ? 0x1B : 0x00));
+}
+
+/*******************************************************************/
+static void _AES_expand_key(uint8_t* key, uint8_t* round_keys) {
+    // Local variables.
+    uint8_t temp[4];
+    uint8_t tmp = 0;
+    uint8_t idx = 0;
+    // First round key is the key itself.
+    for (idx = 0; idx < AES_BLOCK_SIZE_BYTES; idx++) {
+        round_keys[idx] = key[idx];
+    }
+    for (idx = 4; idx < (4 * (AES_NUMBER_OF_ROUNDS + 1)); idx++) {
+        temp[0] = round_keys[(4 * (idx - 1)) + 0];
+        temp[1] = round_keys[(4 * (idx - 1)) + 1];
+        temp[2] = round_keys[(4 * (idx - 1)) + 2];
+        temp[3] = round_keys[(4 * (idx - 1)) + 3];
+        if ((idx % 4) == 0) {
+            // Rotate, substitute and add round constant.
+            tmp = temp[0];
+            temp[0] = (AES_SBOX[temp[1]] ^ AES_RCON[(idx / 4) - 1]);
+            temp[1] = AES_SBOX[temp[2]];
+            temp[2] = AES_SBOX[temp[3]];
+            temp[3] = AES_SBOX[tmp];
+        }
+        round_keys[(4 * idx) + 0] = (round_keys[(4 * (idx - 4)) + 0] ^ temp[0]);
+        round_keys[(4 * idx) + 1] = (round_keys[(4 * (idx - 4)) + 1] ^ temp[1]);
+        round_keys[(4 * idx) + 2] = (round_keys[(4 * (idx - 4)) + 2] ^ temp[2]);
+        round_keys[(4 * idx) + 3] = (round_keys[(4 * (idx - 4)) + 3] ^ temp[3]);
+    }
+}
+
+/*******************************************************************/
+static void _AES_add_round_key(uint8_t* state, uint8_t* round_key) {
+    // Local variables.
+    uint8_t idx = 0;
+    for (idx = 0; idx < AES_BLOCK_SIZE_BYTES; idx++) {
+        state[idx] ^= round_key[idx];
+    }
+}
+
+/*******************************************************************/
+static void _AES_sub_shift_rows(uint8_t* state) {
+    // Local variables.
+    uint8_t temp[AES_BLOCK_SIZE_BYTES];
+    uint8_t row = 0;
+    uint8_t column = 0;
+    // State is stored column by column.
+    for (column = 0; column < 4; column++) {
+        for (row = 0; row < 4; row++) {
+            temp[(4 * column) + row] = AES_SBOX[state[(4 * ((column + row) % 4)) + row]];
+        }
+    }
+    for (row = 0; row < AES_BLOCK_SIZE_BYTES; row++) {
+        state[row] = temp[row];
+    }
+}
+
+/*******************************************************************/
+static void _AES_mix_columns(uint8_t* state) {
+    // Local variables.
+    uint8_t* col = NULL;
+    uint8_t all = 0;
+    uint8_t first = 0;
+    uint8_t column = 0;
+    for (column = 0; column < 4; column++) {
+        col = &(state[4 * column]);
+        all = (col[0] ^ col[1] ^ col[2] ^ col[3]);
+        first = col[0];
+        col[0] ^= (all ^ _AES_xtime(col[0] ^ col[1]));
+        col[1] ^= (all ^ _AES_xtime(col[1] ^ col[2]));
+        col[2] ^= (all ^ _AES_xtime(col[2] ^ col[3]));
+        col[3] ^= (all ^ _AES_xtime(col[3] ^ first));
+    }
+}
+
+/*** AES functions ***/
+
+/*******************************************************************/
+void AES_init(void) {
+    aes_ctx.enabled_flag = 1;
+    aes_ctx.init_count++;
+}
+
+/*******************************************************************/
+void AES_de_init(void) {
+    aes_ctx.enabled_flag = 0;
+}
+
+/*******************************************************************/
+AES_status_t AES_encrypt(uint8_t* data_in, uint8_t* data_out, uint8_t* key) {
+    // Local variables.
+    AES_status_t status = AES_SUCCESS;
+    uint8_t round_keys[AES_ROUND_KEYS_SIZE_BYTES];
+    uint8_t state[AES_BLOCK_SIZE_BYTES];
+    uint8_t round = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((data_in == NULL) || (data_out == NULL) || (key == NULL)) {
+        status = AES_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Emulate the peripheral timeout when the clock is not enabled.
+    if (aes_ctx.enabled_flag == 0) {
+        status = AES_ERROR_TIMEOUT;
+        goto errors;
+    }
+    _AES_expand_key(key, round_keys);
+    for (idx = 0; idx < AES_BLOCK_SIZE_BYTES; idx++) {
+        state[idx] = data_in[idx];
+    }
+    _AES_add_round_key(state, &(round_keys[0]));
+    for (round = 1; round <= AES_NUMBER_OF_ROUNDS; round++) {
+        _AES_sub_shift_rows(state);
+        if (round < AES_NUMBER_OF_ROUNDS) {
+            _AES_mix_columns(state);
+        }
+        _AES_add_round_key(state, &(round_keys[AES_BLOCK_SIZE_BYTES * round]));
+    }
+    for (idx = 0; idx < AES_BLOCK_SIZE_BYTES; idx++) {
+        data_out[idx] = state[idx];
+    }
+errors:
+    return status;
+}
+
+/*** AES mock functions ***/
+
+/*******************************************************************/
+void AES_MOCK_reset_counters(void) {
+    aes_ctx.init_count = 0;
+}
+
+/*******************************************************************/
+uint32_t AES_MOCK_get_init_count(void) {
+    return aes_ctx.init_count;
+}
+
+/*******************************************************************/
+uint8_t AES_MOCK_is_enabled(void) {
+    return aes_ctx.enabled_flag;
+}
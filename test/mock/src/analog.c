@@ -0,0 +1,50 @@
+/*
+ * analog.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "analog.h"
+
+#include "types.h"
+
+/*** ANALOG local global variables ***/
+
+static int32_t analog_channel_data[ANALOG_CHANNEL_LAST];
+static uint32_t analog_conversion_count = 0;
+
+/*** ANALOG functions ***/
+
+/*******************************************************************/
+ANALOG_status_t ANALOG_init(void) {
+    return ANALOG_SUCCESS;
+}
+
+/*******************************************************************/
+ANALOG_status_t ANALOG_de_init(void) {
+    return ANALOG_SUCCESS;
+}
+
+/*******************************************************************/
+ANALOG_status_t ANALOG_convert_channel(ANALOG_channel_t channel, int32_t* analog_data) {
+    if (analog_data == NULL) return ANALOG_ERROR_NULL_PARAMETER;
+    if (channel >= ANALOG_CHANNEL_LAST) return ANALOG_ERROR_CHANNEL;
+    (*analog_data) = analog_channel_data[channel];
+    analog_conversion_count++;
+    return ANALOG_SUCCESS;
+}
+
+/*** ANALOG mock functions ***/
+
+/*******************************************************************/
+void ANALOG_MOCK_set_data(ANALOG_channel_t channel, int32_t analog_data) {
+    if (channel < ANALOG_CHANNEL_LAST) {
+        analog_channel_data[channel] = analog_data;
+    }
+}
+
+/*******************************************************************/
+uint32_t ANALOG_MOCK_get_conversion_count(void) {
+    return analog_conversion_count;
+}
@@ -0,0 +1,164 @@
+/*
+ * cmsis_dsp.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+// Note: straightforward host implementation of the CMSIS-DSP functions used by the firmware.
+// Integer functions are exact and floating point functions accumulate in single precision like the Cortex-M4 implementation.
+
+#include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/statistics_functions.h"
+#include "dsp/transform_functions.h"
+#include "math.h"
+
+/*** CMSIS DSP local macros ***/
+
+#define CMSIS_DSP_PI    3.14159265358979323846
+
+/*** CMSIS DSP functions ***/
+
+/*******************************************************************/
+void arm_mult_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize) {
+    // Local variables.
+    uint32_t idx = 0;
+    for (idx = 0; idx < blockSize; idx++) {
+        pDst[idx] = (pSrcA[idx] * pSrcB[idx]);
+    }
+}
+
+/*******************************************************************/
+void arm_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result) {
+    // Local variables.
+    float32_t sum = 0.0f;
+    uint32_t idx = 0;
+    for (idx = 0; idx < blockSize; idx++) {
+        sum += (pSrcA[idx] * pSrcB[idx]);
+    }
+    (*result) = sum;
+}
+
+/*******************************************************************/
+void arm_dot_prod_q15(const q15_t* pSrcA, const q15_t* pSrcB, uint32_t blockSize, q63_t* result) {
+    // Local variables.
+    q63_t sum = 0;
+    uint32_t idx = 0;
+    // Note: result is kept in 34.30 format without saturation like the CMSIS-DSP implementation.
+    for (idx = 0; idx < blockSize; idx++) {
+        sum += ((q31_t) pSrcA[idx]) * ((q31_t) pSrcB[idx]);
+    }
+    (*result) = sum;
+}
+
+/*******************************************************************/
+void arm_cmplx_mag_squared_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples) {
+    // Local variables.
+    uint32_t idx = 0;
+    for (idx = 0; idx < numSamples; idx++) {
+        pDst[idx] = (pSrc[(idx << 1) + 0] * pSrc[(idx << 1) + 0]) + (pSrc[(idx << 1) + 1] * pSrc[(idx << 1) + 1]);
+    }
+}
+
+/*******************************************************************/
+arm_status arm_sqrt_f32(float32_t in, float32_t* pOut) {
+    // Local variables.
+    arm_status status = ARM_MATH_SUCCESS;
+    // Negative input gives a null result.
+    if (in < 0.0f) {
+        (*pOut) = 0.0f;
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else {
+        (*pOut) = sqrtf(in);
+    }
+    return status;
+}
+
+/*******************************************************************/
+arm_status arm_atan2_f32(float32_t y, float32_t x, float32_t* result) {
+    (*result) = atan2f(y, x);
+    return ARM_MATH_SUCCESS;
+}
+
+/*******************************************************************/
+void arm_mean_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult) {
+    // Local variables.
+    float32_t sum = 0.0f;
+    uint32_t idx = 0;
+    for (idx = 0; idx < blockSize; idx++) {
+        sum += pSrc[idx];
+    }
+    (*pResult) = (sum / ((float32_t) blockSize));
+}
+
+/*******************************************************************/
+void arm_rms_f32(const float32_t* pSrc, uint32_t blockSize, float32_t* pResult) {
+    // Local variables.
+    float32_t sum = 0.0f;
+    uint32_t idx = 0;
+    for (idx = 0; idx < blockSize; idx++) {
+        sum += (pSrc[idx] * pSrc[idx]);
+    }
+    arm_sqrt_f32((sum / ((float32_t) blockSize)), pResult);
+}
+
+/*******************************************************************/
+void arm_power_q15(const q15_t* pSrc, uint32_t blockSize, q63_t* pResult) {
+    // Local variables.
+    q63_t sum = 0;
+    uint32_t idx = 0;
+    for (idx = 0; idx < blockSize; idx++) {
+        sum += ((q31_t) pSrc[idx]) * ((q31_t) pSrc[idx]);
+    }
+    (*pResult) = sum;
+}
+
+/*******************************************************************/
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32* S, uint16_t fftLen) {
+    // Local variables.
+    arm_status status = ARM_MATH_SUCCESS;
+    // Check length (power of 2 from 32 to 4096).
+    if ((fftLen < 32) || (fftLen > 4096) || ((fftLen & (fftLen - 1)) != 0)) {
+        status = ARM_MATH_ARGUMENT_ERROR;
+        goto errors;
+    }
+    S->fftLenRFFT = fftLen;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut, uint8_t ifftFlag) {
+    // Local variables.
+    float64_t real = 0.0;
+    float64_t imaginary = 0.0;
+    float64_t angle = 0.0;
+    uint32_t fft_length = S->fftLenRFFT;
+    uint32_t bin_idx = 0;
+    uint32_t idx = 0;
+    // Note: only the forward transform is used by the firmware.
+    if (ifftFlag != 0) return;
+    // Direct DFT with the CMSIS-DSP output packing (DC and Nyquist real parts first, then complex bins).
+    for (bin_idx = 0; bin_idx <= (fft_length >> 1); bin_idx++) {
+        real = 0.0;
+        imaginary = 0.0;
+        for (idx = 0; idx < fft_length; idx++) {
+            angle = (2.0 * CMSIS_DSP_PI * ((float64_t) ((bin_idx * idx) % fft_length))) / ((float64_t) fft_length);
+            real += ((float64_t) p[idx]) * cos(angle);
+            imaginary -= ((float64_t) p[idx]) * sin(angle);
+        }
+        if (bin_idx == 0) {
+            pOut[0] = (float32_t) real;
+        }
+        else if (bin_idx == (fft_length >> 1)) {
+            pOut[1] = (float32_t) real;
+        }
+        else {
+            pOut[(bin_idx << 1) + 0] = (float32_t) real;
+            pOut[(bin_idx << 1) + 1] = (float32_t) imaginary;
+        }
+    }
+}
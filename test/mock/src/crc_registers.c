@@ -0,0 +1,159 @@
+/*
+ * crc_registers.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+// Note: required for the x86-64 registers indexes of the signal context.
+#define _GNU_SOURCE
+
+#include "crc_registers.h"
+
+#include "signal.h"
+#include "stddef.h"
+#include "sys/mman.h"
+#include "types.h"
+#include "ucontext.h"
+
+/*** CRC local macros ***/
+
+#define CRC_MOCK_PAGE_SIZE_BYTES    0x1000
+
+#define CRC_MOCK_CR_RESET           (0b1 << 0)
+#define CRC_MOCK_CR_POLYSIZE_SHIFT  3
+#define CRC_MOCK_CR_POLYSIZE_MASK   (0b11 << CRC_MOCK_CR_POLYSIZE_SHIFT)
+
+// Page fault error code bit set on write accesses.
+#define CRC_MOCK_FAULT_WRITE        (0b1 << 1)
+// Trap flag of the x86 flags register.
+#define CRC_MOCK_EFLAGS_TF          (0b1 << 8)
+
+/*** CRC local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t crc;
+    uint32_t access_offset;
+    uint8_t access_write;
+    uint32_t access_count;
+    uint8_t init_flag;
+} CRC_MOCK_context_t;
+
+/*** CRC local global variables ***/
+
+static const uint8_t CRC_MOCK_POLYNOMIAL_SIZE_BITS[4] = { 32, 16, 8, 7 };
+
+static CRC_MOCK_context_t crc_mock_ctx;
+
+/*** CRC local functions ***/
+
+/*******************************************************************/
+static uint8_t _CRC_MOCK_get_polynomial_size_bits(void) {
+    return CRC_MOCK_POLYNOMIAL_SIZE_BITS[((CRC->CR) & CRC_MOCK_CR_POLYSIZE_MASK) >> CRC_MOCK_CR_POLYSIZE_SHIFT];
+}
+
+/*******************************************************************/
+static void _CRC_MOCK_feed_byte(uint8_t data) {
+    // Local variables.
+    uint8_t polynomial_size_bits = _CRC_MOCK_get_polynomial_size_bits();
+    uint32_t mask = (polynomial_size_bits == 32) ? 0xFFFFFFFF : ((0b1UL << polynomial_size_bits) - 1);
+    uint32_t feedback = 0;
+    uint8_t idx = 0;
+    // Input bits are processed MSB first (no input reversal).
+    for (idx = 0; idx < 8; idx++) {
+        feedback = ((crc_mock_ctx.crc >> (polynomial_size_bits - 1)) ^ (data >> (7 - idx))) & 0b1;
+        crc_mock_ctx.crc = (crc_mock_ctx.crc << 1) & mask;
+        if (feedback != 0) {
+            crc_mock_ctx.crc ^= ((CRC->POL) & mask);
+        }
+    }
+}
+
+/*******************************************************************/
+static void _CRC_MOCK_segv_handler(int signal_number, siginfo_t* signal_info, void* context) {
+    // Local variables.
+    ucontext_t* user_context = (ucontext_t*) context;
+    uint32_t address = (uint32_t) ((uintptr_t) (signal_info->si_addr));
+    // Forward faults outside the peripheral page.
+    if ((address < CRC_MOCK_BASE_ADDRESS) || (address >= (CRC_MOCK_BASE_ADDRESS + CRC_MOCK_PAGE_SIZE_BYTES))) {
+        signal(signal_number, SIG_DFL);
+        return;
+    }
+    crc_mock_ctx.access_offset = (address - CRC_MOCK_BASE_ADDRESS);
+    crc_mock_ctx.access_write = ((user_context->uc_mcontext.gregs[REG_ERR] & CRC_MOCK_FAULT_WRITE) != 0) ? 1 : 0;
+    crc_mock_ctx.access_count++;
+    // Open the page and execute the faulting instruction step by step.
+    mprotect((void*) CRC_MOCK_BASE_ADDRESS, CRC_MOCK_PAGE_SIZE_BYTES, (PROT_READ | PROT_WRITE));
+    // Data register reads return the current result.
+    if ((crc_mock_ctx.access_write == 0) && (crc_mock_ctx.access_offset == offsetof(CRC_registers_t, DR))) {
+        CRC->DR = crc_mock_ctx.crc;
+    }
+    user_context->uc_mcontext.gregs[REG_EFL] |= CRC_MOCK_EFLAGS_TF;
+}
+
+/*******************************************************************/
+static void _CRC_MOCK_trap_handler(int signal_number, siginfo_t* signal_info, void* context) {
+    // Local variables.
+    ucontext_t* user_context = (ucontext_t*) context;
+    UNUSED(signal_number);
+    UNUSED(signal_info);
+    // Apply the side effects of write accesses.
+    if (crc_mock_ctx.access_write != 0) {
+        switch (crc_mock_ctx.access_offset) {
+        case offsetof(CRC_registers_t, DR):
+            // Note: only byte accesses are emulated.
+            _CRC_MOCK_feed_byte(*((volatile uint8_t*) &(CRC->DR)));
+            break;
+        case offsetof(CRC_registers_t, CR):
+            // Reset loads the initial value and is cleared by hardware.
+            if (((CRC->CR) & CRC_MOCK_CR_RESET) != 0) {
+                crc_mock_ctx.crc = (CRC->INIT);
+                CRC->CR &= ~CRC_MOCK_CR_RESET;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    // Close the page again.
+    mprotect((void*) CRC_MOCK_BASE_ADDRESS, CRC_MOCK_PAGE_SIZE_BYTES, PROT_NONE);
+    user_context->uc_mcontext.gregs[REG_EFL] &= ~CRC_MOCK_EFLAGS_TF;
+}
+
+/*** CRC mock functions ***/
+
+/*******************************************************************/
+uint8_t CRC_MOCK_init(void) {
+    // Local variables.
+    struct sigaction action;
+    // Map registers page once.
+    if (crc_mock_ctx.init_flag == 0) {
+        if (mmap((void*) CRC_MOCK_BASE_ADDRESS, CRC_MOCK_PAGE_SIZE_BYTES, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE), -1, 0) == MAP_FAILED) goto errors;
+        // Install traps.
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_SIGINFO;
+        action.sa_sigaction = &_CRC_MOCK_segv_handler;
+        sigaction(SIGSEGV, &action, NULL);
+        action.sa_sigaction = &_CRC_MOCK_trap_handler;
+        sigaction(SIGTRAP, &action, NULL);
+        crc_mock_ctx.init_flag = 1;
+    }
+    // Reset values.
+    mprotect((void*) CRC_MOCK_BASE_ADDRESS, CRC_MOCK_PAGE_SIZE_BYTES, (PROT_READ | PROT_WRITE));
+    CRC->DR = 0xFFFFFFFF;
+    CRC->IDR = 0;
+    CRC->CR = 0;
+    CRC->INIT = 0xFFFFFFFF;
+    CRC->POL = 0x04C11DB7;
+    crc_mock_ctx.crc = 0xFFFFFFFF;
+    crc_mock_ctx.access_count = 0;
+    mprotect((void*) CRC_MOCK_BASE_ADDRESS, CRC_MOCK_PAGE_SIZE_BYTES, PROT_NONE);
+errors:
+    return crc_mock_ctx.init_flag;
+}
+
+/*******************************************************************/
+uint32_t CRC_MOCK_get_access_count(void) {
+    return crc_mock_ctx.access_count;
+}
@@ -0,0 +1,187 @@
+/*
+ * dma.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "dma.h"
+
+#include "types.h"
+
+/*** DMA local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t init_flag;
+    uint8_t running_flag;
+    DMA_configuration_t configuration;
+    uint16_t number_of_transfered_data;
+} DMA_context_t;
+
+/*** DMA local global variables ***/
+
+static DMA_context_t dma_ctx[DMA_INSTANCE_LAST][DMA_CHANNEL_LAST];
+
+/*** DMA local functions ***/
+
+/*******************************************************************/
+#define _DMA_check_instance_channel(instance, channel) { \
+    if (instance >= DMA_INSTANCE_LAST) { \
+        status = DMA_ERROR_INSTANCE; \
+        goto errors; \
+    } \
+    if (channel >= DMA_CHANNEL_LAST) { \
+        status = DMA_ERROR_CHANNEL; \
+        goto errors; \
+    } \
+}
+
+/*** DMA functions ***/
+
+/*******************************************************************/
+DMA_status_t DMA_init(DMA_instance_t instance, DMA_channel_t channel, DMA_configuration_t* configuration) {
+    // Local variables.
+    DMA_status_t status = DMA_SUCCESS;
+    // Check parameters.
+    _DMA_check_instance_channel(instance, channel);
+    if (configuration == NULL) {
+        status = DMA_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Save configuration.
+    dma_ctx[instance][channel].configuration = (*configuration);
+    dma_ctx[instance][channel].number_of_transfered_data = 0;
+    dma_ctx[instance][channel].running_flag = 0;
+    dma_ctx[instance][channel].init_flag = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_de_init(DMA_instance_t instance, DMA_channel_t channel) {
+    // Local variables.
+    DMA_status_t status = DMA_SUCCESS;
+    // Check parameters.
+    _DMA_check_instance_channel(instance, channel);
+    // Release channel.
+    dma_ctx[instance][channel].running_flag = 0;
+    dma_ctx[instance][channel].init_flag = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_start(DMA_instance_t instance, DMA_channel_t channel) {
+    // Local variables.
+    DMA_status_t status = DMA_SUCCESS;
+    // Check parameters.
+    _DMA_check_instance_channel(instance, channel);
+    if (dma_ctx[instance][channel].init_flag == 0) {
+        status = DMA_ERROR_UNINITIALIZED;
+        goto errors;
+    }
+    dma_ctx[instance][channel].running_flag = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_stop(DMA_instance_t instance, DMA_channel_t channel) {
+    // Local variables.
+    DMA_status_t status = DMA_SUCCESS;
+    // Check parameters.
+    _DMA_check_instance_channel(instance, channel);
+    dma_ctx[instance][channel].running_flag = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_set_memory_address(DMA_instance_t instance, DMA_channel_t channel, uint32_t memory_addr, uint16_t number_of_data) {
+    // Local variables.
+    DMA_status_t status = DMA_SUCCESS;
+    // Check parameters.
+    _DMA_check_instance_channel(instance, channel);
+    // Update buffer and reset counter.
+    dma_ctx[instance][channel].configuration.memory_address = memory_addr;
+    dma_ctx[instance][channel].configuration.number_of_data = number_of_data;
+    dma_ctx[instance][channel].number_of_transfered_data = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_get_number_of_transfered_data(DMA_instance_t instance, DMA_channel_t channel, uint16_t* number_of_transfered_data) {
+    // Local variables.
+    DMA_status_t status = DMA_SUCCESS;
+    // Check parameters.
+    _DMA_check_instance_channel(instance, channel);
+    if (number_of_transfered_data == NULL) {
+        status = DMA_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*number_of_transfered_data) = dma_ctx[instance][channel].number_of_transfered_data;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_MOCK_transfer(DMA_instance_t instance, DMA_channel_t channel, uint32_t data) {
+    // Local variables.
+    DMA_status_t status = DMA_SUCCESS;
+    DMA_context_t* context = NULL;
+    uintptr_t address = 0;
+    // Check parameters.
+    _DMA_check_instance_channel(instance, channel);
+    context = &(dma_ctx[instance][channel]);
+    // Transfers are lost when the channel is stopped or the buffer is full.
+    if ((context->running_flag == 0) || (context->number_of_transfered_data >= context->configuration.number_of_data)) goto errors;
+    // Write data in memory.
+    // Note: the tests are linked without PIE so that static buffers addresses fit in the 32-bits memory address register.
+    address = (uintptr_t) context->configuration.memory_address;
+    switch (context->configuration.memory_data_size) {
+    case DMA_DATA_SIZE_8_BITS:
+        ((volatile uint8_t*) address)[context->number_of_transfered_data] = (uint8_t) data;
+        break;
+    case DMA_DATA_SIZE_16_BITS:
+        ((volatile uint16_t*) address)[context->number_of_transfered_data] = (uint16_t) data;
+        break;
+    default:
+        ((volatile uint32_t*) address)[context->number_of_transfered_data] = data;
+        break;
+    }
+    context->number_of_transfered_data++;
+    // Check end of buffer.
+    if (context->number_of_transfered_data >= context->configuration.number_of_data) {
+        if (context->configuration.flags.circular_mode != 0) {
+            context->number_of_transfered_data = 0;
+        }
+        if (context->configuration.tc_irq_callback != NULL) {
+            context->configuration.tc_irq_callback();
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void DMA_MOCK_request(DMAMUX_peripheral_request_t request_id, uint32_t data) {
+    // Local variables.
+    uint8_t instance = 0;
+    uint8_t channel = 0;
+    // Search channel.
+    for (instance = 0; instance < DMA_INSTANCE_LAST; instance++) {
+        for (channel = 0; channel < DMA_CHANNEL_LAST; channel++) {
+            if ((dma_ctx[instance][channel].running_flag != 0) && (dma_ctx[instance][channel].configuration.request_id == request_id)) {
+                DMA_MOCK_transfer(instance, channel, data);
+                return;
+            }
+        }
+    }
+}
+
+/*******************************************************************/
+uint8_t DMA_MOCK_is_running(DMA_instance_t instance, DMA_channel_t channel) {
+    return (((instance < DMA_INSTANCE_LAST) && (channel < DMA_CHANNEL_LAST)) ? dma_ctx[instance][channel].running_flag : 0);
+}
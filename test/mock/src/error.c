@@ -0,0 +1,43 @@
+/*
+ * error.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "error.h"
+
+#include "types.h"
+
+/*** ERROR local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    ERROR_code_t stack[ERROR_STACK_DEPTH];
+    uint8_t stack_idx;
+} ERROR_context_t;
+
+/*** ERROR local global variables ***/
+
+static ERROR_context_t error_ctx;
+
+/*** ERROR functions ***/
+
+/*******************************************************************/
+void ERROR_stack_init(void) {
+    // Reset stack.
+    error_ctx.stack_idx = 0;
+}
+
+/*******************************************************************/
+void ERROR_stack_add(ERROR_code_t code) {
+    // Add error if there is room left.
+    if (error_ctx.stack_idx < ERROR_STACK_DEPTH) {
+        error_ctx.stack[error_ctx.stack_idx++] = code;
+    }
+}
+
+/*******************************************************************/
+uint8_t ERROR_stack_is_empty(void) {
+    return ((error_ctx.stack_idx == 0) ? 1 : 0);
+}
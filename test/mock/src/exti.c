@@ -0,0 +1,77 @@
+/*
+ * exti.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "exti.h"
+
+#include "gpio.h"
+#include "types.h"
+
+/*** EXTI local macros ***/
+
+#define EXTI_MOCK_NUMBER_OF_LINES   16
+
+/*** EXTI local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t enable_flag;
+    EXTI_gpio_irq_cb_t irq_callback;
+} EXTI_line_t;
+
+/*** EXTI local global variables ***/
+
+static EXTI_line_t exti_lines[EXTI_MOCK_NUMBER_OF_LINES];
+
+/*** EXTI functions ***/
+
+/*******************************************************************/
+void EXTI_configure_gpio(const GPIO_pin_t* gpio, GPIO_pull_resistor_t pull_resistor, EXTI_trigger_t trigger, EXTI_gpio_irq_cb_t irq_callback, uint8_t nvic_priority) {
+    UNUSED(pull_resistor);
+    UNUSED(trigger);
+    UNUSED(nvic_priority);
+    if ((gpio->pin) < EXTI_MOCK_NUMBER_OF_LINES) {
+        exti_lines[gpio->pin].irq_callback = irq_callback;
+        exti_lines[gpio->pin].enable_flag = 0;
+    }
+}
+
+/*******************************************************************/
+void EXTI_release_gpio(const GPIO_pin_t* gpio, GPIO_mode_t released_mode) {
+    UNUSED(released_mode);
+    if ((gpio->pin) < EXTI_MOCK_NUMBER_OF_LINES) {
+        exti_lines[gpio->pin].irq_callback = NULL;
+        exti_lines[gpio->pin].enable_flag = 0;
+    }
+}
+
+/*******************************************************************/
+void EXTI_enable_gpio_interrupt(const GPIO_pin_t* gpio) {
+    if ((gpio->pin) < EXTI_MOCK_NUMBER_OF_LINES) {
+        exti_lines[gpio->pin].enable_flag = 1;
+    }
+}
+
+/*******************************************************************/
+void EXTI_disable_gpio_interrupt(const GPIO_pin_t* gpio) {
+    if ((gpio->pin) < EXTI_MOCK_NUMBER_OF_LINES) {
+        exti_lines[gpio->pin].enable_flag = 0;
+    }
+}
+
+/*******************************************************************/
+void EXTI_clear_gpio_flag(const GPIO_pin_t* gpio) {
+    // Edges are delivered synchronously by the mock.
+    UNUSED(gpio);
+}
+
+/*******************************************************************/
+void EXTI_MOCK_trigger(const GPIO_pin_t* gpio) {
+    // Call registered callback.
+    if (((gpio->pin) < EXTI_MOCK_NUMBER_OF_LINES) && (exti_lines[gpio->pin].enable_flag != 0) && (exti_lines[gpio->pin].irq_callback != NULL)) {
+        exti_lines[gpio->pin].irq_callback();
+    }
+}
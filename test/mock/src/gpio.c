@@ -0,0 +1,47 @@
+/*
+ * gpio.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "gpio.h"
+
+#include "types.h"
+
+/*** GPIO local macros ***/
+
+#define GPIO_MOCK_NUMBER_OF_PORTS   8
+#define GPIO_MOCK_NUMBER_OF_PINS    16
+
+/*** GPIO local global variables ***/
+
+static uint8_t gpio_state[GPIO_MOCK_NUMBER_OF_PORTS][GPIO_MOCK_NUMBER_OF_PINS];
+
+/*** GPIO functions ***/
+
+/*******************************************************************/
+void GPIO_configure(const GPIO_pin_t* gpio, GPIO_mode_t mode, GPIO_output_type_t output_type, GPIO_output_speed_t output_speed, GPIO_pull_resistor_t pull_resistor) {
+    UNUSED(gpio);
+    UNUSED(mode);
+    UNUSED(output_type);
+    UNUSED(output_speed);
+    UNUSED(pull_resistor);
+}
+
+/*******************************************************************/
+void GPIO_write(const GPIO_pin_t* gpio, uint8_t state) {
+    GPIO_MOCK_set_input(gpio, state);
+}
+
+/*******************************************************************/
+uint8_t GPIO_read(const GPIO_pin_t* gpio) {
+    return (((gpio->port) < GPIO_MOCK_NUMBER_OF_PORTS) && ((gpio->pin) < GPIO_MOCK_NUMBER_OF_PINS)) ? gpio_state[gpio->port][gpio->pin] : 0;
+}
+
+/*******************************************************************/
+void GPIO_MOCK_set_input(const GPIO_pin_t* gpio, uint8_t state) {
+    if (((gpio->port) < GPIO_MOCK_NUMBER_OF_PORTS) && ((gpio->pin) < GPIO_MOCK_NUMBER_OF_PINS)) {
+        gpio_state[gpio->port][gpio->pin] = (state != 0) ? 1 : 0;
+    }
+}
@@ -0,0 +1,17 @@
+/*
+ * iwdg.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "iwdg.h"
+
+#include "types.h"
+
+/*** IWDG functions ***/
+
+/*******************************************************************/
+void IWDG_reload(void) {
+    // Nothing to do on host.
+}
@@ -0,0 +1,33 @@
+/*
+ * led.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "led.h"
+
+#include "types.h"
+
+/*** LED functions ***/
+
+/*******************************************************************/
+LED_status_t LED_init(void) {
+    return LED_SUCCESS;
+}
+
+/*******************************************************************/
+LED_status_t LED_de_init(void) {
+    return LED_SUCCESS;
+}
+
+/*******************************************************************/
+LED_status_t LED_single_pulse(uint32_t pulse_duration_ms, LED_color_t color, uint8_t pulse_completion_event) {
+    UNUSED(pulse_completion_event);
+    return ((pulse_duration_ms == 0) ? LED_ERROR_NULL_DURATION : ((color >= LED_COLOR_LAST) ? LED_ERROR_COLOR : LED_SUCCESS));
+}
+
+/*******************************************************************/
+LED_status_t LED_start_single_blink(uint32_t blink_duration_ms, LED_color_t color) {
+    return ((blink_duration_ms == 0) ? LED_ERROR_NULL_DURATION : ((color >= LED_COLOR_LAST) ? LED_ERROR_COLOR : LED_SUCCESS));
+}
@@ -0,0 +1,20 @@
+/*
+ * lptim.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "lptim.h"
+
+#include "types.h"
+
+/*** LPTIM functions ***/
+
+/*******************************************************************/
+LPTIM_status_t LPTIM_delay_milliseconds(uint32_t delay_ms, LPTIM_delay_mode_t delay_mode) {
+    // Note: delays are not emulated by the host tests.
+    UNUSED(delay_ms);
+    UNUSED(delay_mode);
+    return LPTIM_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/*
+ * lpuart.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "lpuart.h"
+
+#include "types.h"
+
+/*** LPUART local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t init_flag;
+    uint8_t rx_enable_flag;
+    LPUART_configuration_t configuration;
+    uint32_t init_count;
+    uint8_t tx_buffer[LPUART_MOCK_TX_BUFFER_SIZE];
+    uint32_t tx_buffer_size;
+    uint32_t tx_baud_rate;
+} LPUART_context_t;
+
+/*** LPUART local global variables ***/
+
+static LPUART_context_t lpuart_ctx;
+
+/*** LPUART functions ***/
+
+/*******************************************************************/
+LPUART_status_t LPUART_init(const LPUART_gpio_t* pins, LPUART_configuration_t* configuration) {
+    // Check parameters.
+    if ((pins == NULL) || (configuration == NULL)) return LPUART_ERROR_NULL_PARAMETER;
+    if (configuration->baud_rate == 0) return LPUART_ERROR_BAUD_RATE;
+    // Save configuration.
+    // Note: the receiver is disabled until LPUART_enable_rx() is called, as on the device.
+    lpuart_ctx.configuration = (*configuration);
+    lpuart_ctx.rx_enable_flag = 0;
+    lpuart_ctx.init_flag = 1;
+    lpuart_ctx.init_count++;
+    return LPUART_SUCCESS;
+}
+
+/*******************************************************************/
+LPUART_status_t LPUART_de_init(const LPUART_gpio_t* pins) {
+    // Check parameter.
+    if (pins == NULL) return LPUART_ERROR_NULL_PARAMETER;
+    // Release peripheral.
+    lpuart_ctx.init_flag = 0;
+    lpuart_ctx.rx_enable_flag = 0;
+    return LPUART_SUCCESS;
+}
+
+/*******************************************************************/
+LPUART_status_t LPUART_enable_rx(void) {
+    if (lpuart_ctx.init_flag == 0) return LPUART_ERROR_UNINITIALIZED;
+    lpuart_ctx.rx_enable_flag = 1;
+    return LPUART_SUCCESS;
+}
+
+/*******************************************************************/
+LPUART_status_t LPUART_disable_rx(void) {
+    if (lpuart_ctx.init_flag == 0) return LPUART_ERROR_UNINITIALIZED;
+    lpuart_ctx.rx_enable_flag = 0;
+    return LPUART_SUCCESS;
+}
+
+/*******************************************************************/
+LPUART_status_t LPUART_write(uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if (data == NULL) return LPUART_ERROR_NULL_PARAMETER;
+    if (lpuart_ctx.init_flag == 0) return LPUART_ERROR_UNINITIALIZED;
+    // Bytes previously sent with another baud rate are not readable anymore.
+    if (lpuart_ctx.tx_baud_rate != lpuart_ctx.configuration.baud_rate) {
+        lpuart_ctx.tx_buffer_size = 0;
+        lpuart_ctx.tx_baud_rate = lpuart_ctx.configuration.baud_rate;
+    }
+    // Put bytes on the bus.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        if (lpuart_ctx.tx_buffer_size >= LPUART_MOCK_TX_BUFFER_SIZE) break;
+        lpuart_ctx.tx_buffer[lpuart_ctx.tx_buffer_size++] = data[idx];
+    }
+    return LPUART_SUCCESS;
+}
+
+/*******************************************************************/
+uint32_t LPUART_MOCK_receive(uint32_t baud_rate, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Note: bytes sent with another baud rate are considered as framing errors and discarded.
+    if ((data == NULL) || (lpuart_ctx.init_flag == 0) || (lpuart_ctx.rx_enable_flag == 0) || (baud_rate != lpuart_ctx.configuration.baud_rate)) return 0;
+    // Call RX interrupt callback for each byte.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        if (lpuart_ctx.configuration.rxne_irq_callback != NULL) {
+            lpuart_ctx.configuration.rxne_irq_callback(data[idx]);
+        }
+    }
+    return data_size_bytes;
+}
+
+/*******************************************************************/
+uint32_t LPUART_MOCK_read_bus(uint32_t baud_rate, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    uint32_t size = 0;
+    // Check baud rate.
+    if ((data != NULL) && (baud_rate == lpuart_ctx.tx_baud_rate)) {
+        for (idx = 0; (idx < lpuart_ctx.tx_buffer_size) && (idx < data_size_bytes); idx++) {
+            data[idx] = lpuart_ctx.tx_buffer[idx];
+        }
+        size = idx;
+    }
+    // Bytes are consumed in any case.
+    lpuart_ctx.tx_buffer_size = 0;
+    return size;
+}
+
+/*******************************************************************/
+uint32_t LPUART_MOCK_get_baud_rate(void) {
+    return ((lpuart_ctx.init_flag != 0) ? lpuart_ctx.configuration.baud_rate : 0);
+}
+
+/*******************************************************************/
+uint32_t LPUART_MOCK_get_init_count(void) {
+    return lpuart_ctx.init_count;
+}
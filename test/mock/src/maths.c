@@ -0,0 +1,14 @@
+/*
+ * maths.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "maths.h"
+
+#include "types.h"
+
+/*** MATH global variables ***/
+
+const uint32_t MATH_POWER_10[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
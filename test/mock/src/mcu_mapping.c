@@ -0,0 +1,28 @@
+/*
+ * mcu_mapping.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "mcu_mapping.h"
+
+#include "adc.h"
+#include "gpio.h"
+#include "lpuart.h"
+#include "tim.h"
+#include "usart.h"
+
+/*** MCU MAPPING global variables ***/
+
+const ADC_gpio_t ADC_GPIO = { 5 };
+const LPUART_gpio_t LPUART_GPIO_RS485 = { 1 };
+const TIM_gpio_t TIM_GPIO_ACV_FREQUENCY = { 1 };
+const GPIO_pin_t GPIO_ZERO_CROSS_PULSE = { 0, 0 };
+const GPIO_pin_t GPIO_ACI1_DETECT = { 1, 10 };
+const GPIO_pin_t GPIO_ACI2_DETECT = { 1, 11 };
+const GPIO_pin_t GPIO_ACI3_DETECT = { 1, 12 };
+const GPIO_pin_t GPIO_ACI4_DETECT = { 1, 13 };
+const GPIO_pin_t GPIO_S2LP_GPIO0 = { 0, 5 };
+const USART_gpio_t USART_GPIO_GPS = { 2 };
+const GPIO_pin_t GPIO_GPS_VBCKP = { 0, 8 };
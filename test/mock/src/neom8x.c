@@ -0,0 +1,122 @@
+/*
+ * neom8x.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "neom8x.h"
+
+#include "types.h"
+
+/*** NEOM8X local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    NEOM8X_acquisition_t acquisition;
+    uint8_t running_flag;
+    uint8_t sentence_flag;
+    NEOM8X_acquisition_status_t sentence_status;
+    NEOM8X_time_t gps_time;
+    NEOM8X_position_t gps_position;
+    uint8_t backup_voltage;
+} NEOM8X_context_t;
+
+/*** NEOM8X local global variables ***/
+
+static NEOM8X_context_t neom8x_ctx;
+
+/*** NEOM8X functions ***/
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_init(void) {
+    neom8x_ctx.running_flag = 0;
+    neom8x_ctx.sentence_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_de_init(void) {
+    neom8x_ctx.running_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_start_acquisition(NEOM8X_acquisition_t* acquisition) {
+    // Check parameters.
+    if ((acquisition == NULL) || ((acquisition->completion_callback) == NULL) || ((acquisition->process_callback) == NULL)) {
+        return NEOM8X_ERROR_NULL_PARAMETER;
+    }
+    neom8x_ctx.acquisition = (*acquisition);
+    neom8x_ctx.running_flag = 1;
+    neom8x_ctx.sentence_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_stop_acquisition(void) {
+    neom8x_ctx.running_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_process(void) {
+    // Decode pending sentence.
+    if ((neom8x_ctx.running_flag != 0) && (neom8x_ctx.sentence_flag != 0)) {
+        neom8x_ctx.sentence_flag = 0;
+        neom8x_ctx.acquisition.completion_callback(neom8x_ctx.sentence_status);
+    }
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_get_time(NEOM8X_time_t* gps_time) {
+    if (gps_time == NULL) return NEOM8X_ERROR_NULL_PARAMETER;
+    (*gps_time) = neom8x_ctx.gps_time;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_get_position(NEOM8X_position_t* gps_position) {
+    if (gps_position == NULL) return NEOM8X_ERROR_NULL_PARAMETER;
+    (*gps_position) = neom8x_ctx.gps_position;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_set_backup_voltage(uint8_t state) {
+    neom8x_ctx.backup_voltage = state;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+uint8_t NEOM8X_get_backup_voltage(void) {
+    return neom8x_ctx.backup_voltage;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_set_timepulse(NEOM8X_timepulse_configuration_t* configuration) {
+    return ((configuration == NULL) ? NEOM8X_ERROR_NULL_PARAMETER : NEOM8X_SUCCESS);
+}
+
+/*******************************************************************/
+void NEOM8X_MOCK_receive_sentence(NEOM8X_acquisition_status_t acquisition_status, NEOM8X_time_t* gps_time, NEOM8X_position_t* gps_position) {
+    // Sentences are ignored when the acquisition is stopped.
+    if (neom8x_ctx.running_flag == 0) return;
+    // Update decoded data.
+    if (gps_time != NULL) {
+        neom8x_ctx.gps_time = (*gps_time);
+    }
+    if (gps_position != NULL) {
+        neom8x_ctx.gps_position = (*gps_position);
+    }
+    neom8x_ctx.sentence_status = acquisition_status;
+    neom8x_ctx.sentence_flag = 1;
+    // Wake-up the upper layer.
+    neom8x_ctx.acquisition.process_callback();
+}
+
+/*******************************************************************/
+uint8_t NEOM8X_MOCK_is_acquisition_running(void) {
+    return neom8x_ctx.running_flag;
+}
@@ -0,0 +1,106 @@
+/*
+ * neom8x_hw.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "neom8x_hw.h"
+
+#include "neom8x.h"
+#include "neom8x_hw_statistics.h"
+#include "neom8x_hw_ubx.h"
+#include "types.h"
+
+/*** NEOM8X HW local macros ***/
+
+#define NEOM8X_HW_MOCK_TX_BUFFER_SIZE   256
+
+/*** NEOM8X HW local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    NEOM8X_HW_ubx_rx_irq_cb_t ubx_rx_irq_callback;
+    uint8_t rx_running_flag;
+    uint8_t tx_buffer[NEOM8X_HW_MOCK_TX_BUFFER_SIZE];
+    uint32_t tx_size;
+    NEOM8X_HW_statistics_t statistics;
+} NEOM8X_HW_context_t;
+
+/*** NEOM8X HW local global variables ***/
+
+static NEOM8X_HW_context_t neom8x_hw_ctx;
+
+/*** NEOM8X HW functions ***/
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_send_message(uint8_t* message, uint32_t message_size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if (message == NULL) return NEOM8X_ERROR_NULL_PARAMETER;
+    // Store bytes.
+    for (idx = 0; idx < message_size_bytes; idx++) {
+        if (neom8x_hw_ctx.tx_size >= NEOM8X_HW_MOCK_TX_BUFFER_SIZE) break;
+        neom8x_hw_ctx.tx_buffer[neom8x_hw_ctx.tx_size++] = message[idx];
+    }
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_start_rx(void) {
+    neom8x_hw_ctx.rx_running_flag = 1;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_stop_rx(void) {
+    neom8x_hw_ctx.rx_running_flag = 0;
+    neom8x_hw_ctx.tx_size = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+void NEOM8X_HW_get_statistics(NEOM8X_HW_statistics_t* statistics) {
+    if (statistics == NULL) return;
+    (*statistics) = neom8x_hw_ctx.statistics;
+}
+
+/*******************************************************************/
+void NEOM8X_HW_reset_statistics(void) {
+    neom8x_hw_ctx.statistics.rx_byte_count = 0;
+    neom8x_hw_ctx.statistics.rx_irq_count = 0;
+    neom8x_hw_ctx.statistics.rx_overrun_count = 0;
+}
+
+/*******************************************************************/
+void NEOM8X_HW_set_ubx_rx_irq_callback(NEOM8X_HW_ubx_rx_irq_cb_t ubx_rx_irq_callback) {
+    neom8x_hw_ctx.ubx_rx_irq_callback = ubx_rx_irq_callback;
+}
+
+/*******************************************************************/
+void NEOM8X_HW_MOCK_receive(uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check state.
+    if (neom8x_hw_ctx.rx_running_flag == 0) return;
+    // Transmit bytes to the UBX parser.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        neom8x_hw_ctx.statistics.rx_byte_count++;
+        neom8x_hw_ctx.statistics.rx_irq_count++;
+        if (neom8x_hw_ctx.ubx_rx_irq_callback != NULL) {
+            neom8x_hw_ctx.ubx_rx_irq_callback(data[idx]);
+        }
+    }
+}
+
+/*******************************************************************/
+uint32_t NEOM8X_HW_MOCK_get_sent_messages(uint8_t** messages) {
+    (*messages) = neom8x_hw_ctx.tx_buffer;
+    return neom8x_hw_ctx.tx_size;
+}
+
+/*******************************************************************/
+uint8_t NEOM8X_HW_MOCK_is_rx_running(void) {
+    return neom8x_hw_ctx.rx_running_flag;
+}
@@ -0,0 +1,146 @@
+/*
+ * nvm.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "nvm.h"
+
+#include "sys/mman.h"
+#include "types.h"
+
+/*** NVM local macros ***/
+
+// Note: the Cortex-M system control space page is mapped on the host so that the SysTick registers can be accessed.
+#define NVM_MOCK_CORE_SCS_ADDRESS           0xE000E000
+#define NVM_MOCK_CORE_SCS_SIZE_BYTES        0x1000
+#define NVM_MOCK_CORE_SYST_CVR              (*((volatile uint32_t*) 0xE000E018))
+#define NVM_MOCK_CORE_SYST_MASK             0x00FFFFFF
+
+/*** NVM local global variables ***/
+
+static uint8_t nvm_memory[NVM_MOCK_SIZE_BYTES];
+static uint32_t nvm_write_count = 0;
+static uint32_t nvm_read_count = 0;
+static uint32_t nvm_power_loss_remaining_write_count = 0;
+static uint8_t nvm_power_loss_flag = 0;
+static uint8_t nvm_core_mapped_flag = 0;
+
+/*** NVM local functions ***/
+
+/*******************************************************************/
+static uint32_t _NVM_get_byte_address(uint32_t word_address) {
+#ifdef MPMCM
+    return (word_address << 2);
+#else
+    return word_address;
+#endif
+}
+
+/*******************************************************************/
+static void __attribute__((constructor)) _NVM_map_core(void) {
+    // Map system control space.
+    if (mmap((void*) NVM_MOCK_CORE_SCS_ADDRESS, NVM_MOCK_CORE_SCS_SIZE_BYTES, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE), -1, 0) != MAP_FAILED) {
+        nvm_core_mapped_flag = 1;
+    }
+}
+
+/*******************************************************************/
+static uint8_t _NVM_write_allowed(void) {
+    // Emulate programming time.
+    if (nvm_core_mapped_flag != 0) {
+        NVM_MOCK_CORE_SYST_CVR = ((NVM_MOCK_CORE_SYST_CVR - NVM_MOCK_PROGRAMMING_TIME_CYCLES) & NVM_MOCK_CORE_SYST_MASK);
+    }
+    // Check power loss emulation.
+    if (nvm_power_loss_remaining_write_count != 0) {
+        nvm_power_loss_remaining_write_count--;
+        if (nvm_power_loss_remaining_write_count == 0) {
+            nvm_power_loss_flag = 1;
+        }
+        return 1;
+    }
+    return (nvm_power_loss_flag == 0) ? 1 : 0;
+}
+
+/*** NVM functions ***/
+
+/*******************************************************************/
+NVM_status_t NVM_read_byte(uint32_t address, uint8_t* data) {
+    if (data == NULL) return NVM_ERROR_NULL_PARAMETER;
+    if (address >= NVM_MOCK_SIZE_BYTES) return NVM_ERROR_ADDRESS;
+    (*data) = nvm_memory[address];
+    nvm_read_count++;
+    return NVM_SUCCESS;
+}
+
+/*******************************************************************/
+NVM_status_t NVM_write_byte(uint32_t address, uint8_t data) {
+    if (address >= NVM_MOCK_SIZE_BYTES) return NVM_ERROR_ADDRESS;
+    if (_NVM_write_allowed() != 0) {
+        nvm_memory[address] = data;
+        nvm_write_count++;
+    }
+    return NVM_SUCCESS;
+}
+
+/*******************************************************************/
+NVM_status_t NVM_read_word(uint32_t address, uint32_t* data) {
+    // Local variables.
+    uint32_t byte_address = _NVM_get_byte_address(address);
+    uint8_t idx = 0;
+    if (data == NULL) return NVM_ERROR_NULL_PARAMETER;
+    if ((byte_address + 4) > NVM_MOCK_SIZE_BYTES) return NVM_ERROR_ADDRESS;
+    (*data) = 0;
+    for (idx = 0; idx < 4; idx++) {
+        (*data) |= ((uint32_t) nvm_memory[byte_address + idx]) << (idx << 3);
+    }
+    nvm_read_count++;
+    return NVM_SUCCESS;
+}
+
+/*******************************************************************/
+NVM_status_t NVM_write_word(uint32_t address, uint32_t data) {
+    // Local variables.
+    uint32_t byte_address = _NVM_get_byte_address(address);
+    uint8_t idx = 0;
+    if ((byte_address + 4) > NVM_MOCK_SIZE_BYTES) return NVM_ERROR_ADDRESS;
+    if (_NVM_write_allowed() != 0) {
+        for (idx = 0; idx < 4; idx++) {
+            nvm_memory[byte_address + idx] = (uint8_t) ((data >> (idx << 3)) & 0xFF);
+        }
+        nvm_write_count++;
+    }
+    return NVM_SUCCESS;
+}
+
+/*** NVM mock functions ***/
+
+/*******************************************************************/
+void NVM_MOCK_erase(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    for (idx = 0; idx < NVM_MOCK_SIZE_BYTES; idx++) {
+        nvm_memory[idx] = 0x00;
+    }
+    nvm_write_count = 0;
+    nvm_read_count = 0;
+    nvm_power_loss_remaining_write_count = 0;
+    nvm_power_loss_flag = 0;
+}
+
+/*******************************************************************/
+uint32_t NVM_MOCK_get_write_count(void) {
+    return nvm_write_count;
+}
+
+/*******************************************************************/
+uint32_t NVM_MOCK_get_read_count(void) {
+    return nvm_read_count;
+}
+
+/*******************************************************************/
+void NVM_MOCK_set_power_loss(uint32_t remaining_write_count) {
+    nvm_power_loss_remaining_write_count = remaining_write_count;
+    nvm_power_loss_flag = 0;
+}
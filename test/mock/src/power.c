@@ -0,0 +1,47 @@
+/*
+ * power.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "power.h"
+
+#include "lptim.h"
+#include "types.h"
+
+/*** POWER local global variables ***/
+
+static uint32_t power_domain_state[POWER_DOMAIN_LAST];
+
+/*** POWER functions ***/
+
+/*******************************************************************/
+void POWER_init(void) {
+    // Local variables.
+    uint8_t idx = 0;
+    // All domains off.
+    for (idx = 0; idx < POWER_DOMAIN_LAST; idx++) {
+        power_domain_state[idx] = 0;
+    }
+}
+
+/*******************************************************************/
+void POWER_enable(POWER_requester_id_t requester_id, POWER_domain_t domain, LPTIM_delay_mode_t delay_mode) {
+    UNUSED(delay_mode);
+    if ((requester_id < POWER_REQUESTER_ID_LAST) && (domain < POWER_DOMAIN_LAST)) {
+        power_domain_state[domain] |= (0b1 << requester_id);
+    }
+}
+
+/*******************************************************************/
+void POWER_disable(POWER_requester_id_t requester_id, POWER_domain_t domain) {
+    if ((requester_id < POWER_REQUESTER_ID_LAST) && (domain < POWER_DOMAIN_LAST)) {
+        power_domain_state[domain] &= ~(0b1 << requester_id);
+    }
+}
+
+/*******************************************************************/
+uint8_t POWER_get_state(POWER_domain_t domain) {
+    return (((domain < POWER_DOMAIN_LAST) && (power_domain_state[domain] != 0)) ? 1 : 0);
+}
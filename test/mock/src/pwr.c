@@ -0,0 +1,28 @@
+/*
+ * pwr.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "pwr.h"
+
+#include "types.h"
+
+/*** PWR local global variables ***/
+
+static uint32_t pwr_reset_count = 0;
+
+/*** PWR functions ***/
+
+/*******************************************************************/
+void PWR_software_reset(void) {
+    pwr_reset_count++;
+}
+
+/*** PWR mock functions ***/
+
+/*******************************************************************/
+uint32_t PWR_MOCK_get_reset_count(void) {
+    return pwr_reset_count;
+}
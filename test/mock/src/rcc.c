@@ -0,0 +1,39 @@
+/*
+ * rcc.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "rcc.h"
+
+#include "rcc_registers.h"
+#include "types.h"
+
+/*** RCC local macros ***/
+
+#define RCC_MOCK_HSI_FREQUENCY_HZ   16000000
+
+/*** RCC global variables ***/
+
+RCC_registers_t rcc_mock_registers;
+
+/*** RCC functions ***/
+
+/*******************************************************************/
+RCC_status_t RCC_switch_to_hsi(void) {
+    return RCC_SUCCESS;
+}
+
+/*******************************************************************/
+RCC_status_t RCC_switch_to_pll(RCC_pll_configuration_t* pll_configuration) {
+    return ((pll_configuration == NULL) ? RCC_ERROR_NULL_PARAMETER : RCC_SUCCESS);
+}
+
+/*******************************************************************/
+RCC_status_t RCC_get_frequency_hz(RCC_clock_t clock, uint32_t* frequency_hz) {
+    if (frequency_hz == NULL) return RCC_ERROR_NULL_PARAMETER;
+    // System always runs on HSI.
+    (*frequency_hz) = (((clock == RCC_CLOCK_SYSTEM) || (clock == RCC_CLOCK_HSI)) ? RCC_MOCK_HSI_FREQUENCY_HZ : 0);
+    return RCC_SUCCESS;
+}
@@ -0,0 +1,43 @@
+/*
+ * rfe.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "rfe.h"
+
+#include "s2lp.h"
+#include "types.h"
+
+/*** RFE local macros ***/
+
+#define RFE_MOCK_RSSI_DBM   -120
+
+/*** RFE local global variables ***/
+
+static RFE_path_t rfe_path = RFE_PATH_NONE;
+
+/*** RFE functions ***/
+
+/*******************************************************************/
+RFE_status_t RFE_set_path(RFE_path_t radio_path) {
+    if (radio_path >= RFE_PATH_LAST) return RFE_ERROR_PATH;
+    rfe_path = radio_path;
+    return RFE_SUCCESS;
+}
+
+/*******************************************************************/
+RFE_status_t RFE_get_rssi(S2LP_rssi_t rssi_type, int16_t* rssi_dbm) {
+    UNUSED(rssi_type);
+    if (rssi_dbm == NULL) return (RFE_ERROR_BASE_S2LP + S2LP_ERROR_NULL_PARAMETER);
+    (*rssi_dbm) = RFE_MOCK_RSSI_DBM;
+    return RFE_SUCCESS;
+}
+
+/*** RFE mock functions ***/
+
+/*******************************************************************/
+RFE_path_t RFE_MOCK_get_path(void) {
+    return rfe_path;
+}
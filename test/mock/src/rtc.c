@@ -0,0 +1,26 @@
+/*
+ * rtc.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "rtc.h"
+
+#include "types.h"
+
+/*** RTC local global variables ***/
+
+static uint32_t rtc_uptime_seconds = 0;
+
+/*** RTC functions ***/
+
+/*******************************************************************/
+uint32_t RTC_get_uptime_seconds(void) {
+    return rtc_uptime_seconds;
+}
+
+/*******************************************************************/
+void RTC_MOCK_set_uptime_seconds(uint32_t uptime_seconds) {
+    rtc_uptime_seconds = uptime_seconds;
+}
@@ -0,0 +1,356 @@
+/*
+ * s2lp.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "s2lp.h"
+
+#include "exti.h"
+#include "mcu_mapping.h"
+#include "types.h"
+
+/*** S2LP local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    S2LP_state_t state;
+    uint8_t shutdown_flag;
+    uint8_t irq_enable_mask;
+    uint8_t irq_status_mask;
+    uint8_t nirq_enable_flag;
+    uint8_t tx_fifo_threshold;
+    uint8_t tx_fifo_level;
+    uint8_t stream[S2LP_MOCK_STREAM_SIZE_BYTES];
+    uint32_t stream_size_bytes;
+    S2LP_MOCK_statistics_t statistics;
+} S2LP_context_t;
+
+/*** S2LP local global variables ***/
+
+static S2LP_context_t s2lp_ctx;
+
+/*** S2LP local functions ***/
+
+/*******************************************************************/
+static S2LP_status_t _S2LP_spi_transaction(void) {
+    s2lp_ctx.statistics.spi_transaction_count++;
+    return ((s2lp_ctx.shutdown_flag == 0) ? S2LP_SUCCESS : S2LP_ERROR_STATE);
+}
+
+/*** S2LP functions ***/
+
+/*******************************************************************/
+S2LP_status_t S2LP_shutdown(uint8_t shutdown_enable) {
+    // Note: shutdown pin is driven directly by the MCU.
+    s2lp_ctx.shutdown_flag = shutdown_enable;
+    if (shutdown_enable != 0) {
+        s2lp_ctx.state = S2LP_STATE_READY;
+        s2lp_ctx.irq_status_mask = 0;
+        s2lp_ctx.nirq_enable_flag = 0;
+        s2lp_ctx.tx_fifo_level = 0;
+    }
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_send_command(S2LP_command_t command) {
+    // Local variables.
+    S2LP_status_t status = _S2LP_spi_transaction();
+    // Update state.
+    switch (command) {
+    case S2LP_COMMAND_TX:
+        s2lp_ctx.state = S2LP_STATE_TX;
+        break;
+    case S2LP_COMMAND_RX:
+        s2lp_ctx.state = S2LP_STATE_RX;
+        break;
+    case S2LP_COMMAND_LOCKRX:
+    case S2LP_COMMAND_LOCKTX:
+        s2lp_ctx.state = S2LP_STATE_LOCK;
+        break;
+    case S2LP_COMMAND_READY:
+    case S2LP_COMMAND_SABORT:
+        s2lp_ctx.state = S2LP_STATE_READY;
+        break;
+    case S2LP_COMMAND_SRES:
+        s2lp_ctx.state = S2LP_STATE_READY;
+        s2lp_ctx.irq_enable_mask = 0;
+        s2lp_ctx.irq_status_mask = 0;
+        s2lp_ctx.nirq_enable_flag = 0;
+        s2lp_ctx.tx_fifo_level = 0;
+        break;
+    case S2LP_COMMAND_FLUSHTXFIFO:
+        s2lp_ctx.tx_fifo_level = 0;
+        break;
+    default:
+        break;
+    }
+    return status;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_wait_for_state(S2LP_state_t new_state) {
+    // Local variables.
+    S2LP_status_t status = _S2LP_spi_transaction();
+    if ((status == S2LP_SUCCESS) && (s2lp_ctx.state != new_state)) {
+        status = S2LP_ERROR_STATE;
+    }
+    return status;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_oscillator(S2LP_oscillator_t oscillator) {
+    UNUSED(oscillator);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_wait_for_oscillator(void) {
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_common_configuration(void) {
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rf_frequency(uint32_t frequency_hz) {
+    UNUSED(frequency_hz);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rf_output_power(int8_t output_power_dbm) {
+    UNUSED(output_power_dbm);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_modulation(S2LP_modulation_t modulation) {
+    UNUSED(modulation);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_datarate(uint32_t datarate_bps) {
+    UNUSED(datarate_bps);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_fsk_deviation(uint32_t deviation_hz) {
+    UNUSED(deviation_hz);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_smps_frequency(uint32_t frequency_hz) {
+    UNUSED(frequency_hz);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_configure_gpio(S2LP_gpio_t gpio, S2LP_gpio_mode_t mode, S2LP_gpio_output_function_t output_function, S2LP_fifo_flag_direction_t fifo_flag_direction) {
+    UNUSED(mode);
+    UNUSED(fifo_flag_direction);
+    // Only GPIO0 is connected to the MCU.
+    if (gpio == S2LP_GPIO0) {
+        s2lp_ctx.nirq_enable_flag = ((output_function == S2LP_GPIO_OUTPUT_FUNCTION_NIRQ) ? 1 : 0);
+    }
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_configure_irq(S2LP_irq_index_t irq_index, uint8_t irq_enable) {
+    if (irq_index < S2LP_IRQ_INDEX_LAST) {
+        s2lp_ctx.irq_enable_mask &= ~(0b1 << irq_index);
+        s2lp_ctx.irq_enable_mask |= ((irq_enable != 0) ? (0b1 << irq_index) : 0);
+    }
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_disable_all_irq(void) {
+    s2lp_ctx.irq_enable_mask = 0;
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_get_irq_flag(S2LP_irq_index_t irq_index, uint8_t* irq_flag) {
+    if (irq_flag == NULL) return S2LP_ERROR_NULL_PARAMETER;
+    (*irq_flag) = ((irq_index < S2LP_IRQ_INDEX_LAST) && ((s2lp_ctx.irq_status_mask & (0b1 << irq_index)) != 0)) ? 1 : 0;
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_clear_all_irq(void) {
+    // Reading the IRQ status registers releases the nIRQ pin.
+    s2lp_ctx.irq_status_mask = 0;
+    s2lp_ctx.statistics.irq_clear_count++;
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_fifo_threshold(S2LP_fifo_threshold_t fifo_threshold, uint8_t threshold_value) {
+    if (fifo_threshold == S2LP_FIFO_THRESHOLD_TX_EMPTY) {
+        s2lp_ctx.tx_fifo_threshold = threshold_value;
+    }
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_tx_source(S2LP_tx_source_t tx_source) {
+    UNUSED(tx_source);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_write_fifo(uint8_t* tx_data, uint8_t tx_data_size) {
+    // Local variables.
+    uint8_t idx = 0;
+    if (tx_data == NULL) return S2LP_ERROR_NULL_PARAMETER;
+    // Check overflow.
+    if (((uint32_t) s2lp_ctx.tx_fifo_level + (uint32_t) tx_data_size) > S2LP_FIFO_SIZE_BYTES) {
+        s2lp_ctx.statistics.fifo_error_count++;
+        return S2LP_ERROR_FIFO;
+    }
+    // Record samples.
+    for (idx = 0; idx < tx_data_size; idx++) {
+        if (s2lp_ctx.stream_size_bytes < S2LP_MOCK_STREAM_SIZE_BYTES) {
+            s2lp_ctx.stream[s2lp_ctx.stream_size_bytes++] = tx_data[idx];
+        }
+    }
+    s2lp_ctx.tx_fifo_level += tx_data_size;
+    s2lp_ctx.statistics.fifo_write_count++;
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rx_source(S2LP_rx_source_t rx_source) {
+    UNUSED(rx_source);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rx_bandwidth(uint32_t rxbw_hz, S2LP_afc_mode_t afc_mode) {
+    UNUSED(rxbw_hz);
+    UNUSED(afc_mode);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rssi_threshold(int16_t rssi_threshold_dbm) {
+    UNUSED(rssi_threshold_dbm);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_preamble_detector(uint8_t preamble_length_2bits, S2LP_preamble_pattern_t preamble_pattern) {
+    UNUSED(preamble_length_2bits);
+    UNUSED(preamble_pattern);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_sync_word(uint8_t* sync_word, uint8_t sync_word_size_bits) {
+    UNUSED(sync_word);
+    UNUSED(sync_word_size_bits);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_packet_format(uint8_t packet_length_bytes, S2LP_crc_mode_t crc_mode) {
+    UNUSED(packet_length_bytes);
+    UNUSED(crc_mode);
+    return _S2LP_spi_transaction();
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_read_fifo(uint8_t* rx_data, uint8_t rx_data_size) {
+    // Local variables.
+    uint8_t idx = 0;
+    if (rx_data == NULL) return S2LP_ERROR_NULL_PARAMETER;
+    for (idx = 0; idx < rx_data_size; idx++) {
+        rx_data[idx] = 0;
+    }
+    return _S2LP_spi_transaction();
+}
+
+/*** S2LP mock functions ***/
+
+/*******************************************************************/
+void S2LP_MOCK_reset(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Reset model.
+    s2lp_ctx.state = S2LP_STATE_READY;
+    s2lp_ctx.shutdown_flag = 1;
+    s2lp_ctx.irq_enable_mask = 0;
+    s2lp_ctx.irq_status_mask = 0;
+    s2lp_ctx.nirq_enable_flag = 0;
+    s2lp_ctx.tx_fifo_threshold = 0;
+    s2lp_ctx.tx_fifo_level = 0;
+    s2lp_ctx.stream_size_bytes = 0;
+    for (idx = 0; idx < S2LP_MOCK_STREAM_SIZE_BYTES; idx++) {
+        s2lp_ctx.stream[idx] = 0;
+    }
+    // Reset statistics.
+    s2lp_ctx.statistics.spi_transaction_count = 0;
+    s2lp_ctx.statistics.fifo_write_count = 0;
+    s2lp_ctx.statistics.irq_clear_count = 0;
+    s2lp_ctx.statistics.missed_irq_count = 0;
+    s2lp_ctx.statistics.fifo_error_count = 0;
+    s2lp_ctx.statistics.transmitted_size_bytes = 0;
+}
+
+/*******************************************************************/
+void S2LP_MOCK_transmit(uint8_t size_bytes) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Radio only consumes the FIFO in TX state.
+    for (idx = 0; idx < size_bytes; idx++) {
+        if (s2lp_ctx.state != S2LP_STATE_TX) break;
+        // Check underflow.
+        if (s2lp_ctx.tx_fifo_level == 0) {
+            s2lp_ctx.statistics.fifo_error_count++;
+            s2lp_ctx.state = S2LP_STATE_READY;
+            break;
+        }
+        s2lp_ctx.tx_fifo_level--;
+        s2lp_ctx.statistics.transmitted_size_bytes++;
+        // Check threshold crossing.
+        if ((s2lp_ctx.tx_fifo_level != s2lp_ctx.tx_fifo_threshold) || ((s2lp_ctx.irq_enable_mask & (0b1 << S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY)) == 0)) continue;
+        // nIRQ is kept low as long as the previous event has not been cleared: no falling edge is generated.
+        if (s2lp_ctx.irq_status_mask != 0) {
+            s2lp_ctx.statistics.missed_irq_count++;
+            continue;
+        }
+        s2lp_ctx.irq_status_mask |= (0b1 << S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY);
+        if (s2lp_ctx.nirq_enable_flag != 0) {
+            EXTI_MOCK_trigger(&GPIO_S2LP_GPIO0);
+        }
+    }
+}
+
+/*******************************************************************/
+S2LP_state_t S2LP_MOCK_get_state(void) {
+    return s2lp_ctx.state;
+}
+
+/*******************************************************************/
+uint8_t* S2LP_MOCK_get_stream(uint32_t* stream_size_bytes) {
+    if (stream_size_bytes != NULL) {
+        (*stream_size_bytes) = s2lp_ctx.stream_size_bytes;
+    }
+    return s2lp_ctx.stream;
+}
+
+/*******************************************************************/
+void S2LP_MOCK_get_statistics(S2LP_MOCK_statistics_t* statistics) {
+    if (statistics != NULL) {
+        (*statistics) = s2lp_ctx.statistics;
+    }
+}
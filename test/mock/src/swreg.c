@@ -0,0 +1,46 @@
+/*
+ * swreg.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "swreg.h"
+
+#include "types.h"
+
+/*** SWREG functions ***/
+
+/*******************************************************************/
+void SWREG_modify_register(uint32_t* reg_value, uint32_t new_value, uint32_t mask) {
+    (*reg_value) &= (~mask);
+    (*reg_value) |= (new_value & mask);
+}
+
+/*******************************************************************/
+uint32_t SWREG_read_field(uint32_t reg_value, uint32_t field_mask) {
+    // Local variables.
+    uint32_t field_value = (reg_value & field_mask);
+    // Right align field.
+    if (field_mask == 0) return 0;
+    while ((field_mask & 0x00000001) == 0) {
+        field_mask >>= 1;
+        field_value >>= 1;
+    }
+    return field_value;
+}
+
+/*******************************************************************/
+void SWREG_write_field(uint32_t* reg_value, uint32_t* reg_mask, uint32_t field_value, uint32_t field_mask) {
+    // Local variables.
+    uint32_t shifted_value = field_value;
+    uint32_t mask = field_mask;
+    // Left align value on field.
+    if (field_mask == 0) return;
+    while ((mask & 0x00000001) == 0) {
+        mask >>= 1;
+        shifted_value <<= 1;
+    }
+    SWREG_modify_register(reg_value, shifted_value, field_mask);
+    (*reg_mask) |= field_mask;
+}
@@ -0,0 +1,139 @@
+/*
+ * tim.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "tim.h"
+
+#include "rcc.h"
+#include "types.h"
+
+/*** TIM local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t running_flag;
+    TIM_completion_irq_cb_t irq_callback;
+} TIM_context_t;
+
+/*** TIM local global variables ***/
+
+static TIM_context_t tim_ctx[TIM_INSTANCE_LAST];
+
+/*** TIM functions ***/
+
+/*******************************************************************/
+TIM_status_t TIM_STD_init(TIM_instance_t instance, uint8_t nvic_priority) {
+    UNUSED(nvic_priority);
+    return ((instance < TIM_INSTANCE_LAST) ? TIM_SUCCESS : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_STD_de_init(TIM_instance_t instance) {
+    return ((instance < TIM_INSTANCE_LAST) ? TIM_SUCCESS : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_STD_start(TIM_instance_t instance, RCC_clock_t clock_source, uint32_t period, TIM_unit_t unit, TIM_completion_irq_cb_t irq_callback) {
+    // Local variables.
+    TIM_status_t status = TIM_SUCCESS;
+    UNUSED(clock_source);
+    UNUSED(period);
+    UNUSED(unit);
+    // Check instance.
+    if (instance >= TIM_INSTANCE_LAST) {
+        status = TIM_ERROR_INSTANCE;
+        goto errors;
+    }
+    // Register callback.
+    tim_ctx[instance].irq_callback = irq_callback;
+    tim_ctx[instance].running_flag = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_STD_stop(TIM_instance_t instance) {
+    // Local variables.
+    TIM_status_t status = TIM_SUCCESS;
+    // Check instance.
+    if (instance >= TIM_INSTANCE_LAST) {
+        status = TIM_ERROR_INSTANCE;
+        goto errors;
+    }
+    tim_ctx[instance].running_flag = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_IC_init(TIM_instance_t instance, TIM_gpio_t* pins) {
+    UNUSED(pins);
+    return ((instance < TIM_INSTANCE_LAST) ? TIM_SUCCESS : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_IC_de_init(TIM_instance_t instance, TIM_gpio_t* pins) {
+    UNUSED(pins);
+    return ((instance < TIM_INSTANCE_LAST) ? TIM_SUCCESS : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_IC_start_channel(TIM_instance_t instance, TIM_channel_t channel, uint32_t capture_frequency_hz, TIM_capture_prescaler_t capture_prescaler) {
+    UNUSED(capture_frequency_hz);
+    UNUSED(capture_prescaler);
+    return ((instance < TIM_INSTANCE_LAST) ? ((channel < TIM_CHANNEL_LAST) ? TIM_SUCCESS : TIM_ERROR_CHANNEL) : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_IC_stop_channel(TIM_instance_t instance, TIM_channel_t channel) {
+    return ((instance < TIM_INSTANCE_LAST) ? ((channel < TIM_CHANNEL_LAST) ? TIM_SUCCESS : TIM_ERROR_CHANNEL) : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+uint32_t TIM_get_ccr_register_address(TIM_instance_t instance, TIM_channel_t channel) {
+    UNUSED(instance);
+    UNUSED(channel);
+    return 0;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_init(TIM_instance_t instance, uint8_t nvic_priority) {
+    UNUSED(nvic_priority);
+    return ((instance < TIM_INSTANCE_LAST) ? TIM_SUCCESS : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_de_init(TIM_instance_t instance) {
+    return ((instance < TIM_INSTANCE_LAST) ? TIM_SUCCESS : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_start_channel(TIM_instance_t instance, TIM_channel_t channel, uint32_t duration_ms, TIM_waiting_mode_t waiting_mode) {
+    UNUSED(duration_ms);
+    UNUSED(waiting_mode);
+    return ((instance < TIM_INSTANCE_LAST) ? ((channel < TIM_CHANNEL_LAST) ? TIM_SUCCESS : TIM_ERROR_CHANNEL) : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_stop_channel(TIM_instance_t instance, TIM_channel_t channel) {
+    return ((instance < TIM_INSTANCE_LAST) ? ((channel < TIM_CHANNEL_LAST) ? TIM_SUCCESS : TIM_ERROR_CHANNEL) : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_get_channel_status(TIM_instance_t instance, TIM_channel_t channel, uint8_t* channel_has_elapsed) {
+    if (channel_has_elapsed == NULL) return TIM_ERROR_NULL_PARAMETER;
+    // Timers never elapse.
+    (*channel_has_elapsed) = 0;
+    return ((instance < TIM_INSTANCE_LAST) ? ((channel < TIM_CHANNEL_LAST) ? TIM_SUCCESS : TIM_ERROR_CHANNEL) : TIM_ERROR_INSTANCE);
+}
+
+/*******************************************************************/
+void TIM_MOCK_trigger(TIM_instance_t instance) {
+    // Call registered callback.
+    if ((instance < TIM_INSTANCE_LAST) && (tim_ctx[instance].running_flag != 0) && (tim_ctx[instance].irq_callback != NULL)) {
+        tim_ctx[instance].irq_callback();
+    }
+}
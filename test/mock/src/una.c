@@ -0,0 +1,51 @@
+/*
+ * una.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una.h"
+
+#include "types.h"
+
+/*** UNA local macros ***/
+
+#define UNA_DATA_FIELD_MASK     0x0000FFFF
+
+/*** UNA functions ***/
+
+/*******************************************************************/
+uint32_t UNA_convert_mv(int32_t voltage_mv) {
+    return (((uint32_t) voltage_mv) & UNA_DATA_FIELD_MASK);
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_ua(int32_t current_ua) {
+    return (((uint32_t) current_ua) & UNA_DATA_FIELD_MASK);
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_mw_mva(int32_t power_mw_mva) {
+    return (((uint32_t) power_mw_mva) & UNA_DATA_FIELD_MASK);
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_mwh_mvah(int32_t energy_mwh_mvah) {
+    return (((uint32_t) energy_mwh_mvah) & UNA_DATA_FIELD_MASK);
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_power_factor(int32_t power_factor) {
+    return (((uint32_t) power_factor) & UNA_DATA_FIELD_MASK);
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_seconds(uint32_t time_seconds) {
+    return time_seconds;
+}
+
+/*******************************************************************/
+uint32_t UNA_get_seconds(uint32_t una_time) {
+    return una_time;
+}
@@ -0,0 +1,139 @@
+/*
+ * usart.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "usart.h"
+
+#include "dma.h"
+#include "types.h"
+
+/*** USART local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t init_flag;
+    uint8_t rx_enable_flag;
+    USART_configuration_t configuration;
+    uint8_t tx_buffer[USART_MOCK_TX_BUFFER_SIZE];
+    uint32_t tx_buffer_size;
+} USART_context_t;
+
+/*** USART local global variables ***/
+
+static USART_context_t usart_ctx[USART_INSTANCE_LAST];
+
+static const DMAMUX_peripheral_request_t USART_RX_DMA_REQUEST[USART_INSTANCE_LAST] = {
+    DMAMUX_PERIPHERAL_REQUEST_USART1_RX,
+    DMAMUX_PERIPHERAL_REQUEST_USART2_RX
+};
+
+/*** USART functions ***/
+
+/*******************************************************************/
+USART_status_t USART_init(USART_instance_t instance, const USART_gpio_t* pins, USART_configuration_t* configuration) {
+    // Check parameters.
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    if ((pins == NULL) || (configuration == NULL)) return USART_ERROR_NULL_PARAMETER;
+    if (configuration->baud_rate == 0) return USART_ERROR_BAUD_RATE;
+    // Save configuration.
+    usart_ctx[instance].configuration = (*configuration);
+    usart_ctx[instance].rx_enable_flag = 0;
+    usart_ctx[instance].tx_buffer_size = 0;
+    usart_ctx[instance].init_flag = 1;
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_de_init(USART_instance_t instance, const USART_gpio_t* pins) {
+    // Check parameters.
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    if (pins == NULL) return USART_ERROR_NULL_PARAMETER;
+    // Release peripheral.
+    usart_ctx[instance].init_flag = 0;
+    usart_ctx[instance].rx_enable_flag = 0;
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_enable_rx(USART_instance_t instance) {
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    if (usart_ctx[instance].init_flag == 0) return USART_ERROR_UNINITIALIZED;
+    usart_ctx[instance].rx_enable_flag = 1;
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_disable_rx(USART_instance_t instance) {
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    if (usart_ctx[instance].init_flag == 0) return USART_ERROR_UNINITIALIZED;
+    usart_ctx[instance].rx_enable_flag = 0;
+    usart_ctx[instance].tx_buffer_size = 0;
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_write(USART_instance_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    USART_context_t* context = NULL;
+    uint32_t idx = 0;
+    // Check parameters.
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    if (data == NULL) return USART_ERROR_NULL_PARAMETER;
+    context = &(usart_ctx[instance]);
+    if (context->init_flag == 0) return USART_ERROR_UNINITIALIZED;
+    // Store bytes.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        if (context->tx_buffer_size >= USART_MOCK_TX_BUFFER_SIZE) break;
+        context->tx_buffer[context->tx_buffer_size++] = data[idx];
+    }
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+uint32_t USART_get_rdr_register_address(USART_instance_t instance) {
+    // Note: the DMA mock does not read the peripheral address.
+    return ((instance < USART_INSTANCE_LAST) ? (0x40004424 + (instance * 0x400)) : 0);
+}
+
+/*******************************************************************/
+void USART_MOCK_receive(USART_instance_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    USART_context_t* context = NULL;
+    uint32_t idx = 0;
+    // Check state.
+    if ((instance >= USART_INSTANCE_LAST) || (data == NULL)) return;
+    context = &(usart_ctx[instance]);
+    if (context->rx_enable_flag == 0) return;
+    // Receive bytes.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        if (context->configuration.rxne_irq_callback != NULL) {
+            context->configuration.rxne_irq_callback(data[idx]);
+        }
+        else {
+            DMA_MOCK_request(USART_RX_DMA_REQUEST[instance], data[idx]);
+        }
+        if ((context->configuration.cm_irq_callback != NULL) && (data[idx] == context->configuration.match_character)) {
+            context->configuration.cm_irq_callback();
+        }
+    }
+    // Idle line at the end of the burst.
+    if (context->configuration.idle_irq_callback != NULL) {
+        context->configuration.idle_irq_callback();
+    }
+}
+
+/*******************************************************************/
+uint32_t USART_MOCK_get_sent_data(USART_instance_t instance, uint8_t** data) {
+    // Check parameters.
+    if ((instance >= USART_INSTANCE_LAST) || (data == NULL)) return 0;
+    (*data) = usart_ctx[instance].tx_buffer;
+    return usart_ctx[instance].tx_buffer_size;
+}
+
+/*******************************************************************/
+uint8_t USART_MOCK_is_rx_enabled(USART_instance_t instance) {
+    return ((instance < USART_INSTANCE_LAST) ? usart_ctx[instance].rx_enable_flag : 0);
+}
@@ -0,0 +1,90 @@
+/*
+ * test.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "test.h"
+
+#include "math.h"
+#include "stdarg.h"
+#include "stdio.h"
+#include "time.h"
+#include "types.h"
+
+/*** TEST local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char_t* suite_name;
+    uint32_t check_count;
+    uint32_t fail_count;
+} TEST_context_t;
+
+/*** TEST local global variables ***/
+
+static TEST_context_t test_ctx;
+
+/*** TEST functions ***/
+
+/*******************************************************************/
+void TEST_start(const char_t* suite_name) {
+    // Reset context.
+    test_ctx.suite_name = suite_name;
+    test_ctx.check_count = 0;
+    test_ctx.fail_count = 0;
+    printf("[SUITE] %s\n", suite_name);
+}
+
+/*******************************************************************/
+void TEST_check(uint8_t condition, const char_t* check_name) {
+    // Update counters.
+    test_ctx.check_count++;
+    if (condition == 0) {
+        test_ctx.fail_count++;
+    }
+    printf("[%s] %s: %s\n", ((condition != 0) ? "PASS" : "FAIL"), test_ctx.suite_name, check_name);
+}
+
+/*******************************************************************/
+void TEST_check_value(float64_t value, float64_t expected, float64_t tolerance, const char_t* check_name) {
+    // Local variables.
+    uint8_t condition = (fabs(value - expected) <= tolerance) ? 1 : 0;
+    // Update counters.
+    test_ctx.check_count++;
+    if (condition == 0) {
+        test_ctx.fail_count++;
+    }
+    printf("[%s] %s: %s (value=%.3f expected=%.3f tolerance=%.3f)\n", ((condition != 0) ? "PASS" : "FAIL"), test_ctx.suite_name, check_name, value, expected, tolerance);
+}
+
+/*******************************************************************/
+void TEST_check_relative(float64_t value, float64_t expected, float64_t tolerance_percent, const char_t* check_name) {
+    TEST_check_value(value, expected, fabs((expected * tolerance_percent) / 100.0), check_name);
+}
+
+/*******************************************************************/
+uint64_t TEST_get_time_ns(void) {
+    // Local variables.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((((uint64_t) now.tv_sec) * 1000000000ULL) + ((uint64_t) now.tv_nsec));
+}
+
+/*******************************************************************/
+void TEST_bench(const char_t* bench_name, const char_t* format, ...) {
+    // Local variables.
+    va_list args;
+    printf("[BENCH] %s: %s: ", test_ctx.suite_name, bench_name);
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+}
+
+/*******************************************************************/
+int TEST_end(void) {
+    printf("[RESULT] %s: %u/%u checks passed\n", test_ctx.suite_name, (test_ctx.check_count - test_ctx.fail_count), test_ctx.check_count);
+    return ((test_ctx.fail_count == 0) ? 0 : 1);
+}
@@ -0,0 +1,189 @@
+/*
+ * test_crc.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "manuf/mcu_api.h"
+
+#include "crc_registers.h"
+#include "error.h"
+#include "rcc_registers.h"
+#include "sigfox_types.h"
+#include "stm32g4xx_registers_flags.h"
+#include "test.h"
+#include "types.h"
+
+/*** TEST CRC local macros ***/
+
+#ifndef TEST_CRC_VARIANT
+#define TEST_CRC_VARIANT                    "default"
+#endif
+
+#define TEST_CRC_CRC16_POLYNOMIAL           0x1021
+#define TEST_CRC_CRC8_POLYNOMIAL            0x07
+
+#define TEST_CRC_NUMBER_OF_BUFFERS          200
+#define TEST_CRC_BUFFER_SIZE_MAX_BYTES      32
+// Uplink frame CRC covers the header, the end-point ID and a 12 bytes payload.
+#define TEST_CRC_FRAME_SIZE_BYTES           20
+#define TEST_CRC_BENCH_NUMBER_OF_FRAMES     200
+
+#define TEST_CRC_RCC_CRCEN                  (0b1 << 12)
+#ifdef STM32G4XX_REGISTERS_DISABLE
+#define TEST_CRC_RCC_AHBENR                 (RCC->AHBENR)
+#else
+#define TEST_CRC_RCC_AHBENR                 (RCC->AHB1ENR)
+#endif
+
+/*** TEST CRC local global variables ***/
+
+static uint32_t test_crc_random = 0x2545F491;
+
+/*** TEST CRC local functions ***/
+
+/*******************************************************************/
+static uint8_t _TEST_CRC_random(void) {
+    // Xorshift generator.
+    test_crc_random ^= (test_crc_random << 13);
+    test_crc_random ^= (test_crc_random >> 17);
+    test_crc_random ^= (test_crc_random << 5);
+    return ((uint8_t) (test_crc_random >> 24));
+}
+
+/*******************************************************************/
+static uint16_t _TEST_CRC_reference_crc16(uint8_t* data, uint8_t data_size, uint16_t polynomial) {
+    // Local variables.
+    uint16_t crc = 0;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // Bitwise MSB first computation with null initial value.
+    for (idx = 0; idx < data_size; idx++) {
+        crc ^= (uint16_t) (data[idx] << 8);
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x8000) != 0) ? (uint16_t) ((crc << 1) ^ polynomial) : (uint16_t) (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************/
+static uint8_t _TEST_CRC_reference_crc8(uint8_t* data, uint8_t data_size, uint8_t polynomial) {
+    // Local variables.
+    uint8_t crc = 0;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // Bitwise MSB first computation with null initial value.
+    for (idx = 0; idx < data_size; idx++) {
+        crc ^= data[idx];
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x80) != 0) ? (uint8_t) ((crc << 1) ^ polynomial) : (uint8_t) (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************/
+static void _TEST_CRC_open(void) {
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+    // Local variables.
+    MCU_API_config_t mcu_api_config = { .rc = NULL };
+    MCU_API_open(&mcu_api_config);
+#endif
+}
+
+/*******************************************************************/
+static void _TEST_CRC_close(void) {
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+    MCU_API_close();
+#endif
+}
+
+/*******************************************************************/
+static void _TEST_CRC_random_buffers(void) {
+    // Local variables.
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+    uint8_t data[TEST_CRC_BUFFER_SIZE_MAX_BYTES];
+    uint8_t data_size = 0;
+    uint16_t crc16 = 0;
+    uint8_t crc8 = 0;
+    uint32_t status_error_count = 0;
+    uint32_t crc16_error_count = 0;
+    uint32_t crc8_error_count = 0;
+    uint32_t clock_error_count = 0;
+    uint32_t buffer_idx = 0;
+    uint8_t idx = 0;
+    // Init.
+    ERROR_stack_init();
+    _TEST_CRC_open();
+    for (buffer_idx = 0; buffer_idx < TEST_CRC_NUMBER_OF_BUFFERS; buffer_idx++) {
+        // Random size and content.
+        data_size = (uint8_t) (1 + (_TEST_CRC_random() % TEST_CRC_BUFFER_SIZE_MAX_BYTES));
+        for (idx = 0; idx < data_size; idx++) {
+            data[idx] = _TEST_CRC_random();
+        }
+        mcu_api_status = MCU_API_compute_crc16(data, data_size, TEST_CRC_CRC16_POLYNOMIAL, &crc16);
+        if (mcu_api_status != MCU_API_SUCCESS) status_error_count++;
+        if (crc16 != _TEST_CRC_reference_crc16(data, data_size, TEST_CRC_CRC16_POLYNOMIAL)) crc16_error_count++;
+        mcu_api_status = MCU_API_compute_crc8(data, data_size, TEST_CRC_CRC8_POLYNOMIAL, &crc8);
+        if (mcu_api_status != MCU_API_SUCCESS) status_error_count++;
+        if (crc8 != _TEST_CRC_reference_crc8(data, data_size, TEST_CRC_CRC8_POLYNOMIAL)) crc8_error_count++;
+        // Peripheral clock is kept during the session only.
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+        if ((TEST_CRC_RCC_AHBENR & TEST_CRC_RCC_CRCEN) == 0) clock_error_count++;
+#else
+        if ((TEST_CRC_RCC_AHBENR & TEST_CRC_RCC_CRCEN) != 0) clock_error_count++;
+#endif
+    }
+    _TEST_CRC_close();
+    TEST_check((status_error_count == 0), "status");
+    TEST_check((crc16_error_count == 0), "crc16 random buffers");
+    TEST_check((crc8_error_count == 0), "crc8 random buffers");
+    TEST_check((clock_error_count == 0), "peripheral clock during computation");
+    TEST_check(((TEST_CRC_RCC_AHBENR & TEST_CRC_RCC_CRCEN) == 0), "peripheral clock released");
+    TEST_check((MCU_API_compute_crc16(data, data_size, TEST_CRC_CRC16_POLYNOMIAL, SIGFOX_NULL) != MCU_API_SUCCESS), "null parameter");
+    TEST_check((ERROR_stack_is_empty() != 0), "error stack empty");
+}
+
+/*******************************************************************/
+static void _TEST_CRC_bench(void) {
+    // Local variables.
+    uint8_t data[TEST_CRC_FRAME_SIZE_BYTES];
+    uint16_t crc16 = 0;
+    uint64_t start_ns = 0;
+    uint64_t duration_ns = 0;
+    uint32_t access_count = 0;
+    uint32_t idx = 0;
+    for (idx = 0; idx < TEST_CRC_FRAME_SIZE_BYTES; idx++) {
+        data[idx] = _TEST_CRC_random();
+    }
+    access_count = CRC_MOCK_get_access_count();
+    // One session per frame, as performed by the library in low level open/close mode.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_CRC_BENCH_NUMBER_OF_FRAMES; idx++) {
+        _TEST_CRC_open();
+        MCU_API_compute_crc16(data, TEST_CRC_FRAME_SIZE_BYTES, TEST_CRC_CRC16_POLYNOMIAL, &crc16);
+        _TEST_CRC_close();
+    }
+    duration_ns = (TEST_get_time_ns() - start_ns);
+    access_count = (CRC_MOCK_get_access_count() - access_count);
+    // Note: each register access is trapped on the host, the register access count is the relevant figure for the target.
+    TEST_bench("frame crc16 " TEST_CRC_VARIANT, "time=%.2fns/frame register_accesses=%.1f/frame",
+        ((float64_t) duration_ns) / ((float64_t) TEST_CRC_BENCH_NUMBER_OF_FRAMES),
+        ((float64_t) access_count) / ((float64_t) TEST_CRC_BENCH_NUMBER_OF_FRAMES));
+}
+
+/*** TEST CRC main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("crc_" TEST_CRC_VARIANT);
+    if (CRC_MOCK_init() == 0) {
+        TEST_check(0, "crc registers mapping");
+        return TEST_end();
+    }
+    _TEST_CRC_random_buffers();
+    _TEST_CRC_bench();
+    return TEST_end();
+}
@@ -0,0 +1,149 @@
+/*
+ * test_data.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "data.h"
+#include "maths.h"
+#include "math.h"
+#include "stdio.h"
+#include "test.h"
+#include "types.h"
+
+/*** TEST DATA local macros ***/
+
+// Note: one run sum holds about 50 periods per second.
+#define TEST_DATA_RUN_NUMBER_OF_SAMPLES             60
+// Note: one accumulated data holds one sample per second (1 hour).
+#define TEST_DATA_ACCUMULATED_NUMBER_OF_SAMPLES     3600
+
+#define TEST_DATA_BENCH_NUMBER_OF_ITERATIONS        1000000
+
+// Previous rolling mean implementation.
+#define TEST_DATA_rolling_mean(rolling_mean, number_of_values, new_value, type) { \
+    rolling_mean = (type) (((rolling_mean * ((type) number_of_values)) + ((type) new_value)) / ((type) (number_of_values + 1))); \
+}
+
+/*** TEST DATA local global variables ***/
+
+// Note: volatile input prevents the compiler from folding the benchmark loops.
+static volatile float64_t test_data_sample = 230000.0;
+
+/*** TEST DATA local functions ***/
+
+/*******************************************************************/
+static float64_t _TEST_DATA_get_sample(uint32_t idx) {
+    // Mains voltage around 230V with a slow variation.
+    return (230000.0 + (1500.0 * sin(((float64_t) idx) * 0.37)));
+}
+
+/*******************************************************************/
+static void _TEST_DATA_run(void) {
+    // Local variables.
+    DATA_run_sum_t run_sum;
+    DATA_run_t run_data;
+    float64_t rolling_mean = 0.0;
+    float64_t sum = 0.0;
+    float64_t sample = 0.0;
+    uint32_t idx = 0;
+    // Empty data.
+    DATA_reset_run_sum(run_sum);
+    DATA_compute_run(run_sum, run_data);
+    TEST_check(((run_data.value == 0.0) && (run_data.number_of_samples == 0)), "run empty");
+    // Accumulate samples.
+    for (idx = 0; idx < TEST_DATA_RUN_NUMBER_OF_SAMPLES; idx++) {
+        sample = _TEST_DATA_get_sample(idx);
+        DATA_add_run_sample(run_sum, sample);
+        TEST_DATA_rolling_mean(rolling_mean, idx, sample, float64_t);
+        sum += sample;
+    }
+    DATA_compute_run(run_sum, run_data);
+    TEST_check((run_data.number_of_samples == TEST_DATA_RUN_NUMBER_OF_SAMPLES), "run number of samples");
+    // Note: float32 sum error is bounded by n * 2^-24 relative.
+    TEST_check_relative(run_data.value, (sum / TEST_DATA_RUN_NUMBER_OF_SAMPLES), ((100.0 * TEST_DATA_RUN_NUMBER_OF_SAMPLES) / 16777216.0), "run mean");
+    TEST_check_value(run_data.value, rolling_mean, 1.0, "run mean vs rolling mean");
+}
+
+/*******************************************************************/
+static void _TEST_DATA_accumulated(void) {
+    // Local variables.
+    DATA_accumulated_t accumulated_data;
+    DATA_accumulated_t accumulated_data_copy;
+    DATA_run_t run_data;
+    float64_t sample_abs = 0.0;
+    float64_t ref_abs = 0.0;
+    float64_t rolling_mean = 0.0;
+    float64_t min = 1.0e308;
+    float64_t max = 0.0;
+    uint32_t idx = 0;
+    // Reset.
+    DATA_reset_accumulated(accumulated_data);
+    // Invalid run data is ignored.
+    run_data.value = 1.0;
+    run_data.number_of_samples = 0;
+    DATA_add_accumulated_sample(accumulated_data, run_data);
+    TEST_check((accumulated_data.number_of_samples == 0), "accumulated invalid sample ignored");
+    // Accumulate samples.
+    for (idx = 0; idx < TEST_DATA_ACCUMULATED_NUMBER_OF_SAMPLES; idx++) {
+        run_data.value = _TEST_DATA_get_sample(idx);
+        run_data.number_of_samples = 1;
+        DATA_add_accumulated_sample(accumulated_data, run_data);
+        TEST_DATA_rolling_mean(rolling_mean, idx, run_data.value, float64_t);
+        if (run_data.value < min) {
+            min = run_data.value;
+        }
+        if (run_data.value > max) {
+            max = run_data.value;
+        }
+    }
+    DATA_copy_accumulated(accumulated_data, accumulated_data_copy);
+    TEST_check((accumulated_data_copy.number_of_samples == TEST_DATA_ACCUMULATED_NUMBER_OF_SAMPLES), "accumulated number of samples");
+    TEST_check_value(accumulated_data_copy.min, min, 0.0, "accumulated min");
+    TEST_check_value(accumulated_data_copy.max, max, 0.0, "accumulated max");
+    TEST_check_relative(accumulated_data_copy.mean, rolling_mean, 1.0e-9, "accumulated mean vs rolling mean");
+}
+
+/*******************************************************************/
+static void _TEST_DATA_bench(void) {
+    // Local variables.
+    DATA_run_sum_t run_sum;
+    DATA_run_t run_data;
+    volatile float64_t rolling_mean = 0.0;
+    uint64_t start_ns = 0;
+    uint64_t sum_duration_ns = 0;
+    uint64_t rolling_mean_duration_ns = 0;
+    uint32_t idx = 0;
+    // Sum accumulator.
+    DATA_reset_run_sum(run_sum);
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_DATA_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        DATA_add_run_sample(run_sum, test_data_sample);
+    }
+    DATA_compute_run(run_sum, run_data);
+    sum_duration_ns = (TEST_get_time_ns() - start_ns);
+    // Previous rolling mean.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_DATA_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        TEST_DATA_rolling_mean(rolling_mean, idx, test_data_sample, float64_t);
+    }
+    rolling_mean_duration_ns = (TEST_get_time_ns() - start_ns);
+    TEST_check((run_data.number_of_samples == TEST_DATA_BENCH_NUMBER_OF_ITERATIONS), "bench number of samples");
+    // Note: host FPU has double precision, the gap is much larger on the Cortex-M4 where float64 operations are emulated.
+    TEST_bench("run update", "sum=%.2fns rolling_mean=%.2fns ratio=%.2f",
+        ((float64_t) sum_duration_ns) / TEST_DATA_BENCH_NUMBER_OF_ITERATIONS,
+        ((float64_t) rolling_mean_duration_ns) / TEST_DATA_BENCH_NUMBER_OF_ITERATIONS,
+        ((float64_t) rolling_mean_duration_ns) / ((float64_t) sum_duration_ns));
+}
+
+/*** TEST DATA main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("data");
+    _TEST_DATA_run();
+    _TEST_DATA_accumulated();
+    _TEST_DATA_bench();
+    return TEST_end();
+}
@@ -0,0 +1,283 @@
+/*
+ * test_dbpsk.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "dbpsk.h"
+#include "test.h"
+#include "types.h"
+
+/*** TEST DBPSK local macros ***/
+
+// Uplink bitstream of a 12 bytes frame.
+#define TEST_DBPSK_BITSTREAM_SIZE_BYTES         26
+// Ramp-up, ramp-down and padding symbols.
+#define TEST_DBPSK_STREAM_SIZE_BYTES_MAX        (((TEST_DBPSK_BITSTREAM_SIZE_BYTES * 8) + 3) * DBPSK_SYMBOL_SIZE_BYTES)
+#define TEST_DBPSK_FIFO_SIZE_BYTES              128
+// Refill size of the radio driver (FIFO size minus half a symbol).
+#define TEST_DBPSK_REFILL_SIZE_BYTES            (TEST_DBPSK_FIFO_SIZE_BYTES - (DBPSK_SYMBOL_SIZE_BYTES >> 1))
+#define TEST_DBPSK_NUMBER_OF_FRAMES             200
+#define TEST_DBPSK_BENCH_NUMBER_OF_ITERATIONS   2000
+
+#define TEST_DBPSK_FDEV_NEGATIVE                0x7F
+#define TEST_DBPSK_FDEV_POSITIVE                0x81
+#define TEST_DBPSK_FDEV_IDX                     (DBPSK_SYMBOL_PROFILE_SIZE_BYTES >> 1)
+
+/*** TEST DBPSK local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    TEST_DBPSK_SYMBOL_RAMP_UP = 0,
+    TEST_DBPSK_SYMBOL_BIT_0,
+    TEST_DBPSK_SYMBOL_BIT_1,
+    TEST_DBPSK_SYMBOL_RAMP_DOWN,
+    TEST_DBPSK_SYMBOL_PADDING,
+    TEST_DBPSK_SYMBOL_END
+} TEST_DBPSK_symbol_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t* bitstream;
+    uint8_t bitstream_size_bytes;
+    uint8_t byte_idx;
+    uint8_t bit_idx;
+    TEST_DBPSK_symbol_t symbol;
+    uint8_t sample_idx;
+    uint8_t fdev;
+} TEST_DBPSK_reference_context_t;
+
+/*** TEST DBPSK local global variables ***/
+
+// Amplitude profiles of the previous on-the-fly encoder.
+static const uint8_t TEST_DBPSK_RAMP_AMPLITUDE_PROFILE[DBPSK_SYMBOL_PROFILE_SIZE_BYTES] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 5, 7, 10, 14, 19, 25, 31, 39, 60, 220 };
+static const uint8_t TEST_DBPSK_BIT0_AMPLITUDE_PROFILE[DBPSK_SYMBOL_PROFILE_SIZE_BYTES] = { 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 5, 7, 10, 14, 19, 25, 31, 39, 60, 220, 220, 60, 39, 31, 25, 19, 14, 10, 7, 5, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1 };
+
+static TEST_DBPSK_reference_context_t test_dbpsk_ref_ctx;
+static uint32_t test_dbpsk_random = 0x12345678;
+
+/*** TEST DBPSK local functions ***/
+
+/*******************************************************************/
+static uint8_t _TEST_DBPSK_random(void) {
+    // Xorshift generator.
+    test_dbpsk_random ^= (test_dbpsk_random << 13);
+    test_dbpsk_random ^= (test_dbpsk_random >> 17);
+    test_dbpsk_random ^= (test_dbpsk_random << 5);
+    return ((uint8_t) (test_dbpsk_random >> 24));
+}
+
+/*******************************************************************/
+static void _TEST_DBPSK_reference_start(uint8_t* bitstream, uint8_t bitstream_size_bytes) {
+    // Note: deviation sign is kept from the previous stream as in the radio driver.
+    test_dbpsk_ref_ctx.bitstream = bitstream;
+    test_dbpsk_ref_ctx.bitstream_size_bytes = bitstream_size_bytes;
+    test_dbpsk_ref_ctx.byte_idx = 0;
+    test_dbpsk_ref_ctx.bit_idx = 0;
+    test_dbpsk_ref_ctx.symbol = TEST_DBPSK_SYMBOL_RAMP_UP;
+    test_dbpsk_ref_ctx.sample_idx = 0;
+}
+
+/*******************************************************************/
+static void _TEST_DBPSK_reference_start_symbol(void) {
+    // Previous symbol sequencing.
+    switch (test_dbpsk_ref_ctx.symbol) {
+    case TEST_DBPSK_SYMBOL_RAMP_UP:
+    case TEST_DBPSK_SYMBOL_BIT_0:
+    case TEST_DBPSK_SYMBOL_BIT_1:
+        if (test_dbpsk_ref_ctx.byte_idx >= test_dbpsk_ref_ctx.bitstream_size_bytes) {
+            test_dbpsk_ref_ctx.symbol = TEST_DBPSK_SYMBOL_RAMP_DOWN;
+            break;
+        }
+        if ((test_dbpsk_ref_ctx.bitstream[test_dbpsk_ref_ctx.byte_idx] & (1 << (7 - test_dbpsk_ref_ctx.bit_idx))) == 0) {
+            test_dbpsk_ref_ctx.fdev = (test_dbpsk_ref_ctx.fdev == TEST_DBPSK_FDEV_NEGATIVE) ? TEST_DBPSK_FDEV_POSITIVE : TEST_DBPSK_FDEV_NEGATIVE;
+            test_dbpsk_ref_ctx.symbol = TEST_DBPSK_SYMBOL_BIT_0;
+        }
+        else {
+            test_dbpsk_ref_ctx.symbol = TEST_DBPSK_SYMBOL_BIT_1;
+        }
+        test_dbpsk_ref_ctx.bit_idx++;
+        if (test_dbpsk_ref_ctx.bit_idx >= 8) {
+            test_dbpsk_ref_ctx.bit_idx = 0;
+            test_dbpsk_ref_ctx.byte_idx++;
+        }
+        break;
+    case TEST_DBPSK_SYMBOL_RAMP_DOWN:
+        test_dbpsk_ref_ctx.symbol = TEST_DBPSK_SYMBOL_PADDING;
+        break;
+    default:
+        test_dbpsk_ref_ctx.symbol = TEST_DBPSK_SYMBOL_END;
+        break;
+    }
+}
+
+/*******************************************************************/
+static uint8_t _TEST_DBPSK_reference_fill_buffer(uint8_t* buffer, uint8_t size_bytes) {
+    // Local variables.
+    uint8_t sample_idx = 0;
+    uint8_t idx = 0;
+    // Previous per-sample computation.
+    for (idx = 0; idx < size_bytes; idx += 2) {
+        if (test_dbpsk_ref_ctx.symbol == TEST_DBPSK_SYMBOL_END) break;
+        sample_idx = test_dbpsk_ref_ctx.sample_idx;
+        switch (test_dbpsk_ref_ctx.symbol) {
+        case TEST_DBPSK_SYMBOL_RAMP_UP:
+            buffer[idx] = 0;
+            buffer[idx + 1] = TEST_DBPSK_RAMP_AMPLITUDE_PROFILE[DBPSK_SYMBOL_PROFILE_SIZE_BYTES - sample_idx - 1];
+            break;
+        case TEST_DBPSK_SYMBOL_BIT_0:
+            buffer[idx] = (sample_idx == TEST_DBPSK_FDEV_IDX) ? test_dbpsk_ref_ctx.fdev : 0;
+            buffer[idx + 1] = TEST_DBPSK_BIT0_AMPLITUDE_PROFILE[sample_idx];
+            break;
+        case TEST_DBPSK_SYMBOL_BIT_1:
+            buffer[idx] = 0;
+            buffer[idx + 1] = TEST_DBPSK_BIT0_AMPLITUDE_PROFILE[0];
+            break;
+        case TEST_DBPSK_SYMBOL_RAMP_DOWN:
+            buffer[idx] = 0;
+            buffer[idx + 1] = TEST_DBPSK_RAMP_AMPLITUDE_PROFILE[sample_idx];
+            break;
+        default:
+            buffer[idx] = 0;
+            buffer[idx + 1] = 0;
+            break;
+        }
+        test_dbpsk_ref_ctx.sample_idx++;
+        if (test_dbpsk_ref_ctx.sample_idx >= DBPSK_SYMBOL_PROFILE_SIZE_BYTES) {
+            test_dbpsk_ref_ctx.sample_idx = 0;
+            _TEST_DBPSK_reference_start_symbol();
+        }
+    }
+    return idx;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_DBPSK_modulate(uint8_t* bitstream, uint8_t bitstream_size_bytes, uint8_t refill_size_bytes, uint8_t* stream) {
+    // Local variables.
+    uint32_t stream_size = 0;
+    uint8_t fill_size = 0;
+    // First FIFO fill, then refills as in the radio driver.
+    DBPSK_start(bitstream, bitstream_size_bytes);
+    fill_size = DBPSK_fill_buffer(&(stream[stream_size]), TEST_DBPSK_FIFO_SIZE_BYTES);
+    stream_size += fill_size;
+    while (DBPSK_is_complete() == 0) {
+        fill_size = DBPSK_fill_buffer(&(stream[stream_size]), refill_size_bytes);
+        stream_size += fill_size;
+    }
+    return stream_size;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_DBPSK_reference_modulate(uint8_t* bitstream, uint8_t bitstream_size_bytes, uint8_t refill_size_bytes, uint8_t* stream) {
+    // Local variables.
+    uint32_t stream_size = 0;
+    uint8_t fill_size = 0;
+    // Same sequence with the previous encoder.
+    _TEST_DBPSK_reference_start(bitstream, bitstream_size_bytes);
+    fill_size = _TEST_DBPSK_reference_fill_buffer(&(stream[stream_size]), TEST_DBPSK_FIFO_SIZE_BYTES);
+    stream_size += fill_size;
+    while (test_dbpsk_ref_ctx.symbol != TEST_DBPSK_SYMBOL_END) {
+        fill_size = _TEST_DBPSK_reference_fill_buffer(&(stream[stream_size]), refill_size_bytes);
+        stream_size += fill_size;
+    }
+    return stream_size;
+}
+
+/*******************************************************************/
+static void _TEST_DBPSK_equivalence(void) {
+    // Local variables.
+    uint8_t bitstream[TEST_DBPSK_BITSTREAM_SIZE_BYTES];
+    uint8_t stream[TEST_DBPSK_STREAM_SIZE_BYTES_MAX];
+    uint8_t ref_stream[TEST_DBPSK_STREAM_SIZE_BYTES_MAX];
+    uint32_t stream_size = 0;
+    uint32_t ref_stream_size = 0;
+    uint8_t bitstream_size_bytes = 0;
+    uint8_t refill_size_bytes = 0;
+    uint8_t size_flag = 1;
+    uint8_t equal_flag = 1;
+    uint8_t byte_index_flag = 1;
+    uint32_t frame_idx = 0;
+    uint32_t idx = 0;
+    // Empty bitstream: ramp-up, ramp-down and padding only.
+    stream_size = _TEST_DBPSK_modulate(NULL, 0, TEST_DBPSK_REFILL_SIZE_BYTES, stream);
+    TEST_check((stream_size == (3 * DBPSK_SYMBOL_SIZE_BYTES)), "empty bitstream");
+    // Random frames with various refill sizes.
+    for (frame_idx = 0; frame_idx < TEST_DBPSK_NUMBER_OF_FRAMES; frame_idx++) {
+        bitstream_size_bytes = (uint8_t) (1 + (frame_idx % TEST_DBPSK_BITSTREAM_SIZE_BYTES));
+        // Note: refill size is even since samples are made of 2 bytes.
+        refill_size_bytes = (uint8_t) (2 + (((frame_idx * 14) % TEST_DBPSK_FIFO_SIZE_BYTES) & 0xFE));
+        if (frame_idx == 0) {
+            refill_size_bytes = TEST_DBPSK_REFILL_SIZE_BYTES;
+        }
+        for (idx = 0; idx < bitstream_size_bytes; idx++) {
+            bitstream[idx] = _TEST_DBPSK_random();
+        }
+        stream_size = _TEST_DBPSK_modulate(bitstream, bitstream_size_bytes, refill_size_bytes, stream);
+        ref_stream_size = _TEST_DBPSK_reference_modulate(bitstream, bitstream_size_bytes, refill_size_bytes, ref_stream);
+        if ((stream_size != ref_stream_size) || (stream_size != ((uint32_t) ((bitstream_size_bytes * 8) + 3) * DBPSK_SYMBOL_SIZE_BYTES))) {
+            size_flag = 0;
+            continue;
+        }
+        for (idx = 0; idx < stream_size; idx++) {
+            if (stream[idx] != ref_stream[idx]) {
+                equal_flag = 0;
+                break;
+            }
+        }
+        if (DBPSK_get_byte_index() != bitstream_size_bytes) {
+            byte_index_flag = 0;
+        }
+    }
+    TEST_check((size_flag != 0), "stream size");
+    TEST_check((equal_flag != 0), "precomputed symbols match previous encoder");
+    TEST_check((byte_index_flag != 0), "byte index at end of stream");
+    // Completed stream is not written anymore.
+    TEST_check((DBPSK_fill_buffer(stream, TEST_DBPSK_FIFO_SIZE_BYTES) == 0), "no sample after end of stream");
+    TEST_check((DBPSK_fill_buffer(NULL, TEST_DBPSK_FIFO_SIZE_BYTES) == 0), "null buffer");
+}
+
+/*******************************************************************/
+static void _TEST_DBPSK_bench(void) {
+    // Local variables.
+    uint8_t bitstream[TEST_DBPSK_BITSTREAM_SIZE_BYTES];
+    uint8_t stream[TEST_DBPSK_STREAM_SIZE_BYTES_MAX];
+    uint32_t stream_size = 0;
+    uint32_t ref_stream_size = 0;
+    uint64_t start_ns = 0;
+    uint64_t table_duration_ns = 0;
+    uint64_t reference_duration_ns = 0;
+    uint32_t number_of_symbols = ((TEST_DBPSK_BITSTREAM_SIZE_BYTES * 8) + 3);
+    uint32_t idx = 0;
+    // Random bitstream.
+    for (idx = 0; idx < TEST_DBPSK_BITSTREAM_SIZE_BYTES; idx++) {
+        bitstream[idx] = _TEST_DBPSK_random();
+    }
+    // Precomputed symbols.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_DBPSK_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        stream_size = _TEST_DBPSK_modulate(bitstream, TEST_DBPSK_BITSTREAM_SIZE_BYTES, TEST_DBPSK_REFILL_SIZE_BYTES, stream);
+    }
+    table_duration_ns = (TEST_get_time_ns() - start_ns);
+    // Previous encoder.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_DBPSK_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        ref_stream_size = _TEST_DBPSK_reference_modulate(bitstream, TEST_DBPSK_BITSTREAM_SIZE_BYTES, TEST_DBPSK_REFILL_SIZE_BYTES, stream);
+    }
+    reference_duration_ns = (TEST_get_time_ns() - start_ns);
+    TEST_check(((stream_size == ref_stream_size) && (stream_size == (number_of_symbols * DBPSK_SYMBOL_SIZE_BYTES))), "bench stream size");
+    TEST_bench("symbol encoding", "tables=%.2fns/bit on_the_fly=%.2fns/bit ratio=%.2f",
+        ((float64_t) table_duration_ns) / (((float64_t) TEST_DBPSK_BENCH_NUMBER_OF_ITERATIONS) * number_of_symbols),
+        ((float64_t) reference_duration_ns) / (((float64_t) TEST_DBPSK_BENCH_NUMBER_OF_ITERATIONS) * number_of_symbols),
+        ((float64_t) reference_duration_ns) / ((float64_t) table_duration_ns));
+}
+
+/*** TEST DBPSK main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("dbpsk");
+    _TEST_DBPSK_equivalence();
+    _TEST_DBPSK_bench();
+    return TEST_end();
+}
@@ -0,0 +1,631 @@
+/*
+ * test_gps.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "error.h"
+#include "gps.h"
+#ifdef GPSM_UART_DMA
+#include "mcu_mapping.h"
+#endif
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "rtc.h"
+#include "test.h"
+#include "types.h"
+#ifdef GPSM_UART_DMA
+#include "usart.h"
+#endif
+
+/*** TEST GPS local macros ***/
+
+#ifndef TEST_GPS_VARIANT
+#define TEST_GPS_VARIANT                "default"
+#endif
+
+#define TEST_GPS_START_TIME_SECONDS     1000
+#define TEST_GPS_TIMEOUT_SECONDS        120
+
+#define TEST_GPS_CORE_SYST_CSR          (*((volatile uint32_t*) 0xE000E010))
+#define TEST_GPS_CORE_SYST_CVR          (*((volatile uint32_t*) 0xE000E018))
+#define TEST_GPS_SYSTICK_MASK           0x00FFFFFF
+// Note: 16MHz system clock in the RCC mock.
+#define TEST_GPS_SYSTICK_TICKS_PER_US   16
+// Sleep periods of 250.4ms: the sub-millisecond part must be accumulated.
+#define TEST_GPS_SLEEP_PERIOD_US        250400
+#define TEST_GPS_SLEEP_PERIOD_COUNT     3
+
+#ifdef GPSM_UBX_PROTOCOL
+#define TEST_GPS_UBX_FRAME_SIZE_MAX     128
+#define TEST_GPS_UBX_OVERHEAD_BYTES     8
+#define TEST_GPS_UBX_NAV_TIMEUTC_SIZE   20
+#define TEST_GPS_UBX_NAV_PVT_SIZE       92
+// Note: 6 NMEA sentences disabled, NAV-TIMEUTC and NAV-PVT rates.
+#define TEST_GPS_UBX_CFG_MSG_COUNT      8
+#define TEST_GPS_UBX_CFG_MSG_SIZE       11
+#define TEST_GPS_UBX_STABLE_FIX_COUNT   6
+#define TEST_GPS_BENCH_NUMBER_OF_FRAMES 100000
+#endif
+
+#ifdef GPSM_UART_DMA
+#define TEST_GPS_BENCH_NAME             "ubx nav-pvt dma"
+// Note: must match the circular buffer size of the hardware interface.
+#define TEST_GPS_DMA_RX_BUFFER_SIZE     256
+#else
+#define TEST_GPS_BENCH_NAME             "ubx nav-pvt"
+#endif
+
+/*** TEST GPS local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t completion_count;
+    GPS_acquisition_status_t acquisition_status;
+    uint32_t acquisition_duration_seconds;
+} TEST_GPS_context_t;
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+typedef struct {
+    uint8_t data[TEST_GPS_UBX_FRAME_SIZE_MAX];
+    uint32_t size;
+} TEST_GPS_ubx_frame_t;
+#endif
+
+/*** TEST GPS local global variables ***/
+
+static TEST_GPS_context_t test_gps_ctx;
+
+#ifndef GPSM_UBX_PROTOCOL
+static NEOM8X_time_t TEST_GPS_TIME = {
+    .year = 2026,
+    .month = 10,
+    .date = 17,
+    .hours = 13,
+    .minutes = 37,
+    .seconds = 42
+};
+
+static NEOM8X_position_t TEST_GPS_POSITION = {
+    .lat_degrees = 48,
+    .lat_minutes = 51,
+    .lat_seconds = 39684,
+    .lat_north_flag = 1,
+    .long_degrees = 1,
+    .long_minutes = 14,
+    .long_seconds = 7406,
+    .long_east_flag = 0,
+    .altitude = 35
+};
+#endif
+
+/*** TEST GPS local functions ***/
+
+/*******************************************************************/
+static void _TEST_GPS_completion_callback(GPS_acquisition_status_t acquisition_status, uint32_t acquisition_duration_seconds) {
+    test_gps_ctx.completion_count++;
+    test_gps_ctx.acquisition_status = acquisition_status;
+    test_gps_ctx.acquisition_duration_seconds = acquisition_duration_seconds;
+}
+
+/*******************************************************************/
+static GPS_status_t _TEST_GPS_start(GPS_acquisition_type_t acquisition_type) {
+    // Local variables.
+    GPS_acquisition_t acquisition;
+    // Reset context.
+    test_gps_ctx.completion_count = 0;
+    test_gps_ctx.acquisition_status = GPS_ACQUISITION_ERROR_LAST;
+    test_gps_ctx.acquisition_duration_seconds = 0;
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS);
+    // Start acquisition.
+    acquisition.type = acquisition_type;
+    acquisition.timeout_seconds = TEST_GPS_TIMEOUT_SECONDS;
+    acquisition.completion_callback = &_TEST_GPS_completion_callback;
+    return GPS_start_acquisition(&acquisition);
+}
+
+/*******************************************************************/
+static uint8_t _TEST_GPS_is_driver_running(void) {
+#if (defined GPSM_UBX_PROTOCOL) && (defined GPSM_UART_DMA)
+    return USART_MOCK_is_rx_enabled(USART_INSTANCE_GPS);
+#elif (defined GPSM_UBX_PROTOCOL)
+    return NEOM8X_HW_MOCK_is_rx_running();
+#else
+    return NEOM8X_MOCK_is_acquisition_running();
+#endif
+}
+
+/*******************************************************************/
+static void _TEST_GPS_sleep(uint32_t duration_us) {
+    // Emulate SysTick down counting while the MCU is sleeping.
+    TEST_GPS_CORE_SYST_CVR = ((TEST_GPS_CORE_SYST_CVR - (duration_us * TEST_GPS_SYSTICK_TICKS_PER_US)) & TEST_GPS_SYSTICK_MASK);
+}
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_receive_bytes(uint8_t* data, uint32_t data_size_bytes) {
+#ifdef GPSM_UART_DMA
+    // Bytes are written in the circular buffer by the DMA.
+    USART_MOCK_receive(USART_INSTANCE_GPS, data, data_size_bytes);
+#else
+    NEOM8X_HW_MOCK_receive(data, data_size_bytes);
+#endif
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static uint32_t _TEST_GPS_ubx_get_sent_messages(uint8_t** messages) {
+#ifdef GPSM_UART_DMA
+    return USART_MOCK_get_sent_data(USART_INSTANCE_GPS, messages);
+#else
+    return NEOM8X_HW_MOCK_get_sent_messages(messages);
+#endif
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_write_u32(uint8_t* payload, uint8_t offset, int32_t value) {
+    // Little-endian field.
+    payload[offset] = (uint8_t) (((uint32_t) value) >> 0);
+    payload[offset + 1] = (uint8_t) (((uint32_t) value) >> 8);
+    payload[offset + 2] = (uint8_t) (((uint32_t) value) >> 16);
+    payload[offset + 3] = (uint8_t) (((uint32_t) value) >> 24);
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_build_frame(TEST_GPS_ubx_frame_t* frame, uint8_t message_class, uint8_t message_id, uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    uint32_t idx = 0;
+    // Header.
+    frame->data[0] = 0xB5;
+    frame->data[1] = 0x62;
+    frame->data[2] = message_class;
+    frame->data[3] = message_id;
+    frame->data[4] = (uint8_t) (payload_size >> 0);
+    frame->data[5] = (uint8_t) (payload_size >> 8);
+    for (idx = 0; idx < payload_size; idx++) {
+        frame->data[6 + idx] = payload[idx];
+    }
+    // Fletcher checksum from class to the end of the payload.
+    for (idx = 2; idx < (6 + (uint32_t) payload_size); idx++) {
+        ck_a = (uint8_t) (ck_a + frame->data[idx]);
+        ck_b = (uint8_t) (ck_b + ck_a);
+    }
+    frame->data[6 + payload_size] = ck_a;
+    frame->data[7 + payload_size] = ck_b;
+    frame->size = (TEST_GPS_UBX_OVERHEAD_BYTES + payload_size);
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_build_nav_timeutc(TEST_GPS_ubx_frame_t* frame, uint8_t valid) {
+    // Local variables.
+    uint8_t payload[TEST_GPS_UBX_NAV_TIMEUTC_SIZE] = { 0 };
+    // Date and time.
+    payload[12] = (uint8_t) (2026 & 0xFF);
+    payload[13] = (uint8_t) (2026 >> 8);
+    payload[14] = 10;
+    payload[15] = 17;
+    payload[16] = 13;
+    payload[17] = 37;
+    payload[18] = 42;
+    payload[19] = valid;
+    _TEST_GPS_ubx_build_frame(frame, 0x01, 0x21, payload, TEST_GPS_UBX_NAV_TIMEUTC_SIZE);
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_build_nav_pvt(TEST_GPS_ubx_frame_t* frame, uint8_t fix_type, int32_t altitude_mm) {
+    // Local variables.
+    uint8_t payload[TEST_GPS_UBX_NAV_PVT_SIZE] = { 0 };
+    // Fix type and gnssFixOK flag.
+    payload[20] = fix_type;
+    payload[21] = 0x01;
+    // Longitude, latitude and height above mean sea level.
+    _TEST_GPS_ubx_write_u32(payload, 24, -12345678);
+    _TEST_GPS_ubx_write_u32(payload, 28, 488566140);
+    _TEST_GPS_ubx_write_u32(payload, 36, altitude_mm);
+    _TEST_GPS_ubx_build_frame(frame, 0x01, 0x07, payload, TEST_GPS_UBX_NAV_PVT_SIZE);
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_receive(TEST_GPS_ubx_frame_t* frame, uint32_t uptime_seconds) {
+    // Receive frame and process.
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + uptime_seconds);
+    _TEST_GPS_ubx_receive_bytes(frame->data, frame->size);
+    GPS_process();
+}
+#endif
+
+/*******************************************************************/
+static void _TEST_GPS_parameters(void) {
+    // Local variables.
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_acquisition_t acquisition;
+    // Null parameters.
+    gps_status = GPS_start_acquisition(NULL);
+    TEST_check((gps_status == GPS_ERROR_NULL_PARAMETER), "null acquisition rejected");
+    acquisition.type = GPS_ACQUISITION_TYPE_TIME;
+    acquisition.timeout_seconds = TEST_GPS_TIMEOUT_SECONDS;
+    acquisition.completion_callback = NULL;
+    gps_status = GPS_start_acquisition(&acquisition);
+    TEST_check((gps_status == GPS_ERROR_NULL_PARAMETER), "null callback rejected");
+    // Invalid type.
+    gps_status = _TEST_GPS_start(GPS_ACQUISITION_TYPE_LAST);
+    TEST_check((gps_status == GPS_ERROR_ACQUISITION_TYPE), "invalid type rejected");
+    TEST_check((GPS_get_state() == GPS_STATE_IDLE), "idle after rejection");
+}
+
+/*******************************************************************/
+static void _TEST_GPS_timeout(void) {
+    // Local variables.
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_statistics_t gps_statistics;
+    uint32_t process_count = 0;
+    uint32_t idx = 0;
+    // Start acquisition.
+    gps_status = _TEST_GPS_start(GPS_ACQUISITION_TYPE_TIME);
+    TEST_check(((gps_status == GPS_SUCCESS) && (GPS_get_state() == GPS_STATE_ACQUISITION) && (_TEST_GPS_is_driver_running() != 0)), "timeout acquisition started");
+    // Second start is rejected while running.
+    gps_status = _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    TEST_check((gps_status == GPS_ERROR_STATE), "start rejected while running");
+    // Process without data until timeout.
+    for (idx = 0; idx < TEST_GPS_TIMEOUT_SECONDS; idx += 10) {
+        RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + idx);
+        gps_status = GPS_process();
+        process_count++;
+    }
+    TEST_check(((gps_status == GPS_SUCCESS) && (test_gps_ctx.completion_count == 0) && (GPS_get_state() == GPS_STATE_ACQUISITION)), "running before timeout");
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + TEST_GPS_TIMEOUT_SECONDS);
+    gps_status = GPS_process();
+    process_count++;
+    TEST_check(((gps_status == GPS_SUCCESS) && (test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_ERROR_TIMEOUT)), "timeout reported");
+    TEST_check((test_gps_ctx.acquisition_duration_seconds == TEST_GPS_TIMEOUT_SECONDS), "timeout duration");
+    TEST_check(((GPS_get_state() == GPS_STATE_IDLE) && (_TEST_GPS_is_driver_running() == 0)), "driver stopped after timeout");
+    // Wake-up count.
+    GPS_get_statistics(&gps_statistics);
+    TEST_check((gps_statistics.wake_up_count == process_count), "wake-up count");
+    // Idle process has no effect.
+    gps_status = GPS_process();
+    TEST_check(((gps_status == GPS_SUCCESS) && (test_gps_ctx.completion_count == 1)), "idle process");
+}
+
+/*******************************************************************/
+static void _TEST_GPS_stop(void) {
+    // Local variables.
+    GPS_status_t gps_status = GPS_SUCCESS;
+    // Start and abort acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    gps_status = GPS_stop_acquisition();
+    TEST_check(((gps_status == GPS_SUCCESS) && (GPS_get_state() == GPS_STATE_IDLE) && (_TEST_GPS_is_driver_running() == 0)), "acquisition stopped");
+    // Completion callback is not called after abort.
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + TEST_GPS_TIMEOUT_SECONDS);
+    GPS_process();
+    TEST_check((test_gps_ctx.completion_count == 0), "no completion after stop");
+    // A new acquisition can be started.
+    gps_status = _TEST_GPS_start(GPS_ACQUISITION_TYPE_TIME);
+    TEST_check((gps_status == GPS_SUCCESS), "restart after stop");
+    GPS_stop_acquisition();
+}
+
+/*******************************************************************/
+static void _TEST_GPS_sleep_time(void) {
+    // Local variables.
+    GPS_statistics_t gps_statistics;
+    uint32_t idx = 0;
+    // Start acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_TIME);
+    TEST_check(((TEST_GPS_CORE_SYST_CSR & 0x1) != 0), "systick running during acquisition");
+    // Sleep between wake-ups.
+    for (idx = 1; idx <= TEST_GPS_SLEEP_PERIOD_COUNT; idx++) {
+        _TEST_GPS_sleep(TEST_GPS_SLEEP_PERIOD_US);
+        RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + idx);
+        GPS_process();
+    }
+    GPS_get_statistics(&gps_statistics);
+    TEST_check((gps_statistics.sleep_time_ms == ((TEST_GPS_SLEEP_PERIOD_COUNT * TEST_GPS_SLEEP_PERIOD_US) / 1000)), "time in sleep");
+    // Measurement is stopped with the acquisition.
+    GPS_stop_acquisition();
+    TEST_check((TEST_GPS_CORE_SYST_CSR == 0), "systick stopped after acquisition");
+    // Counter is reset on the next acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_TIME);
+    GPS_get_statistics(&gps_statistics);
+    TEST_check((gps_statistics.sleep_time_ms == 0), "time in sleep reset");
+    GPS_stop_acquisition();
+}
+
+#ifndef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_nmea_time(void) {
+    // Local variables.
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_time_t gps_time;
+    // Start acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_TIME);
+    // Sentence without valid time.
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + 5);
+    NEOM8X_MOCK_receive_sentence(NEOM8X_ACQUISITION_STATUS_FAIL, NULL, NULL);
+    gps_status = GPS_process();
+    TEST_check(((gps_status == GPS_SUCCESS) && (test_gps_ctx.completion_count == 0)), "nmea time not found");
+    // Valid time.
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + 12);
+    NEOM8X_MOCK_receive_sentence(NEOM8X_ACQUISITION_STATUS_FOUND, &TEST_GPS_TIME, NULL);
+    gps_status = GPS_process();
+    TEST_check(((gps_status == GPS_SUCCESS) && (test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_SUCCESS)), "nmea time found");
+    TEST_check((test_gps_ctx.acquisition_duration_seconds == 12), "nmea time duration");
+    TEST_check(((GPS_get_state() == GPS_STATE_IDLE) && (NEOM8X_MOCK_is_acquisition_running() == 0)), "nmea driver stopped");
+    // Read data.
+    gps_status = GPS_get_time(&gps_time);
+    TEST_check(((gps_status == GPS_SUCCESS) && (gps_time.year == 2026) && (gps_time.month == 10) && (gps_time.date == 17) && (gps_time.hours == 13) && (gps_time.minutes == 37) && (gps_time.seconds == 42)), "nmea time data");
+}
+#endif
+
+#ifndef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_nmea_position(void) {
+    // Local variables.
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_position_t gps_position;
+    // Start acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    // First fix is not stable.
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + 30);
+    NEOM8X_MOCK_receive_sentence(NEOM8X_ACQUISITION_STATUS_FOUND, NULL, &TEST_GPS_POSITION);
+    gps_status = GPS_process();
+    TEST_check(((gps_status == GPS_SUCCESS) && (test_gps_ctx.completion_count == 0) && (GPS_get_state() == GPS_STATE_ACQUISITION)), "nmea position not stable");
+    // Stable fix.
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + 45);
+    NEOM8X_MOCK_receive_sentence(NEOM8X_ACQUISITION_STATUS_STABLE, NULL, &TEST_GPS_POSITION);
+    gps_status = GPS_process();
+    TEST_check(((gps_status == GPS_SUCCESS) && (test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_SUCCESS)), "nmea position stable");
+    TEST_check((test_gps_ctx.acquisition_duration_seconds == 45), "nmea position duration");
+    // Read data.
+    gps_status = GPS_get_position(&gps_position);
+    TEST_check(((gps_status == GPS_SUCCESS) && (gps_position.lat_degrees == 48) && (gps_position.lat_seconds == 39684) && (gps_position.long_east_flag == 0) && (gps_position.altitude == 35)), "nmea position data");
+    // Fix found but not stable before timeout is still reported as a success.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    NEOM8X_MOCK_receive_sentence(NEOM8X_ACQUISITION_STATUS_FOUND, NULL, &TEST_GPS_POSITION);
+    GPS_process();
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + TEST_GPS_TIMEOUT_SECONDS);
+    GPS_process();
+    TEST_check(((test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_SUCCESS) && (test_gps_ctx.acquisition_duration_seconds == TEST_GPS_TIMEOUT_SECONDS)), "nmea unstable position at timeout");
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_configuration(void) {
+    // Local variables.
+    uint8_t* messages = NULL;
+    uint32_t messages_size = 0;
+    uint8_t* message = NULL;
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    uint8_t error_count = 0;
+    uint8_t timeutc_rate = 0xFF;
+    uint8_t pvt_rate = 0xFF;
+    uint32_t idx = 0;
+    uint32_t byte_idx = 0;
+    // Start time acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_TIME);
+    messages_size = _TEST_GPS_ubx_get_sent_messages(&messages);
+    TEST_check((messages_size == (TEST_GPS_UBX_CFG_MSG_COUNT * TEST_GPS_UBX_CFG_MSG_SIZE)), "ubx configuration size");
+    // Check each UBX-CFG-MSG frame.
+    for (idx = 0; idx < TEST_GPS_UBX_CFG_MSG_COUNT; idx++) {
+        message = &(messages[idx * TEST_GPS_UBX_CFG_MSG_SIZE]);
+        ck_a = 0;
+        ck_b = 0;
+        for (byte_idx = 2; byte_idx < (TEST_GPS_UBX_CFG_MSG_SIZE - 2); byte_idx++) {
+            ck_a = (uint8_t) (ck_a + message[byte_idx]);
+            ck_b = (uint8_t) (ck_b + ck_a);
+        }
+        if ((message[0] != 0xB5) || (message[1] != 0x62) || (message[2] != 0x06) || (message[3] != 0x01) || (message[4] != 3) || (message[5] != 0) || (message[9] != ck_a) || (message[10] != ck_b)) {
+            error_count++;
+        }
+        // NMEA sentences must be disabled.
+        if ((message[6] == 0xF0) && (message[8] != 0)) {
+            error_count++;
+        }
+        // Navigation messages rate.
+        if ((message[6] == 0x01) && (message[7] == 0x21)) {
+            timeutc_rate = message[8];
+        }
+        if ((message[6] == 0x01) && (message[7] == 0x07)) {
+            pvt_rate = message[8];
+        }
+    }
+    TEST_check((error_count == 0), "ubx configuration frames");
+    TEST_check(((timeutc_rate == 1) && (pvt_rate == 0)), "ubx time acquisition messages");
+    GPS_stop_acquisition();
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_time(void) {
+    // Local variables.
+    TEST_GPS_ubx_frame_t frame;
+    GPS_time_t gps_time;
+    GPS_statistics_t gps_statistics;
+    uint8_t noise[] = { 0x24, 0x47, 0xB5, 0x00, 0xB5, 0xB5 };
+    // Start acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_TIME);
+    // Corrupted checksum is ignored.
+    _TEST_GPS_ubx_build_nav_timeutc(&frame, 0x07);
+    frame.data[frame.size - 1] ^= 0xFF;
+    _TEST_GPS_ubx_receive(&frame, 2);
+    TEST_check(((test_gps_ctx.completion_count == 0) && (GPS_get_state() == GPS_STATE_ACQUISITION)), "ubx checksum error ignored");
+    // Invalid UTC time is ignored.
+    _TEST_GPS_ubx_build_nav_timeutc(&frame, 0x03);
+    _TEST_GPS_ubx_receive(&frame, 4);
+    TEST_check((test_gps_ctx.completion_count == 0), "ubx invalid time ignored");
+    // Position message is ignored during time acquisition.
+    _TEST_GPS_ubx_build_nav_pvt(&frame, 3, 35000);
+    _TEST_GPS_ubx_receive(&frame, 6);
+    TEST_check((test_gps_ctx.completion_count == 0), "ubx unexpected message ignored");
+    // Valid time after noise and a partial sync sequence.
+    _TEST_GPS_ubx_receive_bytes(noise, sizeof(noise));
+    _TEST_GPS_ubx_build_nav_timeutc(&frame, 0x07);
+    // Note: the noise ends with a sync char, the parser must resynchronize on the frame header.
+    _TEST_GPS_ubx_receive(&frame, 9);
+    TEST_check(((test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_SUCCESS) && (test_gps_ctx.acquisition_duration_seconds == 9)), "ubx time found");
+    TEST_check(((GPS_get_state() == GPS_STATE_IDLE) && (_TEST_GPS_is_driver_running() == 0)), "ubx reception stopped");
+    GPS_get_time(&gps_time);
+    TEST_check(((gps_time.year == 2026) && (gps_time.month == 10) && (gps_time.date == 17) && (gps_time.hours == 13) && (gps_time.minutes == 37) && (gps_time.seconds == 42)), "ubx time data");
+    // Received bytes statistics.
+    GPS_get_statistics(&gps_statistics);
+    TEST_check((gps_statistics.uart_rx_byte_count == (sizeof(noise) + (3 * (TEST_GPS_UBX_OVERHEAD_BYTES + TEST_GPS_UBX_NAV_TIMEUTC_SIZE)) + TEST_GPS_UBX_OVERHEAD_BYTES + TEST_GPS_UBX_NAV_PVT_SIZE)), "ubx byte count");
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_position(void) {
+    // Local variables.
+    TEST_GPS_ubx_frame_t frame;
+    GPS_position_t gps_position;
+    uint8_t* messages = NULL;
+    uint32_t idx = 0;
+    // Start acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    _TEST_GPS_ubx_get_sent_messages(&messages);
+    TEST_check(((messages[(6 * TEST_GPS_UBX_CFG_MSG_SIZE) + 8] == 0) && (messages[(7 * TEST_GPS_UBX_CFG_MSG_SIZE) + 8] == 1)), "ubx position acquisition messages");
+    // 2D fix is not used.
+    _TEST_GPS_ubx_build_nav_pvt(&frame, 2, 35000);
+    _TEST_GPS_ubx_receive(&frame, 10);
+    TEST_check(((test_gps_ctx.completion_count == 0) && (GPS_get_state() == GPS_STATE_ACQUISITION)), "ubx 2d fix ignored");
+    // Unstable altitude.
+    _TEST_GPS_ubx_build_nav_pvt(&frame, 3, 80000);
+    _TEST_GPS_ubx_receive(&frame, 11);
+    _TEST_GPS_ubx_build_nav_pvt(&frame, 3, 35000);
+    _TEST_GPS_ubx_receive(&frame, 12);
+    TEST_check((test_gps_ctx.completion_count == 0), "ubx unstable altitude");
+    // Stable altitude (within 2 meters).
+    for (idx = 1; idx < (TEST_GPS_UBX_STABLE_FIX_COUNT - 1); idx++) {
+        _TEST_GPS_ubx_build_nav_pvt(&frame, 3, (35000 + (int32_t) ((idx % 2) * 1500)));
+        _TEST_GPS_ubx_receive(&frame, (12 + idx));
+    }
+    TEST_check((test_gps_ctx.completion_count == 0), "ubx position not yet stable");
+    _TEST_GPS_ubx_build_nav_pvt(&frame, 4, 35400);
+    _TEST_GPS_ubx_receive(&frame, 20);
+    TEST_check(((test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_SUCCESS) && (test_gps_ctx.acquisition_duration_seconds == 20)), "ubx position stable");
+    // Coordinates conversion to the NMEA format.
+    GPS_get_position(&gps_position);
+    TEST_check(((gps_position.lat_degrees == 48) && (gps_position.lat_minutes == 51) && (gps_position.lat_seconds == 39684) && (gps_position.lat_north_flag == 1)), "ubx latitude");
+    TEST_check(((gps_position.long_degrees == 1) && (gps_position.long_minutes == 14) && (gps_position.long_seconds == 7406) && (gps_position.long_east_flag == 0)), "ubx longitude");
+    TEST_check((gps_position.altitude == 35), "ubx altitude");
+}
+#endif
+
+#ifdef GPSM_UART_DMA
+/*******************************************************************/
+static void _TEST_GPS_dma_flush(void) {
+    // Local variables.
+    TEST_GPS_ubx_frame_t frame;
+    GPS_statistics_t gps_statistics;
+    uint32_t idx = 0;
+    // Stable fix received across several laps of the circular buffer.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    _TEST_GPS_ubx_build_nav_pvt(&frame, 3, 35000);
+    for (idx = 1; idx < TEST_GPS_UBX_STABLE_FIX_COUNT; idx++) {
+        _TEST_GPS_ubx_receive(&frame, idx);
+    }
+    TEST_check((test_gps_ctx.completion_count == 0), "dma position not yet stable");
+    _TEST_GPS_ubx_receive(&frame, TEST_GPS_UBX_STABLE_FIX_COUNT);
+    TEST_check(((test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_SUCCESS)), "dma position across buffer laps");
+    GPS_get_statistics(&gps_statistics);
+    TEST_check(((TEST_GPS_UBX_STABLE_FIX_COUNT * frame.size) > (2 * TEST_GPS_DMA_RX_BUFFER_SIZE)), "dma buffer laps");
+    TEST_check(((gps_statistics.uart_rx_byte_count == (TEST_GPS_UBX_STABLE_FIX_COUNT * frame.size)) && (gps_statistics.uart_rx_overrun_count == 0)), "dma bytes without overrun");
+    // More unread bytes than the buffer size.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    for (idx = 0; idx < ((TEST_GPS_DMA_RX_BUFFER_SIZE / frame.size) + 1); idx++) {
+        _TEST_GPS_ubx_receive_bytes(frame.data, frame.size);
+    }
+    RTC_MOCK_set_uptime_seconds(TEST_GPS_START_TIME_SECONDS + 1);
+    GPS_process();
+    GPS_get_statistics(&gps_statistics);
+    TEST_check(((gps_statistics.uart_rx_overrun_count == 1) && (gps_statistics.uart_rx_byte_count == 0) && (test_gps_ctx.completion_count == 0)), "dma overrun detected");
+    // Reception resumes after the dropped bytes.
+    for (idx = 1; idx <= TEST_GPS_UBX_STABLE_FIX_COUNT; idx++) {
+        _TEST_GPS_ubx_receive(&frame, (1 + idx));
+    }
+    GPS_get_statistics(&gps_statistics);
+    TEST_check(((test_gps_ctx.completion_count == 1) && (test_gps_ctx.acquisition_status == GPS_ACQUISITION_SUCCESS)), "dma position after overrun");
+    TEST_check(((gps_statistics.uart_rx_byte_count == (TEST_GPS_UBX_STABLE_FIX_COUNT * frame.size)) && (gps_statistics.uart_rx_overrun_count == 1)), "dma bytes after overrun");
+}
+#endif
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _TEST_GPS_ubx_bench(void) {
+    // Local variables.
+    TEST_GPS_ubx_frame_t frame;
+    uint64_t start_ns = 0;
+    uint64_t duration_ns = 0;
+    uint32_t idx = 0;
+    // Start acquisition.
+    _TEST_GPS_start(GPS_ACQUISITION_TYPE_POSITION);
+    _TEST_GPS_ubx_build_nav_pvt(&frame, 2, 35000);
+    // Parse and decode frames.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_GPS_BENCH_NUMBER_OF_FRAMES; idx++) {
+        _TEST_GPS_ubx_receive_bytes(frame.data, frame.size);
+        GPS_process();
+    }
+    duration_ns = (TEST_get_time_ns() - start_ns);
+    TEST_check(((test_gps_ctx.completion_count == 0) && (GPS_get_state() == GPS_STATE_ACQUISITION)), "bench acquisition running");
+    GPS_stop_acquisition();
+    TEST_bench(TEST_GPS_BENCH_NAME, "frame=%.2fns byte=%.2fns",
+        ((float64_t) duration_ns) / TEST_GPS_BENCH_NUMBER_OF_FRAMES,
+        ((float64_t) duration_ns) / (TEST_GPS_BENCH_NUMBER_OF_FRAMES * frame.size));
+}
+#endif
+
+/*** TEST GPS main function ***/
+
+/*******************************************************************/
+int main(void) {
+#ifdef GPSM_UART_DMA
+    // Local variables.
+    NEOM8X_HW_configuration_t neom8x_hw_configuration;
+#endif
+    TEST_start("gps_" TEST_GPS_VARIANT);
+    ERROR_stack_init();
+#ifdef GPSM_UART_DMA
+    // Init hardware interface (performed by the NEOM8X driver on target).
+    neom8x_hw_configuration.uart_baud_rate = 9600;
+    neom8x_hw_configuration.rx_irq_callback = NULL;
+    NEOM8X_HW_init(&neom8x_hw_configuration);
+#endif
+    GPS_init();
+    _TEST_GPS_parameters();
+    _TEST_GPS_timeout();
+    _TEST_GPS_stop();
+    _TEST_GPS_sleep_time();
+#ifndef GPSM_UBX_PROTOCOL
+    _TEST_GPS_nmea_time();
+    _TEST_GPS_nmea_position();
+#else
+    _TEST_GPS_ubx_configuration();
+    _TEST_GPS_ubx_time();
+    _TEST_GPS_ubx_position();
+#ifdef GPSM_UART_DMA
+    _TEST_GPS_dma_flush();
+#endif
+    _TEST_GPS_ubx_bench();
+#endif
+    TEST_check((ERROR_stack_is_empty() != 0), "error stack empty");
+    return TEST_end();
+}
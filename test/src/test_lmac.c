@@ -0,0 +1,470 @@
+/*
+ * test_lmac.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "error.h"
+#include "lmac.h"
+#include "lmac_hw.h"
+#include "lmac_hw_baud_rate.h"
+#include "lmac_hw_binary.h"
+#include "lmac_hw_statistics.h"
+#include "lpuart.h"
+#include "nvm.h"
+#include "rtc.h"
+#include "test.h"
+#include "types.h"
+
+/*** TEST LMAC local macros ***/
+
+#ifndef TEST_LMAC_VARIANT
+#define TEST_LMAC_VARIANT                   "default"
+#endif
+
+#define TEST_LMAC_START_TIME_SECONDS        1000
+#define TEST_LMAC_FALLBACK_TIMEOUT_SECONDS  60
+
+#define TEST_LMAC_BAUD_RATE_DEFAULT         1200
+#define TEST_LMAC_BAUD_RATE_HIGH            9600
+
+#define TEST_LMAC_RX_BUFFER_SIZE            64
+#define TEST_LMAC_FRAME_END_CHAR            '\r'
+
+#define TEST_LMAC_SELF_ADDRESS              0x42
+#define TEST_LMAC_MASTER_ADDRESS            0x00
+#define TEST_LMAC_ADDRESS_MARKER            0x80
+#define TEST_LMAC_BINARY_FRAME_MARKER       0x02
+#define TEST_LMAC_BINARY_HEADER_SIZE        4
+#define TEST_LMAC_BINARY_CRC_SIZE           2
+#define TEST_LMAC_BINARY_CHAR_BITS          7
+#define TEST_LMAC_BINARY_FRAME_SIZE_MAX     128
+// Register access payload: opcode, address, number of registers and 4 bytes per register.
+#define TEST_LMAC_BINARY_NUMBER_OF_REGISTERS    14
+#define TEST_LMAC_BINARY_REGISTER_SIZE          4
+// Text register read reply: 8 hexadecimal characters and a separator per register.
+#define TEST_LMAC_TEXT_REGISTER_SIZE            9
+#define TEST_LMAC_BENCH_NUMBER_OF_ITERATIONS    100000
+
+/*** TEST LMAC local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t rx_buffer[TEST_LMAC_RX_BUFFER_SIZE];
+    uint32_t rx_buffer_size;
+    uint8_t rx_frame_flag;
+    uint8_t binary_rx_flag;
+} TEST_LMAC_context_t;
+
+/*** TEST LMAC local global variables ***/
+
+static TEST_LMAC_context_t test_lmac_ctx;
+
+static uint8_t TEST_LMAC_REQUEST[] = { 'R', 'S', '$', 'R', '=', '0', '0', TEST_LMAC_FRAME_END_CHAR };
+static uint8_t TEST_LMAC_REPLY[] = { 'O', 'K', TEST_LMAC_FRAME_END_CHAR };
+
+/*** TEST LMAC local functions ***/
+
+/*******************************************************************/
+static void _TEST_LMAC_rx_irq_callback(uint8_t data) {
+    // Store byte.
+    if (test_lmac_ctx.rx_buffer_size < TEST_LMAC_RX_BUFFER_SIZE) {
+        test_lmac_ctx.rx_buffer[test_lmac_ctx.rx_buffer_size++] = data;
+    }
+    if (data == TEST_LMAC_FRAME_END_CHAR) {
+        test_lmac_ctx.rx_frame_flag = 1;
+    }
+}
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static void _TEST_LMAC_binary_rx_callback(void) {
+    // Set flag.
+    test_lmac_ctx.binary_rx_flag = 1;
+}
+#endif
+
+/*******************************************************************/
+static uint8_t _TEST_LMAC_compare(uint8_t* data, uint8_t* expected, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    for (idx = 0; idx < size; idx++) {
+        if (data[idx] != expected[idx]) return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+static uint8_t _TEST_LMAC_master_request(uint32_t baud_rate) {
+    // Reset slave reception.
+    test_lmac_ctx.rx_buffer_size = 0;
+    test_lmac_ctx.rx_frame_flag = 0;
+    // Send request on the bus.
+    LPUART_MOCK_receive(baud_rate, TEST_LMAC_REQUEST, sizeof(TEST_LMAC_REQUEST));
+    // Check that the slave received the whole frame.
+    return (((test_lmac_ctx.rx_frame_flag != 0) && (test_lmac_ctx.rx_buffer_size == sizeof(TEST_LMAC_REQUEST)) && (_TEST_LMAC_compare(test_lmac_ctx.rx_buffer, TEST_LMAC_REQUEST, sizeof(TEST_LMAC_REQUEST)) != 0)) ? 1 : 0);
+}
+
+/*******************************************************************/
+static uint8_t _TEST_LMAC_master_read_reply(uint32_t baud_rate) {
+    // Local variables.
+    uint8_t reply[TEST_LMAC_RX_BUFFER_SIZE];
+    uint32_t reply_size = 0;
+    // Read bus.
+    reply_size = LPUART_MOCK_read_bus(baud_rate, reply, TEST_LMAC_RX_BUFFER_SIZE);
+    return (((reply_size == sizeof(TEST_LMAC_REPLY)) && (_TEST_LMAC_compare(reply, TEST_LMAC_REPLY, sizeof(TEST_LMAC_REPLY)) != 0)) ? 1 : 0);
+}
+
+/*******************************************************************/
+static uint8_t _TEST_LMAC_exchange(uint32_t master_baud_rate) {
+    // Local variables.
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    // Request.
+    if (_TEST_LMAC_master_request(master_baud_rate) == 0) return 0;
+    // Reply.
+    lmac_status = LMAC_HW_write(TEST_LMAC_REPLY, sizeof(TEST_LMAC_REPLY));
+    if (lmac_status != LMAC_SUCCESS) return 0;
+    return _TEST_LMAC_master_read_reply(master_baud_rate);
+}
+
+/*******************************************************************/
+static void _TEST_LMAC_init(void) {
+    // Local variables.
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    uint8_t self_address = 0;
+    // Clock update before init.
+    lmac_status = LMAC_HW_update_clock();
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (LPUART_MOCK_get_init_count() == 0)), "clock update before init ignored");
+    // Init interface.
+    NVM_MOCK_erase();
+    NVM_write_byte(0, 0x42);
+    RTC_MOCK_set_uptime_seconds(TEST_LMAC_START_TIME_SECONDS);
+    lmac_status = LMAC_HW_init(TEST_LMAC_BAUD_RATE_DEFAULT, &_TEST_LMAC_rx_irq_callback, &self_address);
+    TEST_check((lmac_status == LMAC_SUCCESS), "init");
+    TEST_check((self_address == 0x42), "init self address");
+    lmac_status = LMAC_HW_enable_rx();
+    TEST_check((lmac_status == LMAC_SUCCESS), "enable rx");
+    TEST_check((LPUART_MOCK_get_baud_rate() == TEST_LMAC_BAUD_RATE_DEFAULT), "default baud rate");
+    // Loopback at default baud rate.
+    TEST_check((_TEST_LMAC_exchange(TEST_LMAC_BAUD_RATE_DEFAULT) != 0), "default baud rate exchange");
+    TEST_check((_TEST_LMAC_exchange(TEST_LMAC_BAUD_RATE_HIGH) == 0), "high baud rate frame lost before switch");
+    // No fallback at default baud rate.
+    RTC_MOCK_set_uptime_seconds(TEST_LMAC_START_TIME_SECONDS + (10 * TEST_LMAC_FALLBACK_TIMEOUT_SECONDS));
+    lmac_status = LMAC_HW_check_baud_rate_fallback();
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (LPUART_MOCK_get_init_count() == 1)), "no fallback at default baud rate");
+}
+
+/*******************************************************************/
+static void _TEST_LMAC_switch(void) {
+    // Local variables.
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    // Baud rate request received at default baud rate.
+    RTC_MOCK_set_uptime_seconds(TEST_LMAC_START_TIME_SECONDS);
+    TEST_check((_TEST_LMAC_master_request(TEST_LMAC_BAUD_RATE_DEFAULT) != 0), "switch request received");
+    // Reply is sent before the switch.
+    lmac_status = LMAC_HW_write(TEST_LMAC_REPLY, sizeof(TEST_LMAC_REPLY));
+    TEST_check((lmac_status == LMAC_SUCCESS), "switch reply sent");
+    lmac_status = LMAC_HW_set_baud_rate(TEST_LMAC_BAUD_RATE_HIGH);
+    TEST_check((lmac_status == LMAC_SUCCESS), "switch");
+    TEST_check((_TEST_LMAC_master_read_reply(TEST_LMAC_BAUD_RATE_DEFAULT) != 0), "switch reply received at previous baud rate");
+    TEST_check((LPUART_MOCK_get_baud_rate() == TEST_LMAC_BAUD_RATE_HIGH), "switch baud rate");
+    // Loopback at new baud rate.
+    TEST_check((_TEST_LMAC_exchange(TEST_LMAC_BAUD_RATE_HIGH) != 0), "high baud rate exchange");
+    TEST_check((_TEST_LMAC_exchange(TEST_LMAC_BAUD_RATE_DEFAULT) == 0), "default baud rate frame lost after switch");
+}
+
+/*******************************************************************/
+static void _TEST_LMAC_fallback(void) {
+    // Local variables.
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    uint32_t last_frame_time_seconds = (TEST_LMAC_START_TIME_SECONDS + TEST_LMAC_FALLBACK_TIMEOUT_SECONDS - 1);
+    // Bus activity before timeout keeps the baud rate.
+    RTC_MOCK_set_uptime_seconds(last_frame_time_seconds);
+    lmac_status = LMAC_HW_check_baud_rate_fallback();
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (LPUART_MOCK_get_baud_rate() == TEST_LMAC_BAUD_RATE_HIGH)), "no fallback before timeout");
+    TEST_check((_TEST_LMAC_exchange(TEST_LMAC_BAUD_RATE_HIGH) != 0), "exchange before timeout");
+    // Timeout is restarted by the last frame.
+    RTC_MOCK_set_uptime_seconds(last_frame_time_seconds + TEST_LMAC_FALLBACK_TIMEOUT_SECONDS - 1);
+    lmac_status = LMAC_HW_check_baud_rate_fallback();
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (LPUART_MOCK_get_baud_rate() == TEST_LMAC_BAUD_RATE_HIGH)), "timeout restarted by bus activity");
+    // Silent bus.
+    RTC_MOCK_set_uptime_seconds(last_frame_time_seconds + TEST_LMAC_FALLBACK_TIMEOUT_SECONDS);
+    lmac_status = LMAC_HW_check_baud_rate_fallback();
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (LPUART_MOCK_get_baud_rate() == TEST_LMAC_BAUD_RATE_DEFAULT)), "fallback after timeout");
+    TEST_check((_TEST_LMAC_exchange(TEST_LMAC_BAUD_RATE_HIGH) == 0), "high baud rate frame lost after fallback");
+    TEST_check((_TEST_LMAC_exchange(TEST_LMAC_BAUD_RATE_DEFAULT) != 0), "default baud rate exchange after fallback");
+}
+
+/*******************************************************************/
+static uint16_t _TEST_LMAC_crc16(uint8_t* data, uint32_t size) {
+    // Local variables.
+    uint16_t crc16 = 0xFFFF;
+    uint32_t idx = 0;
+    uint8_t bit_idx = 0;
+    uint8_t bit = 0;
+    // Reference CRC16 CCITT-FALSE computed bit by bit.
+    for (idx = 0; idx < size; idx++) {
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            bit = (((crc16 >> 15) ^ (data[idx] >> (7 - bit_idx))) & 0x01);
+            crc16 = (uint16_t) (crc16 << 1);
+            if (bit != 0) {
+                crc16 ^= 0x1021;
+            }
+        }
+    }
+    return crc16;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_LMAC_binary_encode(uint8_t* data, uint32_t data_size, uint8_t* frame) {
+    // Local variables.
+    uint8_t payload[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint16_t crc16 = _TEST_LMAC_crc16(data, data_size);
+    uint32_t number_of_bits = ((data_size + TEST_LMAC_BINARY_CRC_SIZE) * 8);
+    uint32_t number_of_chars = ((number_of_bits + TEST_LMAC_BINARY_CHAR_BITS - 1) / TEST_LMAC_BINARY_CHAR_BITS);
+    uint32_t idx = 0;
+    // Payload and CRC.
+    for (idx = 0; idx < data_size; idx++) {
+        payload[idx] = data[idx];
+    }
+    payload[data_size] = (uint8_t) (crc16 >> 8);
+    payload[data_size + 1] = (uint8_t) (crc16 >> 0);
+    // Header.
+    frame[0] = (TEST_LMAC_SELF_ADDRESS | TEST_LMAC_ADDRESS_MARKER);
+    frame[1] = TEST_LMAC_MASTER_ADDRESS;
+    frame[2] = TEST_LMAC_BINARY_FRAME_MARKER;
+    frame[3] = (uint8_t) number_of_chars;
+    // Characters are built bit by bit, MSB first.
+    for (idx = 0; idx < number_of_chars; idx++) {
+        frame[TEST_LMAC_BINARY_HEADER_SIZE + idx] = 0;
+    }
+    for (idx = 0; idx < number_of_bits; idx++) {
+        if (((payload[idx / 8] >> (7 - (idx % 8))) & 0x01) != 0) {
+            frame[TEST_LMAC_BINARY_HEADER_SIZE + (idx / TEST_LMAC_BINARY_CHAR_BITS)] |= (uint8_t) (1 << (TEST_LMAC_BINARY_CHAR_BITS - 1 - (idx % TEST_LMAC_BINARY_CHAR_BITS)));
+        }
+    }
+    frame[TEST_LMAC_BINARY_HEADER_SIZE + number_of_chars] = TEST_LMAC_FRAME_END_CHAR;
+    return (TEST_LMAC_BINARY_HEADER_SIZE + number_of_chars + 1);
+}
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static uint32_t _TEST_LMAC_binary_decode(uint8_t* frame, uint32_t frame_size, uint8_t* data) {
+    // Local variables.
+    uint8_t payload[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint32_t number_of_chars = frame[3];
+    uint32_t payload_size = ((number_of_chars * TEST_LMAC_BINARY_CHAR_BITS) / 8);
+    uint32_t idx = 0;
+    // Check header.
+    if ((frame_size != (TEST_LMAC_BINARY_HEADER_SIZE + number_of_chars + 1)) || (frame[0] != (TEST_LMAC_MASTER_ADDRESS | TEST_LMAC_ADDRESS_MARKER)) || (frame[1] != TEST_LMAC_SELF_ADDRESS) || (frame[2] != TEST_LMAC_BINARY_FRAME_MARKER) || (frame[frame_size - 1] != TEST_LMAC_FRAME_END_CHAR)) return 0;
+    if (payload_size <= TEST_LMAC_BINARY_CRC_SIZE) return 0;
+    // Characters are read bit by bit, MSB first.
+    for (idx = 0; idx < payload_size; idx++) {
+        payload[idx] = 0;
+    }
+    for (idx = 0; idx < (payload_size * 8); idx++) {
+        if (((frame[TEST_LMAC_BINARY_HEADER_SIZE + (idx / TEST_LMAC_BINARY_CHAR_BITS)] >> (TEST_LMAC_BINARY_CHAR_BITS - 1 - (idx % TEST_LMAC_BINARY_CHAR_BITS))) & 0x01) != 0) {
+            payload[idx / 8] |= (uint8_t) (1 << (7 - (idx % 8)));
+        }
+    }
+    // Check CRC.
+    payload_size -= TEST_LMAC_BINARY_CRC_SIZE;
+    if (_TEST_LMAC_crc16(payload, payload_size) != ((((uint16_t) payload[payload_size]) << 8) | payload[payload_size + 1])) return 0;
+    for (idx = 0; idx < payload_size; idx++) {
+        data[idx] = payload[idx];
+    }
+    return payload_size;
+}
+#endif
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static void _TEST_LMAC_binary(void) {
+    // Local variables.
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    LMAC_HW_statistics_t statistics;
+    uint8_t crc_check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    uint8_t request[] = { 0x01, 0x10, 0x02 };
+    uint8_t text_frame[] = { (TEST_LMAC_SELF_ADDRESS | TEST_LMAC_ADDRESS_MARKER), TEST_LMAC_MASTER_ADDRESS, 'R', 'S', '$', 'R', '=', '0', '0', TEST_LMAC_FRAME_END_CHAR };
+    uint8_t data[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint8_t frame[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint8_t decoded[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint32_t frame_size = 0;
+    uint8_t data_size = 0;
+    uint8_t decoded_size = 0;
+    uint8_t round_trip_flag = 1;
+    uint32_t idx = 0;
+    // Reference CRC check value.
+    TEST_check((_TEST_LMAC_crc16(crc_check, sizeof(crc_check)) == 0x29B1), "binary reference crc16");
+    // Binary frame without registered callback is dropped.
+    test_lmac_ctx.rx_buffer_size = 0;
+    frame_size = _TEST_LMAC_binary_encode(request, sizeof(request), frame);
+    LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, frame_size);
+    LMAC_HW_get_statistics(&statistics);
+    TEST_check(((test_lmac_ctx.rx_buffer_size == 0) && (statistics.rx_binary_frame_count == 0) && (statistics.rx_binary_error_count == 1)), "binary frame dropped without callback");
+    // Binary frame reception.
+    LMAC_HW_set_binary_rx_callback(&_TEST_LMAC_binary_rx_callback);
+    test_lmac_ctx.binary_rx_flag = 0;
+    LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, frame_size);
+    LMAC_HW_get_statistics(&statistics);
+    TEST_check(((test_lmac_ctx.binary_rx_flag != 0) && (statistics.rx_binary_frame_count == 1)), "binary frame received");
+    TEST_check((test_lmac_ctx.rx_buffer_size == 0), "binary frame not transmitted to the MAC layer");
+    // Pending frame is not overwritten.
+    data[0] = 0xFF;
+    frame_size = _TEST_LMAC_binary_encode(data, 1, frame);
+    LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, frame_size);
+    lmac_status = LMAC_HW_read_binary_frame(data, &data_size);
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (data_size == sizeof(request)) && (_TEST_LMAC_compare(data, request, sizeof(request)) != 0)), "binary frame decoding");
+    LMAC_HW_get_statistics(&statistics);
+    TEST_check((statistics.rx_binary_error_count == 2), "binary frame dropped while previous frame is pending");
+    lmac_status = LMAC_HW_read_binary_frame(data, &data_size);
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (data_size == 0)), "binary frame read once");
+    // Corrupted frame.
+    frame_size = _TEST_LMAC_binary_encode(request, sizeof(request), frame);
+    frame[TEST_LMAC_BINARY_HEADER_SIZE + 1] ^= 0x04;
+    LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, frame_size);
+    lmac_status = LMAC_HW_read_binary_frame(data, &data_size);
+    LMAC_HW_get_statistics(&statistics);
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (data_size == 0) && (statistics.rx_binary_error_count == 3)), "binary frame crc error");
+    // Text frame with header is transmitted unchanged.
+    test_lmac_ctx.rx_buffer_size = 0;
+    test_lmac_ctx.rx_frame_flag = 0;
+    LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, text_frame, sizeof(text_frame));
+    TEST_check(((test_lmac_ctx.rx_frame_flag != 0) && (test_lmac_ctx.rx_buffer_size == sizeof(text_frame)) && (_TEST_LMAC_compare(test_lmac_ctx.rx_buffer, text_frame, sizeof(text_frame)) != 0)), "text frame transmitted to the MAC layer");
+    // Reply is addressed to the request source.
+    frame_size = _TEST_LMAC_binary_encode(request, sizeof(request), frame);
+    LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, frame_size);
+    LMAC_HW_read_binary_frame(data, &data_size);
+    for (idx = 0; idx < LMAC_HW_BINARY_DATA_SIZE_MAX; idx++) {
+        data[idx] = (uint8_t) ((idx * 37) + 11);
+    }
+    lmac_status = LMAC_HW_write_binary_frame(data, LMAC_HW_BINARY_DATA_SIZE_MAX);
+    frame_size = LPUART_MOCK_read_bus(TEST_LMAC_BAUD_RATE_DEFAULT, frame, TEST_LMAC_BINARY_FRAME_SIZE_MAX);
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (_TEST_LMAC_binary_decode(frame, frame_size, decoded) == LMAC_HW_BINARY_DATA_SIZE_MAX) && (_TEST_LMAC_compare(decoded, data, LMAC_HW_BINARY_DATA_SIZE_MAX) != 0)), "binary reply encoding");
+    for (idx = TEST_LMAC_BINARY_HEADER_SIZE; idx < frame_size; idx++) {
+        if ((frame[idx] & TEST_LMAC_ADDRESS_MARKER) != 0) break;
+    }
+    TEST_check((idx == frame_size), "binary reply without address mark");
+    lmac_status = LMAC_HW_write_binary_frame(data, (LMAC_HW_BINARY_DATA_SIZE_MAX + 1));
+    TEST_check((lmac_status != LMAC_SUCCESS), "binary reply size error");
+    // Round trip for all payload sizes.
+    for (data_size = 1; data_size <= LMAC_HW_BINARY_DATA_SIZE_MAX; data_size++) {
+        frame_size = _TEST_LMAC_binary_encode(data, data_size, frame);
+        test_lmac_ctx.binary_rx_flag = 0;
+        LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, frame_size);
+        lmac_status = LMAC_HW_read_binary_frame(decoded, &decoded_size);
+        if ((lmac_status != LMAC_SUCCESS) || (test_lmac_ctx.binary_rx_flag == 0) || (decoded_size != data_size) || (_TEST_LMAC_compare(decoded, data, data_size) == 0)) {
+            round_trip_flag = 0;
+        }
+    }
+    TEST_check((round_trip_flag != 0), "binary round trip all sizes");
+    LMAC_HW_set_binary_rx_callback(NULL);
+}
+#endif
+
+#ifdef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static void _TEST_LMAC_binary_bench(void) {
+    // Local variables.
+    uint8_t reply[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint8_t frame[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint8_t data[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint32_t reply_size = (3 + (TEST_LMAC_BINARY_NUMBER_OF_REGISTERS * TEST_LMAC_BINARY_REGISTER_SIZE));
+    uint32_t binary_size = 0;
+    uint32_t text_size = (2 + (TEST_LMAC_BINARY_NUMBER_OF_REGISTERS * TEST_LMAC_TEXT_REGISTER_SIZE));
+    uint8_t data_size = 0;
+    uint64_t start_ns = 0;
+    uint64_t duration_ns = 0;
+    uint32_t idx = 0;
+    // Register read reply size on the bus.
+    for (idx = 0; idx < reply_size; idx++) {
+        reply[idx] = (uint8_t) idx;
+    }
+    binary_size = _TEST_LMAC_binary_encode(reply, reply_size, frame);
+    // Reception and decoding time.
+    LMAC_HW_set_binary_rx_callback(&_TEST_LMAC_binary_rx_callback);
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_LMAC_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, binary_size);
+        LMAC_HW_read_binary_frame(data, &data_size);
+    }
+    duration_ns = (TEST_get_time_ns() - start_ns);
+    LMAC_HW_set_binary_rx_callback(NULL);
+    TEST_check(((data_size == reply_size) && (_TEST_LMAC_compare(data, reply, reply_size) != 0)), "bench binary frame");
+    TEST_bench("register read reply", "registers=%u binary=%ubytes text=%ubytes ratio=%.2f decode=%.2fns",
+        TEST_LMAC_BINARY_NUMBER_OF_REGISTERS,
+        binary_size,
+        text_size,
+        ((float64_t) text_size) / ((float64_t) binary_size),
+        ((float64_t) duration_ns) / TEST_LMAC_BENCH_NUMBER_OF_ITERATIONS);
+}
+#endif
+
+#ifndef UNA_AT_CUSTOM_COMMANDS
+/*******************************************************************/
+static void _TEST_LMAC_forward(void) {
+    // Local variables.
+    LMAC_HW_statistics_t statistics;
+    uint8_t request[] = { 0x01, 0x10, 0x02 };
+    uint8_t frame[TEST_LMAC_BINARY_FRAME_SIZE_MAX];
+    uint32_t frame_size = 0;
+    // Without custom commands, all bytes are transmitted to the MAC layer, including binary frames.
+    test_lmac_ctx.rx_buffer_size = 0;
+    test_lmac_ctx.rx_frame_flag = 0;
+    frame_size = _TEST_LMAC_binary_encode(request, sizeof(request), frame);
+    LPUART_MOCK_receive(TEST_LMAC_BAUD_RATE_DEFAULT, frame, frame_size);
+    LMAC_HW_get_statistics(&statistics);
+    TEST_check(((test_lmac_ctx.rx_frame_flag != 0) && (test_lmac_ctx.rx_buffer_size == frame_size) && (_TEST_LMAC_compare(test_lmac_ctx.rx_buffer, frame, frame_size) != 0)), "binary frame forwarded");
+    TEST_check(((statistics.rx_binary_frame_count == 0) && (statistics.rx_binary_error_count == 0)), "binary statistics unused");
+}
+#endif
+
+/*******************************************************************/
+static void _TEST_LMAC_update_clock(void) {
+    // Local variables.
+    LMAC_status_t lmac_status = LMAC_SUCCESS;
+    uint32_t init_count = 0;
+    // Clock switch at default baud rate.
+    lmac_status = LMAC_HW_set_baud_rate(TEST_LMAC_BAUD_RATE_DEFAULT);
+    TEST_check((lmac_status == LMAC_SUCCESS), "update clock default baud rate switch");
+    init_count = LPUART_MOCK_get_init_count();
+    lmac_status = LMAC_HW_update_clock();
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (LPUART_MOCK_get_init_count() == init_count)), "update clock at default baud rate ignored");
+    // Switch to an intermediate baud rate.
+    lmac_status = LMAC_HW_set_baud_rate(4800);
+    TEST_check((lmac_status == LMAC_SUCCESS), "update clock switch");
+    // Clock switch.
+    init_count = LPUART_MOCK_get_init_count();
+    lmac_status = LMAC_HW_update_clock();
+    TEST_check((lmac_status == LMAC_SUCCESS), "update clock");
+    TEST_check((LPUART_MOCK_get_init_count() == (init_count + 1)), "update clock re-init");
+    TEST_check((LPUART_MOCK_get_baud_rate() == 4800), "update clock keeps baud rate");
+    TEST_check((_TEST_LMAC_exchange(4800) != 0), "update clock exchange");
+    // Released interface.
+    lmac_status = LMAC_HW_de_init();
+    TEST_check((lmac_status == LMAC_SUCCESS), "de-init");
+    init_count = LPUART_MOCK_get_init_count();
+    lmac_status = LMAC_HW_update_clock();
+    TEST_check(((lmac_status == LMAC_SUCCESS) && (LPUART_MOCK_get_init_count() == init_count)), "clock update after de-init ignored");
+}
+
+/*** TEST LMAC main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("lmac_" TEST_LMAC_VARIANT);
+    ERROR_stack_init();
+    _TEST_LMAC_init();
+    _TEST_LMAC_switch();
+    _TEST_LMAC_fallback();
+#ifdef UNA_AT_CUSTOM_COMMANDS
+    _TEST_LMAC_binary();
+    _TEST_LMAC_binary_bench();
+#else
+    _TEST_LMAC_forward();
+#endif
+    _TEST_LMAC_update_clock();
+    TEST_check((ERROR_stack_is_empty() != 0), "error stack empty");
+    return TEST_end();
+}
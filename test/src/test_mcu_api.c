@@ -0,0 +1,193 @@
+/*
+ * test_mcu_api.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "manuf/mcu_api.h"
+
+#include "aes.h"
+#include "error.h"
+#include "nvm.h"
+#include "nvm_address.h"
+#include "sigfox_types.h"
+#include "test.h"
+#include "types.h"
+
+/*** TEST MCU API local macros ***/
+
+#ifndef TEST_MCU_API_VARIANT
+#define TEST_MCU_API_VARIANT    "default"
+#endif
+
+#define TEST_MCU_API_NUMBER_OF_ENCRYPTIONS          10
+// Authentication of an uplink frame with a payload longer than 4 bytes (CBC over 2 blocks).
+#define TEST_MCU_API_FRAME_NUMBER_OF_BLOCKS         2
+#define TEST_MCU_API_BENCH_NUMBER_OF_FRAMES         20000
+
+/*** TEST MCU API local global variables ***/
+
+// FIPS-197 appendix C.1 AES-128 example vector.
+static const uint8_t TEST_MCU_API_FIPS197_KEY[SIGFOX_EP_KEY_SIZE_BYTES] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F };
+static const uint8_t TEST_MCU_API_FIPS197_PLAINTEXT[AES_BLOCK_SIZE_BYTES] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+static const uint8_t TEST_MCU_API_FIPS197_CIPHERTEXT[AES_BLOCK_SIZE_BYTES] = { 0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30, 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A };
+// NIST SP800-38A F.1.1 ECB-AES128 first block, used as a second end-point key.
+static const uint8_t TEST_MCU_API_SP800_KEY[SIGFOX_EP_KEY_SIZE_BYTES] = { 0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C };
+static const uint8_t TEST_MCU_API_SP800_PLAINTEXT[AES_BLOCK_SIZE_BYTES] = { 0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A };
+static const uint8_t TEST_MCU_API_SP800_CIPHERTEXT[AES_BLOCK_SIZE_BYTES] = { 0x3A, 0xD7, 0x7B, 0xB4, 0x0D, 0x7A, 0x36, 0x60, 0xA8, 0x9E, 0xCA, 0xF3, 0x24, 0x66, 0xEF, 0x97 };
+
+/*** TEST MCU API local functions ***/
+
+/*******************************************************************/
+static void _TEST_MCU_API_write_ep_key(const uint8_t* ep_key) {
+    // Local variables.
+    uint8_t idx = 0;
+    for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
+        NVM_write_byte((NVM_ADDRESS_SIGFOX_EP_KEY + idx), ep_key[idx]);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_MCU_API_open(void) {
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+    // Local variables.
+    MCU_API_config_t mcu_api_config = { .rc = NULL };
+    MCU_API_open(&mcu_api_config);
+#endif
+}
+
+/*******************************************************************/
+static void _TEST_MCU_API_close(void) {
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+    MCU_API_close();
+#endif
+}
+
+/*******************************************************************/
+static uint8_t _TEST_MCU_API_encrypt(const uint8_t* plaintext, const uint8_t* ciphertext) {
+    // Local variables.
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+    MCU_API_encryption_data_t aes_data;
+    uint8_t data[AES_BLOCK_SIZE_BYTES];
+    uint8_t error_count = 0;
+    uint8_t idx = 0;
+    // Encrypt block in place.
+    for (idx = 0; idx < AES_BLOCK_SIZE_BYTES; idx++) {
+        data[idx] = plaintext[idx];
+    }
+    aes_data.data = data;
+    aes_data.key = SIGFOX_EP_KEY_PRIVATE;
+    mcu_api_status = MCU_API_aes_128_cbc_encrypt(&aes_data);
+    if (mcu_api_status != MCU_API_SUCCESS) {
+        error_count++;
+    }
+    for (idx = 0; idx < AES_BLOCK_SIZE_BYTES; idx++) {
+        if (data[idx] != ciphertext[idx]) {
+            error_count++;
+        }
+    }
+    return error_count;
+}
+
+/*******************************************************************/
+static void _TEST_MCU_API_reference_vectors(void) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t idx = 0;
+    NVM_MOCK_erase();
+    ERROR_stack_init();
+    _TEST_MCU_API_write_ep_key(TEST_MCU_API_FIPS197_KEY);
+    _TEST_MCU_API_open();
+    TEST_check((_TEST_MCU_API_encrypt(TEST_MCU_API_FIPS197_PLAINTEXT, TEST_MCU_API_FIPS197_CIPHERTEXT) == 0), "aes fips-197 vector");
+    // Successive encryptions must give the same result.
+    for (idx = 0; idx < TEST_MCU_API_NUMBER_OF_ENCRYPTIONS; idx++) {
+        error_count += _TEST_MCU_API_encrypt(TEST_MCU_API_FIPS197_PLAINTEXT, TEST_MCU_API_FIPS197_CIPHERTEXT);
+    }
+    TEST_check((error_count == 0), "aes repeated encryptions");
+    _TEST_MCU_API_close();
+    // New key programmed between two sessions.
+    _TEST_MCU_API_write_ep_key(TEST_MCU_API_SP800_KEY);
+    _TEST_MCU_API_open();
+    TEST_check((_TEST_MCU_API_encrypt(TEST_MCU_API_SP800_PLAINTEXT, TEST_MCU_API_SP800_CIPHERTEXT) == 0), "aes sp800-38a vector after key update");
+    _TEST_MCU_API_close();
+    TEST_check((ERROR_stack_is_empty() != 0), "aes error stack empty");
+}
+
+/*******************************************************************/
+static void _TEST_MCU_API_key_access(void) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t nvm_read_count = 0;
+    uint32_t idx = 0;
+    NVM_MOCK_erase();
+    AES_MOCK_reset_counters();
+    _TEST_MCU_API_write_ep_key(TEST_MCU_API_FIPS197_KEY);
+    _TEST_MCU_API_open();
+    for (idx = 0; idx < TEST_MCU_API_NUMBER_OF_ENCRYPTIONS; idx++) {
+        error_count += _TEST_MCU_API_encrypt(TEST_MCU_API_FIPS197_PLAINTEXT, TEST_MCU_API_FIPS197_CIPHERTEXT);
+    }
+    nvm_read_count = NVM_MOCK_get_read_count();
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+    TEST_check((nvm_read_count == SIGFOX_EP_KEY_SIZE_BYTES), "session key read once");
+    TEST_check((AES_MOCK_get_init_count() == 1), "session peripheral init once");
+    TEST_check((AES_MOCK_is_enabled() != 0), "session peripheral kept enabled");
+    _TEST_MCU_API_close();
+    TEST_check((AES_MOCK_is_enabled() == 0), "session peripheral released on close");
+    // Key must be read again in the next session.
+    _TEST_MCU_API_open();
+    error_count += _TEST_MCU_API_encrypt(TEST_MCU_API_FIPS197_PLAINTEXT, TEST_MCU_API_FIPS197_CIPHERTEXT);
+    _TEST_MCU_API_close();
+    TEST_check((NVM_MOCK_get_read_count() == (nvm_read_count + SIGFOX_EP_KEY_SIZE_BYTES)), "session key read again after close");
+#else
+    TEST_check((nvm_read_count == (TEST_MCU_API_NUMBER_OF_ENCRYPTIONS * SIGFOX_EP_KEY_SIZE_BYTES)), "per call key read each time");
+    TEST_check((AES_MOCK_get_init_count() == TEST_MCU_API_NUMBER_OF_ENCRYPTIONS), "per call peripheral init each time");
+    TEST_check((AES_MOCK_is_enabled() == 0), "per call peripheral released");
+    _TEST_MCU_API_close();
+#endif
+    TEST_check((error_count == 0), "key access ciphertexts");
+}
+
+/*******************************************************************/
+static void _TEST_MCU_API_bench(void) {
+    // Local variables.
+    MCU_API_encryption_data_t aes_data;
+    uint8_t data[AES_BLOCK_SIZE_BYTES];
+    uint64_t start_ns = 0;
+    uint64_t duration_ns = 0;
+    uint32_t idx = 0;
+    uint8_t block_idx = 0;
+    NVM_MOCK_erase();
+    AES_MOCK_reset_counters();
+    _TEST_MCU_API_write_ep_key(TEST_MCU_API_FIPS197_KEY);
+    for (idx = 0; idx < AES_BLOCK_SIZE_BYTES; idx++) {
+        data[idx] = TEST_MCU_API_FIPS197_PLAINTEXT[idx];
+    }
+    aes_data.data = data;
+    aes_data.key = SIGFOX_EP_KEY_PRIVATE;
+    // One session per frame, as performed by the library in low level open/close mode.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_MCU_API_BENCH_NUMBER_OF_FRAMES; idx++) {
+        _TEST_MCU_API_open();
+        for (block_idx = 0; block_idx < TEST_MCU_API_FRAME_NUMBER_OF_BLOCKS; block_idx++) {
+            MCU_API_aes_128_cbc_encrypt(&aes_data);
+        }
+        _TEST_MCU_API_close();
+    }
+    duration_ns = (TEST_get_time_ns() - start_ns);
+    TEST_bench("frame authentication " TEST_MCU_API_VARIANT, "time=%.2fns/frame nvm_reads=%.1f/frame aes_init=%.1f/frame",
+        ((float64_t) duration_ns) / ((float64_t) TEST_MCU_API_BENCH_NUMBER_OF_FRAMES),
+        ((float64_t) NVM_MOCK_get_read_count()) / ((float64_t) TEST_MCU_API_BENCH_NUMBER_OF_FRAMES),
+        ((float64_t) AES_MOCK_get_init_count()) / ((float64_t) TEST_MCU_API_BENCH_NUMBER_OF_FRAMES));
+}
+
+/*** TEST MCU API main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("mcu_api_" TEST_MCU_API_VARIANT);
+    _TEST_MCU_API_reference_vectors();
+    _TEST_MCU_API_key_access();
+    _TEST_MCU_API_bench();
+    return TEST_end();
+}
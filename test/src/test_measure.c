@@ -0,0 +1,606 @@
+/*
+ * test_measure.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "dma.h"
+#include "dsm_flags.h"
+#include "error.h"
+#include "exti.h"
+#include "gpio.h"
+#include "math.h"
+#include "mcu_mapping.h"
+#include "measure.h"
+#include "power.h"
+#include "rtc.h"
+#include "simulation.h"
+#include "stm32g4xx_drivers_flags.h"
+#include "stdio.h"
+#include "test.h"
+#include "tim.h"
+#include "types.h"
+
+/*** TEST MEASURE local macros ***/
+
+#ifndef TEST_MEASURE_VARIANT
+#define TEST_MEASURE_VARIANT                        "default"
+#endif
+
+#define TEST_MEASURE_PI                             3.14159265358979323846
+
+#define TEST_MEASURE_SAMPLES_PER_SECOND             (1000000 / MEASURE_ACV_ACI_SAMPLING_PERIOD_US)
+#define TEST_MEASURE_ADC_OFFSET                     2048
+
+#define TEST_MEASURE_TRANSFORMER_GAIN               236
+#define TEST_MEASURE_CURRENT_SENSORS_GAIN           { 50, 50, 100, 200 }
+
+// Note: state machine needs 3 seconds to reach the active state and 1 second of warm-up.
+#define TEST_MEASURE_STARTUP_DURATION_SECONDS       5
+#define TEST_MEASURE_RUN_DURATION_SECONDS           5
+
+// Tolerances.
+#define TEST_MEASURE_RMS_TOLERANCE_PERCENT          0.2
+#define TEST_MEASURE_POWER_TOLERANCE_PERCENT        0.5
+#define TEST_MEASURE_POWER_FACTOR_TOLERANCE         0.5
+#define TEST_MEASURE_FREQUENCY_TOLERANCE_MHZ        20.0
+#define TEST_MEASURE_PHASE_ANGLE_TOLERANCE_DEGREES  0.5
+#define TEST_MEASURE_HARMONICS_TOLERANCE_PERCENT    0.5
+// Kernel error against a float64 computation of the same quantized samples.
+#ifdef MPMCM_ANALOG_FIXED_POINT_KERNEL
+#define TEST_MEASURE_KERNEL_TOLERANCE_PERCENT       0.001
+#else
+#define TEST_MEASURE_KERNEL_TOLERANCE_PERCENT       0.01
+#endif
+
+/*** TEST MEASURE local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    float64_t frequency_hz;
+    float64_t acv_amplitude_lsb;
+    float64_t acv_harmonic_3_ratio;
+    float64_t aci_amplitude_lsb[MEASURE_NUMBER_OF_ACI_CHANNELS];
+    float64_t aci_phase_degrees[MEASURE_NUMBER_OF_ACI_CHANNELS];
+    uint8_t aci_probe_connected[MEASURE_NUMBER_OF_ACI_CHANNELS];
+} TEST_MEASURE_waveform_t;
+
+/*******************************************************************/
+typedef struct {
+    float64_t rms_voltage_mv;
+    float64_t rms_current_ma;
+    float64_t active_power_mw;
+    float64_t apparent_power_mva;
+    float64_t power_factor;
+    float64_t reactive_power_mvar;
+    float64_t phase_angle_degrees;
+} TEST_MEASURE_expected_t;
+
+/*******************************************************************/
+typedef struct {
+    uint64_t sample_count;
+    float64_t phase;
+    uint32_t uptime_seconds;
+    uint8_t random_divider;
+    // Processing time statistics.
+    uint64_t period_time_ns_sum;
+    uint64_t period_time_ns_min;
+    uint64_t period_time_ns_max;
+    uint32_t period_time_count;
+} TEST_MEASURE_context_t;
+
+/*** TEST MEASURE local global variables ***/
+
+static const uint16_t TEST_MEASURE_ACI_GAIN[MEASURE_NUMBER_OF_ACI_CHANNELS] = TEST_MEASURE_CURRENT_SENSORS_GAIN;
+
+static const GPIO_pin_t* const TEST_MEASURE_GPIO_ACI_DETECT[MEASURE_NUMBER_OF_ACI_CHANNELS] = {
+    &GPIO_ACI1_DETECT,
+    &GPIO_ACI2_DETECT,
+    &GPIO_ACI3_DETECT,
+    &GPIO_ACI4_DETECT
+};
+
+static TEST_MEASURE_context_t test_measure_ctx;
+
+/*** TEST MEASURE local functions ***/
+
+/*******************************************************************/
+static float64_t _TEST_MEASURE_get_acv_factor(void) {
+    // mV per LSB.
+    return ((((float64_t) TEST_MEASURE_TRANSFORMER_GAIN) * ((float64_t) MPMCM_TRANSFORMER_ATTEN) * ((float64_t) STM32G4XX_DRIVERS_ADC_VREF_MV)) / (10.0 * ((float64_t) ADC_FULL_SCALE)));
+}
+
+/*******************************************************************/
+static float64_t _TEST_MEASURE_get_aci_factor(uint8_t chx_idx) {
+    // mA per LSB.
+    return ((((float64_t) TEST_MEASURE_ACI_GAIN[chx_idx]) * ((float64_t) MEASURE_SCT013_ATTEN[chx_idx]) * ((float64_t) STM32G4XX_DRIVERS_ADC_VREF_MV)) / (10.0 * ((float64_t) ADC_FULL_SCALE)));
+}
+
+/*******************************************************************/
+static void _TEST_MEASURE_reset_timing(void) {
+    test_measure_ctx.period_time_ns_sum = 0;
+    test_measure_ctx.period_time_ns_min = 0xFFFFFFFFFFFFFFFFULL;
+    test_measure_ctx.period_time_ns_max = 0;
+    test_measure_ctx.period_time_count = 0;
+}
+
+/*******************************************************************/
+static void _TEST_MEASURE_init(void) {
+    // Local variables.
+    uint16_t current_sensors_gain[MEASURE_NUMBER_OF_ACI_CHANNELS] = TEST_MEASURE_CURRENT_SENSORS_GAIN;
+    // Reset context.
+    test_measure_ctx.sample_count = 0;
+    test_measure_ctx.phase = 0.0;
+    test_measure_ctx.uptime_seconds = 0;
+    test_measure_ctx.random_divider = 1;
+    _TEST_MEASURE_reset_timing();
+    // Init drivers.
+    ERROR_stack_init();
+    POWER_init();
+    RTC_MOCK_set_uptime_seconds(0);
+    TEST_check((MEASURE_init() == MEASURE_SUCCESS), "init");
+    TEST_check((MEASURE_set_gains(TEST_MEASURE_TRANSFORMER_GAIN, current_sensors_gain) == MEASURE_SUCCESS), "set gains");
+}
+
+/*******************************************************************/
+static void _TEST_MEASURE_process(void) {
+    // Local variables.
+    MEASURE_pipeline_statistics_t statistics_before;
+    MEASURE_pipeline_statistics_t statistics_after;
+    uint64_t start_ns = 0;
+    uint64_t duration_ns = 0;
+    // Process pending periods.
+    MEASURE_get_pipeline_statistics(&statistics_before);
+    start_ns = TEST_get_time_ns();
+    MEASURE_process();
+    duration_ns = (TEST_get_time_ns() - start_ns);
+    MEASURE_get_pipeline_statistics(&statistics_after);
+    // Update timing when exactly one period has been computed.
+    if ((statistics_after.processed_period_count - statistics_before.processed_period_count) == 1) {
+        test_measure_ctx.period_time_ns_sum += duration_ns;
+        test_measure_ctx.period_time_count++;
+        if (duration_ns < test_measure_ctx.period_time_ns_min) {
+            test_measure_ctx.period_time_ns_min = duration_ns;
+        }
+        if (duration_ns > test_measure_ctx.period_time_ns_max) {
+            test_measure_ctx.period_time_ns_max = duration_ns;
+        }
+    }
+}
+
+/*******************************************************************/
+static void _TEST_MEASURE_zero_cross(uint8_t rising_edge, float64_t time_us) {
+    // Zero cross detector pulse.
+    EXTI_MOCK_trigger(&GPIO_ZERO_CROSS_PULSE);
+#ifdef MPMCM_ANALOG_SIMULATION
+    TIM_MOCK_trigger(TIM_INSTANCE_SIMULATION);
+#endif
+    // Frequency timer capture (prescaler 2 gives one capture per mains period).
+    if (rising_edge != 0) {
+        DMA_MOCK_transfer(DMA_INSTANCE_ACV_FREQUENCY, DMA_CHANNEL_ACV_FREQUENCY, (uint32_t) (time_us + 0.5));
+    }
+}
+
+/*******************************************************************/
+static void _TEST_MEASURE_tick_second(void) {
+    // Local variables.
+    uint8_t mains_detected_before = 0;
+    uint8_t mains_detected_after = 0;
+    // Update uptime.
+    test_measure_ctx.uptime_seconds++;
+    RTC_MOCK_set_uptime_seconds(test_measure_ctx.uptime_seconds);
+    // Call driver.
+    MEASURE_get_mains_detect_flag(&mains_detected_before);
+    MEASURE_tick_second();
+    MEASURE_get_mains_detect_flag(&mains_detected_after);
+    // Mirror simulation current divider.
+    if ((mains_detected_before == 0) && (mains_detected_after != 0)) {
+        test_measure_ctx.random_divider = 1;
+    }
+    else {
+        test_measure_ctx.random_divider = (uint8_t) (1 + ((test_measure_ctx.random_divider + 1) % 100));
+    }
+}
+
+/*******************************************************************/
+static void _TEST_MEASURE_run(const TEST_MEASURE_waveform_t* waveform, uint32_t duration_seconds) {
+    // Local variables.
+    float64_t phase_step = (2.0 * TEST_MEASURE_PI * waveform->frequency_hz * ((float64_t) MEASURE_ACV_ACI_SAMPLING_PERIOD_US)) / 1000000.0;
+    float64_t previous_phase = 0.0;
+    float64_t time_us = 0.0;
+    float64_t crossing_time_us = 0.0;
+    float64_t sample = 0.0;
+    int16_t acv_sample = 0;
+    int16_t aci_sample = 0;
+    uint32_t sample_idx = 0;
+    uint8_t chx_idx = 0;
+    uint8_t period_end = 0;
+    // Probes detection.
+    for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+        GPIO_MOCK_set_input(TEST_MEASURE_GPIO_ACI_DETECT[chx_idx], waveform->aci_probe_connected[chx_idx]);
+    }
+    for (sample_idx = 0; sample_idx < (duration_seconds * TEST_MEASURE_SAMPLES_PER_SECOND); sample_idx++) {
+        // Update phase.
+        time_us = ((float64_t) test_measure_ctx.sample_count) * ((float64_t) MEASURE_ACV_ACI_SAMPLING_PERIOD_US);
+        previous_phase = test_measure_ctx.phase;
+        test_measure_ctx.phase += phase_step;
+        period_end = 0;
+        // Zero cross detection (null amplitude emulates mains loss).
+        if (waveform->acv_amplitude_lsb > 0.0) {
+            if ((previous_phase < TEST_MEASURE_PI) && (test_measure_ctx.phase >= TEST_MEASURE_PI)) {
+                crossing_time_us = time_us + (((TEST_MEASURE_PI - previous_phase) / phase_step) * ((float64_t) MEASURE_ACV_ACI_SAMPLING_PERIOD_US));
+                _TEST_MEASURE_zero_cross(0, crossing_time_us);
+            }
+            if (test_measure_ctx.phase >= (2.0 * TEST_MEASURE_PI)) {
+                crossing_time_us = time_us + ((((2.0 * TEST_MEASURE_PI) - previous_phase) / phase_step) * ((float64_t) MEASURE_ACV_ACI_SAMPLING_PERIOD_US));
+                _TEST_MEASURE_zero_cross(1, crossing_time_us);
+                period_end = 1;
+            }
+        }
+        if (test_measure_ctx.phase >= (2.0 * TEST_MEASURE_PI)) {
+            test_measure_ctx.phase -= (2.0 * TEST_MEASURE_PI);
+        }
+        // ADC sequence: master converts the voltage and slave converts each current.
+        for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+            sample = waveform->acv_amplitude_lsb * (sin(test_measure_ctx.phase) + (waveform->acv_harmonic_3_ratio * sin(3.0 * test_measure_ctx.phase)));
+            acv_sample = (int16_t) lround(sample + TEST_MEASURE_ADC_OFFSET);
+            sample = waveform->aci_amplitude_lsb[chx_idx] * sin(test_measure_ctx.phase - ((waveform->aci_phase_degrees[chx_idx] * TEST_MEASURE_PI) / 180.0));
+            aci_sample = (int16_t) lround(sample);
+            DMA_MOCK_transfer(DMA_INSTANCE_ACV_SAMPLING, DMA_CHANNEL_ACV_SAMPLING, (uint32_t) ((uint16_t) acv_sample));
+            DMA_MOCK_transfer(DMA_INSTANCE_ACI_SAMPLING, DMA_CHANNEL_ACI_SAMPLING, (uint32_t) ((uint16_t) aci_sample));
+        }
+        test_measure_ctx.sample_count++;
+        // Main loop processing once per period.
+        if ((period_end != 0) || (waveform->acv_amplitude_lsb <= 0.0)) {
+            _TEST_MEASURE_process();
+        }
+        // RTC wake-up.
+        if ((test_measure_ctx.sample_count % TEST_MEASURE_SAMPLES_PER_SECOND) == 0) {
+            _TEST_MEASURE_tick_second();
+        }
+    }
+}
+
+#ifndef MPMCM_ANALOG_SIMULATION
+/*******************************************************************/
+static void _TEST_MEASURE_compute_expected(const TEST_MEASURE_waveform_t* waveform, uint8_t chx_idx, TEST_MEASURE_expected_t* expected) {
+    // Local variables.
+    float64_t phase_radians = (waveform->aci_phase_degrees[chx_idx] * TEST_MEASURE_PI) / 180.0;
+    float64_t rms_current_lsb = (waveform->aci_probe_connected[chx_idx] != 0) ? (waveform->aci_amplitude_lsb[chx_idx] / sqrt(2.0)) : 0.0;
+    // Voltage includes the harmonic.
+    expected->rms_voltage_mv = (waveform->acv_amplitude_lsb / sqrt(2.0)) * sqrt(1.0 + (waveform->acv_harmonic_3_ratio * waveform->acv_harmonic_3_ratio)) * _TEST_MEASURE_get_acv_factor();
+    expected->rms_current_ma = rms_current_lsb * _TEST_MEASURE_get_aci_factor(chx_idx);
+    // Powers only depend on the fundamental.
+    expected->active_power_mw = ((waveform->acv_amplitude_lsb / sqrt(2.0)) * _TEST_MEASURE_get_acv_factor() * expected->rms_current_ma * cos(phase_radians)) / 1000.0;
+    expected->reactive_power_mvar = ((waveform->acv_amplitude_lsb / sqrt(2.0)) * _TEST_MEASURE_get_acv_factor() * expected->rms_current_ma * sin(phase_radians)) / 1000.0;
+    expected->apparent_power_mva = (expected->rms_voltage_mv * expected->rms_current_ma) / 1000.0;
+    if (expected->active_power_mw < 0.0) {
+        expected->apparent_power_mva *= (-1.0);
+    }
+    expected->power_factor = (expected->apparent_power_mva != 0.0) ? ((100.0 * expected->active_power_mw) / expected->apparent_power_mva) : 0.0;
+    expected->phase_angle_degrees = waveform->aci_phase_degrees[chx_idx];
+}
+#endif
+
+/*******************************************************************/
+static void _TEST_MEASURE_check_channel(const char_t* prefix, uint8_t chx_idx, DATA_run_channel_t* run_data, TEST_MEASURE_expected_t* expected) {
+    // Local variables.
+    char_t check_name[128];
+    // Voltage and current.
+    snprintf(check_name, sizeof(check_name), "%s CH%u RMS voltage", prefix, (chx_idx + 1));
+    TEST_check_relative(run_data->rms_voltage_mv.value, expected->rms_voltage_mv, TEST_MEASURE_RMS_TOLERANCE_PERCENT, check_name);
+    snprintf(check_name, sizeof(check_name), "%s CH%u RMS current", prefix, (chx_idx + 1));
+    if (expected->rms_current_ma == 0.0) {
+        TEST_check_value(run_data->rms_current_ma.value, 0.0, 1.0, check_name);
+    }
+    else {
+        TEST_check_relative(run_data->rms_current_ma.value, expected->rms_current_ma, TEST_MEASURE_RMS_TOLERANCE_PERCENT, check_name);
+    }
+    // Powers.
+    snprintf(check_name, sizeof(check_name), "%s CH%u active power", prefix, (chx_idx + 1));
+    TEST_check_value(run_data->active_power_mw.value, expected->active_power_mw, ((fabs(expected->apparent_power_mva) * TEST_MEASURE_POWER_TOLERANCE_PERCENT) / 100.0) + 1.0, check_name);
+    snprintf(check_name, sizeof(check_name), "%s CH%u apparent power", prefix, (chx_idx + 1));
+    TEST_check_value(run_data->apparent_power_mva.value, expected->apparent_power_mva, ((fabs(expected->apparent_power_mva) * TEST_MEASURE_POWER_TOLERANCE_PERCENT) / 100.0) + 1.0, check_name);
+    snprintf(check_name, sizeof(check_name), "%s CH%u power factor", prefix, (chx_idx + 1));
+    TEST_check_value(run_data->power_factor.value, expected->power_factor, TEST_MEASURE_POWER_FACTOR_TOLERANCE, check_name);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    snprintf(check_name, sizeof(check_name), "%s CH%u reactive power", prefix, (chx_idx + 1));
+    TEST_check_value(run_data->reactive_power_mvar.value, expected->reactive_power_mvar, ((fabs(expected->apparent_power_mva) * TEST_MEASURE_POWER_TOLERANCE_PERCENT) / 100.0) + 1.0, check_name);
+    if (expected->rms_current_ma != 0.0) {
+        snprintf(check_name, sizeof(check_name), "%s CH%u phase angle", prefix, (chx_idx + 1));
+        TEST_check_value(run_data->phase_angle_degrees.value, expected->phase_angle_degrees, TEST_MEASURE_PHASE_ANGLE_TOLERANCE_DEGREES, check_name);
+    }
+#endif
+}
+
+/*******************************************************************/
+static void _TEST_MEASURE_bench(const char_t* bench_name) {
+    // Local variables.
+    MEASURE_pipeline_statistics_t statistics;
+    MEASURE_get_pipeline_statistics(&statistics);
+    if (test_measure_ctx.period_time_count == 0) return;
+    TEST_bench(bench_name, "periods=%u mean=%.2fus min=%.2fus max=%.2fus processed=%u dropped=%u backlog_max=%u",
+        test_measure_ctx.period_time_count,
+        (((float64_t) test_measure_ctx.period_time_ns_sum) / ((float64_t) test_measure_ctx.period_time_count)) / 1000.0,
+        ((float64_t) test_measure_ctx.period_time_ns_min) / 1000.0,
+        ((float64_t) test_measure_ctx.period_time_ns_max) / 1000.0,
+        statistics.processed_period_count,
+        statistics.dropped_period_count,
+        statistics.backlog_max);
+}
+
+#ifndef MPMCM_ANALOG_SIMULATION
+/*******************************************************************/
+static void _TEST_MEASURE_synthetic(const char_t* prefix, const TEST_MEASURE_waveform_t* waveform) {
+    // Local variables.
+    DATA_run_channel_t run_data;
+    DATA_accumulated_channel_t accumulated_data;
+    DATA_run_t frequency_run_data;
+    TEST_MEASURE_expected_t expected;
+    MEASURE_pipeline_statistics_t statistics;
+    char_t check_name[128];
+    uint8_t mains_detected = 0;
+    uint8_t chx_idx = 0;
+    // Start and wait for active state.
+    _TEST_MEASURE_init();
+    _TEST_MEASURE_run(waveform, TEST_MEASURE_STARTUP_DURATION_SECONDS);
+    MEASURE_get_mains_detect_flag(&mains_detected);
+    snprintf(check_name, sizeof(check_name), "%s mains detected", prefix);
+    TEST_check((mains_detected != 0), check_name);
+    // Discard accumulated data of the warm-up.
+    for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+        MEASURE_get_channel_accumulated_data(chx_idx, &accumulated_data);
+    }
+    _TEST_MEASURE_reset_timing();
+    _TEST_MEASURE_run(waveform, TEST_MEASURE_RUN_DURATION_SECONDS);
+    _TEST_MEASURE_bench(prefix);
+    // Check run data of the last second.
+    for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+        MEASURE_get_channel_run_data(chx_idx, &run_data);
+        _TEST_MEASURE_compute_expected(waveform, chx_idx, &expected);
+        _TEST_MEASURE_check_channel(prefix, chx_idx, &run_data, &expected);
+        // Check accumulated data.
+        MEASURE_get_channel_accumulated_data(chx_idx, &accumulated_data);
+        snprintf(check_name, sizeof(check_name), "%s CH%u accumulated samples", prefix, (chx_idx + 1));
+        TEST_check((accumulated_data.rms_voltage_mv.number_of_samples == TEST_MEASURE_RUN_DURATION_SECONDS), check_name);
+        snprintf(check_name, sizeof(check_name), "%s CH%u mean RMS voltage", prefix, (chx_idx + 1));
+        TEST_check_relative(accumulated_data.rms_voltage_mv.mean, expected.rms_voltage_mv, TEST_MEASURE_RMS_TOLERANCE_PERCENT, check_name);
+        snprintf(check_name, sizeof(check_name), "%s CH%u active energy", prefix, (chx_idx + 1));
+        TEST_check_value(accumulated_data.active_energy_mwh.value, ((expected.active_power_mw * TEST_MEASURE_RUN_DURATION_SECONDS) / 3600.0), (((fabs(expected.apparent_power_mva) * TEST_MEASURE_RUN_DURATION_SECONDS * TEST_MEASURE_POWER_TOLERANCE_PERCENT) / 360000.0) + 0.01), check_name);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+        if (expected.rms_current_ma != 0.0) {
+            snprintf(check_name, sizeof(check_name), "%s CH%u mean phase angle", prefix, (chx_idx + 1));
+            TEST_check_value(accumulated_data.phase_angle_degrees.mean, expected.phase_angle_degrees, TEST_MEASURE_PHASE_ANGLE_TOLERANCE_DEGREES, check_name);
+        }
+#endif
+    }
+    // Mains frequency.
+    MEASURE_get_run_data(MEASURE_DATA_INDEX_MAINS_FREQUENCY_MHZ, &frequency_run_data);
+    snprintf(check_name, sizeof(check_name), "%s mains frequency", prefix);
+    TEST_check_value(frequency_run_data.value, (waveform->frequency_hz * 1000.0), TEST_MEASURE_FREQUENCY_TOLERANCE_MHZ, check_name);
+    // Pipeline.
+    MEASURE_get_pipeline_statistics(&statistics);
+    snprintf(check_name, sizeof(check_name), "%s no dropped period", prefix);
+    TEST_check((statistics.dropped_period_count == 0), check_name);
+    snprintf(check_name, sizeof(check_name), "%s error stack empty", prefix);
+    TEST_check((ERROR_stack_is_empty() != 0), check_name);
+}
+#endif
+
+#ifndef MPMCM_ANALOG_SIMULATION
+/*******************************************************************/
+static void _TEST_MEASURE_kernel(const TEST_MEASURE_waveform_t* waveform) {
+    // Local variables.
+    DATA_run_channel_t run_data;
+    float64_t acv[MEASURE_PERIOD_BUFFER_SIZE];
+    float64_t aci[MEASURE_PERIOD_BUFFER_SIZE];
+    float64_t acv_mean = 0.0;
+    float64_t aci_mean = 0.0;
+    float64_t acv_square_sum = 0.0;
+    float64_t aci_square_sum = 0.0;
+    float64_t acp_sum = 0.0;
+    float64_t phase = 0.0;
+    char_t check_name[128];
+    uint32_t idx = 0;
+    uint8_t chx_idx = 0;
+    // Note: 50Hz gives exactly the same quantized samples on each period.
+    _TEST_MEASURE_init();
+    _TEST_MEASURE_run(waveform, (TEST_MEASURE_STARTUP_DURATION_SECONDS + 1));
+    for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+        if (waveform->aci_probe_connected[chx_idx] == 0) continue;
+        // Build reference period.
+        acv_mean = 0.0;
+        aci_mean = 0.0;
+        for (idx = 0; idx < MEASURE_PERIOD_BUFFER_SIZE; idx++) {
+            phase = (2.0 * TEST_MEASURE_PI * ((float64_t) idx)) / ((float64_t) MEASURE_PERIOD_BUFFER_SIZE);
+            acv[idx] = (float64_t) lround((waveform->acv_amplitude_lsb * sin(phase)) + TEST_MEASURE_ADC_OFFSET);
+            aci[idx] = (float64_t) lround(waveform->aci_amplitude_lsb[chx_idx] * sin(phase - ((waveform->aci_phase_degrees[chx_idx] * TEST_MEASURE_PI) / 180.0)));
+            acv_mean += acv[idx];
+            aci_mean += aci[idx];
+        }
+        acv_mean /= (float64_t) MEASURE_PERIOD_BUFFER_SIZE;
+        aci_mean /= (float64_t) MEASURE_PERIOD_BUFFER_SIZE;
+        acv_square_sum = 0.0;
+        aci_square_sum = 0.0;
+        acp_sum = 0.0;
+        for (idx = 0; idx < MEASURE_PERIOD_BUFFER_SIZE; idx++) {
+            acv_square_sum += ((acv[idx] - acv_mean) * (acv[idx] - acv_mean));
+            aci_square_sum += ((aci[idx] - aci_mean) * (aci[idx] - aci_mean));
+            acp_sum += ((acv[idx] - acv_mean) * (aci[idx] - aci_mean));
+        }
+        // Compare kernel output.
+        MEASURE_get_channel_run_data(chx_idx, &run_data);
+        snprintf(check_name, sizeof(check_name), "kernel CH%u RMS voltage", (chx_idx + 1));
+        TEST_check_relative(run_data.rms_voltage_mv.value, (sqrt(acv_square_sum / MEASURE_PERIOD_BUFFER_SIZE) * _TEST_MEASURE_get_acv_factor()), TEST_MEASURE_KERNEL_TOLERANCE_PERCENT, check_name);
+        snprintf(check_name, sizeof(check_name), "kernel CH%u RMS current", (chx_idx + 1));
+        TEST_check_relative(run_data.rms_current_ma.value, (sqrt(aci_square_sum / MEASURE_PERIOD_BUFFER_SIZE) * _TEST_MEASURE_get_aci_factor(chx_idx)), TEST_MEASURE_KERNEL_TOLERANCE_PERCENT, check_name);
+        snprintf(check_name, sizeof(check_name), "kernel CH%u active power", (chx_idx + 1));
+        TEST_check_relative(run_data.active_power_mw.value, (((acp_sum / MEASURE_PERIOD_BUFFER_SIZE) * _TEST_MEASURE_get_acv_factor() * _TEST_MEASURE_get_aci_factor(chx_idx)) / 1000.0), TEST_MEASURE_KERNEL_TOLERANCE_PERCENT, check_name);
+    }
+}
+#endif
+
+#ifndef MPMCM_ANALOG_SIMULATION
+/*******************************************************************/
+static void _TEST_MEASURE_mains_loss(const TEST_MEASURE_waveform_t* waveform) {
+    // Local variables.
+    TEST_MEASURE_waveform_t no_mains;
+    uint8_t mains_detected = 0;
+    uint8_t chx_idx = 0;
+    // Start measure.
+    _TEST_MEASURE_init();
+    _TEST_MEASURE_run(waveform, TEST_MEASURE_STARTUP_DURATION_SECONDS);
+    // Remove mains.
+    no_mains = (*waveform);
+    no_mains.acv_amplitude_lsb = 0.0;
+    for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+        no_mains.aci_amplitude_lsb[chx_idx] = 0.0;
+    }
+    _TEST_MEASURE_run(&no_mains, 1);
+    MEASURE_get_mains_detect_flag(&mains_detected);
+    TEST_check((mains_detected == 0), "mains loss detected");
+    TEST_check((POWER_get_state(POWER_DOMAIN_ANALOG) == 0), "mains loss analog front-end off");
+    TEST_check((DMA_MOCK_is_running(DMA_INSTANCE_ACV_SAMPLING, DMA_CHANNEL_ACV_SAMPLING) == 0), "mains loss DMA stopped");
+    // Restore mains.
+    _TEST_MEASURE_run(waveform, 35);
+    MEASURE_get_mains_detect_flag(&mains_detected);
+    TEST_check((mains_detected != 0), "mains recovery detected");
+    TEST_check((ERROR_stack_is_empty() != 0), "mains loss error stack empty");
+}
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+static void _TEST_MEASURE_harmonics(const TEST_MEASURE_waveform_t* waveform) {
+    // Local variables.
+    DATA_run_harmonics_t harmonics_run_data;
+    // Start measure and run.
+    _TEST_MEASURE_init();
+    _TEST_MEASURE_run(waveform, (TEST_MEASURE_STARTUP_DURATION_SECONDS + TEST_MEASURE_RUN_DURATION_SECONDS));
+    // Check voltage harmonics.
+    MEASURE_get_harmonics_run_data(MEASURE_HARMONICS_SIGNAL_ACV, &harmonics_run_data);
+    TEST_check((harmonics_run_data.thd_percent.number_of_samples > 0), "ACV harmonics computed");
+    TEST_check_value(harmonics_run_data.thd_percent.value, (100.0 * waveform->acv_harmonic_3_ratio), TEST_MEASURE_HARMONICS_TOLERANCE_PERCENT, "ACV THD");
+    TEST_check_value(harmonics_run_data.odd_harmonic_percent[0].value, (100.0 * waveform->acv_harmonic_3_ratio), TEST_MEASURE_HARMONICS_TOLERANCE_PERCENT, "ACV harmonic 3");
+    TEST_check_value(harmonics_run_data.odd_harmonic_percent[1].value, 0.0, TEST_MEASURE_HARMONICS_TOLERANCE_PERCENT, "ACV harmonic 5");
+    // Check current harmonics (pure sine wave).
+    MEASURE_get_harmonics_run_data(MEASURE_HARMONICS_SIGNAL_ACI1, &harmonics_run_data);
+    TEST_check_value(harmonics_run_data.thd_percent.value, 0.0, TEST_MEASURE_HARMONICS_TOLERANCE_PERCENT, "ACI1 THD");
+}
+#endif
+
+#ifdef MPMCM_ANALOG_SIMULATION
+/*******************************************************************/
+static void _TEST_MEASURE_compute_simulation_expected(uint8_t chx_idx, uint8_t divider, TEST_MEASURE_expected_t* expected) {
+    // Local variables.
+    uint32_t number_of_samples = (SIMULATION_BUFFER_SIZE / MEASURE_NUMBER_OF_ACI_CHANNELS);
+    float64_t acv_mean = 0.0;
+    float64_t aci_mean = 0.0;
+    float64_t acv_square_sum = 0.0;
+    float64_t aci_square_sum = 0.0;
+    float64_t acp_sum = 0.0;
+    float64_t acv = 0.0;
+    float64_t aci = 0.0;
+    uint32_t idx = 0;
+    // Means.
+    for (idx = 0; idx < number_of_samples; idx++) {
+        acv_mean += (float64_t) SIMULATION_ACV_BUFFER[(MEASURE_NUMBER_OF_ACI_CHANNELS * idx) + chx_idx];
+        aci_mean += (float64_t) ((int16_t) (SIMULATION_ACI_BUFFER[(MEASURE_NUMBER_OF_ACI_CHANNELS * idx) + chx_idx] / divider));
+    }
+    acv_mean /= (float64_t) number_of_samples;
+    aci_mean /= (float64_t) number_of_samples;
+    // Sums.
+    for (idx = 0; idx < number_of_samples; idx++) {
+        acv = ((float64_t) SIMULATION_ACV_BUFFER[(MEASURE_NUMBER_OF_ACI_CHANNELS * idx) + chx_idx]) - acv_mean;
+        aci = ((float64_t) ((int16_t) (SIMULATION_ACI_BUFFER[(MEASURE_NUMBER_OF_ACI_CHANNELS * idx) + chx_idx] / divider))) - aci_mean;
+        acv_square_sum += (acv * acv);
+        aci_square_sum += (aci * aci);
+        acp_sum += (acv * aci);
+    }
+    // Physical values.
+    expected->rms_voltage_mv = sqrt(acv_square_sum / ((float64_t) number_of_samples)) * _TEST_MEASURE_get_acv_factor();
+    expected->rms_current_ma = sqrt(aci_square_sum / ((float64_t) number_of_samples)) * _TEST_MEASURE_get_aci_factor(chx_idx);
+    expected->active_power_mw = ((acp_sum / ((float64_t) number_of_samples)) * _TEST_MEASURE_get_acv_factor() * _TEST_MEASURE_get_aci_factor(chx_idx)) / 1000.0;
+    expected->apparent_power_mva = (expected->rms_voltage_mv * expected->rms_current_ma) / 1000.0;
+    if (expected->active_power_mw < 0.0) {
+        expected->apparent_power_mva *= (-1.0);
+    }
+    expected->power_factor = (expected->apparent_power_mva != 0.0) ? ((100.0 * expected->active_power_mw) / expected->apparent_power_mva) : 0.0;
+    expected->phase_angle_degrees = (atan2(0.0, 1.0) * 180.0) / TEST_MEASURE_PI;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_SIMULATION
+/*******************************************************************/
+static void _TEST_MEASURE_simulation(void) {
+    // Local variables.
+    TEST_MEASURE_waveform_t waveform;
+    DATA_run_channel_t run_data;
+    TEST_MEASURE_expected_t expected;
+    uint8_t divider = 0;
+    uint8_t chx_idx = 0;
+    // Note: simulation tables replace ADC samples, the synthetic waveform only drives zero cross and frequency capture.
+    waveform.frequency_hz = 50.0;
+    waveform.acv_amplitude_lsb = 1000.0;
+    waveform.acv_harmonic_3_ratio = 0.0;
+    for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+        waveform.aci_amplitude_lsb[chx_idx] = 0.0;
+        waveform.aci_phase_degrees[chx_idx] = 0.0;
+        waveform.aci_probe_connected[chx_idx] = 0;
+    }
+    _TEST_MEASURE_init();
+    _TEST_MEASURE_run(&waveform, TEST_MEASURE_STARTUP_DURATION_SECONDS);
+    _TEST_MEASURE_reset_timing();
+    _TEST_MEASURE_run(&waveform, 1);
+    _TEST_MEASURE_bench("simulation tables");
+    // Run data of the last second was computed with the previous divider.
+    divider = (uint8_t) (((test_measure_ctx.random_divider + 97) % 100) + 1);
+    for (chx_idx = 0; chx_idx < MEASURE_NUMBER_OF_ACI_CHANNELS; chx_idx++) {
+        MEASURE_get_channel_run_data(chx_idx, &run_data);
+        _TEST_MEASURE_compute_simulation_expected(chx_idx, divider, &expected);
+        // Note: tables are sampled on one period, reactive power can not be compared to an analytic value.
+        _TEST_MEASURE_check_channel("simulation", chx_idx, &run_data, &expected);
+    }
+    TEST_check((ERROR_stack_is_empty() != 0), "simulation error stack empty");
+}
+#endif
+
+/*** TEST MEASURE main function ***/
+
+/*******************************************************************/
+int main(void) {
+#ifndef MPMCM_ANALOG_SIMULATION
+    // Local variables.
+    TEST_MEASURE_waveform_t waveform = {
+        .frequency_hz = 50.0,
+        .acv_amplitude_lsb = 1500.0,
+        .acv_harmonic_3_ratio = 0.0,
+        .aci_amplitude_lsb = { 1000.0, 800.0, 500.0, 1000.0 },
+        .aci_phase_degrees = { 0.0, 60.0, -30.0, 0.0 },
+        .aci_probe_connected = { 1, 1, 1, 0 }
+    };
+#endif
+    TEST_start("measure_" TEST_MEASURE_VARIANT);
+#ifdef MPMCM_ANALOG_SIMULATION
+    _TEST_MEASURE_simulation();
+#else
+    // Nominal mains.
+    _TEST_MEASURE_synthetic("50Hz", &waveform);
+    _TEST_MEASURE_kernel(&waveform);
+    // Off-nominal frequency (period size is not a multiple of the quarter period).
+    waveform.frequency_hz = 49.5;
+    _TEST_MEASURE_synthetic("49.5Hz", &waveform);
+    // Distorted voltage.
+    waveform.frequency_hz = 50.0;
+    waveform.acv_harmonic_3_ratio = 0.1;
+    _TEST_MEASURE_synthetic("50Hz distorted", &waveform);
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    _TEST_MEASURE_harmonics(&waveform);
+#endif
+    // Mains loss and recovery.
+    waveform.acv_harmonic_3_ratio = 0.0;
+    _TEST_MEASURE_mains_loss(&waveform);
+#endif
+    return TEST_end();
+}
@@ -0,0 +1,517 @@
+/*
+ * test_mpmcm.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "common_registers.h"
+#include "data.h"
+#include "dsm_flags.h"
+#include "error.h"
+#include "measure.h"
+#include "mpmcm.h"
+#include "mpmcm_registers.h"
+#include "node.h"
+#include "swreg.h"
+#include "test.h"
+#include "tic.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST MPMCM local macros ***/
+
+#ifndef TEST_MPMCM_VARIANT
+#define TEST_MPMCM_VARIANT                      "default"
+#endif
+
+#define TEST_MPMCM_BENCH_NUMBER_OF_ITERATIONS   100000
+
+#define TEST_MPMCM_TIC_CHANNEL_INDEX            MEASURE_NUMBER_OF_ACI_CHANNELS
+#define TEST_MPMCM_DATA_ERROR_VALUE             0xFFFF
+
+#define TEST_MPMCM_MAINS_FREQUENCY_MHZ          50020.0
+#define TEST_MPMCM_ACTIVE_POWER_MW              1000.0
+#define TEST_MPMCM_RMS_VOLTAGE_MV               23000.0
+#define TEST_MPMCM_ACTIVE_ENERGY_MWH            300.0
+#define TEST_MPMCM_APPARENT_ENERGY_MVAH         400.0
+
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+#define TEST_MPMCM_REACTIVE_POWER_MVAR          500.0
+#define TEST_MPMCM_REACTIVE_ENERGY_MVARH        200.0
+#define TEST_MPMCM_PHASE_ANGLE_DEGREES          (-30.5)
+// Phase angle of -30.5 degrees in 0.1 degree unit and 16-bits two's complement.
+#define TEST_MPMCM_PHASE_ANGLE_FIELD            0xFECF
+#define TEST_MPMCM_PHASE_ANGLE_ERROR_VALUE      0x8000
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+#define TEST_MPMCM_NUMBER_OF_REGISTERS_PER_HARMONIC 2
+#define TEST_MPMCM_THD_PERCENT                  4.56
+#define TEST_MPMCM_HARMONIC_PERCENT             1.2
+// Harmonics ratio above the 16-bits field range.
+#define TEST_MPMCM_HARMONIC_PERCENT_OVERFLOW    10000.0
+#define TEST_MPMCM_HARMONIC_VALUE_MAX           0xFFFE
+#endif
+
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+#define TEST_MPMCM_CAPTURE_CHANNEL              2
+#define TEST_MPMCM_CAPTURE_NUMBER_OF_PERIODS    3
+#define TEST_MPMCM_CAPTURE_NUMBER_OF_SAMPLES    20
+#define TEST_MPMCM_CAPTURE_CHUNK_INDEX          2
+#endif
+
+/*** TEST MPMCM local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t registers[MPMCM_REGISTER_ADDRESS_LAST];
+    uint32_t nvm[MPMCM_REGISTER_ADDRESS_LAST];
+    uint16_t transformer_gain;
+    uint16_t current_sensors_gain[MEASURE_NUMBER_OF_ACI_CHANNELS];
+    uint32_t tic_sampling_period_seconds;
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    uint8_t harmonics_overflow_flag;
+#endif
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+    uint32_t capture_start_count;
+    uint8_t capture_channel;
+    uint8_t capture_number_of_periods;
+#endif
+} TEST_MPMCM_context_t;
+
+/*** TEST MPMCM global variables ***/
+
+const uint8_t MEASURE_SCT013_ATTEN[MEASURE_NUMBER_OF_ACI_CHANNELS] = MPMCM_SCT013_ATTEN;
+
+/*** TEST MPMCM local global variables ***/
+
+static TEST_MPMCM_context_t test_mpmcm_ctx;
+
+/*** TEST MPMCM node registers ***/
+
+/*******************************************************************/
+NODE_status_t NODE_write_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+    // Check address.
+    if (reg_addr >= MPMCM_REGISTER_ADDRESS_LAST) return NODE_ERROR_REGISTER_ADDRESS;
+    SWREG_modify_register(&(test_mpmcm_ctx.registers[reg_addr]), reg_value, reg_mask);
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t NODE_read_register(NODE_request_source_t request_source, uint8_t reg_addr, uint32_t* reg_value) {
+    // Check address.
+    if (reg_addr >= MPMCM_REGISTER_ADDRESS_LAST) return NODE_ERROR_REGISTER_ADDRESS;
+    (*reg_value) = test_mpmcm_ctx.registers[reg_addr];
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t NODE_write_nvm(uint8_t reg_addr, uint32_t reg_value) {
+    // Check address.
+    if (reg_addr >= MPMCM_REGISTER_ADDRESS_LAST) return NODE_ERROR_REGISTER_ADDRESS;
+    test_mpmcm_ctx.nvm[reg_addr] = reg_value;
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t NODE_read_nvm(uint8_t reg_addr, uint32_t* reg_value) {
+    // Check address.
+    if (reg_addr >= MPMCM_REGISTER_ADDRESS_LAST) return NODE_ERROR_REGISTER_ADDRESS;
+    (*reg_value) = test_mpmcm_ctx.nvm[reg_addr];
+    return NODE_SUCCESS;
+}
+
+/*** TEST MPMCM measure ***/
+
+/*******************************************************************/
+static void _TEST_MPMCM_fill_run(DATA_run_t* run_data, float64_t value, uint32_t number_of_samples) {
+    run_data->value = value;
+    run_data->number_of_samples = number_of_samples;
+}
+
+/*******************************************************************/
+static void _TEST_MPMCM_fill_accumulated(DATA_accumulated_t* accumulated_data, float64_t mean, uint32_t number_of_samples) {
+    // Note: min and max are set 10% around the mean value.
+    accumulated_data->mean = mean;
+    accumulated_data->min = (mean * 0.9);
+    accumulated_data->max = (mean * 1.1);
+    accumulated_data->sum = (mean * ((float64_t) number_of_samples));
+    accumulated_data->number_of_samples = number_of_samples;
+}
+
+/*******************************************************************/
+MEASURE_status_t MEASURE_set_gains(uint16_t transformer_gain, uint16_t current_sensors_gain[MEASURE_NUMBER_OF_ACI_CHANNELS]) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Store gains.
+    test_mpmcm_ctx.transformer_gain = transformer_gain;
+    for (idx = 0; idx < MEASURE_NUMBER_OF_ACI_CHANNELS; idx++) {
+        test_mpmcm_ctx.current_sensors_gain[idx] = current_sensors_gain[idx];
+    }
+    return MEASURE_SUCCESS;
+}
+
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_probe_detect_flag(uint8_t channel_index, uint8_t* current_probe_connected) {
+    // Probes are connected on even channels.
+    (*current_probe_connected) = ((channel_index % 2) == 0) ? 1 : 0;
+    return MEASURE_SUCCESS;
+}
+
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_mains_detect_flag(uint8_t* mains_voltage_detected) {
+    (*mains_voltage_detected) = 1;
+    return MEASURE_SUCCESS;
+}
+
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_run_data(MEASURE_data_index_t data_index, DATA_run_t* run_data) {
+    _TEST_MPMCM_fill_run(run_data, TEST_MPMCM_MAINS_FREQUENCY_MHZ, 1);
+    return MEASURE_SUCCESS;
+}
+
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_accumulated_data(MEASURE_data_index_t data_index, DATA_accumulated_t* accumulated_data) {
+    _TEST_MPMCM_fill_accumulated(accumulated_data, TEST_MPMCM_MAINS_FREQUENCY_MHZ, 10);
+    return MEASURE_SUCCESS;
+}
+
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_channel_run_data(uint8_t channel, DATA_run_channel_t* channel_run_data) {
+    // Local variables.
+    float64_t channel_offset = (float64_t) channel;
+    // Fill all quantities.
+    _TEST_MPMCM_fill_run(&(channel_run_data->active_power_mw), (TEST_MPMCM_ACTIVE_POWER_MW + channel_offset), 1);
+    _TEST_MPMCM_fill_run(&(channel_run_data->rms_voltage_mv), TEST_MPMCM_RMS_VOLTAGE_MV, 1);
+    _TEST_MPMCM_fill_run(&(channel_run_data->rms_current_ma), 0.0, 0);
+    _TEST_MPMCM_fill_run(&(channel_run_data->apparent_power_mva), 0.0, 0);
+    _TEST_MPMCM_fill_run(&(channel_run_data->power_factor), 0.0, 0);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    _TEST_MPMCM_fill_run(&(channel_run_data->reactive_power_mvar), (TEST_MPMCM_REACTIVE_POWER_MVAR + channel_offset), 1);
+    _TEST_MPMCM_fill_run(&(channel_run_data->phase_angle_degrees), TEST_MPMCM_PHASE_ANGLE_DEGREES, 1);
+#endif
+    return MEASURE_SUCCESS;
+}
+
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_channel_accumulated_data(uint8_t channel, DATA_accumulated_channel_t* channel_accumulated_data) {
+    // Local variables.
+    float64_t channel_offset = (float64_t) channel;
+    // Fill all quantities.
+    _TEST_MPMCM_fill_accumulated(&(channel_accumulated_data->active_power_mw), (TEST_MPMCM_ACTIVE_POWER_MW + channel_offset), 10);
+    _TEST_MPMCM_fill_accumulated(&(channel_accumulated_data->rms_voltage_mv), TEST_MPMCM_RMS_VOLTAGE_MV, 10);
+    _TEST_MPMCM_fill_accumulated(&(channel_accumulated_data->rms_current_ma), 0.0, 0);
+    _TEST_MPMCM_fill_accumulated(&(channel_accumulated_data->apparent_power_mva), 0.0, 0);
+    _TEST_MPMCM_fill_accumulated(&(channel_accumulated_data->power_factor), 0.0, 0);
+    _TEST_MPMCM_fill_run(&(channel_accumulated_data->active_energy_mwh), TEST_MPMCM_ACTIVE_ENERGY_MWH, 10);
+    _TEST_MPMCM_fill_run(&(channel_accumulated_data->apparent_energy_mvah), TEST_MPMCM_APPARENT_ENERGY_MVAH, 10);
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    _TEST_MPMCM_fill_accumulated(&(channel_accumulated_data->reactive_power_mvar), (TEST_MPMCM_REACTIVE_POWER_MVAR + channel_offset), 10);
+    _TEST_MPMCM_fill_accumulated(&(channel_accumulated_data->phase_angle_degrees), TEST_MPMCM_PHASE_ANGLE_DEGREES, 10);
+    _TEST_MPMCM_fill_run(&(channel_accumulated_data->reactive_energy_mvarh), TEST_MPMCM_REACTIVE_ENERGY_MVARH, 10);
+#endif
+    return MEASURE_SUCCESS;
+}
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_harmonics_run_data(MEASURE_harmonics_signal_t signal, DATA_run_harmonics_t* harmonics_run_data) {
+    // Local variables.
+    uint8_t harmonic_idx = 0;
+    // Note: the last current channel has no probe connected.
+    uint32_t number_of_samples = (signal == MEASURE_HARMONICS_SIGNAL_ACI4) ? 0 : 1;
+    float64_t thd_percent = (test_mpmcm_ctx.harmonics_overflow_flag != 0) ? TEST_MPMCM_HARMONIC_PERCENT_OVERFLOW : TEST_MPMCM_THD_PERCENT;
+    // Fill ratios.
+    _TEST_MPMCM_fill_run(&(harmonics_run_data->thd_percent), thd_percent, number_of_samples);
+    for (harmonic_idx = 0; harmonic_idx < DATA_NUMBER_OF_HARMONICS; harmonic_idx++) {
+        _TEST_MPMCM_fill_run(&(harmonics_run_data->odd_harmonic_percent[harmonic_idx]), (TEST_MPMCM_HARMONIC_PERCENT * (harmonic_idx + 1)), number_of_samples);
+    }
+    return MEASURE_SUCCESS;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_harmonics_accumulated_data(MEASURE_harmonics_signal_t signal, DATA_accumulated_harmonics_t* harmonics_accumulated_data) {
+    // Local variables.
+    uint8_t harmonic_idx = 0;
+    uint32_t number_of_samples = (signal == MEASURE_HARMONICS_SIGNAL_ACI4) ? 0 : 10;
+    // Fill ratios.
+    _TEST_MPMCM_fill_accumulated(&(harmonics_accumulated_data->thd_percent), TEST_MPMCM_THD_PERCENT, number_of_samples);
+    for (harmonic_idx = 0; harmonic_idx < DATA_NUMBER_OF_HARMONICS; harmonic_idx++) {
+        _TEST_MPMCM_fill_accumulated(&(harmonics_accumulated_data->odd_harmonic_percent[harmonic_idx]), (TEST_MPMCM_HARMONIC_PERCENT * (harmonic_idx + 1)), number_of_samples);
+    }
+    return MEASURE_SUCCESS;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_start_capture(uint8_t channel, uint8_t number_of_periods) {
+    // Store request.
+    test_mpmcm_ctx.capture_start_count++;
+    test_mpmcm_ctx.capture_channel = channel;
+    test_mpmcm_ctx.capture_number_of_periods = number_of_periods;
+    return MEASURE_SUCCESS;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_get_capture_state(MEASURE_capture_state_t* capture_state, uint16_t* number_of_samples) {
+    // Capture is completed once started.
+    (*capture_state) = (test_mpmcm_ctx.capture_start_count != 0) ? MEASURE_CAPTURE_STATE_DONE : MEASURE_CAPTURE_STATE_IDLE;
+    (*number_of_samples) = (test_mpmcm_ctx.capture_start_count != 0) ? TEST_MPMCM_CAPTURE_NUMBER_OF_SAMPLES : 0;
+    return MEASURE_SUCCESS;
+}
+#endif
+
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+/*******************************************************************/
+MEASURE_status_t MEASURE_read_capture(uint16_t sample_index, int16_t* acv_sample, int16_t* aci_sample) {
+    // Check index.
+    if (sample_index >= TEST_MPMCM_CAPTURE_NUMBER_OF_SAMPLES) return MEASURE_ERROR_CAPTURE_SAMPLE_INDEX;
+    // Negative voltage and positive current samples.
+    (*acv_sample) = (int16_t) (-100 * (sample_index + 1));
+    (*aci_sample) = (int16_t) (10 * sample_index);
+    return MEASURE_SUCCESS;
+}
+#endif
+
+/*** TEST MPMCM Linky TIC ***/
+
+/*******************************************************************/
+TIC_status_t TIC_set_sampling_period(uint32_t period_seconds) {
+    test_mpmcm_ctx.tic_sampling_period_seconds = period_seconds;
+    return TIC_SUCCESS;
+}
+
+/*******************************************************************/
+TIC_status_t TIC_get_detect_flag(uint8_t* linky_tic_connected) {
+    (*linky_tic_connected) = 0;
+    return TIC_SUCCESS;
+}
+
+/*******************************************************************/
+TIC_status_t TIC_get_channel_run_data(DATA_run_channel_t* channel_run_data) {
+    // Note: Linky TIC is not connected.
+    DATA_reset_run_channel((*channel_run_data));
+    return TIC_SUCCESS;
+}
+
+/*******************************************************************/
+TIC_status_t TIC_get_channel_accumulated_data(DATA_accumulated_channel_t* channel_accumulated_data) {
+    // Note: Linky TIC is not connected.
+    DATA_reset_accumulated_channel((*channel_accumulated_data));
+    return TIC_SUCCESS;
+}
+
+/*** TEST MPMCM local functions ***/
+
+/*******************************************************************/
+static uint32_t _TEST_MPMCM_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    return SWREG_read_field(test_mpmcm_ctx.registers[reg_addr], field_mask);
+}
+
+/*******************************************************************/
+static NODE_status_t _TEST_MPMCM_write_control(uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+    // Write register then check it as the node layer does.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, reg_value, reg_mask);
+    return MPMCM_check_register(reg_addr, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_MPMCM_init(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    // Configuration stored in NVM.
+    test_mpmcm_ctx.nvm[MPMCM_REGISTER_ADDRESS_CONFIGURATION_0] = 236;
+    test_mpmcm_ctx.nvm[MPMCM_REGISTER_ADDRESS_CONFIGURATION_1] = ((100 << 16) | 50);
+    test_mpmcm_ctx.nvm[MPMCM_REGISTER_ADDRESS_CONFIGURATION_2] = ((200 << 16) | 100);
+    test_mpmcm_ctx.nvm[MPMCM_REGISTER_ADDRESS_CONFIGURATION_3] = TIC_SAMPLING_PERIOD_DEFAULT_SECONDS;
+    node_status = MPMCM_init_registers();
+    TEST_check((node_status == NODE_SUCCESS), "init");
+    // Flags.
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_FLAGS_1, MPMCM_REGISTER_FLAGS_1_MASK_AME) == 1), "init analog measure flag");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_FLAGS_1, MPMCM_REGISTER_FLAGS_1_MASK_TRANSFORMER_ATTEN) == MPMCM_TRANSFORMER_ATTEN), "init transformer attenuation");
+    // Configuration.
+    TEST_check(((test_mpmcm_ctx.transformer_gain == 236) && (test_mpmcm_ctx.current_sensors_gain[1] == 100) && (test_mpmcm_ctx.current_sensors_gain[3] == 200)), "init gains");
+    TEST_check((test_mpmcm_ctx.tic_sampling_period_seconds == TIC_SAMPLING_PERIOD_DEFAULT_SECONDS), "init tic sampling period");
+    // Status.
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_STATUS_1, 0x0000000F) == 0b0101), "init probes detect flags");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_STATUS_1, MPMCM_REGISTER_STATUS_1_MASK_MVD) == 1), "init mains detect flag");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_STATUS_1, MPMCM_REGISTER_STATUS_1_MASK_TICD) == 0), "init tic detect flag");
+}
+
+/*******************************************************************/
+static void _TEST_MPMCM_run_registers(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    uint8_t tic_offset = (MPMCM_NUMBER_OF_REGISTERS_PER_DATA * TEST_MPMCM_TIC_CHANNEL_INDEX);
+    uint8_t ch2_offset = MPMCM_NUMBER_OF_REGISTERS_PER_DATA;
+    // Update run registers.
+    node_status = MPMCM_mtrg_callback();
+    TEST_check((node_status == NODE_SUCCESS), "mtrg");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_MAINS_FREQUENCY_0, MPMCM_REGISTER_MASK_RUN) == (uint32_t) (TEST_MPMCM_MAINS_FREQUENCY_MHZ / 10.0)), "run mains frequency");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0 + ch2_offset), MPMCM_REGISTER_MASK_RUN) == (uint32_t) (TEST_MPMCM_ACTIVE_POWER_MW + 1)), "run ch2 active power");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_RMS_VOLTAGE_0 + ch2_offset), MPMCM_REGISTER_MASK_RUN) == (uint32_t) TEST_MPMCM_RMS_VOLTAGE_MV), "run ch2 rms voltage");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_RMS_CURRENT_0 + ch2_offset), MPMCM_REGISTER_MASK_RUN) == UNA_CURRENT_ERROR_VALUE), "run ch2 rms current error value");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0 + tic_offset), MPMCM_REGISTER_MASK_RUN) == UNA_ELECTRICAL_POWER_ERROR_VALUE), "run tic active power error value");
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_0 + ch2_offset), MPMCM_REGISTER_MASK_RUN) == (uint32_t) (TEST_MPMCM_REACTIVE_POWER_MVAR + 1)), "run ch2 reactive power");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_0 + ch2_offset), MPMCM_REGISTER_MASK_RUN) == TEST_MPMCM_PHASE_ANGLE_FIELD), "run ch2 phase angle");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_0 + tic_offset), MPMCM_REGISTER_MASK_RUN) == UNA_ELECTRICAL_POWER_ERROR_VALUE), "run tic reactive power error value");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_0 + tic_offset), MPMCM_REGISTER_MASK_RUN) == TEST_MPMCM_PHASE_ANGLE_ERROR_VALUE), "run tic phase angle error value");
+    // Reactive registers must not overlap the next channel block.
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0 + ch2_offset + MPMCM_NUMBER_OF_REGISTERS_PER_DATA), MPMCM_REGISTER_MASK_RUN) == (uint32_t) (TEST_MPMCM_ACTIVE_POWER_MW + 2)), "run ch3 active power");
+#endif
+}
+
+/*******************************************************************/
+static void _TEST_MPMCM_accumulated_registers(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    uint8_t ch3_offset = (MPMCM_NUMBER_OF_REGISTERS_PER_DATA * 2);
+    // Channel 3 request.
+    node_status = _TEST_MPMCM_write_control(MPMCM_REGISTER_ADDRESS_CONTROL_1, 0b0100, 0b0100);
+    TEST_check((node_status == NODE_SUCCESS), "ch3 request");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_CONTROL_1, 0b0100) == 0), "ch3 request cleared");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0 + ch3_offset), MPMCM_REGISTER_MASK_MEAN) == (uint32_t) (TEST_MPMCM_ACTIVE_POWER_MW + 2)), "ch3 active power mean");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_0 + ch3_offset), MPMCM_REGISTER_MASK_RUN) == (uint32_t) (TEST_MPMCM_ACTIVE_POWER_MW + 2)), "ch3 active power run kept");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_1 + ch3_offset), MPMCM_REGISTER_MASK_MIN) == (uint32_t) ((TEST_MPMCM_ACTIVE_POWER_MW + 2) * 0.9)), "ch3 active power min");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ACTIVE_POWER_1 + ch3_offset), MPMCM_REGISTER_MASK_MAX) == (uint32_t) ((TEST_MPMCM_ACTIVE_POWER_MW + 2) * 1.1)), "ch3 active power max");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ENERGY + ch3_offset), MPMCM_REGISTER_MASK_ACTIVE_ENERGY) == (uint32_t) TEST_MPMCM_ACTIVE_ENERGY_MWH), "ch3 active energy");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ENERGY + ch3_offset), MPMCM_REGISTER_MASK_APPARENT_ENERGY) == (uint32_t) TEST_MPMCM_APPARENT_ENERGY_MVAH), "ch3 apparent energy");
+#ifdef MPMCM_ANALOG_REACTIVE_POWER_ENABLE
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_0 + ch3_offset), MPMCM_REGISTER_MASK_MEAN) == (uint32_t) (TEST_MPMCM_REACTIVE_POWER_MVAR + 2)), "ch3 reactive power mean");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_POWER_1 + ch3_offset), MPMCM_REGISTER_MASK_MAX) == (uint32_t) ((TEST_MPMCM_REACTIVE_POWER_MVAR + 2) * 1.1)), "ch3 reactive power max");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_PHASE_ANGLE_0 + ch3_offset), MPMCM_REGISTER_MASK_MEAN) == TEST_MPMCM_PHASE_ANGLE_FIELD), "ch3 phase angle mean");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_REACTIVE_ENERGY + ch3_offset), MPMCM_REGISTER_MASK_REACTIVE_ENERGY) == (uint32_t) TEST_MPMCM_REACTIVE_ENERGY_MVARH), "ch3 reactive energy");
+#endif
+    // Linky TIC request.
+    node_status = _TEST_MPMCM_write_control(MPMCM_REGISTER_ADDRESS_CONTROL_1, 0b10000, 0b10000);
+    TEST_check((node_status == NODE_SUCCESS), "tic request");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_CH1_ENERGY + (MPMCM_NUMBER_OF_REGISTERS_PER_DATA * TEST_MPMCM_TIC_CHANNEL_INDEX)), MPMCM_REGISTER_MASK_ACTIVE_ENERGY) == UNA_ELECTRICAL_ENERGY_ERROR_VALUE), "tic active energy error value");
+    // Mains frequency request.
+    node_status = _TEST_MPMCM_write_control(MPMCM_REGISTER_ADDRESS_CONTROL_1, MPMCM_REGISTER_CONTROL_1_MASK_FRQS, MPMCM_REGISTER_CONTROL_1_MASK_FRQS);
+    TEST_check((node_status == NODE_SUCCESS), "frequency request");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_CONTROL_1, MPMCM_REGISTER_CONTROL_1_MASK_FRQS) == 0), "frequency request cleared");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_MAINS_FREQUENCY_0, MPMCM_REGISTER_MASK_MEAN) == (uint32_t) (TEST_MPMCM_MAINS_FREQUENCY_MHZ / 10.0)), "mains frequency mean");
+}
+
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+/*******************************************************************/
+static void _TEST_MPMCM_harmonics_registers(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    uint8_t aci2_offset = (MPMCM_NUMBER_OF_REGISTERS_PER_HARMONICS_DATA * MEASURE_HARMONICS_SIGNAL_ACI2);
+    uint8_t aci4_offset = (MPMCM_NUMBER_OF_REGISTERS_PER_HARMONICS_DATA * MEASURE_HARMONICS_SIGNAL_ACI4);
+    uint8_t h7_offset = (TEST_MPMCM_NUMBER_OF_REGISTERS_PER_HARMONIC * (DATA_NUMBER_OF_HARMONICS - 1));
+    // Run registers.
+    node_status = MPMCM_mtrg_callback();
+    TEST_check((node_status == NODE_SUCCESS), "harmonics mtrg");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_ACV_THD_0, MPMCM_REGISTER_MASK_RUN) == 45), "acv thd run");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_ACV_H3_0 + aci2_offset), MPMCM_REGISTER_MASK_RUN) == 12), "aci2 h3 run");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_ACV_H3_0 + aci2_offset + h7_offset), MPMCM_REGISTER_MASK_RUN) == 36), "aci2 h7 run");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_ACV_THD_0 + aci4_offset), MPMCM_REGISTER_MASK_RUN) == TEST_MPMCM_DATA_ERROR_VALUE), "aci4 thd run error value");
+    // Last harmonic register must not overlap the capture block.
+    TEST_check(((MPMCM_REGISTER_ADDRESS_ACV_H3_0 + aci4_offset + h7_offset + 1) < MPMCM_REGISTER_ADDRESS_CAPTURE_DATA_0), "harmonics registers range");
+    // Ratio clamped to the field range.
+    test_mpmcm_ctx.harmonics_overflow_flag = 1;
+    MPMCM_mtrg_callback();
+    test_mpmcm_ctx.harmonics_overflow_flag = 0;
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_ACV_THD_0, MPMCM_REGISTER_MASK_RUN) == TEST_MPMCM_HARMONIC_VALUE_MAX), "thd run clamped");
+    // Accumulated registers.
+    node_status = _TEST_MPMCM_write_control(MPMCM_REGISTER_ADDRESS_CONTROL_1, MPMCM_REGISTER_CONTROL_1_MASK_HRMS, MPMCM_REGISTER_CONTROL_1_MASK_HRMS);
+    TEST_check((node_status == NODE_SUCCESS), "harmonics request");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_CONTROL_1, MPMCM_REGISTER_CONTROL_1_MASK_HRMS) == 0), "harmonics request cleared");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_ACV_THD_0, MPMCM_REGISTER_MASK_MEAN) == 45), "acv thd mean");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_ACV_THD_1, MPMCM_REGISTER_MASK_MIN) == 41), "acv thd min");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_ACV_THD_1, MPMCM_REGISTER_MASK_MAX) == 50), "acv thd max");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_ACV_H3_0 + aci2_offset + h7_offset), MPMCM_REGISTER_MASK_MEAN) == 36), "aci2 h7 mean");
+    TEST_check((_TEST_MPMCM_read_field((MPMCM_REGISTER_ADDRESS_ACV_H3_0 + aci4_offset + h7_offset + 1), MPMCM_REGISTER_MASK_MAX) == TEST_MPMCM_DATA_ERROR_VALUE), "aci4 h7 max error value");
+}
+#endif
+
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+/*******************************************************************/
+static void _TEST_MPMCM_capture_registers(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t sample_index = 0;
+    uint8_t idx = 0;
+    uint8_t window_flag = 1;
+    // Idle status.
+    node_status = MPMCM_update_register(MPMCM_REGISTER_ADDRESS_CAPTURE_STATUS);
+    TEST_check(((node_status == NODE_SUCCESS) && (_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_CAPTURE_STATUS, MPMCM_REGISTER_CAPTURE_STATUS_MASK_CAPR) == 0)), "capture status idle");
+    // Start request.
+    SWREG_write_field(&reg_value, &reg_mask, 0b1, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CAPS);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_MPMCM_CAPTURE_CHANNEL, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CHANNEL);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_MPMCM_CAPTURE_NUMBER_OF_PERIODS, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_NUMBER_OF_PERIODS);
+    node_status = _TEST_MPMCM_write_control(MPMCM_REGISTER_ADDRESS_CAPTURE_CONTROL, reg_value, reg_mask);
+    TEST_check((node_status == NODE_SUCCESS), "capture request");
+    TEST_check(((test_mpmcm_ctx.capture_start_count == 1) && (test_mpmcm_ctx.capture_channel == TEST_MPMCM_CAPTURE_CHANNEL) && (test_mpmcm_ctx.capture_number_of_periods == TEST_MPMCM_CAPTURE_NUMBER_OF_PERIODS)), "capture started");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_CAPTURE_CONTROL, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CAPS) == 0), "capture request cleared");
+    // Done status.
+    node_status = MPMCM_update_register(MPMCM_REGISTER_ADDRESS_CAPTURE_STATUS);
+    TEST_check((node_status == NODE_SUCCESS), "capture status update");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_CAPTURE_STATUS, MPMCM_REGISTER_CAPTURE_STATUS_MASK_CAPR) == 1), "capture status ready");
+    TEST_check((_TEST_MPMCM_read_field(MPMCM_REGISTER_ADDRESS_CAPTURE_STATUS, MPMCM_REGISTER_CAPTURE_STATUS_MASK_NUMBER_OF_SAMPLES) == TEST_MPMCM_CAPTURE_NUMBER_OF_SAMPLES), "capture status number of samples");
+    // Last window is partially filled.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, TEST_MPMCM_CAPTURE_CHUNK_INDEX, MPMCM_REGISTER_CAPTURE_CONTROL_MASK_CHUNK_INDEX);
+    node_status = _TEST_MPMCM_write_control(MPMCM_REGISTER_ADDRESS_CAPTURE_CONTROL, reg_value, reg_mask);
+    TEST_check(((node_status == NODE_SUCCESS) && (test_mpmcm_ctx.capture_start_count == 1)), "capture chunk request");
+    for (idx = 0; idx < MPMCM_NUMBER_OF_CAPTURE_DATA_REGISTERS; idx++) {
+        sample_index = ((TEST_MPMCM_CAPTURE_CHUNK_INDEX * MPMCM_NUMBER_OF_CAPTURE_DATA_REGISTERS) + idx);
+        reg_value = test_mpmcm_ctx.registers[MPMCM_REGISTER_ADDRESS_CAPTURE_DATA_0 + idx];
+        if (sample_index < TEST_MPMCM_CAPTURE_NUMBER_OF_SAMPLES) {
+            if ((int16_t) SWREG_read_field(reg_value, MPMCM_REGISTER_CAPTURE_DATA_MASK_ACV) != (int16_t) (-100 * (sample_index + 1))) window_flag = 0;
+            if ((int16_t) SWREG_read_field(reg_value, MPMCM_REGISTER_CAPTURE_DATA_MASK_ACI) != (int16_t) (10 * sample_index)) window_flag = 0;
+        }
+        else {
+            if (reg_value != 0) window_flag = 0;
+        }
+    }
+    TEST_check((window_flag != 0), "capture window samples");
+}
+#endif
+
+/*******************************************************************/
+static void _TEST_MPMCM_bench(void) {
+    // Local variables.
+    uint64_t start_ns = 0;
+    uint64_t elapsed_ns = 0;
+    uint32_t idx = 0;
+    // Run registers update.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_MPMCM_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        MPMCM_mtrg_callback();
+    }
+    elapsed_ns = (TEST_get_time_ns() - start_ns);
+    TEST_bench("mtrg callback", "time=%.2fns", ((float64_t) elapsed_ns) / ((float64_t) TEST_MPMCM_BENCH_NUMBER_OF_ITERATIONS));
+}
+
+/*** TEST MPMCM main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("mpmcm_" TEST_MPMCM_VARIANT);
+    ERROR_stack_init();
+    _TEST_MPMCM_init();
+    _TEST_MPMCM_run_registers();
+    _TEST_MPMCM_accumulated_registers();
+#ifdef MPMCM_ANALOG_HARMONICS_ENABLE
+    _TEST_MPMCM_harmonics_registers();
+#endif
+#ifdef MPMCM_ANALOG_CAPTURE_ENABLE
+    _TEST_MPMCM_capture_registers();
+#endif
+    _TEST_MPMCM_bench();
+    TEST_check((ERROR_stack_is_empty() != 0), "error stack empty");
+    return TEST_end();
+}
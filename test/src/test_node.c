@@ -0,0 +1,452 @@
+/*
+ * test_node.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "common.h"
+#include "common_registers.h"
+#include "error.h"
+#include "node.h"
+#include "nvm.h"
+#include "nvm_address.h"
+#include "pwr.h"
+#include "sm.h"
+#include "sm_registers.h"
+#include "stdio.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST NODE local macros ***/
+
+#ifndef TEST_NODE_VARIANT
+#define TEST_NODE_VARIANT                       "default"
+#endif
+
+#define TEST_NODE_BENCH_NUMBER_OF_ITERATIONS    100000
+
+#define TEST_NODE_SELF_ADDRESS                  0x21
+
+#if ((defined DSM_NVM_JOURNAL) || (defined DSM_NVM_WORD_WRITE))
+#define TEST_NODE_NVM_WORD_OPERATIONS           1
+#else
+#define TEST_NODE_NVM_WORD_OPERATIONS           4
+#endif
+#define TEST_NODE_NVM_PROGRAMMING_TIME_US       3200
+// SysTick control register (mapped on the host by the NVM mock).
+#define TEST_NODE_CORE_SYST_CSR                 (*((volatile uint32_t*) 0xE000E010))
+#define TEST_NODE_CORE_SYST_CSR_OTHER_USER      0x00000005
+
+#ifdef DSM_NVM_JOURNAL
+// Note: all board registers are persisted to exceed the journal bank size.
+#define TEST_NODE_JOURNAL_NUMBER_OF_REGISTERS   (SM_REGISTER_ADDRESS_LAST - COMMON_REGISTER_ADDRESS_LAST)
+#define TEST_NODE_JOURNAL_NUMBER_OF_UPDATES     100
+#define TEST_NODE_JOURNAL_NUMBER_OF_STEPS       (TEST_NODE_JOURNAL_NUMBER_OF_REGISTERS + TEST_NODE_JOURNAL_NUMBER_OF_UPDATES)
+#endif
+
+/*** TEST NODE local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    TEST_NODE_HANDLER_NONE = 0,
+    TEST_NODE_HANDLER_COMMON,
+    TEST_NODE_HANDLER_BOARD,
+    TEST_NODE_HANDLER_LAST
+} TEST_NODE_handler_t;
+
+/*******************************************************************/
+typedef struct {
+    uint32_t update_count;
+    uint32_t check_count;
+    TEST_NODE_handler_t last_handler;
+    uint8_t last_reg_addr;
+    uint32_t last_reg_mask;
+} TEST_NODE_context_t;
+
+/*** TEST NODE global variables ***/
+
+// Note: dinfox-registers tables of the reduced host register map.
+const UNA_register_access_t SM_REGISTER_ACCESS[SM_REGISTER_ADDRESS_LAST] = {
+    [0 ... (COMMON_REGISTER_ADDRESS_CONTROL_0 - 1)] = UNA_REGISTER_ACCESS_READ_ONLY,
+    [COMMON_REGISTER_ADDRESS_CONTROL_0] = UNA_REGISTER_ACCESS_READ_WRITE,
+    [(COMMON_REGISTER_ADDRESS_CONTROL_0 + 1) ... (COMMON_REGISTER_ADDRESS_LAST - 1)] = UNA_REGISTER_ACCESS_READ_ONLY,
+    [COMMON_REGISTER_ADDRESS_LAST ... (SM_REGISTER_ADDRESS_LAST - 1)] = UNA_REGISTER_ACCESS_READ_WRITE
+};
+
+const uint32_t SM_REGISTER_ERROR_VALUE[SM_REGISTER_ADDRESS_LAST] = {
+    [0 ... (SM_REGISTER_ADDRESS_LAST - 1)] = 0x00000000
+};
+
+/*** TEST NODE local global variables ***/
+
+static TEST_NODE_context_t test_node_ctx;
+
+/*** TEST NODE handlers ***/
+
+/*******************************************************************/
+NODE_status_t COMMON_init_registers(UNA_node_address_t self_address) {
+    return NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, COMMON_REGISTER_ADDRESS_NODE_ID, (uint32_t) self_address, 0x000000FF);
+}
+
+/*******************************************************************/
+NODE_status_t COMMON_update_register(uint8_t reg_addr) {
+    test_node_ctx.update_count++;
+    test_node_ctx.last_handler = TEST_NODE_HANDLER_COMMON;
+    test_node_ctx.last_reg_addr = reg_addr;
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t COMMON_check_register(uint8_t reg_addr, uint32_t reg_mask) {
+    test_node_ctx.check_count++;
+    test_node_ctx.last_handler = TEST_NODE_HANDLER_COMMON;
+    test_node_ctx.last_reg_addr = reg_addr;
+    test_node_ctx.last_reg_mask = reg_mask;
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t SM_init_registers(void) {
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t SM_update_register(uint8_t reg_addr) {
+    test_node_ctx.update_count++;
+    test_node_ctx.last_handler = TEST_NODE_HANDLER_BOARD;
+    test_node_ctx.last_reg_addr = reg_addr;
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t SM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_value = 0;
+    test_node_ctx.check_count++;
+    test_node_ctx.last_handler = TEST_NODE_HANDLER_BOARD;
+    test_node_ctx.last_reg_addr = reg_addr;
+    test_node_ctx.last_reg_mask = reg_mask;
+    // Store configuration register in NVM like the board handlers.
+    if ((reg_addr == SM_REGISTER_ADDRESS_CONFIGURATION_0) && (reg_mask != 0)) {
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, &reg_value);
+        status = NODE_write_nvm(reg_addr, reg_value);
+    }
+    return status;
+}
+
+/*******************************************************************/
+NODE_status_t SM_mtrg_callback(void) {
+    return NODE_SUCCESS;
+}
+
+/*** TEST NODE local functions ***/
+
+/*******************************************************************/
+static void _TEST_NODE_reset_handlers(void) {
+    test_node_ctx.update_count = 0;
+    test_node_ctx.check_count = 0;
+    test_node_ctx.last_handler = TEST_NODE_HANDLER_NONE;
+    test_node_ctx.last_reg_addr = 0xFF;
+    test_node_ctx.last_reg_mask = 0;
+}
+
+/*******************************************************************/
+static void _TEST_NODE_init(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    // Blank memory with self address.
+    ERROR_stack_init();
+    NVM_MOCK_erase();
+    NVM_write_byte(NVM_ADDRESS_SELF_ADDRESS, TEST_NODE_SELF_ADDRESS);
+    node_status = NODE_init();
+    TEST_check((node_status == NODE_SUCCESS), "init");
+    _TEST_NODE_reset_handlers();
+}
+
+/*******************************************************************/
+static void _TEST_NODE_dispatch(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    NODE_status_t check_status = NODE_SUCCESS;
+    TEST_NODE_handler_t expected_handler = TEST_NODE_HANDLER_NONE;
+    uint32_t reg_value = 0;
+    uint32_t reg_values[SM_REGISTER_ADDRESS_LAST];
+    uint8_t routing_error_count = 0;
+    uint8_t access_error_count = 0;
+    uint8_t reg_addr = 0;
+    _TEST_NODE_init();
+    // Self address.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, COMMON_REGISTER_ADDRESS_NODE_ID, &reg_value);
+    TEST_check((reg_value == TEST_NODE_SELF_ADDRESS), "self address");
+    // External reads are routed to the handler of the register.
+    for (reg_addr = 0; reg_addr < SM_REGISTER_ADDRESS_LAST; reg_addr++) {
+        expected_handler = (reg_addr < COMMON_REGISTER_ADDRESS_LAST) ? TEST_NODE_HANDLER_COMMON : TEST_NODE_HANDLER_BOARD;
+        _TEST_NODE_reset_handlers();
+        node_status = NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+        if ((node_status != NODE_SUCCESS) || (test_node_ctx.update_count != 1) || (test_node_ctx.check_count != 0) || (test_node_ctx.last_handler != expected_handler) || (test_node_ctx.last_reg_addr != reg_addr)) {
+            routing_error_count++;
+        }
+    }
+    TEST_check((routing_error_count == 0), "external read routing");
+    // External writes are routed to the check handler of the register.
+    routing_error_count = 0;
+    for (reg_addr = 0; reg_addr < SM_REGISTER_ADDRESS_LAST; reg_addr++) {
+        expected_handler = (reg_addr < COMMON_REGISTER_ADDRESS_LAST) ? TEST_NODE_HANDLER_COMMON : TEST_NODE_HANDLER_BOARD;
+        _TEST_NODE_reset_handlers();
+        check_status = NODE_check_register_write(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr);
+        node_status = NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, 0x12345678, 0x0000FF00);
+        if (SM_REGISTER_ACCESS[reg_addr] == UNA_REGISTER_ACCESS_READ_ONLY) {
+            // Read only registers must be rejected before any handler call.
+            if ((node_status != NODE_ERROR_REGISTER_READ_ONLY) || (check_status != NODE_ERROR_REGISTER_READ_ONLY) || (test_node_ctx.check_count != 0)) {
+                access_error_count++;
+            }
+            continue;
+        }
+        if (check_status != NODE_SUCCESS) {
+            access_error_count++;
+        }
+        if ((node_status != NODE_SUCCESS) || (test_node_ctx.check_count != 1) || (test_node_ctx.update_count != 0) || (test_node_ctx.last_handler != expected_handler) || (test_node_ctx.last_reg_addr != reg_addr) || (test_node_ctx.last_reg_mask != 0x0000FF00)) {
+            routing_error_count++;
+        }
+        // Check masked write.
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, &reg_value);
+        if ((reg_value & 0x0000FF00) != 0x00005600) {
+            routing_error_count++;
+        }
+    }
+    TEST_check((routing_error_count == 0), "external write routing");
+    TEST_check((access_error_count == 0), "read only registers protection");
+    // Internal accesses do not call handlers.
+    _TEST_NODE_reset_handlers();
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, COMMON_REGISTER_ADDRESS_STATUS_0, 0xA5A5A5A5, 0xFFFFFFFF);
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, COMMON_REGISTER_ADDRESS_STATUS_0, &reg_value);
+    TEST_check(((test_node_ctx.update_count == 0) && (test_node_ctx.check_count == 0) && (reg_value == 0xA5A5A5A5)), "internal access without handler");
+    // Address range.
+    node_status = NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_LAST, &reg_value);
+    TEST_check((node_status == NODE_ERROR_REGISTER_ADDRESS), "read address range");
+    node_status = NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_LAST, 0, 0xFFFFFFFF);
+    TEST_check((node_status == NODE_ERROR_REGISTER_ADDRESS), "write address range");
+    node_status = NODE_check_register_write(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_LAST);
+    TEST_check((node_status == NODE_ERROR_REGISTER_ADDRESS), "write check address range");
+    // Burst read crossing the common and board areas.
+    _TEST_NODE_reset_handlers();
+    node_status = NODE_read_registers(NODE_REQUEST_SOURCE_EXTERNAL, 0, reg_values, SM_REGISTER_ADDRESS_LAST);
+    TEST_check(((node_status == NODE_SUCCESS) && (test_node_ctx.update_count == SM_REGISTER_ADDRESS_LAST)), "burst read");
+    node_status = NODE_read_registers(NODE_REQUEST_SOURCE_EXTERNAL, 1, reg_values, SM_REGISTER_ADDRESS_LAST);
+    TEST_check((node_status == NODE_ERROR_REGISTER_ADDRESS), "burst read address range");
+    TEST_check((ERROR_stack_is_empty() != 0), "dispatch error stack empty");
+}
+
+/*******************************************************************/
+static void _TEST_NODE_nvm(void) {
+    // Local variables.
+    NODE_status_t node_status = NODE_SUCCESS;
+    NODE_nvm_statistics_t nvm_statistics;
+    uint32_t nvm_value = 0;
+    uint32_t nvm_write_count = 0;
+    uint32_t reset_count = 0;
+    _TEST_NODE_init();
+    // Configuration register is stored before the end of the external write.
+    nvm_write_count = NVM_MOCK_get_write_count();
+    node_status = NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_CONFIGURATION_0, 0x12345678, 0xFFFFFFFF);
+    NODE_read_nvm(SM_REGISTER_ADDRESS_CONFIGURATION_0, &nvm_value);
+    NODE_get_nvm_statistics(&nvm_statistics);
+    TEST_check(((node_status == NODE_SUCCESS) && (nvm_value == 0x12345678)), "nvm synchronous flush");
+    TEST_check((nvm_statistics.write_count == TEST_NODE_NVM_WORD_OPERATIONS), "nvm word programming operations");
+    TEST_check((nvm_statistics.programming_time_us == ((NVM_MOCK_get_write_count() - nvm_write_count) * TEST_NODE_NVM_PROGRAMMING_TIME_US)), "nvm programming time measurement");
+    // Unchanged value is skipped.
+    nvm_write_count = NVM_MOCK_get_write_count();
+    TEST_NODE_CORE_SYST_CSR = TEST_NODE_CORE_SYST_CSR_OTHER_USER;
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_CONFIGURATION_0, 0x12345678, 0xFFFFFFFF);
+    NODE_get_nvm_statistics(&nvm_statistics);
+    TEST_check(((nvm_statistics.skip_count == 1) && (NVM_MOCK_get_write_count() == nvm_write_count)), "nvm unchanged value skipped");
+    // SysTick is only used when the flush programs the NVM.
+    NODE_process();
+    TEST_check((TEST_NODE_CORE_SYST_CSR == TEST_NODE_CORE_SYST_CSR_OTHER_USER), "systick untouched without programming");
+    // Single byte change.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_CONFIGURATION_0, 0x00009900, 0x0000FF00);
+    NODE_read_nvm(SM_REGISTER_ADDRESS_CONFIGURATION_0, &nvm_value);
+    nvm_write_count = nvm_statistics.write_count;
+    NODE_get_nvm_statistics(&nvm_statistics);
+    TEST_check(((nvm_value == 0x12349978) && (nvm_statistics.write_count == (nvm_write_count + 1))), "nvm single byte programming");
+    // SysTick is left running when it is used by another layer.
+    TEST_check((TEST_NODE_CORE_SYST_CSR == TEST_NODE_CORE_SYST_CSR_OTHER_USER), "systick kept running for other user");
+    TEST_NODE_CORE_SYST_CSR = 0;
+    // Pending value is stored before software reset.
+    NODE_write_nvm(SM_REGISTER_ADDRESS_CONFIGURATION_0, 0xCAFEBABE);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, COMMON_REGISTER_ADDRESS_CONTROL_0, COMMON_REGISTER_CONTROL_0_MASK_RTRG, COMMON_REGISTER_CONTROL_0_MASK_RTRG);
+    reset_count = PWR_MOCK_get_reset_count();
+    node_status = NODE_process();
+    NODE_read_nvm(SM_REGISTER_ADDRESS_CONFIGURATION_0, &nvm_value);
+    TEST_check(((node_status == NODE_SUCCESS) && (nvm_value == 0xCAFEBABE) && (PWR_MOCK_get_reset_count() == (reset_count + 1))), "nvm flush before reset");
+    TEST_check((ERROR_stack_is_empty() != 0), "nvm error stack empty");
+}
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static void _TEST_NODE_journal_get_step(uint32_t step_idx, uint8_t* reg_addr, uint32_t* reg_value) {
+    // Write all registers once, then update them in a scattered order.
+    if (step_idx < TEST_NODE_JOURNAL_NUMBER_OF_REGISTERS) {
+        (*reg_addr) = (uint8_t) (COMMON_REGISTER_ADDRESS_LAST + step_idx);
+    }
+    else {
+        (*reg_addr) = (uint8_t) (COMMON_REGISTER_ADDRESS_LAST + ((step_idx * 7) % TEST_NODE_JOURNAL_NUMBER_OF_REGISTERS));
+    }
+    (*reg_value) = ((((uint32_t) (*reg_addr)) << 24) | (step_idx + 1));
+}
+#endif
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static uint8_t _TEST_NODE_journal_run(uint32_t power_loss_write_count, uint32_t* committed_value, uint8_t* pending_reg_addr, uint32_t* pending_reg_value) {
+    // Local variables.
+    uint8_t error_count = 0;
+    uint32_t power_loss_limit = 0;
+    uint32_t step_idx = 0;
+    uint32_t reg_value = 0;
+    uint8_t reg_addr = 0;
+    // Reset model.
+    for (reg_addr = 0; reg_addr < SM_REGISTER_ADDRESS_LAST; reg_addr++) {
+        committed_value[reg_addr] = 0;
+    }
+    (*pending_reg_addr) = SM_REGISTER_ADDRESS_LAST;
+    (*pending_reg_value) = 0;
+    // Blank memory with self address.
+    ERROR_stack_init();
+    NVM_MOCK_erase();
+    NVM_write_byte(NVM_ADDRESS_SELF_ADDRESS, TEST_NODE_SELF_ADDRESS);
+    if (NODE_init() != NODE_SUCCESS) {
+        error_count++;
+    }
+    NVM_MOCK_set_power_loss(power_loss_write_count);
+    power_loss_limit = (power_loss_write_count == 0) ? 0xFFFFFFFF : (NVM_MOCK_get_write_count() + power_loss_write_count);
+    // Steps loop.
+    for (step_idx = 0; step_idx < TEST_NODE_JOURNAL_NUMBER_OF_STEPS; step_idx++) {
+        // Stop at power loss.
+        if (NVM_MOCK_get_write_count() >= power_loss_limit) break;
+        _TEST_NODE_journal_get_step(step_idx, &reg_addr, &reg_value);
+        if (NODE_write_nvm(reg_addr, reg_value) != NODE_SUCCESS) {
+            error_count++;
+        }
+        if (NODE_process() != NODE_SUCCESS) {
+            error_count++;
+        }
+        // Update model.
+        if (NVM_MOCK_get_write_count() >= power_loss_limit) {
+            // Value may have been stored or not.
+            (*pending_reg_addr) = reg_addr;
+            (*pending_reg_value) = reg_value;
+            break;
+        }
+        committed_value[reg_addr] = reg_value;
+    }
+    // Reboot.
+    NVM_MOCK_set_power_loss(0);
+    ERROR_stack_init();
+    if (NODE_init() != NODE_SUCCESS) {
+        error_count++;
+    }
+    return error_count;
+}
+#endif
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static uint8_t _TEST_NODE_journal_check(uint32_t* committed_value, uint8_t pending_reg_addr, uint32_t pending_reg_value) {
+    // Local variables.
+    uint8_t error_count = 0;
+    uint32_t nvm_value = 0;
+    uint8_t reg_addr = 0;
+    // Registers loop.
+    for (reg_addr = COMMON_REGISTER_ADDRESS_LAST; reg_addr < SM_REGISTER_ADDRESS_LAST; reg_addr++) {
+        NODE_read_nvm(reg_addr, &nvm_value);
+        if (nvm_value == committed_value[reg_addr]) continue;
+        if ((reg_addr == pending_reg_addr) && (nvm_value == pending_reg_value)) continue;
+        error_count++;
+    }
+    return error_count;
+}
+#endif
+
+#ifdef DSM_NVM_JOURNAL
+/*******************************************************************/
+static void _TEST_NODE_journal(void) {
+    // Local variables.
+    NODE_nvm_journal_statistics_t nvm_journal_statistics;
+    uint32_t committed_value[SM_REGISTER_ADDRESS_LAST];
+    uint32_t pending_reg_value = 0;
+    uint32_t total_write_count = 0;
+    uint32_t power_loss_write_count = 0;
+    uint32_t power_loss_error_count = 0;
+    uint8_t pending_reg_addr = 0;
+    uint8_t error_count = 0;
+    // Full run.
+    error_count = _TEST_NODE_journal_run(0, committed_value, &pending_reg_addr, &pending_reg_value);
+    total_write_count = NVM_MOCK_get_write_count();
+    NODE_get_nvm_journal_statistics(&nvm_journal_statistics);
+    TEST_check((error_count == 0), "journal more registers than bank entries");
+    TEST_check((_TEST_NODE_journal_check(committed_value, pending_reg_addr, pending_reg_value) == 0), "journal restore");
+    TEST_check((nvm_journal_statistics.restore_entry_count <= 32), "journal restore bounded by bank size");
+    TEST_check(((nvm_journal_statistics.compaction_count != 0) && (nvm_journal_statistics.spill_count != 0)), "journal compaction with spill");
+    // Power loss after each programming operation.
+    for (power_loss_write_count = 1; power_loss_write_count <= total_write_count; power_loss_write_count++) {
+        error_count = _TEST_NODE_journal_run(power_loss_write_count, committed_value, &pending_reg_addr, &pending_reg_value);
+        error_count += _TEST_NODE_journal_check(committed_value, pending_reg_addr, pending_reg_value);
+        if (error_count != 0) {
+            power_loss_error_count++;
+        }
+    }
+    TEST_check((power_loss_error_count == 0), "journal power loss at each write");
+    TEST_check((ERROR_stack_is_empty() != 0), "journal error stack empty");
+}
+#endif
+
+/*******************************************************************/
+static void _TEST_NODE_bench_dispatch(void) {
+    // Local variables.
+    uint64_t start_ns = 0;
+    uint64_t read_duration_ns = 0;
+    uint64_t write_duration_ns = 0;
+    uint32_t reg_value = 0;
+    uint32_t idx = 0;
+    uint8_t reg_addr = 0;
+    _TEST_NODE_init();
+    // External reads of all registers.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_NODE_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        for (reg_addr = 0; reg_addr < SM_REGISTER_ADDRESS_LAST; reg_addr++) {
+            NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+        }
+    }
+    read_duration_ns = (TEST_get_time_ns() - start_ns);
+    // External writes of board registers.
+    start_ns = TEST_get_time_ns();
+    for (idx = 0; idx < TEST_NODE_BENCH_NUMBER_OF_ITERATIONS; idx++) {
+        for (reg_addr = COMMON_REGISTER_ADDRESS_LAST; reg_addr < SM_REGISTER_ADDRESS_LAST; reg_addr++) {
+            NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, idx, 0xFFFFFFFF);
+        }
+    }
+    write_duration_ns = (TEST_get_time_ns() - start_ns);
+    TEST_check((test_node_ctx.update_count == (TEST_NODE_BENCH_NUMBER_OF_ITERATIONS * SM_REGISTER_ADDRESS_LAST)), "bench all reads dispatched");
+    TEST_bench("dispatch", "read=%.2fns write=%.2fns reads_per_second=%.0f",
+        ((float64_t) read_duration_ns) / ((float64_t) (TEST_NODE_BENCH_NUMBER_OF_ITERATIONS * SM_REGISTER_ADDRESS_LAST)),
+        ((float64_t) write_duration_ns) / ((float64_t) (TEST_NODE_BENCH_NUMBER_OF_ITERATIONS * (SM_REGISTER_ADDRESS_LAST - COMMON_REGISTER_ADDRESS_LAST))),
+        (1.0e9 * ((float64_t) (TEST_NODE_BENCH_NUMBER_OF_ITERATIONS * SM_REGISTER_ADDRESS_LAST))) / ((float64_t) read_duration_ns));
+}
+
+/*** TEST NODE main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("node_" TEST_NODE_VARIANT);
+    _TEST_NODE_dispatch();
+    _TEST_NODE_nvm();
+#ifdef DSM_NVM_JOURNAL
+    _TEST_NODE_journal();
+#endif
+    _TEST_NODE_bench_dispatch();
+    return TEST_end();
+}
@@ -0,0 +1,406 @@
+/*
+ * test_rf_api.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "manuf/rf_api.h"
+
+#include "analog.h"
+#include "dbpsk.h"
+#include "error.h"
+#include "manuf/mcu_api.h"
+#include "power.h"
+#include "rfe.h"
+#include "s2lp.h"
+#include "sigfox_types.h"
+#include "test.h"
+#include "types.h"
+
+/*** TEST RF API local macros ***/
+
+#define TEST_RF_API_FREQUENCY_HZ                868130000
+#define TEST_RF_API_BIT_RATE_BPS                100
+#define TEST_RF_API_TX_POWER_DBM_EIRP           14
+// Uplink bitstream of a 12 bytes frame, sent 3 times.
+#define TEST_RF_API_BITSTREAM_SIZE_BYTES        26
+#define TEST_RF_API_NUMBER_OF_FRAMES            3
+// Ramp-up, ramp-down and padding symbols.
+#define TEST_RF_API_STREAM_SIZE_BYTES           (((TEST_RF_API_BITSTREAM_SIZE_BYTES * 8) + 3) * DBPSK_SYMBOL_SIZE_BYTES)
+// Refill size of the radio driver (FIFO size minus half a symbol).
+#define TEST_RF_API_REFILL_SIZE_BYTES           (S2LP_FIFO_SIZE_BYTES - (DBPSK_SYMBOL_SIZE_BYTES >> 1))
+#define TEST_RF_API_NUMBER_OF_FIFO_WRITES       (1 + (((TEST_RF_API_STREAM_SIZE_BYTES - S2LP_FIFO_SIZE_BYTES) + TEST_RF_API_REFILL_SIZE_BYTES - 1) / TEST_RF_API_REFILL_SIZE_BYTES))
+// Main loop frame start: nIRQ configuration, FIFO flush, FIFO fill, IRQ clear, PLL lock, state check, TX start and state check.
+#define TEST_RF_API_SEND_SPI_TRANSACTIONS       8
+// Each FIFO interrupt performs a FIFO write (or the final abort command) and an IRQ clear.
+#define TEST_RF_API_IRQ_SPI_TRANSACTIONS        2
+// Supply voltage sample at the middle of the frame and end of transmission.
+#define TEST_RF_API_WAKE_UPS_PER_FRAME          2
+// Number of samples transmitted by the radio between two main loop iterations.
+#define TEST_RF_API_TRANSMIT_STEP_BYTES         8
+#define TEST_RF_API_TRANSMIT_TIMEOUT_STEPS      (TEST_RF_API_STREAM_SIZE_BYTES)
+
+#define TEST_RF_API_FDEV_NEGATIVE               0x7F
+#define TEST_RF_API_FDEV_POSITIVE               0x81
+#define TEST_RF_API_FDEV_IDX                    DBPSK_SYMBOL_PROFILE_SIZE_BYTES
+#define TEST_RF_API_RAMP_AMPLITUDE_MAX          220
+
+// Supply voltage before transmission, during the first frame, during the repetitions and after the message.
+#define TEST_RF_API_VOLTAGE_IDLE_MV             3300
+#define TEST_RF_API_VOLTAGE_TX_MV               3100
+#define TEST_RF_API_VOLTAGE_REPETITION_MV       3000
+#define TEST_RF_API_VOLTAGE_FALLBACK_MV         2900
+#define TEST_RF_API_TEMPERATURE_DEGREES         25
+// Idle voltage and temperature, then TX voltage.
+#define TEST_RF_API_CONVERSIONS_PER_MESSAGE     3
+// Fallback conversions of the MCU API (voltage and temperature).
+#define TEST_RF_API_CONVERSIONS_PER_READ        2
+
+/*** TEST RF API local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    volatile uint8_t process_flag;
+    volatile uint8_t tx_cplt_flag;
+    uint32_t wake_up_count;
+} TEST_RF_API_context_t;
+
+/*** TEST RF API local global variables ***/
+
+static TEST_RF_API_context_t test_rf_api_ctx;
+
+/*** TEST RF API local functions ***/
+
+/*******************************************************************/
+static void _TEST_RF_API_process_callback(void) {
+    test_rf_api_ctx.process_flag = 1;
+}
+
+/*******************************************************************/
+static void _TEST_RF_API_tx_cplt_callback(void) {
+    test_rf_api_ctx.tx_cplt_flag = 1;
+}
+
+/*******************************************************************/
+static void _TEST_RF_API_fill_bitstream(uint8_t* bitstream, uint8_t seed) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Mix of 0 and 1 bits.
+    for (idx = 0; idx < TEST_RF_API_BITSTREAM_SIZE_BYTES; idx++) {
+        bitstream[idx] = (uint8_t) ((idx * 37) + 0x5A + seed);
+    }
+}
+
+/*******************************************************************/
+static RF_API_status_t _TEST_RF_API_init(void) {
+    // Local variables.
+    RF_API_status_t rf_api_status = RF_API_SUCCESS;
+    RF_API_radio_parameters_t radio_parameters;
+    // Wake-up and configure radio.
+    rf_api_status = RF_API_wake_up();
+    if (rf_api_status != RF_API_SUCCESS) goto errors;
+    radio_parameters.rf_mode = RF_API_MODE_TX;
+    radio_parameters.frequency_hz = TEST_RF_API_FREQUENCY_HZ;
+    radio_parameters.modulation = RF_API_MODULATION_DBPSK;
+    radio_parameters.bit_rate_bps = TEST_RF_API_BIT_RATE_BPS;
+    radio_parameters.tx_power_dbm_eirp = TEST_RF_API_TX_POWER_DBM_EIRP;
+    radio_parameters.deviation_hz = 0;
+    rf_api_status = RF_API_init(&radio_parameters);
+errors:
+    return rf_api_status;
+}
+
+/*******************************************************************/
+static RF_API_status_t _TEST_RF_API_open(void) {
+    // Local variables.
+    RF_API_status_t rf_api_status = RF_API_SUCCESS;
+    RF_API_config_t rf_api_config;
+    // Open driver.
+    rf_api_config.rc = NULL;
+    rf_api_config.process_cb = &_TEST_RF_API_process_callback;
+    rf_api_config.error_cb = NULL;
+    rf_api_status = RF_API_open(&rf_api_config);
+    if (rf_api_status != RF_API_SUCCESS) goto errors;
+    rf_api_status = _TEST_RF_API_init();
+errors:
+    return rf_api_status;
+}
+
+/*******************************************************************/
+static void _TEST_RF_API_close(void) {
+    RF_API_de_init();
+    RF_API_sleep();
+    RF_API_close();
+}
+
+/*******************************************************************/
+static RF_API_status_t _TEST_RF_API_send(uint8_t* bitstream) {
+    // Local variables.
+    RF_API_status_t rf_api_status = RF_API_SUCCESS;
+    RF_API_tx_data_t tx_data;
+    uint32_t step_count = 0;
+    // Reset flags.
+    test_rf_api_ctx.process_flag = 0;
+    test_rf_api_ctx.tx_cplt_flag = 0;
+    test_rf_api_ctx.wake_up_count = 0;
+    // Start transmission.
+    tx_data.bitstream = bitstream;
+    tx_data.bitstream_size_bytes = TEST_RF_API_BITSTREAM_SIZE_BYTES;
+    tx_data.cplt_cb = &_TEST_RF_API_tx_cplt_callback;
+    rf_api_status = RF_API_send(&tx_data);
+    if (rf_api_status != RF_API_SUCCESS) goto errors;
+    // Emulate radio transmission and main loop.
+    while ((test_rf_api_ctx.tx_cplt_flag == 0) && (step_count < TEST_RF_API_TRANSMIT_TIMEOUT_STEPS)) {
+        S2LP_MOCK_transmit(TEST_RF_API_TRANSMIT_STEP_BYTES);
+        if (test_rf_api_ctx.process_flag != 0) {
+            test_rf_api_ctx.process_flag = 0;
+            test_rf_api_ctx.wake_up_count++;
+            rf_api_status = RF_API_process();
+            if (rf_api_status != RF_API_SUCCESS) goto errors;
+        }
+        step_count++;
+    }
+errors:
+    return rf_api_status;
+}
+
+/*******************************************************************/
+static RF_API_status_t _TEST_RF_API_message(uint8_t read_before_sleep, uint32_t* analog_power_error_count, sfx_u16* voltage_idle_mv, sfx_u16* voltage_tx_mv, sfx_s16* temperature_tenth_degrees) {
+    // Local variables.
+    RF_API_status_t rf_api_status = RF_API_SUCCESS;
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+    uint8_t bitstream[TEST_RF_API_BITSTREAM_SIZE_BYTES];
+    uint8_t frame_idx = 0;
+    // Idle conditions.
+    S2LP_MOCK_reset();
+    ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_IDLE_MV);
+    ANALOG_MOCK_set_data(ANALOG_CHANNEL_TMCU_DEGREES, TEST_RF_API_TEMPERATURE_DEGREES);
+    rf_api_status = _TEST_RF_API_open();
+    if (rf_api_status != RF_API_SUCCESS) goto errors;
+    // Library sequence of each frame: wake-up, init, send, de-init and sleep.
+    for (frame_idx = 0; frame_idx < TEST_RF_API_NUMBER_OF_FRAMES; frame_idx++) {
+        if (frame_idx != 0) {
+            rf_api_status = _TEST_RF_API_init();
+            if (rf_api_status != RF_API_SUCCESS) goto errors;
+        }
+        // Analog domain must only be powered during the first frame.
+        if (POWER_get_state(POWER_DOMAIN_ANALOG) != ((frame_idx == 0) ? 1 : 0)) {
+            (*analog_power_error_count)++;
+        }
+        ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, ((frame_idx == 0) ? TEST_RF_API_VOLTAGE_TX_MV : TEST_RF_API_VOLTAGE_REPETITION_MV));
+        _TEST_RF_API_fill_bitstream(bitstream, frame_idx);
+        rf_api_status = _TEST_RF_API_send(bitstream);
+        if (rf_api_status != RF_API_SUCCESS) goto errors;
+        rf_api_status = RF_API_de_init();
+        if (rf_api_status != RF_API_SUCCESS) goto errors;
+        if (POWER_get_state(POWER_DOMAIN_ANALOG) != 0) {
+            (*analog_power_error_count)++;
+        }
+        // Read measurements between de-init and sleep of the last frame.
+        if ((read_before_sleep != 0) && (frame_idx == (TEST_RF_API_NUMBER_OF_FRAMES - 1))) {
+            mcu_api_status = MCU_API_get_voltage_temperature(voltage_idle_mv, voltage_tx_mv, temperature_tenth_degrees);
+            if (mcu_api_status != MCU_API_SUCCESS) {
+                rf_api_status = RF_API_ERROR;
+                goto errors;
+            }
+        }
+        rf_api_status = RF_API_sleep();
+        if (rf_api_status != RF_API_SUCCESS) goto errors;
+    }
+    // Read measurements after the last sleep.
+    ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_FALLBACK_MV);
+    if (read_before_sleep == 0) {
+        mcu_api_status = MCU_API_get_voltage_temperature(voltage_idle_mv, voltage_tx_mv, temperature_tenth_degrees);
+        if (mcu_api_status != MCU_API_SUCCESS) {
+            rf_api_status = RF_API_ERROR;
+            goto errors;
+        }
+    }
+errors:
+    return rf_api_status;
+}
+
+/*******************************************************************/
+static uint8_t _TEST_RF_API_decode_stream(uint8_t* stream, uint32_t stream_size_bytes, uint8_t* bitstream) {
+    // Local variables.
+    uint8_t* symbol = NULL;
+    uint8_t previous_fdev = 0;
+    uint8_t bit = 0;
+    uint32_t error_count = 0;
+    uint32_t symbol_idx = 0;
+    uint32_t idx = 0;
+    // Check size.
+    if (stream_size_bytes != TEST_RF_API_STREAM_SIZE_BYTES) return 1;
+    // Ramp-up ends with the maximum amplitude, ramp-down starts from it.
+    if ((stream[0] != 0) || (stream[1] != TEST_RF_API_RAMP_AMPLITUDE_MAX)) error_count++;
+    symbol = &(stream[(TEST_RF_API_BITSTREAM_SIZE_BYTES * 8 + 1) * DBPSK_SYMBOL_SIZE_BYTES]);
+    if (symbol[DBPSK_SYMBOL_SIZE_BYTES - 1] != TEST_RF_API_RAMP_AMPLITUDE_MAX) error_count++;
+    // Padding symbol.
+    symbol = &(stream[(TEST_RF_API_BITSTREAM_SIZE_BYTES * 8 + 2) * DBPSK_SYMBOL_SIZE_BYTES]);
+    for (idx = 0; idx < DBPSK_SYMBOL_SIZE_BYTES; idx++) {
+        if (symbol[idx] != 0) error_count++;
+    }
+    // Bit 0 is a phase shift in the middle of the symbol, bit 1 a constant carrier.
+    for (symbol_idx = 0; symbol_idx < (TEST_RF_API_BITSTREAM_SIZE_BYTES * 8); symbol_idx++) {
+        symbol = &(stream[(symbol_idx + 1) * DBPSK_SYMBOL_SIZE_BYTES]);
+        bit = ((bitstream[symbol_idx >> 3] >> (7 - (symbol_idx & 0x07))) & 0x01);
+        if (symbol[TEST_RF_API_FDEV_IDX] == 0) {
+            if (bit == 0) error_count++;
+        }
+        else {
+            if (bit != 0) error_count++;
+            if ((symbol[TEST_RF_API_FDEV_IDX] != TEST_RF_API_FDEV_NEGATIVE) && (symbol[TEST_RF_API_FDEV_IDX] != TEST_RF_API_FDEV_POSITIVE)) error_count++;
+            // Deviation sign alternates on each phase shift.
+            if (symbol[TEST_RF_API_FDEV_IDX] == previous_fdev) error_count++;
+            previous_fdev = symbol[TEST_RF_API_FDEV_IDX];
+        }
+    }
+    return ((error_count == 0) ? 0 : 1);
+}
+
+/*******************************************************************/
+static void _TEST_RF_API_frames(void) {
+    // Local variables.
+    RF_API_status_t rf_api_status = RF_API_SUCCESS;
+    S2LP_MOCK_statistics_t statistics_before;
+    S2LP_MOCK_statistics_t statistics_after;
+    uint8_t bitstream[TEST_RF_API_BITSTREAM_SIZE_BYTES];
+    uint8_t* stream = NULL;
+    uint32_t stream_start = 0;
+    uint32_t stream_end = 0;
+    uint32_t decode_error_count = 0;
+    uint32_t wake_up_error_count = 0;
+    uint32_t spi_error_count = 0;
+    uint32_t fifo_write_error_count = 0;
+    uint32_t frame_error_count = 0;
+    uint32_t transmitted_error_count = 0;
+    uint32_t fifo_writes = 0;
+    uint32_t spi_transactions = 0;
+    uint8_t frame_idx = 0;
+    // Init.
+    ERROR_stack_init();
+    S2LP_MOCK_reset();
+    rf_api_status = _TEST_RF_API_open();
+    TEST_check((rf_api_status == RF_API_SUCCESS), "radio init");
+    TEST_check((RFE_MOCK_get_path() == RFE_PATH_TX), "radio front-end tx path");
+    // Message repetitions.
+    for (frame_idx = 0; frame_idx < TEST_RF_API_NUMBER_OF_FRAMES; frame_idx++) {
+        _TEST_RF_API_fill_bitstream(bitstream, frame_idx);
+        S2LP_MOCK_get_stream(&stream_start);
+        S2LP_MOCK_get_statistics(&statistics_before);
+        rf_api_status = _TEST_RF_API_send(bitstream);
+        S2LP_MOCK_get_statistics(&statistics_after);
+        stream = S2LP_MOCK_get_stream(&stream_end);
+        if ((rf_api_status != RF_API_SUCCESS) || (test_rf_api_ctx.tx_cplt_flag == 0) || (S2LP_MOCK_get_state() != S2LP_STATE_READY)) {
+            frame_error_count++;
+        }
+        // Symbol stream.
+        decode_error_count += _TEST_RF_API_decode_stream(&(stream[stream_start]), (stream_end - stream_start), bitstream);
+        // Ramp-down must have been completely transmitted before the abort command.
+        if ((statistics_after.transmitted_size_bytes - statistics_before.transmitted_size_bytes) < (TEST_RF_API_STREAM_SIZE_BYTES - DBPSK_SYMBOL_SIZE_BYTES)) {
+            transmitted_error_count++;
+        }
+        // Main loop wake-ups.
+        if (test_rf_api_ctx.wake_up_count != TEST_RF_API_WAKE_UPS_PER_FRAME) {
+            wake_up_error_count++;
+        }
+        // SPI transactions.
+        fifo_writes = (statistics_after.fifo_write_count - statistics_before.fifo_write_count);
+        spi_transactions = (statistics_after.spi_transaction_count - statistics_before.spi_transaction_count);
+        if (fifo_writes != TEST_RF_API_NUMBER_OF_FIFO_WRITES) {
+            fifo_write_error_count++;
+        }
+        if (spi_transactions != (TEST_RF_API_SEND_SPI_TRANSACTIONS + (TEST_RF_API_IRQ_SPI_TRANSACTIONS * fifo_writes))) {
+            spi_error_count++;
+        }
+    }
+    TEST_check((frame_error_count == 0), "frames completed");
+    TEST_check((decode_error_count == 0), "symbol stream");
+    TEST_check((transmitted_error_count == 0), "ramp-down transmitted");
+    TEST_check((statistics_after.fifo_error_count == 0), "no fifo underflow or overflow");
+    TEST_check((statistics_after.missed_irq_count == 0), "nirq re-armed at each refill");
+    TEST_check((wake_up_error_count == 0), "main loop wake-ups per frame");
+    TEST_check((fifo_write_error_count == 0), "fifo writes per frame");
+    TEST_check((spi_error_count == 0), "spi transactions per frame");
+    _TEST_RF_API_close();
+    TEST_check((RFE_MOCK_get_path() == RFE_PATH_NONE), "radio front-end released");
+    TEST_check((ERROR_stack_is_empty() != 0), "error stack empty");
+    TEST_bench("tx frame", "spi_transactions=%u/frame fifo_writes=%u/frame wake_ups=%u/frame", spi_transactions, fifo_writes, test_rf_api_ctx.wake_up_count);
+}
+
+/*******************************************************************/
+static void _TEST_RF_API_voltage_temperature(void) {
+    // Local variables.
+    RF_API_status_t rf_api_status = RF_API_SUCCESS;
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+    sfx_u16 voltage_idle_mv = 0;
+    sfx_u16 voltage_tx_mv = 0;
+    sfx_s16 temperature_tenth_degrees = 0;
+    uint8_t bitstream[TEST_RF_API_BITSTREAM_SIZE_BYTES];
+    uint32_t analog_power_error_count = 0;
+    uint32_t conversion_count = 0;
+    uint32_t message_conversions = 0;
+    uint8_t read_before_sleep = 0;
+    uint8_t sample_error_count = 0;
+    // Init.
+    ERROR_stack_init();
+    // Both positions of the read in the library sequence.
+    for (read_before_sleep = 0; read_before_sleep < 2; read_before_sleep++) {
+        conversion_count = ANALOG_MOCK_get_conversion_count();
+        rf_api_status = _TEST_RF_API_message(read_before_sleep, &analog_power_error_count, &voltage_idle_mv, &voltage_tx_mv, &temperature_tenth_degrees);
+        message_conversions = (ANALOG_MOCK_get_conversion_count() - conversion_count);
+        RF_API_close();
+        if ((rf_api_status != RF_API_SUCCESS) || (message_conversions != TEST_RF_API_CONVERSIONS_PER_MESSAGE)) sample_error_count++;
+        if ((voltage_idle_mv != TEST_RF_API_VOLTAGE_IDLE_MV) || (voltage_tx_mv != TEST_RF_API_VOLTAGE_TX_MV) || (temperature_tenth_degrees != (TEST_RF_API_TEMPERATURE_DEGREES * 10))) sample_error_count++;
+    }
+    TEST_check((sample_error_count == 0), "tx sample read before and after sleep");
+    TEST_check((analog_power_error_count == 0), "analog powered during first frame only");
+    // Measurements are consumed by the first read.
+    conversion_count = ANALOG_MOCK_get_conversion_count();
+    mcu_api_status = MCU_API_get_voltage_temperature(&voltage_idle_mv, &voltage_tx_mv, &temperature_tenth_degrees);
+    TEST_check(((mcu_api_status == MCU_API_SUCCESS) && (voltage_idle_mv == TEST_RF_API_VOLTAGE_FALLBACK_MV) && (voltage_tx_mv == TEST_RF_API_VOLTAGE_FALLBACK_MV) && ((ANALOG_MOCK_get_conversion_count() - conversion_count) == TEST_RF_API_CONVERSIONS_PER_READ)), "second read falls back to direct conversion");
+    // Unread measurements of a previous message are discarded on open.
+    S2LP_MOCK_reset();
+    ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_IDLE_MV);
+    rf_api_status = _TEST_RF_API_open();
+    if (rf_api_status == RF_API_SUCCESS) {
+        ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_TX_MV);
+        _TEST_RF_API_fill_bitstream(bitstream, 0);
+        rf_api_status = _TEST_RF_API_send(bitstream);
+    }
+    _TEST_RF_API_close();
+    ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_FALLBACK_MV);
+    if (rf_api_status == RF_API_SUCCESS) rf_api_status = _TEST_RF_API_open();
+    _TEST_RF_API_close();
+    mcu_api_status = MCU_API_get_voltage_temperature(&voltage_idle_mv, &voltage_tx_mv, &temperature_tenth_degrees);
+    TEST_check(((rf_api_status == RF_API_SUCCESS) && (mcu_api_status == MCU_API_SUCCESS) && (voltage_tx_mv == TEST_RF_API_VOLTAGE_FALLBACK_MV)), "stale measurements discarded on open");
+    // Measurements of an aborted message are discarded.
+    S2LP_MOCK_reset();
+    ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_IDLE_MV);
+    rf_api_status = _TEST_RF_API_open();
+    if (rf_api_status == RF_API_SUCCESS) {
+        ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_TX_MV);
+        _TEST_RF_API_fill_bitstream(bitstream, 0);
+        rf_api_status = _TEST_RF_API_send(bitstream);
+    }
+    RF_API_error();
+    ANALOG_MOCK_set_data(ANALOG_CHANNEL_VMCU_MV, TEST_RF_API_VOLTAGE_FALLBACK_MV);
+    mcu_api_status = MCU_API_get_voltage_temperature(&voltage_idle_mv, &voltage_tx_mv, &temperature_tenth_degrees);
+    RF_API_sleep();
+    RF_API_close();
+    TEST_check(((rf_api_status == RF_API_SUCCESS) && (mcu_api_status == MCU_API_SUCCESS) && (voltage_idle_mv == TEST_RF_API_VOLTAGE_FALLBACK_MV)), "measurements discarded on error");
+    TEST_check((POWER_get_state(POWER_DOMAIN_ANALOG) == 0), "analog released");
+    TEST_check((ERROR_stack_is_empty() != 0), "error stack empty");
+    TEST_bench("voltage", "analog_conversions=%u/message", message_conversions);
+}
+
+/*** TEST RF API main function ***/
+
+/*******************************************************************/
+int main(void) {
+    TEST_start("rf_api");
+    _TEST_RF_API_frames();
+    _TEST_RF_API_voltage_temperature();
+    return TEST_end();
+}